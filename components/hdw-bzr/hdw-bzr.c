@@ -17,39 +17,62 @@
 
 #define LEDC_MODE LEDC_LOW_SPEED_MODE //!< Low speed mode is sufficient
 
+#define BZR_BGM_VOICE    0         //!< The voice index reserved for BGM
+#define BZR_NO_VOICE     -1        //!< A voice index meaning no voice is available
+#define BZR_NO_DEADLINE  INT64_MAX //!< A deadline which never passes
+#define BZR_MIN_ALARM_US 100       //!< The soonest an alarm is set, so it isn't set for a time which already passed
+
 //==============================================================================
 // Structs
 //==============================================================================
 
 /**
- * @brief A track for a song on the buzzer. This plays notes from a songTrack_t
+ * @brief A track for a voice on one buzzer. This plays notes from a songTrack_t
  */
 typedef struct
 {
-    int32_t usAccum;           ///< Accumulated time for the current musicalNote_t
-    int32_t note_index;        ///< The index of the current musicalNote_t in the song
-    const songTrack_t* sTrack; ///< The song being played
-    bool should_loop;          ///< Whether or not this track should loop when done
+    const songTrack_t* sTrack; ///< The song track being played, NULL if this voice doesn't use this buzzer
+    int32_t note_index;        ///< The index of the current musicalNote_t in the song, -1 if not started yet
+    int64_t deadlineUs;        ///< The buzzer clock time when the current musicalNote_t ends
 } bzrTrack_t;
 
 /**
- * @brief A physical buzzer that has BGM and SFX tracks
+ * @brief A logical voice, one song playing on one or both buzzers
+ */
+typedef struct
+{
+    bzrTrack_t tracks[NUM_BUZZERS]; ///< This voice's track for each buzzer
+    bool should_loop;               ///< Whether or not this voice should loop when done
+    uint8_t priority;               ///< This voice's priority. Higher priority voices are heard over lower ones
+    uint32_t seq;                   ///< When this voice started, relative to other voices. Used to break ties
+    songFinishedCbFn cbFn;          ///< A callback to call when this voice finishes playing
+} bzrVoice_t;
+
+/**
+ * @brief A physical buzzer that voices are played on
  */
 typedef struct
 {
     ledc_timer_t ledcTimer;     ///< LEDC timer to play notes
     ledc_channel_t ledcChannel; ///< LEDC channel to play notes
     noteFrequency_t cFreq;      ///< The current frequency of the note being played
-    uint16_t volume;            ///< This track's volume, from 0 (off) to 4096 (max)
-    bzrTrack_t bgm;             ///< The BGM track for this buzzer
-    bzrTrack_t sfx;             ///< The SFX track for this buzzer
+    uint16_t volume;            ///< This buzzer's current volume, from 0 (off) to 4096 (max)
 } buzzer_t;
 
+/**
+ * @brief The saved state of the buzzer, returned by bzrSave()
+ */
+typedef struct
+{
+    int64_t clockUs;                   ///< The buzzer clock time when this was saved
+    bzrVoice_t voices[BZR_NUM_VOICES]; ///< The saved voices
+} bzrSaveState_t;
+
 //==============================================================================
 // Variables
 //==============================================================================
 
-/// @brief Timer to check for note transitions
+/// @brief Timer to fire when the next note transition is due
 static gptimer_handle_t bzrTimer = NULL;
 /// @brief Track if the buzzer timer is active or not
 static bool bzrTimerActive = false;
@@ -57,6 +80,13 @@ static bool bzrTimerActive = false;
 /// @brief Array of buzzers, left and right
 static buzzer_t buzzers[NUM_BUZZERS] = {0};
 
+/// @brief Pool of voices played on the buzzers. The first is reserved for BGM
+static bzrVoice_t voices[BZR_NUM_VOICES] = {0};
+/// @brief Counter to mark when voices start, relative to each other
+static uint32_t voiceSeq = 0;
+/// @brief The earliest deadline of all voices. The timer alarm is set for this time
+static volatile int64_t nextDeadlineUs = BZR_NO_DEADLINE;
+
 /// @brief BGM volume
 static uint16_t bgmVolume = 0;
 /// @brief SFX volume
@@ -65,19 +95,16 @@ static uint16_t sfxVolume = 0;
 /// @brief Track if the buzzer is paused or not
 static bool bzrPaused = false;
 
-/// @brief A flag to set if bgmDoneCb should be called from the main loop
-static bool bgmDoneFlag = false;
-/// @brief A flag to set if sfxDoneCb should be called from the main loop
-static bool sfxDoneFlag = false;
-/// @brief A callback function to call after SFX finishes. This is not called if the song is manually stopped or another
-/// song starts before this one finishes
-static songFinishedCbFn sfxDoneCb = NULL;
-/// @brief A callback function to call after BGM finishes. This is not called if the song is manually stopped or another
-/// song starts before this one finishes
-static songFinishedCbFn bgmDoneCb = NULL;
+/// @brief Offset from esp_timer_get_time() to the buzzer clock, which doesn't advance while stopped
+static int64_t clockOffsetUs = 0;
+/// @brief true if the buzzer clock is stopped
+static bool clockStopped = true;
+/// @brief The buzzer clock time when it was stopped
+static int64_t clockStoppedUs = 0;
 
-/// @brief Boolean to reset clocks after buzzer is restored
-static volatile bool bzrIsRestored = false;
+/// @brief Callbacks to call from the main loop for voices which finished. These are not called if the voice is
+/// manually stopped or stolen by another song before it finishes
+static volatile songFinishedCbFn doneCbs[BZR_NUM_VOICES] = {0};
 
 //==============================================================================
 // Functions Prototypes
@@ -85,9 +112,16 @@ static volatile bool bzrIsRestored = false;
 
 static void initSingleBuzzer(buzzer_t* buzzer, gpio_num_t bzrGpio, ledc_timer_t ledcTimer, ledc_channel_t ledcChannel);
 static bool buzzer_check_next_note_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t* edata, void* user_ctx);
-static bool buzzer_track_check_next_note(bzrTrack_t* track, buzzerPlayTrack_t bIdx, uint16_t volume, bool isActive,
-                                         bool isBgm, int32_t tElapsedUs);
-static void bzrPlayTrack(bzrTrack_t* trackL, bzrTrack_t* trackR, const song_t* song, buzzerPlayTrack_t track);
+static bool buzzer_track_check_next_note(bzrTrack_t* track, bool shouldLoop, int64_t tNowUs);
+static void bzrPlayVoice(int16_t vIdx, const song_t* song, buzzerPlayTrack_t track, uint8_t priority,
+                         songFinishedCbFn cbFn);
+static int16_t bzrAllocSfxVoice(uint8_t priority);
+static int64_t bzrClockUs(void);
+static void bzrClockStop(void);
+static void bzrClockStart(void);
+static void bzrSetAlarm(int64_t delayUs);
+static void bzrStartTimer(void);
+static void bzrStopTimer(void);
 
 //==============================================================================
 // Const variables
@@ -120,6 +154,10 @@ void initBuzzer(gpio_num_t bzrGpioL, ledc_timer_t ledcTimerL, ledc_channel_t led
     bzrSetBgmVolume(_bgmVolume);
     bzrSetSfxVolume(_sfxVolume);
 
+    // Clear all voices
+    memset(voices, 0, sizeof(voices));
+    nextDeadlineUs = BZR_NO_DEADLINE;
+
     // Save the LEDC timers and channels
     initSingleBuzzer(&buzzers[BZR_LEFT], bzrGpioL, ledcTimerL, ledcChannelL);
     initSingleBuzzer(&buzzers[BZR_RIGHT], bzrGpioR, ledcTimerR, ledcChannelR);
@@ -132,13 +170,7 @@ void initBuzzer(gpio_num_t bzrGpioL, ledc_timer_t ledcTimerL, ledc_channel_t led
     };
     ESP_ERROR_CHECK(gptimer_new_timer(&timer_config, &bzrTimer));
 
-    // Configure the hardware timer to check for note transitions
-    gptimer_alarm_config_t config = {
-        .alarm_count                = 5000, // Check every 5000 ticks of a 1MHz clock, i.e. every 5ms
-        .reload_count               = 0,
-        .flags.auto_reload_on_alarm = true,
-    };
-    ESP_ERROR_CHECK(gptimer_set_alarm_action(bzrTimer, &config));
+    // The alarm is set for each note transition as it's needed, by bzrSetAlarm()
 
     // Configure the ISR
     gptimer_event_callbacks_t callbacks = {
@@ -148,8 +180,8 @@ void initBuzzer(gpio_num_t bzrGpioL, ledc_timer_t ledcTimerL, ledc_channel_t led
 
     // Don't start the timer until a song is played
     ESP_ERROR_CHECK(gptimer_enable(bzrTimer));
-    gptimer_stop(bzrTimer);
     bzrTimerActive = false;
+    bzrClockStop();
 }
 
 /**
@@ -167,8 +199,6 @@ static void initSingleBuzzer(buzzer_t* buzzer, gpio_num_t bzrGpio, ledc_timer_t
     buzzer->ledcTimer   = ledcTimer;
     buzzer->cFreq       = SILENCE;
     buzzer->volume      = 0;
-    memset(&buzzer->bgm, 0, sizeof(bzrTrack_t));
-    memset(&buzzer->sfx, 0, sizeof(bzrTrack_t));
 
     // Prepare and then apply the LEDC PWM timer configuration
     ledc_timer_config_t ledc_timer = {
@@ -230,49 +260,180 @@ void bzrSetSfxVolume(uint16_t vol)
 }
 
 /**
- * @brief Play a song_t on one or two bzrTrack_t depending on what
+ * @brief Get the current time of the buzzer clock. This clock doesn't advance while the buzzer is paused or stopped
+ * This has IRAM_ATTR because it is called from buzzer_check_next_note_isr()
+ *
+ * @return The buzzer clock time, in microseconds
+ */
+static int64_t IRAM_ATTR bzrClockUs(void)
+{
+    if (clockStopped)
+    {
+        return clockStoppedUs;
+    }
+    return esp_timer_get_time() - clockOffsetUs;
+}
+
+/**
+ * @brief Stop the buzzer clock, if it's running
+ */
+static void bzrClockStop(void)
+{
+    if (!clockStopped)
+    {
+        clockStoppedUs = bzrClockUs();
+        clockStopped   = true;
+    }
+}
+
+/**
+ * @brief Start the buzzer clock from where it was stopped, if it's stopped
+ */
+static void bzrClockStart(void)
+{
+    if (clockStopped)
+    {
+        clockOffsetUs = esp_timer_get_time() - clockStoppedUs;
+        clockStopped  = false;
+    }
+}
+
+/**
+ * @brief Set the timer to fire a single alarm after some delay. The timer counts freely and never reloads, so this
+ * is relative to the current count
+ * This has IRAM_ATTR because it is called from buzzer_check_next_note_isr()
+ *
+ * @param delayUs The number of microseconds from now to fire the alarm
+ */
+static void IRAM_ATTR bzrSetAlarm(int64_t delayUs)
+{
+    if (delayUs < BZR_MIN_ALARM_US)
+    {
+        delayUs = BZR_MIN_ALARM_US;
+    }
+
+    uint64_t count = 0;
+    gptimer_get_raw_count(bzrTimer, &count);
+
+    gptimer_alarm_config_t config = {
+        .alarm_count                = count + delayUs,
+        .reload_count               = 0,
+        .flags.auto_reload_on_alarm = false,
+    };
+    gptimer_set_alarm_action(bzrTimer, &config);
+}
+
+/**
+ * @brief Start the timer and have it fire as soon as possible so voices are checked right away. The alarm is set
+ * while the timer is stopped so it can't be missed, even if this is interrupted
+ */
+static void bzrStartTimer(void)
+{
+    if (bzrTimerActive)
+    {
+        gptimer_stop(bzrTimer);
+    }
+    gptimer_set_raw_count(bzrTimer, 0);
+    nextDeadlineUs = 0;
+    bzrSetAlarm(BZR_MIN_ALARM_US);
+    gptimer_start(bzrTimer);
+    bzrTimerActive = true;
+}
+
+/**
+ * @brief Stop the timer so no more alarms fire
+ */
+static void bzrStopTimer(void)
+{
+    if (bzrTimerActive)
+    {
+        gptimer_stop(bzrTimer);
+        bzrTimerActive = false;
+    }
+}
+
+/**
+ * @brief Find a voice to play a new SFX on. This returns an unused voice if there is one, otherwise it steals the
+ * lowest priority, oldest voice.
  *
- * @param trackL The left track to play on
- * @param trackR The right track to play on
+ * @param priority The priority of the new SFX
+ * @return The index of the voice to use, or ::BZR_NO_VOICE if every voice has a higher priority
+ */
+static int16_t bzrAllocSfxVoice(uint8_t priority)
+{
+    int16_t victim = BZR_NO_VOICE;
+    for (int16_t vIdx = BZR_BGM_VOICE + 1; vIdx < BZR_NUM_VOICES; vIdx++)
+    {
+        bzrVoice_t* voice = &voices[vIdx];
+        if ((NULL == voice->tracks[BZR_LEFT].sTrack) && (NULL == voice->tracks[BZR_RIGHT].sTrack))
+        {
+            // Unused voice, take it
+            return vIdx;
+        }
+        else if ((BZR_NO_VOICE == victim) || (voice->priority < voices[victim].priority)
+                 || ((voice->priority == voices[victim].priority) && (voice->seq < voices[victim].seq)))
+        {
+            // Lowest priority, oldest voice so far
+            victim = vIdx;
+        }
+    }
+
+    // Only steal voices which are not more important than the new SFX
+    if (voices[victim].priority <= priority)
+    {
+        return victim;
+    }
+    return BZR_NO_VOICE;
+}
+
+/**
+ * @brief Play a song_t on a voice, on one or both buzzers depending on the song and requested track
+ *
+ * @param vIdx The index of the voice to play on
  * @param song The song_t to play
  * @param track The requested track or tracks to play on
+ * @param priority The priority of this voice
+ * @param cbFn A callback function to call when the song finishes playing, may be NULL
  */
-static void bzrPlayTrack(bzrTrack_t* trackL, bzrTrack_t* trackR, const song_t* song, buzzerPlayTrack_t track)
+static void bzrPlayVoice(int16_t vIdx, const song_t* song, buzzerPlayTrack_t track, uint8_t priority,
+                         songFinishedCbFn cbFn)
 {
+    bzrVoice_t* voice = &voices[vIdx];
+
+    // Clear the voice before setting it up, and drop any callback pending for it
+    memset(voice, 0, sizeof(bzrVoice_t));
+    doneCbs[vIdx] = NULL;
+
+    voice->should_loop = song->shouldLoop;
+    voice->priority    = priority;
+    voice->seq         = ++voiceSeq;
+    voice->cbFn        = cbFn;
+
     if (1 == song->numTracks)
     {
         // Mono song, play it on the requested tracks
         if (BZR_STEREO == track || BZR_LEFT == track)
         {
-            trackL->sTrack      = &song->tracks[0];
-            trackL->note_index  = -1;
-            trackL->usAccum     = 0;
-            trackL->should_loop = song->shouldLoop;
+            voice->tracks[BZR_LEFT].note_index = -1;
+            voice->tracks[BZR_LEFT].sTrack     = &song->tracks[0];
         }
 
         if (BZR_STEREO == track || BZR_RIGHT == track)
         {
-            trackR->sTrack      = &song->tracks[0];
-            trackR->note_index  = -1;
-            trackR->usAccum     = 0;
-            trackR->should_loop = song->shouldLoop;
+            voice->tracks[BZR_RIGHT].note_index = -1;
+            voice->tracks[BZR_RIGHT].sTrack     = &song->tracks[0];
         }
     }
     else
     {
         // Stereo song, play it on both tracks
-        trackL->sTrack      = &song->tracks[0];
-        trackL->note_index  = -1;
-        trackL->usAccum     = 0;
-        trackL->should_loop = song->shouldLoop;
-
-        trackR->sTrack      = &song->tracks[1];
-        trackR->note_index  = -1;
-        trackR->usAccum     = 0;
-        trackR->should_loop = song->shouldLoop;
+        voice->tracks[BZR_LEFT].note_index  = -1;
+        voice->tracks[BZR_LEFT].sTrack      = &song->tracks[0];
+        voice->tracks[BZR_RIGHT].note_index = -1;
+        voice->tracks[BZR_RIGHT].sTrack     = &song->tracks[1];
     }
 
-    // Un-pause if paused
+    // Un-pause if paused, and start the voice right away
     bzrResume();
 }
 
@@ -285,18 +446,8 @@ static void bzrPlayTrack(bzrTrack_t* trackL, bzrTrack_t* trackR, const song_t* s
  */
 void bzrPlayBgm(const song_t* song, buzzerPlayTrack_t track)
 {
-    // Play this song on the BGM track
-    bzrPlayTrack(&buzzers[0].bgm, &buzzers[1].bgm, song, track);
-
-    // If the timer is off
-    if (false == bzrTimerActive)
-    {
-        // Start timer, the timer function will start the song
-        gptimer_start(bzrTimer);
-        bzrTimerActive = true;
-    }
-    // Called without a callback, so null it out
-    bgmDoneCb = NULL;
+    // Play this song on the BGM voice, without a callback
+    bzrPlayVoice(BZR_BGM_VOICE, song, track, BZR_BGM_PRIORITY, NULL);
 }
 
 /**
@@ -308,18 +459,7 @@ void bzrPlayBgm(const song_t* song, buzzerPlayTrack_t track)
  */
 void bzrPlaySfx(const song_t* song, buzzerPlayTrack_t track)
 {
-    // Play this song on the SFX track
-    bzrPlayTrack(&buzzers[0].sfx, &buzzers[1].sfx, song, track);
-
-    // If the timer is off
-    if (false == bzrTimerActive)
-    {
-        // Start timer, the timer function will start the song
-        gptimer_start(bzrTimer);
-        bzrTimerActive = true;
-    }
-    // Called without a callback, so null it out
-    sfxDoneCb = NULL;
+    bzrPlaySfxPriority(song, track, BZR_SFX_PRIORITY_DEFAULT, NULL);
 }
 
 /**
@@ -332,8 +472,7 @@ void bzrPlaySfx(const song_t* song, buzzerPlayTrack_t track)
  */
 void bzrPlayBgmCb(const song_t* song, buzzerPlayTrack_t track, songFinishedCbFn cbFn)
 {
-    bzrPlayBgm(song, track);
-    bgmDoneCb = cbFn;
+    bzrPlayVoice(BZR_BGM_VOICE, song, track, BZR_BGM_PRIORITY, cbFn);
 }
 
 /**
@@ -346,8 +485,32 @@ void bzrPlayBgmCb(const song_t* song, buzzerPlayTrack_t track, songFinishedCbFn
  */
 void bzrPlaySfxCb(const song_t* song, buzzerPlayTrack_t track, songFinishedCbFn cbFn)
 {
-    bzrPlaySfx(song, track);
-    sfxDoneCb = cbFn;
+    bzrPlaySfxPriority(song, track, BZR_SFX_PRIORITY_DEFAULT, cbFn);
+}
+
+/**
+ * @brief Start playing a sound effect on the buzzer with a given priority. On each buzzer, the highest priority voice
+ * is heard. If all SFX voices are busy, the lowest priority, oldest one is stolen. If all busy voices have a higher
+ * priority than this, the sound effect is not played.
+ *
+ * @param song The song to play as a sequence of notes
+ * @param track The track to play on if the song is mono. This is ignored if the song is stereo
+ * @param priority The priority of the sound effect, 1 to 255. bzrPlaySfx() uses ::BZR_SFX_PRIORITY_DEFAULT
+ * @param cbFn A callback function to call when the effect finishes playing, may be NULL
+ */
+void bzrPlaySfxPriority(const song_t* song, buzzerPlayTrack_t track, uint8_t priority, songFinishedCbFn cbFn)
+{
+    // SFX are always heard over BGM
+    if (BZR_BGM_PRIORITY == priority)
+    {
+        priority = BZR_BGM_PRIORITY + 1;
+    }
+
+    int16_t vIdx = bzrAllocSfxVoice(priority);
+    if (BZR_NO_VOICE != vIdx)
+    {
+        bzrPlayVoice(vIdx, song, track, priority, cbFn);
+    }
 }
 
 /**
@@ -358,8 +521,8 @@ void bzrPlaySfxCb(const song_t* song, buzzerPlayTrack_t track, songFinishedCbFn
 void bzrStop(bool resetTracks)
 {
     // Stop the timer to check notes
-    gptimer_stop(bzrTimer);
-    bzrTimerActive = false;
+    bzrStopTimer();
+    bzrClockStop();
 
     // Stop the note
     bzrStopNote(BZR_LEFT);
@@ -368,11 +531,8 @@ void bzrStop(bool resetTracks)
     if (resetTracks)
     {
         // Clear internal variables
-        for (uint8_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
-        {
-            memset(&(buzzers[bIdx].bgm), 0, sizeof(bzrTrack_t));
-            memset(&(buzzers[bIdx].sfx), 0, sizeof(bzrTrack_t));
-        }
+        memset(voices, 0, sizeof(voices));
+        nextDeadlineUs = BZR_NO_DEADLINE;
     }
 }
 
@@ -399,9 +559,10 @@ void IRAM_ATTR bzrPlayNote(noteFrequency_t freq, buzzerPlayTrack_t track, uint16
                 bzr->cFreq = SILENCE;
                 ledc_stop(LEDC_MODE, bzr->ledcChannel, 0);
             }
-            else if (bzr->cFreq != freq)
+            else if ((bzr->cFreq != freq) || (bzr->volume != volume))
             {
-                bzr->cFreq = freq;
+                bzr->cFreq  = freq;
+                bzr->volume = volume;
                 // Set the frequency
                 ledc_set_freq(LEDC_MODE, bzr->ledcTimer, bzr->cFreq);
                 // Set duty to 50%
@@ -433,8 +594,10 @@ void IRAM_ATTR bzrStopNote(buzzerPlayTrack_t track)
 /////////////////////////////
 
 /**
- * @brief Check if there is a new note to play on the buzzer.
- * This is called periodically in a timer interrupt
+ * @brief Play the next notes on the buzzer.
+ * This is called from a timer interrupt which is set to fire at the earliest note deadline of all voices, so it only
+ * runs when a note actually changes. All voices are advanced, each buzzer plays the note of its highest priority voice,
+ * and the timer is set to fire again at the next deadline. If no voices are playing, the timer isn't set again
  *
  * This has IRAM_ATTR because it is an interrupt
  *
@@ -446,149 +609,139 @@ void IRAM_ATTR bzrStopNote(buzzerPlayTrack_t track)
 static bool IRAM_ATTR buzzer_check_next_note_isr(gptimer_handle_t timer, const gptimer_alarm_event_data_t* edata,
                                                  void* user_ctx)
 {
-    // Track time between function calls
-    static int32_t tLastLoopUs = 0;
-    if (0 == tLastLoopUs)
+    // Don't do anything if paused
+    if (bzrPaused)
     {
-        tLastLoopUs = esp_timer_get_time();
+        return false;
     }
-    else
+
+    // If the alarm fired a little early, wait for the deadline
+    int64_t tNowUs = bzrClockUs();
+    if (tNowUs < nextDeadlineUs)
     {
-        int32_t tNowUs     = esp_timer_get_time();
-        int32_t tElapsedUs = tNowUs - tLastLoopUs;
-        tLastLoopUs        = tNowUs;
+        bzrSetAlarm(nextDeadlineUs - tNowUs);
+        return false;
+    }
 
-        // If the buzzer is being restored
-        if (bzrIsRestored)
+    // Advance all voices and find the next deadline
+    int64_t nextUs = BZR_NO_DEADLINE;
+    for (int16_t vIdx = 0; vIdx < BZR_NUM_VOICES; vIdx++)
+    {
+        bzrVoice_t* voice = &voices[vIdx];
+        bool wasActive    = false;
+        bool isActive     = false;
+        for (int16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
         {
-            bzrIsRestored = false;
-            // Return for once cycle so that tNowUs is set to a sane value
-            return false;
+            bzrTrack_t* track = &voice->tracks[bIdx];
+            if (NULL != track->sTrack)
+            {
+                wasActive = true;
+                if (buzzer_track_check_next_note(track, voice->should_loop, tNowUs))
+                {
+                    isActive = true;
+                    if (track->deadlineUs < nextUs)
+                    {
+                        nextUs = track->deadlineUs;
+                    }
+                }
+            }
         }
 
-        // Don't do much if paused. Check here so that tElapsedUs stays sane
-        if (bzrPaused)
+        // If the voice just finished
+        if (wasActive && !isActive)
         {
-            return false;
+            // Save the callback here but do not directly call it because this is in an interrupt. The callback should
+            // be called from the main loop
+            doneCbs[vIdx] = voice->cbFn;
+            voice->cbFn   = NULL;
         }
+    }
+    nextDeadlineUs = nextUs;
 
-        for (uint16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
+    // Fire again when the next note changes
+    if (BZR_NO_DEADLINE != nextUs)
+    {
+        bzrSetAlarm(nextUs - tNowUs);
+    }
+
+    // Play the highest priority voice's note on each buzzer
+    for (int16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
+    {
+        const bzrVoice_t* best = NULL;
+        for (int16_t vIdx = 0; vIdx < BZR_NUM_VOICES; vIdx++)
         {
-            buzzer_t* bzr = &buzzers[bIdx];
-            // Try playing SFX first
-            bool sfxIsActive = buzzer_track_check_next_note(&bzr->sfx, bIdx, sfxVolume, true, false, tElapsedUs);
-            // Then play BGM if SFX isn't active
-            bool bgmIsActive = buzzer_track_check_next_note(&bzr->bgm, bIdx, bgmVolume, !sfxIsActive, true, tElapsedUs);
+            const bzrVoice_t* voice = &voices[vIdx];
+            if ((NULL != voice->tracks[bIdx].sTrack)
+                && ((NULL == best) || (voice->priority > best->priority)
+                    || ((voice->priority == best->priority) && (voice->seq > best->seq))))
+            {
+                best = voice;
+            }
+        }
 
-            // If nothing is playing, but there is BGM (i.e. SFX finished)
-            if ((false == sfxIsActive) && (false == bgmIsActive) && (NULL != bzr->bgm.sTrack))
+        if (NULL == best)
+        {
+            // Nothing to play
+            if (SILENCE != buzzers[bIdx].cFreq)
             {
-                // Immediately start playing BGM to get back on track faster
-                bzrPlayNote(bzr->bgm.sTrack->notes[bzr->bgm.note_index].note, bIdx, bgmVolume);
+                bzrStopNote(bIdx);
             }
         }
+        else
+        {
+            const bzrTrack_t* track = &best->tracks[bIdx];
+            bzrPlayNote(track->sTrack->notes[track->note_index].note, bIdx,
+                        (&voices[BZR_BGM_VOICE] == best) ? bgmVolume : sfxVolume);
+        }
     }
     return false;
 }
 
 /**
- * Check a specific track for notes to be played and queue them for playing.
- * This will always advance through notes in a song, even if it's not the active
- * track
+ * Advance a specific track to the note which should be playing now.
+ * This will always advance through notes in a song, even if it's not the heard voice
  * This has IRAM_ATTR because it is called from buzzer_check_next_note_isr()
  *
  * @param track The track to advance notes in
- * @param bIdx The index of the buzzer to play on
- * @param volume The volume to play
- * @param isActive true if this is active and should set a note to be played
- *                 false to just advance notes without playing
- * @param isBgm true if this is BGM, false if this is SFX
- * @param tElapsedUs The elapsed time since this function was last called
+ * @param shouldLoop true if the track should loop when done
+ * @param tNowUs The current buzzer clock time
  * @return true  if this track is playing a note
- *         false if this track is not playing a note
+ *         false if this track finished
  */
-static bool IRAM_ATTR buzzer_track_check_next_note(bzrTrack_t* track, buzzerPlayTrack_t bIdx, uint16_t volume,
-                                                   bool isActive, bool isBgm, int32_t tElapsedUs)
+static bool IRAM_ATTR buzzer_track_check_next_note(bzrTrack_t* track, bool shouldLoop, int64_t tNowUs)
 {
-    // Check if there is a song and there are still notes
-    if ((NULL != track->sTrack) && (track->note_index < track->sTrack->numNotes))
+    if (-1 == track->note_index)
     {
-        // Check if it's time to play the next note
-        bool shouldAdvance = false;
-        if (-1 == track->note_index)
-        {
-            // Index is negative, so the song is just starting
-            track->note_index++;
-            track->usAccum = 0;
-            shouldAdvance  = true;
-        }
-        else
+        // Index is negative, so the song is just starting
+        track->deadlineUs = tNowUs;
+    }
+
+    // Advance through every note which ended, at most one pass through the song
+    int32_t maxSteps = track->sTrack->numNotes + 1;
+    while ((track->deadlineUs <= tNowUs) && (0 < maxSteps--))
+    {
+        track->note_index++;
+
+        // Loop if we should
+        if (shouldLoop && (track->note_index == track->sTrack->numNotes))
         {
-            // Accumulate time
-            track->usAccum += tElapsedUs;
-            // Get the current note length
-            int32_t noteTimeUs = (1000 * track->sTrack->notes[track->note_index].timeMs);
-            // If the note expired
-            if (track->usAccum >= noteTimeUs)
-            {
-                // Decrement the count
-                track->usAccum -= noteTimeUs;
-                // Move to the next
-                track->note_index++;
-                shouldAdvance = true;
-            }
+            track->note_index = track->sTrack->loopStartNote;
         }
 
-        // Check if it's time to play the next note
-        if (shouldAdvance)
+        // If there are no more notes
+        if (track->note_index >= track->sTrack->numNotes)
         {
-            // Loop if we should
-            if (track->should_loop && (track->note_index == track->sTrack->numNotes))
-            {
-                track->note_index = track->sTrack->loopStartNote;
-            }
-
-            // If there is a note
-            if (track->note_index < track->sTrack->numNotes)
-            {
-                if (isActive)
-                {
-                    bzrPlayNote(track->sTrack->notes[track->note_index].note, bIdx, volume);
-                }
-            }
-            else
-            {
-                if (isActive)
-                {
-                    // Set the song to stop
-                    bzrStopNote(bIdx);
-                }
-
-                // Clear track data
-                track->usAccum    = 0;
-                track->note_index = 0;
-                track->sTrack     = NULL;
-
-                // Raise a flag here but do not directly call the callback because this
-                // is in an interrupt. The callback should be called from the main loop
-                if (isBgm)
-                {
-                    bgmDoneFlag = true;
-                }
-                else
-                {
-                    sfxDoneFlag = true;
-                }
-
-                // Track isn't active
-                return false;
-            }
+            // Clear track data
+            track->note_index = 0;
+            track->deadlineUs = 0;
+            track->sTrack     = NULL;
+            return false;
         }
-        // Track is active
-        return true;
+
+        // The next note ends relative to when the last one ended, not when this was called, so timing doesn't drift
+        track->deadlineUs += 1000 * (int64_t)track->sTrack->notes[track->note_index].timeMs;
     }
-    // Track isn't active
-    return false;
+    return true;
 }
 
 /**
@@ -596,23 +749,13 @@ static bool IRAM_ATTR buzzer_track_check_next_note(bzrTrack_t* track, buzzerPlay
  */
 void bzrCheckSongDone(void)
 {
-    if (true == bgmDoneFlag)
+    for (int16_t vIdx = 0; vIdx < BZR_NUM_VOICES; vIdx++)
     {
-        bgmDoneFlag = false;
-        if (NULL != bgmDoneCb)
+        songFinishedCbFn cbFn = doneCbs[vIdx];
+        if (NULL != cbFn)
         {
-            bgmDoneCb();
-            bgmDoneCb = NULL;
-        }
-    }
-
-    if (true == sfxDoneFlag)
-    {
-        sfxDoneFlag = false;
-        if (NULL != sfxDoneCb)
-        {
-            sfxDoneCb();
-            sfxDoneCb = NULL;
+            doneCbs[vIdx] = NULL;
+            cbFn();
         }
     }
 }
@@ -627,6 +770,8 @@ bool bzrPause(void)
     if (!bzrPaused)
     {
         bzrPaused = true;
+        bzrStopTimer();
+        bzrClockStop();
         bzrPlayNote(SILENCE, BZR_STEREO, 0);
         return true;
     }
@@ -638,28 +783,14 @@ bool bzrPause(void)
  */
 void bzrResume(void)
 {
-    if (bzrPaused || !bzrTimerActive)
-    {
-        // Mark it as not paused
-        bzrPaused = false;
-
-        // Set this to restore the elapsed clock in the ISR
-        bzrIsRestored = true;
+    // Mark it as not paused
+    bzrPaused = false;
 
-        if (!bzrTimerActive)
-        {
-            // Restart timer stopped by bzrStop()
-            gptimer_start(bzrTimer);
-            bzrTimerActive = true;
-        }
+    // Continue the clock from where it stopped so no notes are skipped
+    bzrClockStart();
 
-        // For each buzzer, resume playing the tone before pausing
-        for (uint16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
-        {
-            buzzer_t* bzr = &buzzers[bIdx];
-            bzrPlayNote(bzr->cFreq, bIdx, bzr->volume);
-        }
-    }
+    // Check voices right away to resume playing the tones from before pausing, or to start new ones
+    bzrStartTimer();
 }
 
 /**
@@ -672,12 +803,9 @@ void* bzrSave(void)
 {
     bzrPause();
 
-    bzrTrack_t* result = malloc(sizeof(bzrTrack_t) * NUM_BUZZERS * 2);
-    for (uint16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
-    {
-        memcpy(&result[bIdx * 2], &buzzers[bIdx].bgm, sizeof(bzrTrack_t));
-        memcpy(&result[bIdx * 2 + 1], &buzzers[bIdx].sfx, sizeof(bzrTrack_t));
-    }
+    bzrSaveState_t* result = malloc(sizeof(bzrSaveState_t));
+    result->clockUs        = bzrClockUs();
+    memcpy(result->voices, voices, sizeof(voices));
 
     return (void*)result;
 }
@@ -691,11 +819,17 @@ void* bzrSave(void)
  */
 void bzrRestore(void* data)
 {
-    bzrTrack_t* buzzerState = (bzrTrack_t*)data;
-    for (uint16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
+    bzrSaveState_t* buzzerState = (bzrSaveState_t*)data;
+    memcpy(voices, buzzerState->voices, sizeof(voices));
+
+    // Shift the saved deadlines to the current buzzer clock
+    int64_t shiftUs = bzrClockUs() - buzzerState->clockUs;
+    for (int16_t vIdx = 0; vIdx < BZR_NUM_VOICES; vIdx++)
     {
-        memcpy(&buzzers[bIdx].bgm, &buzzerState[bIdx * 2], sizeof(bzrTrack_t));
-        memcpy(&buzzers[bIdx].sfx, &buzzerState[bIdx * 2 + 1], sizeof(bzrTrack_t));
+        for (int16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
+        {
+            voices[vIdx].tracks[bIdx].deadlineUs += shiftUs;
+        }
     }
 
     free(data);
@@ -7,13 +7,24 @@
  * peripheral</a>. This is usually used to generate a PWM signal to control the intensity of an LED, but here it
  * generates frequencies for the buzzers.
  *
- * A hardware timer is started which calls an interrupt every 5ms to check if the song should play the next note, so no
- * note can be shorter than 5ms.
+ * A hardware timer is set to call an interrupt exactly when the next note of any playing song should start. The
+ * interrupt plays the new notes and sets the timer again for the following note, so it does no work while notes are
+ * sustained and no work at all while nothing is playing.
  *
- * This component manages two physical buzzers, each with two tracks, background music (BGM) and sound effects (SFX).
- * When BGM is playing, it may be interrupted by SFX. SFX will not interrupt BGM.
- * If BGM and SFX are playing at the same time, both will progress through their respective notes, but only SFX will be
- * heard. This way, BGM keeps accurate time even when SFX is playing.
+ * This component manages two physical buzzers which are shared by a pool of ::BZR_NUM_VOICES logical voices. One voice
+ * is reserved for background music (BGM) and the rest are used for sound effects (SFX). Each voice plays one ::song_t
+ * on one or both buzzers and has a priority. BGM always has the lowest priority, ::BZR_BGM_PRIORITY.
+ *
+ * For each buzzer, the highest priority voice that has a track on that buzzer is heard. If two voices have the same
+ * priority, the one which started most recently is heard. All voices progress through their respective notes whether
+ * they are heard or not. This way, BGM keeps accurate time even when SFX is playing, and an older SFX picks back up
+ * where it should be when a newer, shorter SFX finishes.
+ *
+ * When a new SFX is played and all SFX voices are busy, the lowest priority voice is stolen, oldest first. If every
+ * busy voice has a higher priority than the new SFX, the new SFX is not played.
+ *
+ * Each voice's notes are tracked as absolute deadlines against a buzzer clock that stops while the buzzer is paused.
+ * The timer is always set for the earliest deadline of all voices.
  *
  * Songs may be played on one or more buzzer. If the ::song_t has two tracks, the first one will play on the left buzzer
  * and the second one will play on the right one. This cannot be changed. If the ::song_t has one track, it may be
@@ -32,7 +43,9 @@
  * setBgmVolumeSetting() and setSfxVolumeSetting() should be called instead if the volume change should be persistent
  * through reboots. Setting the volume to 0 will mute it.
  *
- * A song can be played on with either bzrPlayBgm() or bzrPlaySfx().
+ * A song can be played on with either bzrPlayBgm() or bzrPlaySfx(). bzrPlaySfxPriority() may be used to play SFX with a
+ * priority other than ::BZR_SFX_PRIORITY_DEFAULT, for instance to keep a game's important effects from being cut off by
+ * frequent, less important ones.
  * Both BGM and SFX can be stopped at the same time with bzrStop().
  *
  * An individual note can be played with bzrPlayNote() or stopped with bzrStopNote().
@@ -77,6 +90,15 @@
 
 #define MAX_VOLUME 13
 
+/** @brief The number of logical voices shared between the buzzers. The first voice is reserved for BGM */
+#define BZR_NUM_VOICES 8
+
+/** @brief The priority of BGM, lower than any SFX */
+#define BZR_BGM_PRIORITY 0
+
+/** @brief The priority of SFX played with bzrPlaySfx() or bzrPlaySfxCb() */
+#define BZR_SFX_PRIORITY_DEFAULT 128
+
 /**
  * @brief Frequencies for all the notes, in hertz.
  *
@@ -269,6 +291,7 @@ void bzrPlayBgm(const song_t* song, buzzerPlayTrack_t track);
 void bzrPlaySfx(const song_t* song, buzzerPlayTrack_t track);
 void bzrPlayBgmCb(const song_t* song, buzzerPlayTrack_t track, songFinishedCbFn cbFn);
 void bzrPlaySfxCb(const song_t* song, buzzerPlayTrack_t track, songFinishedCbFn cbFn);
+void bzrPlaySfxPriority(const song_t* song, buzzerPlayTrack_t track, uint8_t priority, songFinishedCbFn cbFn);
 void bzrStop(bool resetTracks);
 void bzrPlayNote(noteFrequency_t freq, buzzerPlayTrack_t track, uint16_t volume);
 void bzrStopNote(buzzerPlayTrack_t track);
@@ -581,8 +581,13 @@ void espNowSend(const char* data, uint8_t len)
     }
     else
     {
-        // Send a packet
-        esp_now_send((uint8_t*)espNowBroadcastMac, (uint8_t*)data, len);
+        // Send a packet. If it isn't accepted, the send callback won't be called, so call it here
+        esp_err_t err = esp_now_send((uint8_t*)espNowBroadcastMac, (uint8_t*)data, len);
+        if (ESP_OK != err)
+        {
+            ESP_LOGE("ESPNOW", "esp_now_send() failed (%s)", esp_err_to_name(err));
+            espNowSendCb(espNowBroadcastMac, ESP_NOW_SEND_FAIL);
+        }
     }
 }
 
@@ -17,21 +17,36 @@
 
 #define SAMPLING_RATE 8000
 
+#define BZR_BGM_VOICE   0         //!< The voice index reserved for BGM
+#define BZR_NO_VOICE    -1        //!< A voice index meaning no voice is available
+#define BZR_NO_DEADLINE INT64_MAX //!< A deadline which never passes
+
 //==============================================================================
 // Structs
 //==============================================================================
 
 /**
- * @brief A buzzer track which a song is played on, either BGM or SFX
+ * @brief A voice's track on one buzzer
  */
 typedef struct
 {
-    const songTrack_t* sTrack; ///< The song currently being played on this track
-    int32_t note_index;        ///< The note index into the song
-    int32_t usAccum;           ///< Accumulated time for the current note
-    bool should_loop;          ///< True if this track should loop, false if it plays once
+    const songTrack_t* sTrack; ///< The song track currently being played, NULL if the voice doesn't use this buzzer
+    int32_t note_index;        ///< The note index into the song, -1 if not started yet
+    int64_t deadlineUs;        ///< The buzzer clock time when the current note ends
 } bzrTrack_t;
 
+/**
+ * @brief A logical voice, one song playing on one or both buzzers
+ */
+typedef struct
+{
+    bzrTrack_t tracks[NUM_BUZZERS]; ///< This voice's track for each buzzer
+    bool should_loop;               ///< True if this voice should loop, false if it plays once
+    uint8_t priority;               ///< This voice's priority. Higher priority voices are heard over lower ones
+    uint32_t seq;                   ///< When this voice started, relative to other voices. Used to break ties
+    songFinishedCbFn cbFn;          ///< A callback to call when this voice finishes playing
+} bzrVoice_t;
+
 /**
  * @brief A buzzer, currently either left or right
  */
@@ -39,10 +54,17 @@ typedef struct
 {
     noteFrequency_t cFreq; ///< The current frequency of the note being played
     uint16_t vol;          ///< The current volume
-    bzrTrack_t bgm;        ///< The BGM track for this buzzer
-    bzrTrack_t sfx;        ///< The SFX track for this buzzer
 } buzzer_t;
 
+/**
+ * @brief The saved state of the buzzer, returned by bzrSave()
+ */
+typedef struct
+{
+    int64_t clockUs;                   ///< The buzzer clock time when this was saved
+    bzrVoice_t voices[BZR_NUM_VOICES]; ///< The saved voices
+} bzrSaveState_t;
+
 //==============================================================================
 // Const variables
 //==============================================================================
@@ -63,26 +85,38 @@ static buzzer_t buzzers[NUM_BUZZERS] = {0};
 uint16_t bgmVolume;
 uint16_t sfxVolume;
 
+/// @brief Pool of voices played on the buzzers. The first is reserved for BGM
+static bzrVoice_t voices[BZR_NUM_VOICES] = {0};
+/// @brief Counter to mark when voices start, relative to each other
+static uint32_t voiceSeq = 0;
+/// @brief The earliest deadline of all voices. The timer is set for this time
+static int64_t nextDeadlineUs = BZR_NO_DEADLINE;
+/// @brief Timer to fire when the next note transition is due
+static esp_timer_handle_t checkNoteTimerHandle = NULL;
+
 /// @brief Track if the buzzer is paused or not
 static bool bzrPaused = false;
 
-/// @brief A flag to set if bgmDoneCb should be called from the main loop
-static bool bgmDoneFlag = false;
-/// @brief A flag to set if sfxDoneCb should be called from the main loop
-static bool sfxDoneFlag = false;
-/// @brief A callback function to call after SFX finishes. This is not called if the song is manually stopped or another
-/// song starts before this one finishes
-static songFinishedCbFn sfxDoneCb = NULL;
-/// @brief A callback function to call after BGM finishes. This is not called if the song is manually stopped or another
-/// song starts before this one finishes
-static songFinishedCbFn bgmDoneCb = NULL;
+/// @brief Offset from esp_timer_get_time() to the buzzer clock, which doesn't advance while paused
+static int64_t clockOffsetUs = 0;
+/// @brief The buzzer clock time when it was paused
+static int64_t clockPausedUs = 0;
+
+/// @brief Callbacks to call from the main loop for voices which finished. These are not called if the voice is
+/// manually stopped or stolen by another song before it finishes
+static songFinishedCbFn doneCbs[BZR_NUM_VOICES] = {0};
 
 //==============================================================================
 // Function Prototypes
 //==============================================================================
 
-static bool buzzer_track_check_next_note(bzrTrack_t* track, int16_t bIdx, uint16_t volume, bool isActive, bool isBgm,
-                                         int32_t tElapsedUs);
+static bool buzzer_track_check_next_note(bzrTrack_t* track, bool shouldLoop, int64_t tNowUs);
+static void bzrPlayVoice(int16_t vIdx, const song_t* song, buzzerPlayTrack_t track, uint8_t priority,
+                         songFinishedCbFn cbFn);
+static int16_t bzrAllocSfxVoice(uint8_t priority);
+static int64_t bzrClockUs(void);
+static void bzrStartTimer(void);
+static void bzrStartTimerAt(int64_t deadlineUs, int64_t tNowUs);
 void buzzer_check_next_note(void* arg);
 void EmuSoundCb(struct SoundDriver* sd, short* in, short* out, int samples_R, int samples_W);
 
@@ -123,9 +157,11 @@ void initBuzzer(gpio_num_t bzrGpioL, ledc_timer_t ledcTimerL, ledc_channel_t led
         .name                  = "BZR",
         .skip_unhandled_events = true,
     };
-    esp_timer_handle_t checkNoteTimerHandle = NULL;
-    esp_timer_create(&checkNoteTimeArgs, &checkNoteTimerHandle);
-    esp_timer_start_periodic(checkNoteTimerHandle, 1);
+    if (NULL == checkNoteTimerHandle)
+    {
+        // The timer is started for each note transition as it's needed
+        esp_timer_create(&checkNoteTimeArgs, &checkNoteTimerHandle);
+    }
 }
 
 /**
@@ -165,47 +201,124 @@ void bzrSetSfxVolume(uint16_t vol)
 }
 
 /**
- * @brief Play a song_t on one or two bzrTrack_t depending on what
+ * @brief Get the current time of the buzzer clock, which doesn't advance while the buzzer is paused
  *
- * @param trackL The left track to play on
- * @param trackR The right track to play on
+ * @return The buzzer clock time, in microseconds
+ */
+static int64_t bzrClockUs(void)
+{
+    if (bzrPaused)
+    {
+        return clockPausedUs;
+    }
+    return esp_timer_get_time() - clockOffsetUs;
+}
+
+/**
+ * @brief Start the timer to check voices as soon as possible
+ */
+static void bzrStartTimer(void)
+{
+    nextDeadlineUs = 0;
+    esp_timer_stop(checkNoteTimerHandle);
+    esp_timer_start_once(checkNoteTimerHandle, 1);
+}
+
+/**
+ * @brief Start the timer to check voices at a deadline. If the deadline already passed, check as soon as possible
+ *
+ * @param deadlineUs The buzzer clock time to check voices at
+ * @param tNowUs The current buzzer clock time
+ */
+static void bzrStartTimerAt(int64_t deadlineUs, int64_t tNowUs)
+{
+    int64_t delayUs = deadlineUs - tNowUs;
+    esp_timer_start_once(checkNoteTimerHandle, (delayUs < 1) ? 1 : delayUs);
+}
+
+/**
+ * @brief Find a voice to play a new SFX on. This returns an unused voice if there is one, otherwise it steals the
+ * lowest priority, oldest voice.
+ *
+ * @param priority The priority of the new SFX
+ * @return The index of the voice to use, or ::BZR_NO_VOICE if every voice has a higher priority
+ */
+static int16_t bzrAllocSfxVoice(uint8_t priority)
+{
+    int16_t victim = BZR_NO_VOICE;
+    for (int16_t vIdx = BZR_BGM_VOICE + 1; vIdx < BZR_NUM_VOICES; vIdx++)
+    {
+        bzrVoice_t* voice = &voices[vIdx];
+        if ((NULL == voice->tracks[BZR_LEFT].sTrack) && (NULL == voice->tracks[BZR_RIGHT].sTrack))
+        {
+            // Unused voice, take it
+            return vIdx;
+        }
+        else if ((BZR_NO_VOICE == victim) || (voice->priority < voices[victim].priority)
+                 || ((voice->priority == voices[victim].priority) && (voice->seq < voices[victim].seq)))
+        {
+            // Lowest priority, oldest voice so far
+            victim = vIdx;
+        }
+    }
+
+    // Only steal voices which are not more important than the new SFX
+    if (voices[victim].priority <= priority)
+    {
+        return victim;
+    }
+    return BZR_NO_VOICE;
+}
+
+/**
+ * @brief Play a song_t on a voice, on one or both buzzers depending on the song and requested track
+ *
+ * @param vIdx The index of the voice to play on
  * @param song The song_t to play
  * @param track The requested track or tracks to play on
+ * @param priority The priority of this voice
+ * @param cbFn A callback function to call when the song finishes playing, may be NULL
  */
-static void bzrPlayTrack(bzrTrack_t* trackL, bzrTrack_t* trackR, const song_t* song, buzzerPlayTrack_t track)
+static void bzrPlayVoice(int16_t vIdx, const song_t* song, buzzerPlayTrack_t track, uint8_t priority,
+                         songFinishedCbFn cbFn)
 {
+    bzrVoice_t* voice = &voices[vIdx];
+
+    // Clear the voice before setting it up, and drop any callback pending for it
+    memset(voice, 0, sizeof(bzrVoice_t));
+    doneCbs[vIdx] = NULL;
+
+    voice->should_loop = song->shouldLoop;
+    voice->priority    = priority;
+    voice->seq         = ++voiceSeq;
+    voice->cbFn        = cbFn;
+
     if (1 == song->numTracks)
     {
         // Mono song, play it on the requested tracks
         if (BZR_STEREO == track || BZR_LEFT == track)
         {
-            trackL->sTrack      = &song->tracks[0];
-            trackL->note_index  = -1;
-            trackL->usAccum     = 0;
-            trackL->should_loop = song->shouldLoop;
+            voice->tracks[BZR_LEFT].note_index = -1;
+            voice->tracks[BZR_LEFT].sTrack     = &song->tracks[0];
         }
 
         if (BZR_STEREO == track || BZR_RIGHT == track)
         {
-            trackR->sTrack      = &song->tracks[0];
-            trackR->note_index  = -1;
-            trackR->usAccum     = 0;
-            trackL->should_loop = song->shouldLoop;
+            voice->tracks[BZR_RIGHT].note_index = -1;
+            voice->tracks[BZR_RIGHT].sTrack     = &song->tracks[0];
         }
     }
     else
     {
         // Stereo song, play it on both tracks
-        trackL->sTrack      = &song->tracks[0];
-        trackL->note_index  = -1;
-        trackL->usAccum     = 0;
-        trackL->should_loop = song->shouldLoop;
-
-        trackR->sTrack      = &song->tracks[1];
-        trackR->note_index  = -1;
-        trackR->usAccum     = 0;
-        trackR->should_loop = song->shouldLoop;
+        voice->tracks[BZR_LEFT].note_index  = -1;
+        voice->tracks[BZR_LEFT].sTrack      = &song->tracks[0];
+        voice->tracks[BZR_RIGHT].note_index = -1;
+        voice->tracks[BZR_RIGHT].sTrack     = &song->tracks[1];
     }
+
+    // Un-pause if paused, and start the voice right away
+    bzrResume();
 }
 
 /**
@@ -217,9 +330,7 @@ static void bzrPlayTrack(bzrTrack_t* trackL, bzrTrack_t* trackR, const song_t* s
  */
 void bzrPlayBgm(const song_t* song, buzzerPlayTrack_t track)
 {
-    bzrPlayTrack(&buzzers[0].bgm, &buzzers[1].bgm, song, track);
-    bzrResume();
-    bgmDoneCb = NULL;
+    bzrPlayVoice(BZR_BGM_VOICE, song, track, BZR_BGM_PRIORITY, NULL);
 }
 
 /**
@@ -231,9 +342,7 @@ void bzrPlayBgm(const song_t* song, buzzerPlayTrack_t track)
  */
 void bzrPlaySfx(const song_t* song, buzzerPlayTrack_t track)
 {
-    bzrPlayTrack(&buzzers[0].sfx, &buzzers[1].sfx, song, track);
-    bzrResume();
-    sfxDoneCb = NULL;
+    bzrPlaySfxPriority(song, track, BZR_SFX_PRIORITY_DEFAULT, NULL);
 }
 
 /**
@@ -246,8 +355,7 @@ void bzrPlaySfx(const song_t* song, buzzerPlayTrack_t track)
  */
 void bzrPlayBgmCb(const song_t* song, buzzerPlayTrack_t track, songFinishedCbFn cbFn)
 {
-    bzrPlayBgm(song, track);
-    bgmDoneCb = cbFn;
+    bzrPlayVoice(BZR_BGM_VOICE, song, track, BZR_BGM_PRIORITY, cbFn);
 }
 
 /**
@@ -260,32 +368,46 @@ void bzrPlayBgmCb(const song_t* song, buzzerPlayTrack_t track, songFinishedCbFn
  */
 void bzrPlaySfxCb(const song_t* song, buzzerPlayTrack_t track, songFinishedCbFn cbFn)
 {
-    bzrPlaySfx(song, track);
-    sfxDoneCb = cbFn;
+    bzrPlaySfxPriority(song, track, BZR_SFX_PRIORITY_DEFAULT, cbFn);
 }
 
 /**
- * @brief Check if a song has finished playing and call the appropriate callback if applicable
+ * @brief Start playing a sound effect on the buzzer with a given priority. On each buzzer, the highest priority voice
+ * is heard. If all SFX voices are busy, the lowest priority, oldest one is stolen. If all busy voices have a higher
+ * priority than this, the sound effect is not played.
+ *
+ * @param song The song to play as a sequence of notes
+ * @param track The track to play on if the song is mono. This is ignored if the song is stereo
+ * @param priority The priority of the sound effect, 1 to 255. bzrPlaySfx() uses ::BZR_SFX_PRIORITY_DEFAULT
+ * @param cbFn A callback function to call when the effect finishes playing, may be NULL
  */
-void bzrCheckSongDone(void)
+void bzrPlaySfxPriority(const song_t* song, buzzerPlayTrack_t track, uint8_t priority, songFinishedCbFn cbFn)
 {
-    if (true == bgmDoneFlag)
+    // SFX are always heard over BGM
+    if (BZR_BGM_PRIORITY == priority)
     {
-        bgmDoneFlag = false;
-        if (NULL != bgmDoneCb)
-        {
-            bgmDoneCb();
-            bgmDoneCb = NULL;
-        }
+        priority = BZR_BGM_PRIORITY + 1;
     }
 
-    if (true == sfxDoneFlag)
+    int16_t vIdx = bzrAllocSfxVoice(priority);
+    if (BZR_NO_VOICE != vIdx)
+    {
+        bzrPlayVoice(vIdx, song, track, priority, cbFn);
+    }
+}
+
+/**
+ * @brief Check if a song has finished playing and call the appropriate callback if applicable
+ */
+void bzrCheckSongDone(void)
+{
+    for (int16_t vIdx = 0; vIdx < BZR_NUM_VOICES; vIdx++)
     {
-        sfxDoneFlag = false;
-        if (NULL != sfxDoneCb)
+        songFinishedCbFn cbFn = doneCbs[vIdx];
+        if (NULL != cbFn)
         {
-            sfxDoneCb();
-            sfxDoneCb = NULL;
+            doneCbs[vIdx] = NULL;
+            cbFn();
         }
     }
 }
@@ -296,9 +418,15 @@ void bzrCheckSongDone(void)
  */
 void bzrStop(bool resetTracks)
 {
+    if (NULL != checkNoteTimerHandle)
+    {
+        esp_timer_stop(checkNoteTimerHandle);
+    }
+
     if (resetTracks)
     {
-        memset(buzzers, 0, sizeof(buzzers));
+        memset(voices, 0, sizeof(voices));
+        nextDeadlineUs = BZR_NO_DEADLINE;
     }
     bzrPlayNote(SILENCE, BZR_LEFT, 0);
     bzrPlayNote(SILENCE, BZR_RIGHT, 0);
@@ -349,141 +477,138 @@ void bzrStopNote(buzzerPlayTrack_t track)
 ////////////////////////////////
 
 /**
- * @brief Call this periodically to check if the next note in the song should be played
+ * @brief Play the next notes on the buzzer. This is called from a timer which is set to fire at the earliest note
+ * deadline of all voices. All voices are advanced, each buzzer plays the note of its highest priority voice, and the
+ * timer is set to fire again at the next deadline
  *
  * @param arg unused
  */
 void buzzer_check_next_note(void* arg)
 {
-    static int32_t tLastLoopUs = 0;
-
-    if (0 == tLastLoopUs)
+    // If paused, don't do anything
+    if (bzrPaused)
     {
-        tLastLoopUs = esp_timer_get_time();
+        return;
     }
-    else
+
+    // If the timer fired a little early, wait for the deadline
+    int64_t tNowUs = bzrClockUs();
+    if (tNowUs < nextDeadlineUs)
     {
-        int32_t tNowUs     = esp_timer_get_time();
-        int32_t tElapsedUs = tNowUs - tLastLoopUs;
-        tLastLoopUs        = tNowUs;
+        bzrStartTimerAt(nextDeadlineUs, tNowUs);
+        return;
+    }
 
-        // If paused, return here so tElapsedUs stays sane
-        if (bzrPaused)
+    // Advance all voices and find the next deadline
+    int64_t nextUs = BZR_NO_DEADLINE;
+    for (int16_t vIdx = 0; vIdx < BZR_NUM_VOICES; vIdx++)
+    {
+        bzrVoice_t* voice = &voices[vIdx];
+        bool wasActive    = false;
+        bool isActive     = false;
+        for (int16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
         {
-            return;
+            bzrTrack_t* track = &voice->tracks[bIdx];
+            if (NULL != track->sTrack)
+            {
+                wasActive = true;
+                if (buzzer_track_check_next_note(track, voice->should_loop, tNowUs))
+                {
+                    isActive = true;
+                    if (track->deadlineUs < nextUs)
+                    {
+                        nextUs = track->deadlineUs;
+                    }
+                }
+            }
         }
 
-        for (int16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
+        // If the voice just finished, save the callback to be called from the main loop
+        if (wasActive && !isActive)
         {
-            buzzer_t* buzzer = &buzzers[bIdx];
+            doneCbs[vIdx] = voice->cbFn;
+            voice->cbFn   = NULL;
+        }
+    }
+    nextDeadlineUs = nextUs;
 
-            bool sfxIsActive = buzzer_track_check_next_note(&buzzer->sfx, bIdx, sfxVolume, true, false, tElapsedUs);
-            bool bgmIsActive
-                = buzzer_track_check_next_note(&buzzer->bgm, bIdx, bgmVolume, !sfxIsActive, true, tElapsedUs);
+    // Fire again when the next note changes
+    if (BZR_NO_DEADLINE != nextUs)
+    {
+        bzrStartTimerAt(nextUs, tNowUs);
+    }
 
-            // If nothing is playing, but there is BGM (i.e. SFX finished)
-            if ((false == sfxIsActive) && (false == bgmIsActive) && (NULL != buzzer->bgm.sTrack))
+    // Play the highest priority voice's note on each buzzer
+    for (int16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
+    {
+        const bzrVoice_t* best = NULL;
+        for (int16_t vIdx = 0; vIdx < BZR_NUM_VOICES; vIdx++)
+        {
+            const bzrVoice_t* voice = &voices[vIdx];
+            if ((NULL != voice->tracks[bIdx].sTrack)
+                && ((NULL == best) || (voice->priority > best->priority)
+                    || ((voice->priority == best->priority) && (voice->seq > best->seq))))
             {
-                // Immediately start playing BGM to get back on track faster
-                bzrPlayNote(buzzer->bgm.sTrack->notes[buzzer->bgm.note_index].note, bIdx, bgmVolume);
+                best = voice;
             }
         }
+
+        if (NULL == best)
+        {
+            // Nothing to play
+            bzrStopNote(bIdx);
+        }
+        else
+        {
+            const bzrTrack_t* track = &best->tracks[bIdx];
+            bzrPlayNote(track->sTrack->notes[track->note_index].note, bIdx,
+                        (&voices[BZR_BGM_VOICE] == best) ? bgmVolume : sfxVolume);
+        }
     }
 }
 
 /**
- * @brief Advance the notes in a specific track and play them if the track is active
+ * @brief Advance a specific track to the note which should be playing now
  *
- * @param track The track to check notes in
- * @param bIdx The index of the buzzer to play on
- * @param volume The volume to play at
- * @param isActive true if this is active and should set a note to be played
- *                 false to just advance notes without playing
- * @param isBgm true if this is BGM, false if this is SFX
- * @param tElapsedUs The microseconds since this function was last called
+ * @param track The track to advance notes in
+ * @param shouldLoop true if the track should loop when done
+ * @param tNowUs The current buzzer clock time
  * @return true  if this track is playing a note
- *         false if it is not
+ *         false if it finished
  */
-static bool buzzer_track_check_next_note(bzrTrack_t* track, int16_t bIdx, uint16_t volume, bool isActive, bool isBgm,
-                                         int32_t tElapsedUs)
+static bool buzzer_track_check_next_note(bzrTrack_t* track, bool shouldLoop, int64_t tNowUs)
 {
-    // Check if there is a song and there are still notes
-    if ((NULL != track->sTrack) && (track->note_index < track->sTrack->numNotes))
+    if (-1 == track->note_index)
     {
-        // Check if it's time to play the next note
-        bool shouldAdvance = false;
-        if (-1 == track->note_index)
+        // The song is just starting
+        track->deadlineUs = tNowUs;
+    }
+
+    // Advance through every note which ended, at most one pass through the song
+    int32_t maxSteps = track->sTrack->numNotes + 1;
+    while ((track->deadlineUs <= tNowUs) && (0 < maxSteps--))
+    {
+        track->note_index++;
+
+        // Loop if requested
+        if (shouldLoop && (track->note_index == track->sTrack->numNotes))
         {
-            track->note_index++;
-            track->usAccum = 0;
-            shouldAdvance  = true;
-        }
-        else
-        {
-            // Accumulate time
-            track->usAccum += tElapsedUs;
-            // Get this note's length in microseconds
-            int32_t noteTimeUs = (1000 * track->sTrack->notes[track->note_index].timeMs);
-            // If we've accumulated as much time as the note
-            if (track->usAccum >= noteTimeUs)
-            {
-                // Decrement the accumulated time
-                track->usAccum -= noteTimeUs;
-                // Advance to the next note
-                track->note_index++;
-                shouldAdvance = true;
-            }
+            track->note_index = track->sTrack->loopStartNote;
         }
 
-        // Check if it's time to play the next note
-        if (shouldAdvance)
+        // Song is over
+        if (track->note_index >= track->sTrack->numNotes)
         {
-            // Loop if requested
-            if (track->should_loop && (track->note_index == track->sTrack->numNotes))
-            {
-                track->note_index = track->sTrack->loopStartNote;
-            }
-
-            // If there is a note
-            if (track->note_index < track->sTrack->numNotes)
-            {
-                if (isActive)
-                {
-                    // Play the note
-                    bzrPlayNote(track->sTrack->notes[track->note_index].note, bIdx, volume);
-                }
-            }
-            else
-            {
-                if (isActive)
-                {
-                    // Song is over
-                    bzrStopNote(bIdx);
-                }
-
-                track->usAccum    = 0;
-                track->note_index = 0;
-                track->sTrack     = NULL;
-
-                // Set flag to call CB from main loop
-                if (isBgm)
-                {
-                    bgmDoneFlag = true;
-                }
-                else
-                {
-                    sfxDoneFlag = true;
-                }
-
-                // Track is inactive
-                return false;
-            }
+            track->note_index = 0;
+            track->deadlineUs = 0;
+            track->sTrack     = NULL;
+            return false;
         }
-        // Track is active
-        return true;
+
+        // The next note ends relative to when the last one ended, so timing doesn't drift
+        track->deadlineUs += 1000 * (int64_t)track->sTrack->notes[track->note_index].timeMs;
     }
-    // Track is inactive
-    return false;
+    return true;
 }
 
 /**
@@ -541,6 +666,7 @@ void EmuSoundCb(struct SoundDriver* sd, short* in, short* out, int samples_R, in
     }
 }
 
+
 /**
  * @brief Pause the buzzer but do not reset the song
  *
@@ -550,7 +676,9 @@ bool bzrPause(void)
 {
     if (!bzrPaused)
     {
-        bzrPaused = true;
+        // Stop the clock
+        clockPausedUs = bzrClockUs();
+        bzrPaused     = true;
         bzrStop(false);
         return true;
     }
@@ -564,15 +692,13 @@ void bzrResume(void)
 {
     if (bzrPaused)
     {
-        bzrPaused = false;
-
-        // For each buzzer, resume playing the tone before pausing
-        for (uint16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
-        {
-            buzzer_t* bzr = &buzzers[bIdx];
-            bzrPlayNote(bzr->cFreq, bIdx, bzr->vol);
-        }
+        // Continue the clock from where it was paused so no notes are skipped
+        clockOffsetUs = esp_timer_get_time() - clockPausedUs;
+        bzrPaused     = false;
     }
+
+    // Check voices right away to resume playing the tones from before pausing, or to start new ones
+    bzrStartTimer();
 }
 
 /**
@@ -585,12 +711,9 @@ void* bzrSave(void)
 {
     bzrPause();
 
-    bzrTrack_t* result = malloc(sizeof(bzrTrack_t) * NUM_BUZZERS * 2);
-    for (uint16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
-    {
-        memcpy(&result[bIdx * 2], &buzzers[bIdx].bgm, sizeof(bzrTrack_t));
-        memcpy(&result[bIdx * 2 + 1], &buzzers[bIdx].sfx, sizeof(bzrTrack_t));
-    }
+    bzrSaveState_t* result = malloc(sizeof(bzrSaveState_t));
+    result->clockUs        = bzrClockUs();
+    memcpy(result->voices, voices, sizeof(voices));
 
     return (void*)result;
 }
@@ -604,14 +727,22 @@ void* bzrSave(void)
  */
 void bzrRestore(void* data)
 {
-    bzrTrack_t* buzzerState = (bzrTrack_t*)data;
-    for (uint16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
+    bzrSaveState_t* buzzerState = (bzrSaveState_t*)data;
+    memcpy(voices, buzzerState->voices, sizeof(voices));
+
+    // Shift the saved deadlines to the current buzzer clock
+    int64_t shiftUs = bzrClockUs() - buzzerState->clockUs;
+    for (int16_t vIdx = 0; vIdx < BZR_NUM_VOICES; vIdx++)
     {
-        memcpy(&buzzers[bIdx].bgm, &buzzerState[bIdx * 2], sizeof(bzrTrack_t));
-        memcpy(&buzzers[bIdx].sfx, &buzzerState[bIdx * 2 + 1], sizeof(bzrTrack_t));
+        for (int16_t bIdx = 0; bIdx < NUM_BUZZERS; bIdx++)
+        {
+            voices[vIdx].tracks[bIdx].deadlineUs += shiftUs;
+        }
     }
 
     free(data);
+
+    bzrResume();
 }
 
 /**
@@ -15,7 +15,8 @@
 #if defined(USING_WINDOWS)
     #include <WinSock2.h>
 #elif defined(USING_LINUX) || defined(USING_MAC)
-    #include <sys/socket.h> // for socket(), connect(), sendto(), and recvfrom()
+    #include <sys/socket.h> // for socket(), sendmsg(), recvmmsg(), and recvfrom()
+    #include <sys/uio.h>    // for struct iovec
     #include <arpa/inet.h>  // for sockaddr_in and inet_addr()
     #include <fcntl.h>
 #endif
@@ -27,7 +28,10 @@
 #include "hdw-esp-now.h"
 #include "esp_wifi.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_random.h"
 #include "emu_main.h"
+#include "emu_args.h"
 
 //==============================================================================
 // Defines
@@ -36,6 +40,54 @@
 #define ESP_NOW_PORT  32888
 #define MAXRECVSTRING 1024 // Longest string to receive
 
+/// Magic byte at the start of every emulated ESP-NOW packet, to reject stray UDP traffic
+#define ESP_NOW_EMU_MAGIC 0xE5
+
+/// Header flag set when the packet was sent while espNowUseSerial() was active
+#define ESP_NOW_EMU_FLAG_WIRED 0x01
+
+/// The largest payload ESP-NOW can carry
+#define ESP_NOW_EMU_MAX_DATA 250
+
+/// How many datagrams to pull from the socket per recvmmsg() call
+#define ESP_NOW_RECV_BATCH 16
+
+/// How many packets may be held back at once to simulate latency. Packets beyond this are dropped.
+#define ESP_NOW_DELAY_QUEUE_LEN 256
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * @brief The binary header prepended to every emulated ESP-NOW packet
+ */
+typedef struct __attribute__((packed))
+{
+    uint8_t magic;  ///< Always ::ESP_NOW_EMU_MAGIC
+    uint8_t flags;  ///< A bitmask of ESP_NOW_EMU_FLAG_*
+    uint8_t mac[6]; ///< The sender's MAC address
+} espNowEmuHdr_t;
+
+/**
+ * @brief A received packet which is being held back to simulate latency
+ */
+typedef struct
+{
+    int64_t deliverAt;                  ///< The time, in microseconds, to deliver this packet at
+    uint8_t mac[6];                     ///< The sender's MAC address
+    uint8_t len;                        ///< The length of the payload
+    uint8_t data[ESP_NOW_EMU_MAX_DATA]; ///< The payload
+} espNowDelayedPkt_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void espNowRecvPacket(const uint8_t* packet, int packetLen);
+static void espNowDeliver(const uint8_t* srcMac, const uint8_t* data, uint8_t len);
+static void espNowDrainDelayQueue(void);
+
 //==============================================================================
 // Variables
 //==============================================================================
@@ -45,6 +97,20 @@ hostEspNowSendCb_t hostEspNowSendCb = NULL;
 
 int socketFd;
 
+/// Our own MAC, fetched once at init rather than per packet
+static uint8_t ourMac[6] = {0};
+
+/// Whether espNowUseSerial() is active. Wired and wireless swadges can't hear each other.
+static bool useWired = false;
+
+/// The broadcast address all packets are sent to
+static struct sockaddr_in broadcastAddr;
+
+/// Ring buffer of packets held back to simulate latency. Latency is constant, so FIFO order is delivery order.
+static espNowDelayedPkt_t delayQueue[ESP_NOW_DELAY_QUEUE_LEN];
+static uint16_t delayHead  = 0;
+static uint16_t delayCount = 0;
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -69,6 +135,12 @@ esp_err_t initEspNow(hostEspNowRecvCb_t recvCb, hostEspNowSendCb_t sendCb, gpio_
     hostEspNowRecvCb = recvCb;
     hostEspNowSendCb = sendCb;
 
+    // Cache our MAC and reset the simulated link
+    esp_wifi_get_mac(WIFI_IF_STA, ourMac);
+    useWired   = false;
+    delayHead  = 0;
+    delayCount = 0;
+
 #if defined(USING_WINDOWS)
     // Initialize Winsock
     WSADATA wsaData;
@@ -127,18 +199,24 @@ esp_err_t initEspNow(hostEspNowRecvCb_t recvCb, hostEspNowSendCb_t sendCb, gpio_
     setsockopt(socketFd, SOL_SOCKET, SO_RCVTIMEO, (const char*)&read_timeout, sizeof(read_timeout));
 
     // Construct bind structure
-    struct sockaddr_in broadcastAddr;                    // Broadcast Address
-    memset(&broadcastAddr, 0, sizeof(broadcastAddr));    // Zero out structure
-    broadcastAddr.sin_family      = AF_INET;             // Internet address family
-    broadcastAddr.sin_addr.s_addr = htonl(INADDR_ANY);   // Any incoming interface
-    broadcastAddr.sin_port        = htons(ESP_NOW_PORT); // Broadcast port
+    struct sockaddr_in bindAddr;                    // Bind Address
+    memset(&bindAddr, 0, sizeof(bindAddr));         // Zero out structure
+    bindAddr.sin_family      = AF_INET;             // Internet address family
+    bindAddr.sin_addr.s_addr = htonl(INADDR_ANY);   // Any incoming interface
+    bindAddr.sin_port        = htons(ESP_NOW_PORT); // Broadcast port
 
     // Bind to the broadcast port
-    if (bind(socketFd, (struct sockaddr*)&broadcastAddr, sizeof(broadcastAddr)) < 0)
+    if (bind(socketFd, (struct sockaddr*)&bindAddr, sizeof(bindAddr)) < 0)
     {
         ESP_LOGE("WIFI", "bind() failed");
         return ESP_ERR_WIFI_IF;
     }
+
+    // Construct the broadcast address once, it's the same for every send
+    memset(&broadcastAddr, 0, sizeof(broadcastAddr));    // Zero out structure
+    broadcastAddr.sin_family      = AF_INET;             // Internet address family
+    broadcastAddr.sin_addr.s_addr = htonl(INADDR_NONE);  // Broadcast IP address  // inet_addr("255.255.255.255");
+    broadcastAddr.sin_port        = htons(ESP_NOW_PORT); // Broadcast port
     return ESP_OK;
 }
 
@@ -147,7 +225,7 @@ esp_err_t initEspNow(hostEspNowRecvCb_t recvCb, hostEspNowSendCb_t sendCb, gpio_
  */
 esp_err_t espNowUseWireless(void)
 {
-    // Do nothing
+    useWired = false;
     return ESP_OK;
 }
 
@@ -159,7 +237,8 @@ esp_err_t espNowUseWireless(void)
  */
 void espNowUseSerial(bool crossoverPins)
 {
-    // Do nothing
+    // There's no real wire, but wired packets are flagged so only other wired emulators hear them
+    useWired = true;
 }
 
 /**
@@ -168,37 +247,144 @@ void espNowUseSerial(bool crossoverPins)
  */
 void checkEspNowRxQueue(void)
 {
-    char recvString[MAXRECVSTRING + 1]; // Buffer for received string
-    int recvStringLen;                  // Length of received string
+#if defined(USING_LINUX)
+    static uint8_t recvBufs[ESP_NOW_RECV_BATCH][MAXRECVSTRING];
+    static struct iovec recvIovs[ESP_NOW_RECV_BATCH];
+    static struct mmsghdr recvMsgs[ESP_NOW_RECV_BATCH];
+
+    int numRecv;
+    do
+    {
+        // (Re)build the message headers, recvmmsg() overwrites msg_len and the lengths
+        memset(recvMsgs, 0, sizeof(recvMsgs));
+        for (int i = 0; i < ESP_NOW_RECV_BATCH; i++)
+        {
+            recvIovs[i].iov_base           = recvBufs[i];
+            recvIovs[i].iov_len            = sizeof(recvBufs[i]);
+            recvMsgs[i].msg_hdr.msg_iov    = &recvIovs[i];
+            recvMsgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        // Pull as many datagrams as are waiting, up to a batch, in one syscall
+        numRecv = recvmmsg(socketFd, recvMsgs, ESP_NOW_RECV_BATCH, MSG_DONTWAIT, NULL);
+        for (int i = 0; i < numRecv; i++)
+        {
+            espNowRecvPacket(recvBufs[i], recvMsgs[i].msg_len);
+        }
+    } while (numRecv == ESP_NOW_RECV_BATCH);
+#else
+    uint8_t recvString[MAXRECVSTRING]; // Buffer for received packet
+    int recvStringLen;                 // Length of received packet
 
     // While we've received a packet
-    while ((recvStringLen = recvfrom(socketFd, recvString, MAXRECVSTRING, 0, NULL, 0)) > 0)
+    while ((recvStringLen = recvfrom(socketFd, (char*)recvString, MAXRECVSTRING, 0, NULL, 0)) > 0)
+    {
+        espNowRecvPacket(recvString, recvStringLen);
+    }
+#endif
+
+    // Deliver any packets whose simulated latency has elapsed
+    espNowDrainDelayQueue();
+}
+
+/**
+ * @brief Validate a packet received from the socket, apply simulated loss and latency, and deliver it
+ *
+ * @param packet The raw packet, including the header
+ * @param packetLen The length of the raw packet
+ */
+static void espNowRecvPacket(const uint8_t* packet, int packetLen)
+{
+    const espNowEmuHdr_t* hdr = (const espNowEmuHdr_t*)packet;
+    int dataLen               = packetLen - (int)sizeof(espNowEmuHdr_t);
+
+    // Make sure the packet matches the ESP_NOW format
+    if (dataLen < 0 || dataLen > ESP_NOW_EMU_MAX_DATA || ESP_NOW_EMU_MAGIC != hdr->magic)
     {
-        // If the packet matches the ESP_NOW format
-        uint8_t recvMac[6] = {0};
-        if (6
-            == sscanf(recvString, "ESP_NOW-%02hhX%02hhX%02hhX%02hhX%02hhX%02hhX-", &recvMac[0], &recvMac[1],
-                      &recvMac[2], &recvMac[3], &recvMac[4], &recvMac[5]))
+        return;
+    }
+
+    // Wired and wireless swadges can't hear each other
+    if (useWired != (0 != (hdr->flags & ESP_NOW_EMU_FLAG_WIRED)))
+    {
+        return;
+    }
+
+    // Make sure the MAC differs from our own
+    if (0 == memcmp(hdr->mac, ourMac, sizeof(ourMac)))
+    {
+        return;
+    }
+
+    // Simulate packet loss
+    if (emulatorArgs.espNowLoss && (esp_random() % 100) < emulatorArgs.espNowLoss)
+    {
+        return;
+    }
+
+    if (emulatorArgs.espNowLatency)
+    {
+        // Simulate latency by holding the packet back. If the queue is full, the packet is lost.
+        if (delayCount < ESP_NOW_DELAY_QUEUE_LEN)
         {
-            // Make sure the MAC differs from our own
-            uint8_t ourMac[6] = {0};
-            esp_wifi_get_mac(WIFI_IF_STA, ourMac);
-            if (0 != memcmp(recvMac, ourMac, sizeof(ourMac)))
-            {
-                // Set up the receive info
-                esp_now_recv_info_t espNowInfo = {0};
-                espNowInfo.src_addr            = recvMac;
-                espNowInfo.des_addr            = ourMac;
-
-                wifi_pkt_rx_ctrl_t packetRxCtrl = {0};
-                packetRxCtrl.rssi               = 0x7F;
-                espNowInfo.rx_ctrl              = &packetRxCtrl;
-
-                // If it does, send it to the application through the callback
-                hostEspNowRecvCb(&espNowInfo, (uint8_t*)&recvString[21], recvStringLen - 21, packetRxCtrl.rssi);
-            }
+            espNowDelayedPkt_t* pkt = &delayQueue[(delayHead + delayCount) % ESP_NOW_DELAY_QUEUE_LEN];
+            pkt->deliverAt          = esp_timer_get_time() + (int64_t)emulatorArgs.espNowLatency * 1000;
+            pkt->len                = dataLen;
+            memcpy(pkt->mac, hdr->mac, sizeof(pkt->mac));
+            memcpy(pkt->data, &packet[sizeof(espNowEmuHdr_t)], dataLen);
+            delayCount++;
         }
     }
+    else
+    {
+        espNowDeliver(hdr->mac, &packet[sizeof(espNowEmuHdr_t)], dataLen);
+    }
+}
+
+/**
+ * @brief Deliver all packets held back for latency simulation whose delivery time has passed
+ */
+static void espNowDrainDelayQueue(void)
+{
+    if (0 == delayCount)
+    {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+    while (delayCount && delayQueue[delayHead].deliverAt <= now)
+    {
+        espNowDelayedPkt_t* pkt = &delayQueue[delayHead];
+        delayHead               = (delayHead + 1) % ESP_NOW_DELAY_QUEUE_LEN;
+        delayCount--;
+
+        // The slot isn't reused until after the callback returns
+        espNowDeliver(pkt->mac, pkt->data, pkt->len);
+    }
+}
+
+/**
+ * @brief Send a received packet to the application through the callback
+ *
+ * @param srcMac The sender's MAC address
+ * @param data The payload
+ * @param len The length of the payload
+ */
+static void espNowDeliver(const uint8_t* srcMac, const uint8_t* data, uint8_t len)
+{
+    // Set up the receive info, which wants a mutable source address
+    uint8_t srcAddr[6];
+    memcpy(srcAddr, srcMac, sizeof(srcAddr));
+
+    esp_now_recv_info_t espNowInfo = {0};
+    espNowInfo.src_addr            = srcAddr;
+    espNowInfo.des_addr            = ourMac;
+
+    wifi_pkt_rx_ctrl_t packetRxCtrl = {0};
+    packetRxCtrl.rssi               = emulatorArgs.espNowRssi;
+    espNowInfo.rx_ctrl              = &packetRxCtrl;
+
+    hostEspNowRecvCb(&espNowInfo, data, len, packetRxCtrl.rssi);
 }
 
 /**
@@ -210,33 +396,49 @@ void checkEspNowRxQueue(void)
  */
 void espNowSend(const char* data, uint8_t dataLen)
 {
-    struct sockaddr_in broadcastAddr; // Broadcast address
-
-    // Construct local address structure
-    memset(&broadcastAddr, 0, sizeof(broadcastAddr));    // Zero out structure
-    broadcastAddr.sin_family      = AF_INET;             // Internet address family
-    broadcastAddr.sin_addr.s_addr = htonl(INADDR_NONE);  // Broadcast IP address  // inet_addr("255.255.255.255");
-    broadcastAddr.sin_port        = htons(ESP_NOW_PORT); // Broadcast port
-
-    // Tack on ESP-NOW header and randomized MAC address
-    char espNowPacket[dataLen + 24];
-    uint8_t mac[6] = {0};
-    esp_wifi_get_mac(WIFI_IF_STA, mac);
-    sprintf(espNowPacket, "ESP_NOW-%02X%02X%02X%02X%02X%02X-", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
-    int hdrLen = strlen(espNowPacket);
-    memcpy(&espNowPacket[hdrLen], data, dataLen);
+    // Tack on the binary ESP-NOW header with our MAC address
+    espNowEmuHdr_t hdr = {
+        .magic = ESP_NOW_EMU_MAGIC,
+        .flags = useWired ? ESP_NOW_EMU_FLAG_WIRED : 0,
+    };
+    memcpy(hdr.mac, ourMac, sizeof(hdr.mac));
+    int pktLen = sizeof(hdr) + dataLen;
 
     // For the callback
     uint8_t bcastMac[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
+    // Real ESP-NOW refuses packets which are too long, so refuse them here too rather than letting receivers drop them
+    if (dataLen > ESP_NOW_EMU_MAX_DATA)
+    {
+        ESP_LOGE("WIFI", "Packet is %d bytes, more than the %d byte limit", dataLen, ESP_NOW_EMU_MAX_DATA);
+        hostEspNowSendCb(bcastMac, ESP_NOW_SEND_FAIL);
+        return;
+    }
+
     errno = 0;
     // Send the packet
-    int sentLen
-        = sendto(socketFd, espNowPacket, hdrLen + dataLen, 0, (struct sockaddr*)&broadcastAddr, sizeof(broadcastAddr));
-    if (sentLen != (hdrLen + dataLen))
+#if defined(USING_WINDOWS)
+    char espNowPacket[sizeof(espNowEmuHdr_t) + 255];
+    memcpy(espNowPacket, &hdr, sizeof(hdr));
+    memcpy(&espNowPacket[sizeof(hdr)], data, dataLen);
+    int sentLen = sendto(socketFd, espNowPacket, pktLen, 0, (struct sockaddr*)&broadcastAddr, sizeof(broadcastAddr));
+#else
+    // Gather the header and payload without copying them together
+    struct iovec iov[2] = {
+        {.iov_base = &hdr, .iov_len = sizeof(hdr)},
+        {.iov_base = (void*)(uintptr_t)data, .iov_len = dataLen},
+    };
+    struct msghdr msg = {
+        .msg_name    = &broadcastAddr,
+        .msg_namelen = sizeof(broadcastAddr),
+        .msg_iov     = iov,
+        .msg_iovlen  = 2,
+    };
+    int sentLen = sendmsg(socketFd, &msg, 0);
+#endif
+    if (sentLen != pktLen)
     {
-        ESP_LOGE("WIFI", "sendto() sent a different number of bytes than expected: %d, not %d", sentLen,
-                 hdrLen + dataLen);
+        ESP_LOGE("WIFI", "sendto() sent a different number of bytes than expected: %d, not %d", sentLen, pktLen);
         if (errno != 0)
         {
             ESP_LOGE("WIFI", "errno was: %d", errno);
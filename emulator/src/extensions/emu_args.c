@@ -3,7 +3,9 @@
 //==============================================================================
 
 // Includes mostly for getopt
+#include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 #include <stdint.h>
@@ -32,6 +34,9 @@
 ///< The column to start wrapped usage lines at
 #define HELP_USAGE_COL 12
 
+///< The longest ESP-NOW latency which can be simulated, in milliseconds
+#define ESP_NOW_MAX_LATENCY_MS 60000
+
 //==============================================================================
 // Structs
 //==============================================================================
@@ -110,6 +115,10 @@ emuArgs_t emulatorArgs = {
 
     .recordFile = NULL,
     .replayFile = NULL,
+
+    .espNowLoss    = 0,
+    .espNowLatency = 0,
+    .espNowRssi    = 0x7F,
 };
 
 static const char mainDoc[] = "Emulates a swadge";
@@ -125,12 +134,15 @@ static const char argFuzzMotion[]  = "fuzz-motion";
 static const char argHeadless[]    = "headless";
 static const char argHideLeds[]    = "hide-leds";
 static const char argKeymap[]      = "keymap";
+static const char argLatency[]     = "espnow-latency";
 static const char argLock[]        = "lock";
+static const char argLoss[]        = "espnow-loss";
 static const char argMode[]        = "mode";
 static const char argModeSwitch[]  = "mode-switch";
 static const char argModeList[]    = "modes-list";
 static const char argPlayback[]    = "playback";
 static const char argRecord[]      = "record";
+static const char argRssi[]        = "espnow-rssi";
 static const char argTouch[]       = "touch";
 static const char argHelp[]        = "help";
 static const char argUsage[]       = "usage";
@@ -149,10 +161,13 @@ static const struct option options[] =
     { argHeadless,    no_argument,       (int*)&emulatorArgs.headless,     true },
     { argHideLeds,    no_argument,       (int*)&emulatorArgs.hideLeds,     true },
     { argKeymap,      required_argument, NULL,                             'k'  },
+    { argLatency,     required_argument, NULL,                             0    },
     { argLock,        no_argument,       (int*)&emulatorArgs.lock,         true },
+    { argLoss,        required_argument, NULL,                             0    },
     { argMode,        required_argument, NULL,                             'm'  },
     { argPlayback,    required_argument, (int*)&emulatorArgs.playback,     'p'  },
     { argRecord,      optional_argument, (int*)&emulatorArgs.record,       'r'  },
+    { argRssi,        required_argument, NULL,                             0    },
     { argModeSwitch,  optional_argument, NULL,                             10   },
     { argModeList,    no_argument,       NULL,                             0    },
     { argTouch,       no_argument,       (int*)&emulatorArgs.emulateTouch, true },
@@ -174,12 +189,15 @@ static const optDoc_t argDocs[] =
     { 0,  argHeadless,    NULL,    "Runs the emulator without a window." },
     { 0,  argHideLeds,    NULL,    "Don't draw simulated LEDs next to the display" },
     {'k', argKeymap,     "LAYOUT", "Use an alternative keymap. LAYOUT can be azerty, colemak, or dvorak"},
+    { 0,  argLatency,     "MS",    "Delay each received ESP-NOW packet by MS milliseconds, up to 60000" },
     {'l', argLock,        NULL,    "Lock the emulator in the start mode" },
+    { 0,  argLoss,        "PCT",   "Drop PCT percent of received ESP-NOW packets, from 0 to 100" },
     {'m', argMode,        "MODE",  "Start the emulator in the swadge mode MODE instead of the main menu"},
     { 0,  argModeSwitch,  "TIME",  "Enable or set the timer to switch modes automatically" },
     { 0,  argModeList,    NULL,    "Print out a list of all possible values for MODE" },
     {'p', argPlayback,    "FILE",  "Play back recorded emulator inputs from a file" },
     {'r', argRecord,      "FILE",  "Record emulator inputs to a file" },
+    { 0,  argRssi,        "DBM",   "Report DBM as the RSSI of received ESP-NOW packets, from -128 to 127" },
     {'t', argTouch,       NULL,    "Simulate touch sensor readings with a virtual touchpad" },
     {'h', argHelp,        NULL,    "Give this help list" },
     { 0,  argUsage,       NULL,    "Give a short usage message" },
@@ -286,6 +304,47 @@ static bool handleArgument(const char* optName, const char* arg, int optVal)
             emulatorArgs.modeSwitchTime = optVal;
         }
     }
+    else if (argLatency == optName || argLoss == optName || argRssi == optName)
+    {
+        long min = 0;
+        long max = 100;
+        if (argLatency == optName)
+        {
+            max = ESP_NOW_MAX_LATENCY_MS;
+        }
+        else if (argRssi == optName)
+        {
+            min = INT8_MIN;
+            max = INT8_MAX;
+        }
+
+        char* end;
+        errno    = 0;
+        long val = strtol(arg, &end, 10);
+        if (errno || end == arg || *end != '\0')
+        {
+            printf("ERR: Invalid integer value '%s'\n", arg);
+            return false;
+        }
+        if (val < min || val > max)
+        {
+            printf("ERR: Value %ld for %s must be between %ld and %ld\n", val, optName, min, max);
+            return false;
+        }
+
+        if (argLatency == optName)
+        {
+            emulatorArgs.espNowLatency = val;
+        }
+        else if (argLoss == optName)
+        {
+            emulatorArgs.espNowLoss = val;
+        }
+        else
+        {
+            emulatorArgs.espNowRssi = val;
+        }
+    }
     else if (argRecord == optName)
     {
         if (emulatorArgs.playback)
@@ -61,6 +61,17 @@ typedef struct
 
     /// @brief Name of the file to replay inputs from
     const char* replayFile;
+
+    // ESP-NOW Simulation
+
+    /// @brief Percentage of received ESP-NOW packets to drop, 0 to 100
+    uint8_t espNowLoss;
+
+    /// @brief Milliseconds to delay each received ESP-NOW packet by
+    uint32_t espNowLatency;
+
+    /// @brief The RSSI reported for each received ESP-NOW packet
+    int8_t espNowRssi;
 } emuArgs_t;
 
 //==============================================================================
@@ -254,13 +254,11 @@ void check_esp_timer(uint64_t elapsed_us)
 
         if (timerExpired)
         {
+            // Reset the timer if periodic, or stop it if one-shot. This is done before calling the callback so that
+            // the callback may restart the timer
+            tmr->alarm = tmr->period;
             // Call the callback
             tmr->callback(tmr->arg);
-            // Reset the timer if periodic
-            if (tmr->period)
-            {
-                tmr->alarm = tmr->period;
-            }
         }
     }
 }
\ No newline at end of file
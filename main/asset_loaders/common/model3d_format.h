@@ -0,0 +1,73 @@
+/*! \file model3d_format.h
+ *
+ * \section model3d_format_design Design Philosophy
+ *
+ * This is the layout of `.mdl` files, which are 3D models converted from `.obj` files by the spiffs_file_preprocessor.
+ * It is shared by the preprocessor, which writes it, and spiffs_model.c, which reads it.
+ *
+ * Everything is precomputed so a `.mdl` file can be used in place once it's read into RAM. All values are little
+ * endian, and every section starts on a four byte boundary. A file is:
+ *
+ * \code{.unparsed}
+ * model3dHeader_t
+ * model3dPartDesc_t, one per part
+ * for each part:
+ *   tdModel, followed by its indices and vertices
+ *   int16_t normals[nrfaces][3], for triangle parts only
+ *   uint16_t edges[nrEdges][2]
+ * \endcode
+ *
+ * All offsets are in bytes from the start of the file.
+ */
+
+#ifndef _MODEL3D_FORMAT_H_
+#define _MODEL3D_FORMAT_H_
+
+#include <stdint.h>
+
+/// The first four bytes of every `.mdl` file
+#define MODEL3D_MAGIC "imdl"
+
+/// The version of the `.mdl` layout. Files with any other version are rejected
+#define MODEL3D_VERSION 1
+
+/// The length of a unit face normal
+#define MODEL3D_NORMAL_ONE 16384
+
+/**
+ * @brief One part of a model, which is drawn with either triangles or lines
+ */
+typedef struct
+{
+    uint16_t nrvertnums;             ///< The number of vertex coordinates, three per vertex
+    uint16_t nrfaces;                ///< The number of triangles or lines
+    uint16_t indices_per_face;       ///< 3 for triangles, 2 for lines
+    int16_t center[3];               ///< The center of the part's bounding box
+    int16_t radius;                  ///< The radius of a sphere around center which holds every vertex
+    uint16_t label;                  ///< The number after LABEL in the part's `o` line, or 0
+    int16_t indices_and_vertices[0]; ///< Indices, which are vertex numbers times 3, followed by vertices
+} tdModel;
+
+/**
+ * @brief The header at the start of a `.mdl` file
+ */
+typedef struct
+{
+    char magic[4];    ///< MODEL3D_MAGIC
+    uint16_t version; ///< MODEL3D_VERSION
+    uint16_t nrParts; ///< The number of model3dPartDesc_t which follow
+} model3dHeader_t;
+
+/**
+ * @brief Where to find one part of a model, and its precomputed data
+ */
+typedef struct
+{
+    uint32_t model;    ///< The offset of the part's tdModel
+    uint32_t normals;  ///< The offset of the part's face normals, or 0 for parts made of lines
+    uint32_t edges;    ///< The offset of the part's edges
+    uint16_t nrEdges;  ///< The number of edges
+    uint16_t reserved; ///< Zero
+} model3dPartDesc_t;
+
+#endif
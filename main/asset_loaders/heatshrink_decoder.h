@@ -82,7 +82,7 @@ void heatshrink_decoder_reset(heatshrink_decoder* hsd);
 
 /* Sink at most SIZE bytes from IN_BUF into the decoder. *INPUT_SIZE is set to
  * indicate how many bytes were actually sunk (in case a buffer was filled). */
-HSD_sink_res heatshrink_decoder_sink(heatshrink_decoder* hsd, uint8_t* in_buf, size_t size, size_t* input_size);
+HSD_sink_res heatshrink_decoder_sink(heatshrink_decoder* hsd, const uint8_t* in_buf, size_t size, size_t* input_size);
 
 /* Poll for output from the decoder, copying at most OUT_BUF_SIZE bytes into
  * OUT_BUF (setting *OUTPUT_SIZE to the actual amount copied). */
@@ -165,6 +165,78 @@ uint8_t* readHeatshrinkNvs(const char* namespace, const char* key, uint32_t* out
     return decompressedBuf;
 }
 
+/**
+ * @brief Decompress a buffer which was compressed with heatshrinkCompress()
+ *
+ * @param dest     The buffer to write the decompressed data to
+ * @param destSize The size of the destination buffer. Any decompressed data which doesn't fit is dropped
+ * @param src      The compressed data, starting with the four byte decompressed size
+ * @param size     The length of the compressed data
+ * @return The number of bytes written to dest, or 0 if there was a failure
+ */
+uint32_t heatshrinkDecompress(uint8_t* dest, uint32_t destSize, const uint8_t* src, uint32_t size)
+{
+    if (size < 4)
+    {
+        return 0;
+    }
+
+    // Pick out the decompressed size and clip it to the destination
+    uint32_t outsize = (src[0] << 24) | (src[1] << 16) | (src[2] << 8) | (src[3]);
+    if (outsize > destSize)
+    {
+        outsize = destSize;
+    }
+
+    // Create the decoder
+    size_t copied           = 0;
+    heatshrink_decoder* hsd = heatshrink_decoder_alloc(256, 8, 4);
+    if (NULL == hsd)
+    {
+        return 0;
+    }
+    heatshrink_decoder_reset(hsd);
+
+    // The decompressed size is four bytes, so start after that
+    uint32_t inputIdx  = 4;
+    uint32_t outputIdx = 0;
+    // Decode the buffer in chunks
+    while (inputIdx < size)
+    {
+        // Decode some data
+        copied = 0;
+        heatshrink_decoder_sink(hsd, &src[inputIdx], size - inputIdx, &copied);
+        inputIdx += copied;
+
+        if (copied == 0)
+        {
+            ESP_LOGE("Heatshrink", "Fault on decode");
+            heatshrink_decoder_finish(hsd);
+            heatshrink_decoder_free(hsd);
+            return 0;
+        }
+
+        // Save it to the output array
+        copied = 0;
+        heatshrink_decoder_poll(hsd, &dest[outputIdx], outsize - outputIdx, &copied);
+        outputIdx += copied;
+    }
+
+    // Note that it's all done
+    heatshrink_decoder_finish(hsd);
+
+    // Flush any final output
+    copied = 0;
+    heatshrink_decoder_poll(hsd, &dest[outputIdx], outsize - outputIdx, &copied);
+    outputIdx += copied;
+
+    // All done decoding
+    heatshrink_decoder_finish(hsd);
+    heatshrink_decoder_free(hsd);
+
+    return outputIdx;
+}
+
 uint32_t heatshrinkCompress(uint8_t* dest, const uint8_t* src, uint32_t size)
 {
     heatshrink_encoder* hse = heatshrink_encoder_alloc(8, 4);
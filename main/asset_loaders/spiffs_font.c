@@ -77,6 +77,9 @@ bool loadFont(const char* name, font_t* font, bool spiRam)
         font->chars[chIdx++].width = 0;
     }
 
+    // Glyphs are only expanded on request, see cacheFontGlyphs()
+    font->glyphCache = NULL;
+
     // Free the SPIFFS data
     free(buf);
 
@@ -98,4 +101,6 @@ void freeFont(font_t* font)
             free(font->chars[idx].bitmap);
         }
     }
+
+    freeFontGlyphs(font);
 }
@@ -0,0 +1,171 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <esp_log.h>
+
+#include "hdw-spiffs.h"
+#include "spiffs_model.h"
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static bool modelSectionFits(uint32_t offset, uint32_t len, size_t sz);
+static bool modelIndexValid(int32_t idx, uint16_t nrvertnums);
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Load a model from ROM to RAM. OBJs placed in the assets folder before compilation will be automatically
+ * converted and flashed to ROM
+ *
+ * The file is used in place, so this only checks the header, where each part is and that every index names a vertex
+ * of its part. It never touches the vertices.
+ *
+ * @param name The filename of the model to load, ending in `.mdl`
+ * @param model A handle to load the model to
+ * @param spiRam true to load to SPI RAM, false to load to normal RAM. SPI RAM is more plentiful but slower to access
+ * than normal RAM
+ * @return true if the model was loaded successfully,
+ *         false if the model load failed and should not be used
+ */
+bool loadModel(const char* name, model3d_t* model, bool spiRam)
+{
+    memset(model, 0, sizeof(model3d_t));
+
+    size_t sz;
+    uint8_t* buf = spiffsReadFile(name, &sz, spiRam);
+    if (NULL == buf)
+    {
+        ESP_LOGE("MDL", "Failed to read %s", name);
+        return false;
+    }
+
+    const model3dHeader_t* header = (const model3dHeader_t*)buf;
+    if (sz < sizeof(model3dHeader_t) || memcmp(header->magic, MODEL3D_MAGIC, sizeof(header->magic))
+        || MODEL3D_VERSION != header->version
+        || !modelSectionFits(sizeof(model3dHeader_t), header->nrParts * sizeof(model3dPartDesc_t), sz))
+    {
+        ESP_LOGE("MDL", "%s is not a version %d model", name, MODEL3D_VERSION);
+        free(buf);
+        return false;
+    }
+
+    model3dPart_t* parts = malloc(sizeof(model3dPart_t) * header->nrParts);
+    if (NULL == parts)
+    {
+        free(buf);
+        return false;
+    }
+
+    const model3dPartDesc_t* descs = (const model3dPartDesc_t*)(buf + sizeof(model3dHeader_t));
+    for (uint16_t i = 0; i < header->nrParts; i++)
+    {
+        const model3dPartDesc_t* desc = &descs[i];
+
+        // Sections are used in place, so each must be aligned for the fields in it
+        if (desc->model % 4 || desc->normals % 4 || desc->edges % 4)
+        {
+            ESP_LOGE("MDL", "Part %d of %s is misaligned", i, name);
+            free(parts);
+            free(buf);
+            return false;
+        }
+
+        // Make sure each section is within the file, so a bad file can't make anyone read past the end of it
+        bool fits = modelSectionFits(desc->model, sizeof(tdModel), sz);
+        if (fits)
+        {
+            const tdModel* m = (const tdModel*)(buf + desc->model);
+            uint32_t nrInts  = m->nrfaces * m->indices_per_face + m->nrvertnums;
+            fits = modelSectionFits(desc->model, sizeof(tdModel) + sizeof(int16_t) * nrInts, sz)
+                   && (0 == desc->normals || modelSectionFits(desc->normals, sizeof(int16_t) * 3 * m->nrfaces, sz))
+                   && modelSectionFits(desc->edges, sizeof(uint16_t) * 2 * desc->nrEdges, sz);
+        }
+
+        if (!fits)
+        {
+            ESP_LOGE("MDL", "Part %d of %s is truncated", i, name);
+            free(parts);
+            free(buf);
+            return false;
+        }
+
+        // Then make sure every face and edge names a vertex of the part, so drawing can't read past its vertices
+        const tdModel* m = (const tdModel*)(buf + desc->model);
+        bool valid       = (2 == m->indices_per_face || 3 == m->indices_per_face);
+        for (uint32_t j = 0; valid && j < (uint32_t)m->nrfaces * m->indices_per_face; j++)
+        {
+            valid = modelIndexValid(m->indices_and_vertices[j], m->nrvertnums);
+        }
+
+        const uint16_t* edges = (const uint16_t*)(buf + desc->edges);
+        for (uint32_t j = 0; valid && j < 2 * (uint32_t)desc->nrEdges; j++)
+        {
+            valid = modelIndexValid(edges[j], m->nrvertnums);
+        }
+
+        if (!valid)
+        {
+            ESP_LOGE("MDL", "Part %d of %s has a bad index", i, name);
+            free(parts);
+            free(buf);
+            return false;
+        }
+
+        parts[i].model   = (const tdModel*)(buf + desc->model);
+        parts[i].normals = desc->normals ? (const int16_t*)(buf + desc->normals) : NULL;
+        parts[i].edges   = (const uint16_t*)(buf + desc->edges);
+        parts[i].nrEdges = desc->nrEdges;
+    }
+
+    model->data    = buf;
+    model->nrParts = header->nrParts;
+    model->parts   = parts;
+    return true;
+}
+
+/**
+ * @brief Free a loaded model
+ *
+ * @param model The model to free
+ */
+void freeModel(model3d_t* model)
+{
+    free(model->parts);
+    free(model->data);
+    memset(model, 0, sizeof(model3d_t));
+}
+
+/**
+ * @brief Check if a section of a model file is within the file
+ *
+ * @param offset The offset of the section
+ * @param len The length of the section
+ * @param sz The size of the file
+ * @return true if the whole section is within the file
+ */
+static bool modelSectionFits(uint32_t offset, uint32_t len, size_t sz)
+{
+    return offset <= sz && len <= sz - offset;
+}
+
+/**
+ * @brief Check if an index names a vertex of a part. Indices are vertex numbers times 3
+ *
+ * @param idx The index to check
+ * @param nrvertnums The number of vertex coordinates in the part
+ * @return true if the index is the first coordinate of one of the part's vertices
+ */
+static bool modelIndexValid(int32_t idx, uint16_t nrvertnums)
+{
+    return 0 <= idx && idx < nrvertnums && 0 == idx % 3;
+}
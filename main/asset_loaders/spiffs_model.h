@@ -0,0 +1,71 @@
+/*! \file spiffs_model.h
+ *
+ * \section spiffs_model_design Design Philosophy
+ *
+ * These functions load and free 3D models which are compiled into the SPIFFS filesystem into RAM. Models are
+ * converted from `.obj` files by the spiffs_file_preprocessor into `.mdl` files, which have centers, radii, face
+ * normals and edge lists precomputed. Once read into RAM a model is used in place, so loading doesn't touch any
+ * vertices. See model3d_format.h for the file layout.
+ *
+ * Each `o` in the `.obj` file becomes one part of the model. A part is drawn with either triangles or lines, and may
+ * be labelled by putting `LABEL` and a number in its name.
+ *
+ * For information on asset processing, see <a
+ * href="https://github.com/AEFeinstein/Super-2024-Swadge-FW/tree/main/tools/spiffs_file_preprocessor">spiffs_file_preprocessor</a>.
+ *
+ * \section spiffs_model_usage Usage
+ *
+ * Load models from SPIFFS to RAM using loadModel(). Models may be loaded to normal RAM, which is smaller and faster,
+ * or SPI RAM, which is larger and slower.
+ *
+ * Free when done using freeModel(). If a model is not freed, the memory will leak.
+ *
+ * \section spiffs_model_example Example
+ *
+ * \code{.c}
+ * // Declare and load a model
+ * model3d_t level;
+ * loadModel("3denv.mdl", &level, true);
+ * // Do something with each part
+ * for (uint16_t i = 0; i < level.nrParts; i++)
+ * {
+ *     drawPart(level.parts[i].model);
+ * }
+ * // Free the model
+ * freeModel(&level);
+ * \endcode
+ */
+
+#ifndef _SPIFFS_MODEL_H_
+#define _SPIFFS_MODEL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "model3d_format.h"
+
+/**
+ * @brief One part of a loaded model, and its precomputed data
+ */
+typedef struct
+{
+    const tdModel* model;   ///< The part's triangles or lines and vertices
+    const int16_t* normals; ///< Face normals of length MODEL3D_NORMAL_ONE, three values per triangle. NULL for lines
+    const uint16_t* edges;  ///< Each edge once, as pairs of indices in the same units as the model's indices
+    uint16_t nrEdges;       ///< The number of edges
+} model3dPart_t;
+
+/**
+ * @brief A loaded model
+ */
+typedef struct
+{
+    uint8_t* data;        ///< The contents of the `.mdl` file, which the parts point into
+    uint16_t nrParts;     ///< The number of parts
+    model3dPart_t* parts; ///< The parts, in the order they were in the `.obj` file
+} model3d_t;
+
+bool loadModel(const char* name, model3d_t* model, bool spiRam);
+void freeModel(model3d_t* model);
+
+#endif
@@ -15,10 +15,64 @@
 // Function Prototypes
 //==============================================================================
 
-static void _floodFill(uint16_t x, uint16_t y, paletteColor_t search, paletteColor_t fill, uint16_t xMin, uint16_t yMin,
-                       uint16_t xMax, uint16_t yMax);
-static void _floodFillInner(uint16_t x, uint16_t y, paletteColor_t search, paletteColor_t fill, uint16_t xMin,
-                            uint16_t yMin, uint16_t xMax, uint16_t yMax);
+static inline void _fillRowMasked(paletteColor_t* px, int len, uint32_t cWord, uint32_t mask, int x);
+static void _floodFillPush(int32_t x1, int32_t x2, int32_t y, int32_t dy);
+static void _floodFillSeed(paletteColor_t* px, int32_t stride, int32_t x, int32_t y);
+static void _floodFillSpans(paletteColor_t* px, int32_t stride);
+static bool _floodFillSweep(paletteColor_t* px, int32_t stride);
+static void _floodFillBuffer(paletteColor_t* px, int32_t stride, int32_t x, int32_t y, paletteColor_t col, int32_t xMin,
+                             int32_t yMin, int32_t xMax, int32_t yMax);
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+/// The number of pending spans the flood fill can hold. Overflowing it is handled, it just costs an extra pass
+#define FLOOD_FILL_STACK_SIZE 256
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/// A horizontal run of pixels whose neighbors in the next row still need to be checked by the flood fill
+typedef struct
+{
+    int16_t x1; ///< The leftmost pixel of the span, inclusive
+    int16_t x2; ///< The rightmost pixel of the span, inclusive
+    int16_t y;  ///< The row to check
+    int16_t dy; ///< The direction the fill was moving when the span was pushed, +1 or -1
+} floodFillSpan_t;
+
+/// The state of a flood fill in progress
+typedef struct
+{
+    floodFillSpan_t stack[FLOOD_FILL_STACK_SIZE]; ///< The pending spans
+    uint16_t depth;                               ///< The number of pending spans
+    bool overflowed;                              ///< true if a span was dropped because the stack was full
+    paletteColor_t search;                        ///< The color being replaced
+    paletteColor_t mark;                          ///< The color filled pixels are marked with until the fill is done
+    int32_t xMin, yMin, xMax, yMax;               ///< The bounds of the fill, max exclusive
+    int32_t bbX0, bbY0, bbX1, bbY1;               ///< The bounding box of filled pixels, inclusive
+} floodFillState_t;
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+/**
+ * The ordered dither patterns for shadeDisplayArea(), indexed by shade level and then row parity. Each pattern is a
+ * mask for four pixels, one byte per pixel, where byte N applies to pixels where (x % 4) == N.
+ */
+static const uint32_t shadePatterns[][2] = {
+    {0x00FF00FF, 0x00000000}, ///< 25% faded
+    {0x00FF00FF, 0x000000FF}, ///< 37.5% faded
+    {0x00FF00FF, 0xFF00FF00}, ///< 50% faded
+    {0x00FFFFFF, 0x00FFFFFF}, ///< 62.5% faded
+    {0xFFFFFFFF, 0x00FF00FF}, ///< 75% faded
+};
+
+/// The flood fill's state. This is static to keep the span stack off the task stack
+static floodFillState_t ff;
 
 //==============================================================================
 // Functions
@@ -35,25 +89,33 @@ static void _floodFillInner(uint16_t x, uint16_t y, paletteColor_t search, palet
  */
 void fillDisplayArea(int16_t x1, int16_t y1, int16_t x2, int16_t y2, paletteColor_t c)
 {
-    // Note: int16_t vs int data types tested for speed.
-    // This function has been micro optimized by cnlohr on 2022-09-07,
-    // using gcc version 8.4.0 (crosstool-NG esp-2021r2-patch3)
-
     // Only draw on the display
     int xMin = CLAMP(x1, 0, TFT_WIDTH);
     int xMax = CLAMP(x2, 0, TFT_WIDTH);
     int yMin = CLAMP(y1, 0, TFT_HEIGHT);
     int yMax = CLAMP(y2, 0, TFT_HEIGHT);
 
-    uint32_t dw         = TFT_WIDTH;
-    paletteColor_t* pxs = getPxTftFramebuffer() + yMin * dw + xMin;
+    if (xMin >= xMax || yMin >= yMax)
+    {
+        return;
+    }
+
+    paletteColor_t* pxs = getPxTftFramebuffer() + yMin * TFT_WIDTH + xMin;
     int copyLen         = xMax - xMin;
 
-    // Set each pixel
+    // Full width rows are contiguous, so this covers full screen clears with a single call
+    if (copyLen == TFT_WIDTH)
+    {
+        memset(pxs, c, (yMax - yMin) * TFT_WIDTH);
+        return;
+    }
+
+    // Otherwise write each row a word (four pixels) at a time
+    uint32_t cWord = c * 0x01010101u;
     for (int y = yMin; y < yMax; y++)
     {
-        memset(pxs, c, copyLen);
-        pxs += dw;
+        _fillRowMasked(pxs, copyLen, cWord, 0xFFFFFFFFu, xMin);
+        pxs += TFT_WIDTH;
     }
 }
 
@@ -69,127 +131,100 @@ void fillDisplayArea(int16_t x1, int16_t y1, int16_t x2, int16_t y2, paletteColo
  */
 void shadeDisplayArea(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t shadeLevel, paletteColor_t color)
 {
-    SETUP_FOR_TURBO();
-    int16_t xMin, yMin, xMax, yMax;
-    if (x1 < x2)
-    {
-        xMin = x1;
-        xMax = x2;
-    }
-    else
-    {
-        xMin = x2;
-        xMax = x1;
-    }
-    if (y1 < y2)
-    {
-        yMin = y1;
-        yMax = y2;
-    }
-    else
-    {
-        yMin = y2;
-        yMax = y1;
-    }
-
-    if (xMin < 0)
-    {
-        xMin = 0;
-    }
-    if (xMax >= (int16_t)TFT_WIDTH)
-    {
-        xMax = TFT_WIDTH - 1;
-    }
-    if (xMin >= (int16_t)TFT_WIDTH)
+    if (shadeLevel >= ARRAY_SIZE(shadePatterns))
     {
         return;
     }
-    if (xMax < 0)
+
+    int16_t xMin = MIN(x1, x2);
+    int16_t xMax = MAX(x1, x2);
+    int16_t yMin = MIN(y1, y2);
+    int16_t yMax = MAX(y1, y2);
+
+    // X is drawn up to, but not including, xMax. Y is drawn up to and including yMax
+    xMin = MAX(xMin, 0);
+    xMax = MIN(xMax, TFT_WIDTH - 1);
+    yMin = MAX(yMin, 0);
+    yMax = MIN(yMax, TFT_HEIGHT - 1);
+
+    if (xMin >= xMax || yMin > yMax)
     {
         return;
     }
-    if (yMin < 0)
+
+    paletteColor_t* pxs = getPxTftFramebuffer() + yMin * TFT_WIDTH + xMin;
+    int copyLen         = xMax - xMin;
+    uint32_t cWord      = color * 0x01010101u;
+
+    for (int16_t dy = yMin; dy <= yMax; dy++)
     {
-        yMin = 0;
+        _fillRowMasked(pxs, copyLen, cWord, shadePatterns[shadeLevel][dy % 2], xMin);
+        pxs += TFT_WIDTH;
     }
-    if (yMax >= (int16_t)TFT_HEIGHT)
+}
+
+/**
+ * @brief Write a color to a row of pixels a word at a time, only where a repeating four pixel mask is set
+ *
+ * Pixels before the first word boundary and after the last one are written individually.
+ *
+ * @param px The first pixel in the row to write
+ * @param len The number of pixels to write
+ * @param cWord The color to write, repeated in all four bytes
+ * @param mask The mask, one byte per pixel. Byte N applies to pixels where (x % 4) == N
+ * @param x The X coordinate of the first pixel, which lines the mask up with the screen
+ */
+static inline void _fillRowMasked(paletteColor_t* px, int len, uint32_t cWord, uint32_t mask, int x)
+{
+    // Leading pixels before the first word boundary
+    while (len > 0 && ((uintptr_t)px & 3))
     {
-        yMax = TFT_HEIGHT - 1;
+        if (mask & (0xFFu << (8 * (x & 3))))
+        {
+            *px = (paletteColor_t)cWord;
+        }
+        px++;
+        x++;
+        len--;
     }
-    if (yMin >= (int16_t)TFT_HEIGHT)
+
+    // Rotate the mask so byte 0 lines up with the pixel at the word boundary
+    uint8_t rot       = 8 * (x & 3);
+    uint32_t wordMask = rot ? ((mask >> rot) | (mask << (32 - rot))) : mask;
+
+    // px is word aligned here
+    uintptr_t wordAddr = (uintptr_t)px;
+    uint32_t* words    = (uint32_t*)wordAddr;
+    int numWords       = len / 4;
+    if (0xFFFFFFFFu == wordMask)
     {
-        return;
+        for (int i = 0; i < numWords; i++)
+        {
+            words[i] = cWord;
+        }
     }
-    if (yMax < 0)
+    else if (wordMask)
     {
-        return;
+        uint32_t colorBits = cWord & wordMask;
+        for (int i = 0; i < numWords; i++)
+        {
+            words[i] = (words[i] & ~wordMask) | colorBits;
+        }
     }
+    px += numWords * 4;
+    x += numWords * 4;
+    len -= numWords * 4;
 
-    for (int16_t dy = yMin; dy <= yMax; dy++)
+    // Trailing pixels after the last word boundary
+    while (len > 0)
     {
-        for (int16_t dx = xMin; dx < xMax; dx++)
+        if (mask & (0xFFu << (8 * (x & 3))))
         {
-            switch (shadeLevel)
-            {
-                case 0:
-                {
-                    // 25% faded
-                    if (dy % 2 == 0 && dx % 2 == 0)
-                    {
-                        TURBO_SET_PIXEL_BOUNDS(dx, dy, color);
-                    }
-                    break;
-                }
-                case 1:
-                {
-                    // 37.5% faded
-                    if (dy % 2 == 0 && dx % 2 == 0)
-                    {
-                        TURBO_SET_PIXEL_BOUNDS(dx, dy, color);
-                    }
-                    else if (dx % 4 == 0)
-                    {
-                        TURBO_SET_PIXEL_BOUNDS(dx, dy, color);
-                    }
-                    break;
-                }
-                case 2:
-                {
-                    // 50% faded
-                    if ((dy % 2) == (dx % 2))
-                    {
-                        TURBO_SET_PIXEL_BOUNDS(dx, dy, color);
-                    }
-                    break;
-                }
-                case 3:
-                {
-                    // 62.5% faded
-                    if (dy % 2 == 0 && dx % 2 == 0)
-                    {
-                        TURBO_SET_PIXEL_BOUNDS(dx, dy, color);
-                    }
-                    else if (dx % 4 < 3)
-                    {
-                        TURBO_SET_PIXEL_BOUNDS(dx, dy, color);
-                    }
-                    break;
-                }
-                case 4:
-                {
-                    // 75% faded
-                    if (dy % 2 == 0 || dx % 2 == 0)
-                    {
-                        TURBO_SET_PIXEL_BOUNDS(dx, dy, color);
-                    }
-                    break;
-                }
-                default:
-                {
-                    return;
-                }
-            }
+            *px = (paletteColor_t)cWord;
         }
+        px++;
+        x++;
+        len--;
     }
 }
 
@@ -296,174 +331,280 @@ void oddEvenFill(int x0, int y0, int x1, int y1, paletteColor_t boundaryColor, p
 }
 
 /**
- * This is a recursive flood fill algorithm. It starts at the given coordinate, and will replace the color at
+ * @brief Fill a contiguous area of the display. This starts at the given coordinate, and will replace the color at
  * that coordinate, and all adjacent pixels with the same color, with the fill color.
  *
  * The flood is also bounded wthin the given rectangle.
  *
- * Note that the recursive algorithm is relatively slow and uses a lot of stack memory, so try not to use it when
- * possible.
- *
- * This is adapted from http://www.adammil.net/blog/v126_A_More_Efficient_Flood_Fill.html
+ * This is a scanline flood fill which works on whole rows of the framebuffer at a time. Pending rows are kept on a
+ * fixed-size stack rather than the call stack, so the fill uses a constant amount of memory no matter how complex the
+ * area is.
  *
  * @param x The X coordinate to start the fill at
  * @param y The Y coordinate to start the fill at
  * @param col The color to fill in
- * @param xMin The minimum X coordinate to bound the fill
- * @param yMin The minimum Y coordinate to bound the fill
- * @param xMax The maximum X coordinate to bound the fill
- * @param yMax The maximum Y coordinate to bound the fill
+ * @param xMin The minimum X coordinate to bound the fill, inclusive
+ * @param yMin The minimum Y coordinate to bound the fill, inclusive
+ * @param xMax The maximum X coordinate to bound the fill, exclusive
+ * @param yMax The maximum Y coordinate to bound the fill, exclusive
  */
 void floodFill(uint16_t x, uint16_t y, paletteColor_t col, uint16_t xMin, uint16_t yMin, uint16_t xMax, uint16_t yMax)
 {
-    if (getPxTft(x, y) == col)
-    {
-        // makes no sense to fill with the same color, so just don't
-        return;
-    }
-
-    _floodFill(x, y, getPxTft(x, y), col, xMin, yMin, xMax, yMax);
+    _floodFillBuffer(getPxTftFramebuffer(), TFT_WIDTH, x, y, col, xMin, yMin, MIN(xMax, TFT_WIDTH),
+                     MIN(yMax, TFT_HEIGHT));
 }
 
 /**
- * A helper function for floodFill(), a recursive flood fill algorithm. These two functions do basically the same thing
- * except this one accepts two colors, the color to replace and the color to replace with.
+ * @brief Fill a contiguous area of an off-screen image, such as a canvas. This works just like floodFill(), but on a
+ * row-major pixel buffer instead of the display
  *
+ * @param px The pixels of the image
+ * @param stride The number of pixels in each row of the image
  * @param x The X coordinate to start the fill at
  * @param y The Y coordinate to start the fill at
- * @param search The color to replace
- * @param fill The color to draw
- * @param xMin The minimum X coordinate to bound the fill
- * @param yMin The minimum Y coordinate to bound the fill
- * @param xMax The maximum X coordinate to bound the fill
- * @param yMax The maximum Y coordinate to bound the fill
+ * @param col The color to fill in
+ * @param xMin The minimum X coordinate to bound the fill, inclusive
+ * @param yMin The minimum Y coordinate to bound the fill, inclusive
+ * @param xMax The maximum X coordinate to bound the fill, exclusive. Must be no more than stride
+ * @param yMax The maximum Y coordinate to bound the fill, exclusive. Must be no more than the image height
  */
-static void _floodFill(uint16_t x, uint16_t y, paletteColor_t search, paletteColor_t fill, uint16_t xMin, uint16_t yMin,
-                       uint16_t xMax, uint16_t yMax)
+void floodFillArea(paletteColor_t* px, uint16_t stride, uint16_t x, uint16_t y, paletteColor_t col, uint16_t xMin,
+                   uint16_t yMin, uint16_t xMax, uint16_t yMax)
 {
-    // at this point, we know array[y,x] is clear, and we want to move as far as possible to the upper-left. moving
-    // up is much more important than moving left, so we could try to make this smarter by sometimes moving to
-    // the right if doing so would allow us to move further up, but it doesn't seem worth the complexity
-    while (true)
-    {
-        uint16_t ox = x, oy = y;
-        while (y != yMin && getPxTft(x, y - 1) == search)
-        {
-            y--;
-        }
-        while (x != xMin && getPxTft(x - 1, y) == search)
-        {
-            x--;
-        }
-        if (x == ox && y == oy)
-        {
-            break;
-        }
-    }
-    _floodFillInner(x, y, search, fill, xMin, yMin, xMax, yMax);
+    _floodFillBuffer(px, stride, x, y, col, xMin, yMin, MIN(xMax, stride), yMax);
 }
 
 /**
- * A helper function for floodFill() and _floodFillInner(), a recursive flood fill algorithm. This does the heavy
- * lifting for the algorithm.
+ * @brief Flood fill a row-major pixel buffer
  *
+ * Filled pixels are first marked with ::cTransparent, which never appears in a finished image, so they can be told
+ * apart from pixels which were already the fill color. If the stack overflows, the dropped spans are found again by
+ * sweeping for unfilled pixels next to marked ones. Once the fill is done, marked pixels are set to the fill color.
+ *
+ * @param px The pixels to fill
+ * @param stride The number of pixels in each row
  * @param x The X coordinate to start the fill at
  * @param y The Y coordinate to start the fill at
- * @param search The color to replace
- * @param fill The color to draw
- * @param xMin The minimum X coordinate to bound the fill
- * @param yMin The minimum Y coordinate to bound the fill
- * @param xMax The maximum X coordinate to bound the fill
- * @param yMax The maximum Y coordinate to bound the fill
+ * @param col The color to fill in
+ * @param xMin The minimum X coordinate to bound the fill, inclusive
+ * @param yMin The minimum Y coordinate to bound the fill, inclusive
+ * @param xMax The maximum X coordinate to bound the fill, exclusive
+ * @param yMax The maximum Y coordinate to bound the fill, exclusive
  */
-static void _floodFillInner(uint16_t x, uint16_t y, paletteColor_t search, paletteColor_t fill, uint16_t xMin,
-                            uint16_t yMin, uint16_t xMax, uint16_t yMax)
+static void _floodFillBuffer(paletteColor_t* px, int32_t stride, int32_t x, int32_t y, paletteColor_t col, int32_t xMin,
+                             int32_t yMin, int32_t xMax, int32_t yMax)
 {
-    // at this point, we know that array[y,x] is clear, and array[y-1,x] and array[y,x-1] are set.
-    // we'll begin scanning down and to the right, attempting to fill an entire rectangular block
-    uint16_t lastRowLength = 0; // the number of cells that were clear in the last row we scanned
-    do
+    if (x < xMin || x >= xMax || y < yMin || y >= yMax)
+    {
+        return;
+    }
+
+    paletteColor_t search = px[y * stride + x];
+    if (search == col)
     {
-        uint16_t rowLength = 0,
-                 sx        = x; // keep track of how long this row is. sx is the starting x for the main scan below
-        // now we want to handle a case like |***|, where we fill 3 cells in the first row and then after we move to
-        // the second row we find the first  | **| cell is filled, ending our rectangular scan. rather than handling
-        // this via the recursion below, we'll increase the starting value of 'x' and reduce the last row length to
-        // match. then we'll continue trying to set the narrower rectangular block
-        if (lastRowLength != 0
-            && getPxTft(x, y) != search) // if this is not the first row and the leftmost cell is filled...
+        // makes no sense to fill with the same color, so just don't
+        return;
+    }
+
+    ff.search = search;
+    // If the area being filled is somehow transparent, mark with the fill color instead. A stack overflow may then
+    // fill a little too much, but that's the best that can be done
+    ff.mark       = (cTransparent == search) ? col : cTransparent;
+    ff.xMin       = xMin;
+    ff.yMin       = yMin;
+    ff.xMax       = xMax;
+    ff.yMax       = yMax;
+    ff.bbX0       = x;
+    ff.bbY0       = y;
+    ff.bbX1       = x;
+    ff.bbY1       = y;
+    ff.depth      = 0;
+    ff.overflowed = false;
+
+    _floodFillSeed(px, stride, x, y);
+    _floodFillSpans(px, stride);
+
+    // Pick up anything that was dropped. Each sweep fills at least one more pixel, so this ends
+    while (ff.overflowed && _floodFillSweep(px, stride))
+    {
+        _floodFillSpans(px, stride);
+    }
+
+    // Turn the marked pixels into the fill color
+    if (ff.mark != col)
+    {
+        for (int32_t row = ff.bbY0; row <= ff.bbY1; row++)
         {
-            do
+            paletteColor_t* pxRow = &px[row * stride];
+            for (int32_t fx = ff.bbX0; fx <= ff.bbX1; fx++)
             {
-                if (--lastRowLength == 0)
+                if (ff.mark == pxRow[fx])
                 {
-                    return; // shorten the row. if it's full, we're done
+                    pxRow[fx] = col;
                 }
-            } while (getPxTft(++x, y) != search); // otherwise, update the starting point of the main scan to match
-            sx = x;
+            }
         }
-        // we also want to handle the opposite case, | **|, where we begin scanning a 2-wide rectangular block and
-        // then find on the next row that it has     |***| gotten wider on the left. again, we could handle this
-        // with recursion but we'd prefer to adjust x and lastRowLength instead
-        else
+    }
+}
+
+/**
+ * @brief Push a span to the flood fill's stack, or note that it was dropped if the stack is full
+ *
+ * @param x1 The leftmost pixel of the span, inclusive
+ * @param x2 The rightmost pixel of the span, inclusive
+ * @param y The row to check
+ * @param dy The direction the fill was moving, +1 or -1
+ */
+static void _floodFillPush(int32_t x1, int32_t x2, int32_t y, int32_t dy)
+{
+    if (y < ff.yMin || y >= ff.yMax)
+    {
+        return;
+    }
+
+    if (ff.depth == FLOOD_FILL_STACK_SIZE)
+    {
+        ff.overflowed = true;
+        return;
+    }
+
+    floodFillSpan_t* span = &ff.stack[ff.depth++];
+    span->x1              = x1;
+    span->x2              = x2;
+    span->y               = y;
+    span->dy              = dy;
+}
+
+/**
+ * @brief Start filling at a pixel, which must be the search color
+ *
+ * @param px The pixels to fill
+ * @param stride The number of pixels in each row
+ * @param x The X coordinate to start at
+ * @param y The Y coordinate to start at
+ */
+static void _floodFillSeed(paletteColor_t* px, int32_t stride, int32_t x, int32_t y)
+{
+    _floodFillPush(x, x, y, 1);
+    _floodFillPush(x, x, y - 1, -1);
+}
+
+/**
+ * @brief Fill spans until the flood fill's stack is empty
+ *
+ * This is the combined scan-and-fill span algorithm. Each span popped off the stack is a range of a row which may
+ * contain pixels to fill. Every run of fillable pixels touching it is filled, extended as far left and right as it
+ * goes, and the rows above and below it are pushed. Only the parts of the row behind the fill which weren't already
+ * covered by the parent span need to be pushed.
+ *
+ * @param px The pixels to fill
+ * @param stride The number of pixels in each row
+ */
+static void _floodFillSpans(paletteColor_t* px, int32_t stride)
+{
+    while (ff.depth > 0)
+    {
+        floodFillSpan_t span = ff.stack[--ff.depth];
+        int32_t x1           = span.x1;
+        int32_t x2           = span.x2;
+        int32_t y            = span.y;
+        int32_t dy           = span.dy;
+
+        paletteColor_t* row = &px[y * stride];
+        int32_t x           = x1;
+
+        // Extend left from the start of the span
+        if (row[x] == ff.search)
         {
-            for (; x != xMin && getPxTft(x - 1, y) == search; rowLength++, lastRowLength++)
+            while (x > ff.xMin && row[x - 1] == ff.search)
             {
-                setPxTft(--x, y, fill); // to avoid scanning the cells twice, we'll fill them and update rowLength here
-                // if there's something above the new starting point, handle that recursively. this deals with cases
-                // like |* **| when we begin filling from (2,0), move down to (2,1), and then move left to (0,1).
-                // the  |****| main scan assumes the portion of the previous row from x to x+lastRowLength has already
-                // been filled. adjusting x and lastRowLength breaks that assumption in this case, so we must fix it
-                if (y != yMin && getPxTft(x, y - 1) == search)
-                {
-                    _floodFill(x, y - 1, search, fill, xMin, yMin, xMax,
-                               yMax); // use _Fill since there may be more up and left
-                }
+                x--;
+            }
+            if (x < x1)
+            {
+                memset(&row[x], ff.mark, x1 - x);
+                _floodFillPush(x, x1 - 1, y - dy, -dy);
             }
         }
 
-        // now at this point we can begin to scan the current row in the rectangular block. the span of the previous
-        // row from x (inclusive) to x+lastRowLength (exclusive) has already been filled, so we don't need to
-        // check it. so scan across to the right in the current row
-        for (; sx < xMax && getPxTft(sx, y) == search; rowLength++, sx++)
+        while (x1 <= x2)
         {
-            setPxTft(sx, y, fill);
-        }
-        // now we've scanned this row. if the block is rectangular, then the previous row has already been scanned,
-        // so we don't need to look upwards and we're going to scan the next row in the next iteration so we don't
-        // need to look downwards. however, if the block is not rectangular, we may need to look upwards or rightwards
-        // for some portion of the row. if this row was shorter than the last row, we may need to look rightwards near
-        // the end, as in the case of |*****|, where the first row is 5 cells long and the second row is 3 cells long.
-        // we must look to the right  |*** *| of the single cell at the end of the second row, i.e. at (4,1)
-        if (rowLength < lastRowLength)
-        {
-            for (int end = x + lastRowLength;
-                 ++sx < end;) // 'end' is the end of the previous row, so scan the current row to
-            {                 // there. any clear cells would have been connected to the previous
-                if (getPxTft(sx, y) == search)
+            // Fill the run starting at x1
+            int32_t runEnd = x1;
+            while (runEnd < ff.xMax && row[runEnd] == ff.search)
+            {
+                runEnd++;
+            }
+            if (runEnd > x1)
+            {
+                memset(&row[x1], ff.mark, runEnd - x1);
+                x1 = runEnd;
+            }
+
+            if (x1 > x)
+            {
+                ff.bbX0 = MIN(ff.bbX0, x);
+                ff.bbX1 = MAX(ff.bbX1, x1 - 1);
+                ff.bbY0 = MIN(ff.bbY0, y);
+                ff.bbY1 = MAX(ff.bbY1, y);
+
+                _floodFillPush(x, x1 - 1, y + dy, dy);
+                // Look back where the run went past the end of the parent span
+                if (x1 - 1 > x2)
                 {
-                    _floodFillInner(sx, y, search, fill, xMin, yMin, xMax,
-                                    yMax); // row. the cells up and left must be set so use FillCore
+                    _floodFillPush(x2 + 1, x1 - 1, y - dy, -dy);
                 }
             }
+
+            // Skip to the next fillable pixel in the span
+            x1++;
+            while (x1 < x2 && row[x1] != ff.search)
+            {
+                x1++;
+            }
+            x = x1;
         }
-        // alternately, if this row is longer than the previous row, as in the case |*** *| then we must look above
-        // the end of the row, i.e at (4,0)                                         |*****|
-        else if (rowLength > lastRowLength && y != yMin) // if this row is longer and we're not already at the top...
+    }
+}
+
+/**
+ * @brief After the stack overflowed, find pixels of the search color touching marked pixels and seed the fill there
+ *
+ * Fills always cover whole horizontal runs, so a missed pixel can only be directly above or below a marked one.
+ *
+ * @param px The pixels to fill
+ * @param stride The number of pixels in each row
+ * @return true if any seeds were pushed
+ */
+static bool _floodFillSweep(paletteColor_t* px, int32_t stride)
+{
+    ff.overflowed = false;
+
+    int32_t yFrom = MAX(ff.bbY0 - 1, ff.yMin);
+    int32_t yTo   = MIN(ff.bbY1 + 1, ff.yMax - 1);
+    for (int32_t y = yFrom; y <= yTo; y++)
+    {
+        const paletteColor_t* row   = &px[y * stride];
+        const paletteColor_t* above = (y > ff.yMin) ? &px[(y - 1) * stride] : NULL;
+        const paletteColor_t* below = (y < ff.yMax - 1) ? &px[(y + 1) * stride] : NULL;
+
+        for (int32_t x = ff.bbX0; x <= ff.bbX1; x++)
         {
-            for (int ux = x + lastRowLength; ++ux < sx;) // sx is the end of the current row
+            if (row[x] == ff.search && ((above && above[x] == ff.mark) || (below && below[x] == ff.mark)))
             {
-                if (getPxTft(ux, y - 1) == search)
+                _floodFillSeed(px, stride, x, y);
+                if (ff.depth == FLOOD_FILL_STACK_SIZE)
                 {
-                    _floodFill(ux, y - 1, search, fill, xMin, yMin, xMax,
-                               yMax); // since there may be clear cells up and left, use _Fill
+                    // No room for more seeds. Fill these, then sweep again
+                    ff.overflowed = true;
+                    return true;
                 }
             }
         }
-        lastRowLength = rowLength;              // record the new row length
-    } while (lastRowLength != 0 && ++y < yMax); // if we get to a full row or to the bottom, we're done
-}
+    }
 
+    return ff.depth > 0;
+}
 /**
  * @brief Helper function to draw a filled circle with translation and scaling
  *
@@ -15,9 +15,11 @@
  * href="https://en.wikipedia.org/wiki/Even%E2%80%93odd_rule">Even–odd rule</a>. It may not work in all cases, but if it
  * does work, it is preferrable to use.
  *
- * floodFill() is a less efficient way to fill areas using the <a href="https://en.wikipedia.org/wiki/Flood_fill">Flood
- * fill</a> recursive algorithm. It produces better results than oddEvenFill(), but is considerably slower and uses far
- * more stack memory.
+ * floodFill() fills areas using a scanline <a href="https://en.wikipedia.org/wiki/Flood_fill">Flood fill</a>. It
+ * produces better results than oddEvenFill(), but is slower. It works on whole framebuffer rows and keeps pending rows
+ * on a small fixed-size stack, so it never recurses and its memory use doesn't depend on the shape being filled.
+ *
+ * floodFillArea() is the same flood fill for an off-screen image, like a canvas, rather than the display.
  *
  * \section fill_example Example
  *
@@ -55,6 +57,8 @@ void fillDisplayArea(int16_t x1, int16_t y1, int16_t x2, int16_t y2, paletteColo
 void shadeDisplayArea(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t shadeLevel, paletteColor_t color);
 void oddEvenFill(int x0, int y0, int x1, int y1, paletteColor_t boundaryColor, paletteColor_t fillColor);
 void floodFill(uint16_t x, uint16_t y, paletteColor_t col, uint16_t xMin, uint16_t yMin, uint16_t xMax, uint16_t yMax);
+void floodFillArea(paletteColor_t* px, uint16_t stride, uint16_t x, uint16_t y, paletteColor_t col, uint16_t xMin,
+                   uint16_t yMin, uint16_t xMax, uint16_t yMax);
 void fillCircleSector(uint16_t x, uint16_t y, uint16_t innerR, uint16_t outerR, uint16_t startAngle, uint16_t endAngle,
                       paletteColor_t col);
 
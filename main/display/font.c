@@ -2,10 +2,22 @@
 // Includes
 //==============================================================================
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "hdw-tft.h"
 #include "font.h"
+#include "macros.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+/// The number of word wrapped text layouts to remember
+#define TEXT_LAYOUT_CACHE_SIZE 8
+
+/// The most drawn pieces of text a cached layout can hold. Longer layouts aren't cached
+#define TEXT_LAYOUT_MAX_SEGMENTS 24
 
 //==============================================================================
 // Enums
@@ -17,12 +29,61 @@
 /// @brief Flag for drawTexTWordWrapFlags() to measure the text without drawing
 #define TEXT_MEASURE 1
 
+//==============================================================================
+// Structs
+//==============================================================================
+
+/// A piece of word wrapped text which was drawn on one line
+typedef struct
+{
+    uint16_t start; ///< The index in the text of the first char
+    uint8_t len;    ///< The number of chars
+    int16_t x;      ///< The X coordinate the text was drawn at
+    int16_t y;      ///< The Y coordinate the text was drawn at
+} textSegment_t;
+
+/// The result of word wrapping a string, and everything it depends on
+typedef struct
+{
+    const font_t* font;                                ///< The font the text was laid out in, or NULL if unused
+    uint32_t hash;                                     ///< A hash of the text
+    char* text;                                        ///< A copy of the text, to tell texts with the same hash apart
+    uint16_t textLen;                                  ///< The length of the text
+    int16_t xOff;                                      ///< The X coordinate the text started at
+    int16_t yOff;                                      ///< The Y coordinate the text started at
+    int16_t xMax;                                      ///< The maximum X coordinate
+    int16_t yMax;                                      ///< The maximum Y coordinate
+    uint16_t flags;                                    ///< TEXT_DRAW or TEXT_MEASURE
+    int16_t xEnd;                                      ///< The X coordinate the text ended at
+    int16_t yEnd;                                      ///< The Y coordinate the last line was drawn at
+    int32_t remaining;                                 ///< The index of the first undrawn char, or -1 if all drawn
+    uint8_t numSegments;                               ///< The number of segments drawn
+    textSegment_t segments[TEXT_LAYOUT_MAX_SEGMENTS];  ///< The pieces of text drawn
+    uint32_t lastUse;                                  ///< When this layout was last used, for eviction
+} textLayout_t;
+
 //==============================================================================
 // Static Function Declarations
 //==============================================================================
 
+static void drawCharRuns(paletteColor_t color, const font_t* font, const font_ch_t* ch, int16_t xOff, int16_t yOff);
+static int16_t drawTextLen(const font_t* font, paletteColor_t color, const char* text, uint16_t len, int16_t xOff,
+                           int16_t yOff);
 static const char* drawTextWordWrapFlags(const font_t* font, paletteColor_t color, const char* text, int16_t* xOff,
                                          int16_t* yOff, int16_t xMax, int16_t yMax, uint16_t flags);
+static const char* layoutTextWordWrap(const font_t* font, paletteColor_t color, const char* text, int16_t* xOff,
+                                      int16_t* yOff, int16_t xMax, int16_t yMax, uint16_t flags, textLayout_t* layout);
+static inline bool fontGlyphBit(const font_ch_t* ch, int x, int y);
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+/// Recently word wrapped text
+static textLayout_t textLayouts[TEXT_LAYOUT_CACHE_SIZE];
+
+/// Incremented each time a text layout is used
+static uint32_t textLayoutClock;
 
 //==============================================================================
 // Functions
@@ -134,28 +195,83 @@ void drawChar(paletteColor_t color, int h, const font_ch_t* ch, int16_t xOff, in
 }
 
 /**
- * @brief Draw text to a display with the given color and font
+ * @brief Draw a single character from a font's glyph cache to a display. This draws exactly the same pixels as
+ * drawChar(), but as runs rather than bit by bit
+ *
+ * @param color The color of the character to draw
+ * @param font  The font to draw from, which must have a glyph cache
+ * @param ch    The character to draw
+ * @param xOff  The x offset to draw the char at
+ * @param yOff  The y offset to draw the char at
+ */
+static void drawCharRuns(paletteColor_t color, const font_t* font, const font_ch_t* ch, int16_t xOff, int16_t yOff)
+{
+    // Do not draw transparent chars
+    if (cTransparent == color)
+    {
+        return;
+    }
+
+    const uint8_t* runs      = &font->glyphCache->runs[font->glyphCache->offsets[ch - font->chars]];
+    paletteColor_t* pxOutput = getPxTftFramebuffer() + (yOff * TFT_WIDTH);
+
+    for (int y = yOff; y < yOff + font->height && y < TFT_HEIGHT; y++, pxOutput += TFT_WIDTH)
+    {
+        uint8_t numRuns = *runs++;
+
+        // Skip rows above the display
+        if (y < 0)
+        {
+            runs += 2 * numRuns;
+            continue;
+        }
+
+        for (; numRuns; numRuns--, runs += 2)
+        {
+            int16_t startX = MAX(xOff + runs[0], 0);
+            int16_t endX   = MIN(xOff + runs[0] + runs[1], TFT_WIDTH);
+            if (startX < endX)
+            {
+                memset(&pxOutput[startX], color, endX - startX);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Draw at most some number of characters of text to a display
  *
  * @param font  The font to use for the text
  * @param color The color of the character to draw
  * @param text  The text to draw to the display
+ * @param len   The most characters to draw. Drawing also stops at the end of the string
  * @param xOff  The x offset to draw the text at
  * @param yOff  The y offset to draw the text at
  * @return The x offset at the end of the drawn string
  */
-int16_t drawText(const font_t* font, paletteColor_t color, const char* text, int16_t xOff, int16_t yOff)
+static int16_t drawTextLen(const font_t* font, paletteColor_t color, const char* text, uint16_t len, int16_t xOff,
+                           int16_t yOff)
 {
-    while (*text >= ' ')
+    for (; len && *text >= ' '; len--)
     {
+        const font_ch_t* ch = &font->chars[(*text) - ' '];
+
         // Only draw if the char is on the screen
-        if (xOff + font->chars[(*text) - ' '].width >= 0)
+        if (xOff + ch->width >= 0)
         {
             // Draw char
-            drawChar(color, font->height, &font->chars[(*text) - ' '], xOff, yOff);
+            if (font->glyphCache)
+            {
+                drawCharRuns(color, font, ch, xOff, yOff);
+            }
+            else
+            {
+                drawChar(color, font->height, ch, xOff, yOff);
+            }
         }
 
         // Move to the next char
-        xOff += (font->chars[(*text) - ' '].width + 1);
+        xOff += (ch->width + 1);
         text++;
 
         // If this char is offscreen, finish drawing
@@ -167,6 +283,21 @@ int16_t drawText(const font_t* font, paletteColor_t color, const char* text, int
     return xOff;
 }
 
+/**
+ * @brief Draw text to a display with the given color and font
+ *
+ * @param font  The font to use for the text
+ * @param color The color of the character to draw
+ * @param text  The text to draw to the display
+ * @param xOff  The x offset to draw the text at
+ * @param yOff  The y offset to draw the text at
+ * @return The x offset at the end of the drawn string
+ */
+int16_t drawText(const font_t* font, paletteColor_t color, const char* text, int16_t xOff, int16_t yOff)
+{
+    return drawTextLen(font, color, text, UINT16_MAX, xOff, yOff);
+}
+
 /**
  * @brief Return the pixel width of some text in a given font
  *
@@ -193,13 +324,41 @@ uint16_t textWidth(const font_t* font, const char* text)
     return width;
 }
 
-static const char* drawTextWordWrapFlags(const font_t* font, paletteColor_t color, const char* text, int16_t* xOff,
-                                         int16_t* yOff, int16_t xMax, int16_t yMax, uint16_t flags)
+/**
+ * @brief Get the width of a string from the sum of its characters' widths plus one, as textWidth() would return it
+ *
+ * @param rawWidth The sum of each character's width plus one
+ * @return The width of the text
+ */
+static inline int16_t rawTextWidth(uint16_t rawWidth)
+{
+    // Delete trailing space
+    return (0 < rawWidth) ? (rawWidth - 1) : 0;
+}
+
+/**
+ * @brief Lay out and draw word wrapped text. See drawTextWordWrap()
+ *
+ * @param font The font to use when drawing the text
+ * @param color The color of the text to be drawn
+ * @param text The text to be pointed, as a null-terminated string
+ * @param xOff The X-coordinate to begin drawing the text at, written with the X-coordinate the text ended at
+ * @param yOff The Y-coordinate to begin drawing the text at, written with the Y-coordinate of the last line
+ * @param xMax The maximum x-coordinate at which any text may be drawn
+ * @param yMax The maximum y-coordinate at which text may be drawn
+ * @param flags TEXT_DRAW or TEXT_MEASURE
+ * @param layout If not NULL, each piece of text drawn is recorded here. If there are too many, numSegments is set past
+ * TEXT_LAYOUT_MAX_SEGMENTS
+ * @return A pointer to the first unprinted character within `text`, or NULL if all text has been written
+ */
+static const char* layoutTextWordWrap(const font_t* font, paletteColor_t color, const char* text, int16_t* xOff,
+                                      int16_t* yOff, int16_t xMax, int16_t yMax, uint16_t flags, textLayout_t* layout)
 {
     const char* textPtr = text;
     int16_t textX = *xOff, textY = *yOff;
     int nextSpace, nextDash, nextNl;
     int nextBreak;
+    uint16_t rawWidth;
     char buf[64];
 
     // don't dereference that null pointer
@@ -263,13 +422,28 @@ static const char* drawTextWordWrapFlags(const font_t* font, paletteColor_t colo
         // end the string at the break
         buf[nextBreak] = '\0';
 
+        // measure it once, then keep the width up to date as it's shortened
+        rawWidth = 0;
+        for (int i = 0; i < nextBreak; i++)
+        {
+            if (buf[i] >= ' ')
+            {
+                rawWidth += (font->chars[buf[i] - ' '].width + 1);
+            }
+        }
+
         // The text is longer than an entire line, so we must shorten it
-        if (*xOff + textWidth(font, buf) > xMax)
+        if (*xOff + rawTextWidth(rawWidth) > xMax)
         {
             // shorten the text until it fits
-            while (textX + textWidth(font, buf) > xMax && nextBreak > 0)
+            while (textX + rawTextWidth(rawWidth) > xMax && nextBreak > 0)
             {
-                buf[--nextBreak] = '\0';
+                nextBreak--;
+                if (buf[nextBreak] >= ' ')
+                {
+                    rawWidth -= (font->chars[buf[nextBreak] - ' '].width + 1);
+                }
+                buf[nextBreak] = '\0';
             }
         }
 
@@ -277,7 +451,7 @@ static const char* drawTextWordWrapFlags(const font_t* font, paletteColor_t colo
         // Or we shortened it down to nothing. Either way, move to next line.
         // Also, go back to the start of the loop so we don't
         // accidentally overrun the yMax
-        if (textX + textWidth(font, buf) > xMax || nextBreak == 0)
+        if (textX + rawTextWidth(rawWidth) > xMax || nextBreak == 0)
         {
             // The line won't fit
             textY += font->height + 1;
@@ -289,13 +463,27 @@ static const char* drawTextWordWrapFlags(const font_t* font, paletteColor_t colo
         // print the line, and advance the text pointer and offset
         if (!(flags & TEXT_MEASURE) && textY + font->height >= 0 && textY <= TFT_HEIGHT)
         {
-            textX = drawText(font, color, buf, textX, textY);
+            // remember what was drawn where, so it can be drawn again without laying it out
+            if (layout && layout->numSegments < TEXT_LAYOUT_MAX_SEGMENTS)
+            {
+                textSegment_t* seg = &layout->segments[layout->numSegments++];
+                seg->start         = textPtr - text;
+                seg->len           = nextBreak;
+                seg->x             = textX;
+                seg->y             = textY;
+            }
+            else if (layout)
+            {
+                layout->numSegments = TEXT_LAYOUT_MAX_SEGMENTS + 1;
+            }
+
+            textX = drawTextLen(font, color, textPtr, nextBreak, textX, textY);
         }
         else
         {
             // drawText returns the next text position, which is 1px past the last char
             // textWidth returns, well, the text width, so add 1 to account for the last pixel
-            textX += textWidth(font, buf) + 1;
+            textX += rawTextWidth(rawWidth) + 1;
         }
         textPtr += nextBreak;
     }
@@ -306,6 +494,99 @@ static const char* drawTextWordWrapFlags(const font_t* font, paletteColor_t colo
     return *textPtr ? textPtr : NULL;
 }
 
+/**
+ * @brief Draw or measure word wrapped text, reusing the layout from the last time the same text was wrapped the same
+ * way. See drawTextWordWrap()
+ *
+ * @param font The font to use when drawing the text
+ * @param color The color of the text to be drawn
+ * @param text The text to be pointed, as a null-terminated string
+ * @param xOff The X-coordinate to begin drawing the text at, written with the X-coordinate the text ended at
+ * @param yOff The Y-coordinate to begin drawing the text at, written with the Y-coordinate of the last line
+ * @param xMax The maximum x-coordinate at which any text may be drawn
+ * @param yMax The maximum y-coordinate at which text may be drawn
+ * @param flags TEXT_DRAW or TEXT_MEASURE
+ * @return A pointer to the first unprinted character within `text`, or NULL if all text has been written
+ */
+static const char* drawTextWordWrapFlags(const font_t* font, paletteColor_t color, const char* text, int16_t* xOff,
+                                         int16_t* yOff, int16_t xMax, int16_t yMax, uint16_t flags)
+{
+    // don't dereference that null pointer
+    if (text == NULL)
+    {
+        return NULL;
+    }
+
+    // Layouts are found by the text's contents rather than its address, since text is often formatted into a buffer
+    uint32_t hash = 2166136261u;
+    uint32_t len  = 0;
+    for (const char* c = text; *c; c++, len++)
+    {
+        hash = (hash ^ (uint8_t)*c) * 16777619u;
+    }
+
+    textLayout_t* oldest = &textLayouts[0];
+    for (int i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+        textLayout_t* layout = &textLayouts[i];
+        if (layout->font == font && layout->hash == hash && layout->textLen == len && layout->xOff == *xOff
+            && layout->yOff == *yOff && layout->xMax == xMax && layout->yMax == yMax && layout->flags == flags
+            && 0 == memcmp(layout->text, text, len))
+        {
+            // Draw the same pieces of text in the same places as last time
+            layout->lastUse = ++textLayoutClock;
+            for (int s = 0; s < layout->numSegments; s++)
+            {
+                const textSegment_t* seg = &layout->segments[s];
+                drawTextLen(font, color, &text[seg->start], seg->len, seg->x, seg->y);
+            }
+
+            *xOff = layout->xEnd;
+            *yOff = layout->yEnd;
+            return (layout->remaining < 0) ? NULL : &text[layout->remaining];
+        }
+
+        if (layout->lastUse < oldest->lastUse)
+        {
+            oldest = layout;
+        }
+    }
+
+    // Text too long to index isn't cached
+    if (len > UINT16_MAX)
+    {
+        return layoutTextWordWrap(font, color, text, xOff, yOff, xMax, yMax, flags, NULL);
+    }
+
+    // Lay the text out into the least recently used slot
+    textLayout_t* layout = oldest;
+    layout->font         = NULL;
+    layout->numSegments  = 0;
+    layout->xOff         = *xOff;
+    layout->yOff         = *yOff;
+
+    const char* remaining = layoutTextWordWrap(font, color, text, xOff, yOff, xMax, yMax, flags, layout);
+
+    // The text may be in a buffer which is reused, so keep a copy of it to compare against
+    char* copy = (layout->numSegments <= TEXT_LAYOUT_MAX_SEGMENTS) ? realloc(layout->text, len + 1) : NULL;
+    if (NULL != copy)
+    {
+        memcpy(copy, text, len + 1);
+        layout->text      = copy;
+        layout->font      = font;
+        layout->hash      = hash;
+        layout->textLen   = len;
+        layout->xMax      = xMax;
+        layout->yMax      = yMax;
+        layout->flags     = flags;
+        layout->xEnd      = *xOff;
+        layout->yEnd      = *yOff;
+        layout->remaining = remaining ? (remaining - text) : -1;
+        layout->lastUse   = ++textLayoutClock;
+    }
+    return remaining;
+}
+
 /**
  * @brief Draws text, breaking on word boundaries, until the given bounds are filled or all text is drawn.
  *
@@ -346,3 +627,118 @@ uint16_t textWordWrapHeight(const font_t* font, const char* text, int16_t width,
     drawTextWordWrapFlags(font, cTransparent, text, &xEnd, &yEnd, width, maxHeight, TEXT_MEASURE);
     return yEnd + font->height + 1;
 }
+
+/**
+ * @brief Expand a font's glyphs into horizontal runs of pixels, so that text in the font is drawn with fills rather
+ * than decoded bit by bit. This is worth doing for fonts which are drawn a lot. The cache is freed by freeFont()
+ *
+ * @param font The font to cache
+ * @return true if the glyphs were cached, false if there wasn't enough memory
+ */
+bool cacheFontGlyphs(font_t* font)
+{
+    if (font->glyphCache)
+    {
+        return true;
+    }
+
+    fontGlyphCache_t* cache = calloc(1, sizeof(fontGlyphCache_t));
+    if (NULL == cache)
+    {
+        return false;
+    }
+
+    // The first pass counts how much space the runs need, the second writes them
+    for (int pass = 0; pass < 2; pass++)
+    {
+        uint32_t size = 0;
+        for (int c = 0; c < ARRAY_SIZE(font->chars); c++)
+        {
+            const font_ch_t* ch = &font->chars[c];
+            cache->offsets[c]   = size;
+
+            for (int y = 0; y < font->height; y++)
+            {
+                uint32_t countIdx = size++;
+                uint8_t numRuns   = 0;
+
+                for (int x = 0; x < ch->width; x++)
+                {
+                    if (fontGlyphBit(ch, x, y))
+                    {
+                        int start = x;
+                        while (x < ch->width && fontGlyphBit(ch, x, y))
+                        {
+                            x++;
+                        }
+
+                        if (cache->runs)
+                        {
+                            cache->runs[size]     = start;
+                            cache->runs[size + 1] = x - start;
+                        }
+                        size += 2;
+                        numRuns++;
+                    }
+                }
+
+                if (cache->runs)
+                {
+                    cache->runs[countIdx] = numRuns;
+                }
+            }
+        }
+
+        if (NULL == cache->runs)
+        {
+            cache->runs = malloc(size);
+            if (NULL == cache->runs)
+            {
+                free(cache);
+                return false;
+            }
+        }
+    }
+
+    font->glyphCache = cache;
+    return true;
+}
+
+/**
+ * @brief Free a font's glyph cache, if it has one, and forget any text laid out in the font. This is called by
+ * freeFont()
+ *
+ * @param font The font to free the cache of
+ */
+void freeFontGlyphs(font_t* font)
+{
+    if (font->glyphCache)
+    {
+        free(font->glyphCache->runs);
+        free(font->glyphCache);
+        font->glyphCache = NULL;
+    }
+
+    // The font's memory may be reused for another font, so its layouts can't be trusted
+    for (int i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+        if (textLayouts[i].font == font)
+        {
+            textLayouts[i].font = NULL;
+        }
+    }
+}
+
+/**
+ * @brief Check if a pixel of a character's bitmap is set
+ *
+ * @param ch The character
+ * @param x The pixel's X coordinate
+ * @param y The pixel's Y coordinate
+ * @return true if the pixel is set
+ */
+static inline bool fontGlyphBit(const font_ch_t* ch, int x, int y)
+{
+    int bitIdx = y * ch->width + x;
+    return (ch->bitmap[bitIdx >> 3] >> (bitIdx & 7)) & 1;
+}
@@ -27,6 +27,13 @@
  * textWordWrapHeight() is used to measure the height of a word-wrapped text block.
  * There is no function to get the height of text because it is accessible in ::font_t.height.
  *
+ * Fonts which are drawn a lot, like HUD fonts, can have their glyphs pre-expanded with cacheFontGlyphs(). Each row of
+ * each glyph is stored as a list of horizontal runs of pixels, so drawing a character is a handful of short fills
+ * rather than decoding it bit by bit. This costs some RAM per font. The cache is freed by freeFont().
+ *
+ * The line breaks of recently drawn or measured word-wrapped text are cached too, so text which is wrapped the same way
+ * every frame is only laid out once. This is automatic.
+ *
  * \section font_example Example
  *
  * \code{.c}
@@ -44,6 +51,7 @@
 #define _FONT_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "palette.h"
 
@@ -57,6 +65,15 @@ typedef struct
     uint8_t* bitmap; ///< This character's bitmap data
 } font_ch_t;
 
+/**
+ * @brief A font's glyphs expanded into horizontal runs of pixels, so they can be drawn without decoding bits
+ */
+typedef struct
+{
+    uint32_t offsets['~' - ' ' + 2]; ///< The index in runs where each character starts
+    uint8_t* runs;                   ///< For each row of each character, a run count then a (start, length) per run
+} fontGlyphCache_t;
+
 /**
  * @brief A font is a collection of font_ch_t for all ASCII characters. Each character has the same height and variable
  * width.
@@ -65,6 +82,7 @@ typedef struct
 {
     uint8_t height;                 ///< The height of this font. All chars have the same height
     font_ch_t chars['~' - ' ' + 2]; ///< An array of characters, enough space for all printed ASCII chars, and pi
+    fontGlyphCache_t* glyphCache;   ///< The expanded glyphs, or NULL if cacheFontGlyphs() wasn't called
 } font_t;
 
 void drawChar(paletteColor_t color, int h, const font_ch_t* ch, int16_t xOff, int16_t yOff);
@@ -73,5 +91,7 @@ const char* drawTextWordWrap(const font_t* font, paletteColor_t color, const cha
                              int16_t xMax, int16_t yMax);
 uint16_t textWidth(const font_t* font, const char* text);
 uint16_t textWordWrapHeight(const font_t* font, const char* text, int16_t width, int16_t maxHeight);
+bool cacheFontGlyphs(font_t* font);
+void freeFontGlyphs(font_t* font);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,419 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdlib.h>
+#include <string.h>
+#include <esp_heap_caps.h>
+
+#include "hdw-tft.h"
+#include "macros.h"
+#include "tileLayer.h"
+
+//==============================================================================
+// Enums
+//==============================================================================
+
+/// What kind of pixels a slot holds, used to draw transparent layers
+typedef enum
+{
+    TL_EMPTY,   ///< Every pixel is transparent
+    TL_OPAQUE,  ///< No pixel is transparent
+    TL_PARTIAL, ///< Some pixels are transparent
+} tileLayerSlotKind_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static inline int32_t tileLayerWrap(int32_t v, int32_t n);
+static void tileLayerRenderSlot(tileLayer_t* layer, int32_t tx, int32_t ty, bool force);
+static void tileLayerRenderRect(tileLayer_t* layer, int32_t tx0, int32_t ty0, int32_t tx1, int32_t ty1, bool force);
+static void tileLayerBlitOpaque(const tileLayer_t* layer, int32_t offsetX, int32_t offsetY);
+static void tileLayerBlitTransparent(const tileLayer_t* layer, int32_t offsetX, int32_t offsetY);
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Wrap a coordinate into the range [0, n)
+ *
+ * @param v The coordinate, which may be negative
+ * @param n The size of the range
+ * @return The wrapped coordinate
+ */
+static inline int32_t tileLayerWrap(int32_t v, int32_t n)
+{
+    v %= n;
+    return (v < 0) ? v + n : v;
+}
+
+/**
+ * @brief Initialize a tile layer and allocate its memory. The layer starts out transparent
+ *
+ * @param layer The tile layer to initialize
+ * @param viewW The width of the view, in pixels. This is clipped to the display
+ * @param viewH The height of the view, in pixels. This is clipped to the display
+ * @param tileShift The size of a tile, as a power of two
+ * @param lookup A function which looks up the tile at a tile coordinate
+ * @param ctx A context passed to lookup
+ */
+void tileLayerInit(tileLayer_t* layer, uint16_t viewW, uint16_t viewH, uint8_t tileShift, tileLayerLookup_t lookup,
+                   void* ctx)
+{
+    uint16_t tileSize = 1 << tileShift;
+
+    layer->lookup    = lookup;
+    layer->ctx       = ctx;
+    layer->tileShift = tileShift;
+    layer->viewW     = MIN(viewW, TFT_WIDTH);
+    layer->viewH     = MIN(viewH, TFT_HEIGHT);
+
+    // One more tile than fits on screen, since the view is usually not tile aligned
+    layer->slotsW = ((layer->viewW + tileSize - 1) >> tileShift) + 1;
+    layer->slotsH = ((layer->viewH + tileSize - 1) >> tileShift) + 1;
+    layer->pxW    = layer->slotsW << tileShift;
+    layer->pxH    = layer->slotsH << tileShift;
+
+    layer->px    = heap_caps_malloc(layer->pxW * layer->pxH * sizeof(paletteColor_t), MALLOC_CAP_SPIRAM);
+    layer->tags  = malloc(layer->slotsW * layer->slotsH);
+    layer->kinds = malloc(layer->slotsW * layer->slotsH);
+
+    layer->bgColor        = cTransparent;
+    layer->valid          = false;
+    layer->refreshPending = false;
+    layer->tx0            = 0;
+    layer->ty0            = 0;
+}
+
+/**
+ * @brief Free memory allocated by a tile layer
+ *
+ * @param layer The tile layer to deinitialize
+ */
+void tileLayerDeinit(tileLayer_t* layer)
+{
+    free(layer->px);
+    free(layer->tags);
+    free(layer->kinds);
+    layer->px    = NULL;
+    layer->tags  = NULL;
+    layer->kinds = NULL;
+}
+
+/**
+ * @brief Set the color tiles are composited over. Changing it re-renders the whole layer on the next draw
+ *
+ * @param layer The tile layer
+ * @param bgColor The background color, or ::cTransparent for a transparent layer
+ */
+void tileLayerSetBackground(tileLayer_t* layer, paletteColor_t bgColor)
+{
+    if (bgColor != layer->bgColor)
+    {
+        layer->bgColor = bgColor;
+        layer->valid   = false;
+    }
+}
+
+/**
+ * @brief Re-render the whole layer on the next draw. Call this after loading a new map or tileset
+ *
+ * @param layer The tile layer
+ */
+void tileLayerInvalidate(tileLayer_t* layer)
+{
+    layer->valid = false;
+}
+
+/**
+ * @brief Look up every visible tile again on the next draw, re-rendering only the ones which changed. Call this after
+ * an animation frame changes
+ *
+ * @param layer The tile layer
+ */
+void tileLayerRefresh(tileLayer_t* layer)
+{
+    layer->refreshPending = true;
+}
+
+/**
+ * @brief Re-render a single tile if it is in the cached window. Call this after changing a tile
+ *
+ * @param layer The tile layer
+ * @param tx The tile's X coordinate
+ * @param ty The tile's Y coordinate
+ */
+void tileLayerUpdateTile(tileLayer_t* layer, int32_t tx, int32_t ty)
+{
+    // Tiles outside the window are looked up when they scroll into it
+    if (layer->valid && tx >= layer->tx0 && tx < layer->tx0 + layer->slotsW && ty >= layer->ty0
+        && ty < layer->ty0 + layer->slotsH)
+    {
+        tileLayerRenderSlot(layer, tx, ty, false);
+    }
+}
+
+/**
+ * @brief Look up a tile and render it into its slot, if the slot doesn't already hold a tile that looks the same
+ *
+ * @param layer The tile layer
+ * @param tx The tile's X coordinate
+ * @param ty The tile's Y coordinate
+ * @param force true to render the tile even if the slot's tag matches
+ */
+static void tileLayerRenderSlot(tileLayer_t* layer, int32_t tx, int32_t ty, bool force)
+{
+    int32_t sx   = tileLayerWrap(tx, layer->slotsW);
+    int32_t sy   = tileLayerWrap(ty, layer->slotsH);
+    int32_t slot = sy * layer->slotsW + sx;
+
+    uint8_t tag       = 0;
+    const wsg_t* tile = layer->lookup(layer->ctx, tx, ty, &tag);
+
+    if (!force && layer->tags[slot] == tag)
+    {
+        return;
+    }
+    layer->tags[slot] = tag;
+
+    int32_t tileSize    = 1 << layer->tileShift;
+    paletteColor_t* dst = &layer->px[(sy << layer->tileShift) * layer->pxW + (sx << layer->tileShift)];
+
+    if (NULL == tile)
+    {
+        for (int32_t y = 0; y < tileSize; y++)
+        {
+            memset(&dst[y * layer->pxW], layer->bgColor, tileSize);
+        }
+        layer->kinds[slot] = (cTransparent == layer->bgColor) ? TL_EMPTY : TL_OPAQUE;
+        return;
+    }
+
+    // Copy the tile, replacing transparent pixels with the background color
+    int32_t w           = MIN(tile->w, tileSize);
+    int32_t h           = MIN(tile->h, tileSize);
+    bool anyTransparent = (w < tileSize) || (h < tileSize);
+    bool anyOpaque      = false;
+    for (int32_t y = 0; y < tileSize; y++)
+    {
+        paletteColor_t* dstRow = &dst[y * layer->pxW];
+        if (y >= h)
+        {
+            memset(dstRow, layer->bgColor, tileSize);
+            continue;
+        }
+
+        const paletteColor_t* srcRow = &tile->px[y * tile->w];
+        for (int32_t x = 0; x < w; x++)
+        {
+            if (cTransparent == srcRow[x])
+            {
+                dstRow[x]      = layer->bgColor;
+                anyTransparent = true;
+            }
+            else
+            {
+                dstRow[x] = srcRow[x];
+                anyOpaque = true;
+            }
+        }
+        memset(&dstRow[w], layer->bgColor, tileSize - w);
+    }
+
+    if (cTransparent != layer->bgColor || !anyTransparent)
+    {
+        layer->kinds[slot] = TL_OPAQUE;
+    }
+    else
+    {
+        layer->kinds[slot] = anyOpaque ? TL_PARTIAL : TL_EMPTY;
+    }
+}
+
+/**
+ * @brief Render every tile in a rectangle of tile coordinates
+ *
+ * @param layer The tile layer
+ * @param tx0 The first tile column, inclusive
+ * @param ty0 The first tile row, inclusive
+ * @param tx1 The last tile column, exclusive
+ * @param ty1 The last tile row, exclusive
+ * @param force true to render tiles even if their slot's tag matches
+ */
+static void tileLayerRenderRect(tileLayer_t* layer, int32_t tx0, int32_t ty0, int32_t tx1, int32_t ty1, bool force)
+{
+    for (int32_t ty = ty0; ty < ty1; ty++)
+    {
+        for (int32_t tx = tx0; tx < tx1; tx++)
+        {
+            tileLayerRenderSlot(layer, tx, ty, force);
+        }
+    }
+}
+
+/**
+ * @brief Draw a tile layer to the display at (0, 0), rendering any tiles which scrolled into view
+ *
+ * @param layer The tile layer
+ * @param offsetX The X offset of the view into the world, in pixels
+ * @param offsetY The Y offset of the view into the world, in pixels
+ */
+void tileLayerDraw(tileLayer_t* layer, int32_t offsetX, int32_t offsetY)
+{
+    int32_t tx0 = offsetX >> layer->tileShift;
+    int32_t ty0 = offsetY >> layer->tileShift;
+    int32_t dx  = tx0 - layer->tx0;
+    int32_t dy  = ty0 - layer->ty0;
+
+    if (!layer->valid)
+    {
+        // Render everything from scratch
+        tileLayerRenderRect(layer, tx0, ty0, tx0 + layer->slotsW, ty0 + layer->slotsH, true);
+    }
+    else if (layer->refreshPending || ABS(dx) >= layer->slotsW || ABS(dy) >= layer->slotsH)
+    {
+        // Look everything up again, which only renders tiles which changed
+        tileLayerRenderRect(layer, tx0, ty0, tx0 + layer->slotsW, ty0 + layer->slotsH, false);
+    }
+    else
+    {
+        // Only look up the columns and rows which were just exposed
+        if (dx > 0)
+        {
+            tileLayerRenderRect(layer, layer->tx0 + layer->slotsW, ty0, tx0 + layer->slotsW, ty0 + layer->slotsH,
+                                false);
+        }
+        else if (dx < 0)
+        {
+            tileLayerRenderRect(layer, tx0, ty0, layer->tx0, ty0 + layer->slotsH, false);
+        }
+
+        if (dy > 0)
+        {
+            tileLayerRenderRect(layer, tx0, layer->ty0 + layer->slotsH, tx0 + layer->slotsW, ty0 + layer->slotsH,
+                                false);
+        }
+        else if (dy < 0)
+        {
+            tileLayerRenderRect(layer, tx0, ty0, tx0 + layer->slotsW, layer->ty0, false);
+        }
+    }
+
+    layer->valid          = true;
+    layer->refreshPending = false;
+    layer->tx0            = tx0;
+    layer->ty0            = ty0;
+
+    if (cTransparent == layer->bgColor)
+    {
+        tileLayerBlitTransparent(layer, offsetX, offsetY);
+    }
+    else
+    {
+        tileLayerBlitOpaque(layer, offsetX, offsetY);
+    }
+}
+
+/**
+ * @brief Copy an opaque tile layer to the display, one block per row
+ *
+ * @param layer The tile layer
+ * @param offsetX The X offset of the view into the world, in pixels
+ * @param offsetY The Y offset of the view into the world, in pixels
+ */
+static void tileLayerBlitOpaque(const tileLayer_t* layer, int32_t offsetX, int32_t offsetY)
+{
+    paletteColor_t* pxDisp = getPxTftFramebuffer();
+
+    // The view may wrap around the right edge of the ring, so each row is at most two copies
+    int32_t srcX   = tileLayerWrap(offsetX, layer->pxW);
+    int32_t first  = MIN(layer->viewW, layer->pxW - srcX);
+    int32_t second = layer->viewW - first;
+    int32_t srcY   = tileLayerWrap(offsetY, layer->pxH);
+
+    for (int32_t y = 0; y < layer->viewH; y++)
+    {
+        const paletteColor_t* srcRow = &layer->px[srcY * layer->pxW];
+        memcpy(pxDisp, &srcRow[srcX], first);
+        if (second > 0)
+        {
+            memcpy(&pxDisp[first], srcRow, second);
+        }
+
+        pxDisp += TFT_WIDTH;
+        if (++srcY == layer->pxH)
+        {
+            srcY = 0;
+        }
+    }
+}
+
+/**
+ * @brief Copy a transparent tile layer to the display, tile by tile, skipping empty tiles
+ *
+ * @param layer The tile layer
+ * @param offsetX The X offset of the view into the world, in pixels
+ * @param offsetY The Y offset of the view into the world, in pixels
+ */
+static void tileLayerBlitTransparent(const tileLayer_t* layer, int32_t offsetX, int32_t offsetY)
+{
+    paletteColor_t* pxDisp = getPxTftFramebuffer();
+    int32_t tileSize       = 1 << layer->tileShift;
+
+    for (int32_t ty = layer->ty0; ty < layer->ty0 + layer->slotsH; ty++)
+    {
+        int32_t sy    = tileLayerWrap(ty, layer->slotsH);
+        int32_t yOff  = (ty << layer->tileShift) - offsetY;
+        int32_t yFrom = MAX(0, -yOff);
+        int32_t yTo   = MIN(tileSize, layer->viewH - yOff);
+        if (yFrom >= yTo)
+        {
+            continue;
+        }
+
+        for (int32_t tx = layer->tx0; tx < layer->tx0 + layer->slotsW; tx++)
+        {
+            int32_t sx   = tileLayerWrap(tx, layer->slotsW);
+            uint8_t kind = layer->kinds[sy * layer->slotsW + sx];
+            if (TL_EMPTY == kind)
+            {
+                continue;
+            }
+
+            int32_t xOff  = (tx << layer->tileShift) - offsetX;
+            int32_t xFrom = MAX(0, -xOff);
+            int32_t xTo   = MIN(tileSize, layer->viewW - xOff);
+            if (xFrom >= xTo)
+            {
+                continue;
+            }
+
+            const paletteColor_t* src
+                = &layer->px[((sy << layer->tileShift) + yFrom) * layer->pxW + (sx << layer->tileShift) + xFrom];
+            paletteColor_t* dst = &pxDisp[(yOff + yFrom) * TFT_WIDTH + xOff + xFrom];
+            int32_t len         = xTo - xFrom;
+
+            for (int32_t y = yFrom; y < yTo; y++)
+            {
+                if (TL_OPAQUE == kind)
+                {
+                    memcpy(dst, src, len);
+                }
+                else
+                {
+                    for (int32_t x = 0; x < len; x++)
+                    {
+                        if (cTransparent != src[x])
+                        {
+                            dst[x] = src[x];
+                        }
+                    }
+                }
+                src += layer->pxW;
+                dst += TFT_WIDTH;
+            }
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/*! \file tileLayer.h
+ *
+ * \section tileLayer_design Design Philosophy
+ *
+ * A tile layer is a cached, pre-rendered copy of the part of a tilemap which is on screen. Drawing a tilemap tile by
+ * tile means looking up, decoding and clipping every visible tile every frame, even though almost none of them change
+ * from one frame to the next. A tile layer renders each tile once into an off-screen buffer and then copies that
+ * buffer to the display.
+ *
+ * The off-screen buffer holds one screen plus a border of one tile, and is addressed as a ring in both directions. A
+ * world tile at (tx, ty) always lives in the same slot of the ring, so scrolling never moves pixels around. When the
+ * view scrolls, only the rows and columns of tiles which were just exposed are rendered. Each slot remembers which tile
+ * it holds, so a newly exposed tile which looks the same as the one it replaces, like open sky, isn't rendered at all.
+ *
+ * Tiles which change in place must be reported with tileLayerUpdateTile(), and animated tiles with tileLayerRefresh().
+ *
+ * A layer can either be opaque or transparent. An opaque layer composites tiles over a solid background color and
+ * covers the whole view, so it's drawn with one block copy per row and the display doesn't need to be cleared first. A
+ * transparent layer keeps transparent pixels, so whatever was drawn underneath shows through. It's drawn tile by tile,
+ * skipping empty tiles and copying fully opaque tiles row by row.
+ *
+ * \section tileLayer_usage Usage
+ *
+ * Call tileLayerInit() once with the size of the view and a function which looks up the tile at a tile coordinate. The
+ * lookup function returns the image for a tile, or NULL for an empty tile, and a tag. Two tiles with the same tag must
+ * look the same. Usually the tag is the tile ID, including any animation frame. Call tileLayerDeinit() when done.
+ *
+ * Call tileLayerSetBackground() to make a layer opaque, or give it ::cTransparent to make it transparent.
+ *
+ * Call tileLayerDraw() each frame with the view's offset into the world, in pixels.
+ *
+ * Call tileLayerUpdateTile() after changing a tile, tileLayerRefresh() after an animation frame changes, and
+ * tileLayerInvalidate() after loading a new map.
+ *
+ * \section tileLayer_example Example
+ *
+ * \code{.c}
+ * static const wsg_t* lookupTile(void* ctx, int32_t tx, int32_t ty, uint8_t* tag)
+ * {
+ *     map_t* map = ctx;
+ *     *tag       = getTile(map, tx, ty);
+ *     return (*tag == TILE_EMPTY) ? NULL : &map->tiles[*tag];
+ * }
+ *
+ * tileLayer_t layer;
+ * tileLayerInit(&layer, TFT_WIDTH, TFT_HEIGHT, 4, lookupTile, &map);
+ * tileLayerSetBackground(&layer, c335);
+ *
+ * // Once per frame
+ * tileLayerDraw(&layer, map.offsetX, map.offsetY);
+ *
+ * // When a tile changes
+ * setTile(&map, tx, ty, TILE_EMPTY);
+ * tileLayerUpdateTile(&layer, tx, ty);
+ *
+ * tileLayerDeinit(&layer);
+ * \endcode
+ */
+
+#ifndef _TILE_LAYER_H_
+#define _TILE_LAYER_H_
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "palette.h"
+#include "wsg.h"
+
+//==============================================================================
+// Typedefs
+//==============================================================================
+
+/**
+ * @brief A function which looks up the tile at a tile coordinate
+ *
+ * @param ctx The context given to tileLayerInit()
+ * @param tx The tile's X coordinate. This may be outside the map
+ * @param ty The tile's Y coordinate. This may be outside the map
+ * @param tag Written with a value identifying how the tile looks
+ * @return The tile's image, or NULL if the tile is empty
+ */
+typedef const wsg_t* (*tileLayerLookup_t)(void* ctx, int32_t tx, int32_t ty, uint8_t* tag);
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * @brief A cached, pre-rendered tilemap layer
+ */
+typedef struct
+{
+    tileLayerLookup_t lookup; ///< Looks up the tile at a tile coordinate
+    void* ctx;                ///< The context passed to lookup
+
+    uint8_t tileShift; ///< Tiles are (1 << tileShift) pixels on a side
+    uint16_t viewW;    ///< The width of the view, in pixels
+    uint16_t viewH;    ///< The height of the view, in pixels
+    uint16_t slotsW;   ///< The width of the ring buffer, in tiles
+    uint16_t slotsH;   ///< The height of the ring buffer, in tiles
+    uint16_t pxW;      ///< The width of the ring buffer, in pixels
+    uint16_t pxH;      ///< The height of the ring buffer, in pixels
+
+    paletteColor_t* px; ///< The ring buffer of rendered tiles
+    uint8_t* tags;      ///< The tag of the tile rendered in each slot
+    uint8_t* kinds;     ///< Whether each slot is empty, opaque, or partially transparent
+
+    paletteColor_t bgColor; ///< The background color, or cTransparent for a transparent layer
+    bool valid;             ///< false if every slot must be re-rendered on the next draw
+    bool refreshPending;    ///< true if every visible tile must be looked up again on the next draw
+    int32_t tx0;            ///< The X coordinate of the first tile in the cached window
+    int32_t ty0;            ///< The Y coordinate of the first tile in the cached window
+} tileLayer_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+void tileLayerInit(tileLayer_t* layer, uint16_t viewW, uint16_t viewH, uint8_t tileShift, tileLayerLookup_t lookup,
+                   void* ctx);
+void tileLayerDeinit(tileLayer_t* layer);
+void tileLayerSetBackground(tileLayer_t* layer, paletteColor_t bgColor);
+void tileLayerInvalidate(tileLayer_t* layer);
+void tileLayerRefresh(tileLayer_t* layer);
+void tileLayerUpdateTile(tileLayer_t* layer, int32_t tx, int32_t ty);
+void tileLayerDraw(tileLayer_t* layer, int32_t offsetX, int32_t offsetY);
+
+#endif
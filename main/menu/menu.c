@@ -14,11 +14,19 @@
 
 const char* mnuBackStr = "Back";
 
+//==============================================================================
+// Variables
+//==============================================================================
+
+/// The last revision given to a menu. Revisions are never reused, even by menus allocated at the same address
+static uint32_t lastMenuRevision = 0;
+
 //==============================================================================
 // Function Prototypes
 //==============================================================================
 
 static void deinitSubMenu(menu_t* menu);
+static void menuChanged(menu_t* menu);
 
 //==============================================================================
 // Functions
@@ -54,9 +62,20 @@ menu_t* initMenu(const char* title, menuCb cbFunc)
     menu->items       = calloc(1, sizeof(list_t));
     menu->parentMenu  = NULL;
     menu->showBattery = false;
+    menuChanged(menu);
     return menu;
 }
 
+/**
+ * @brief Give a menu a new revision, so renderers know that anything they cached for it is stale
+ *
+ * @param menu The menu which was created or had items added or removed
+ */
+static void menuChanged(menu_t* menu)
+{
+    menu->revision = ++lastMenuRevision;
+}
+
 /**
  * @brief Deinitialize a menu and all connected menus, including submenus and parent
  * menus. This frees memory allocated for this menu, but not memory allocated
@@ -136,6 +155,7 @@ menu_t* startSubMenu(menu_t* menu, const char* label)
     subMenu->currentItem = NULL;
     subMenu->items       = calloc(1, sizeof(list_t));
     subMenu->parentMenu  = menu;
+    menuChanged(subMenu);
 
     // Allocate a new menu item
     menuItem_t* newItem = calloc(1, sizeof(menuItem_t));
@@ -145,6 +165,7 @@ menu_t* startSubMenu(menu_t* menu, const char* label)
     newItem->currentOpt = 0;
     newItem->subMenu    = subMenu;
     push(menu->items, newItem);
+    menuChanged(menu);
 
     // If this is the first item, set it as the current
     if (1 == menu->items->length)
@@ -198,6 +219,7 @@ menuItem_t* addSingleItemToMenu(menu_t* menu, const char* label)
     newItem->currentOpt = 0;
     newItem->subMenu    = NULL;
     push(menu->items, newItem);
+    menuChanged(menu);
 
     // If this is the first item, set it as the current
     if (1 == menu->items->length)
@@ -234,6 +256,7 @@ void removeSingleItemFromMenu(menu_t* menu, const char* label)
                 }
             }
             removeEntry(menu->items, listNode);
+            menuChanged(menu);
             free(item);
             return;
         }
@@ -267,6 +290,7 @@ void addMultiItemToMenu(menu_t* menu, const char* const* labels, uint8_t numLabe
     newItem->currentOpt = currentLabel;
     newItem->subMenu    = NULL;
     push(menu->items, newItem);
+    menuChanged(menu);
 
     // If this is the first item, set it as the current
     if (1 == menu->items->length)
@@ -291,6 +315,7 @@ void removeMultiItemFromMenu(menu_t* menu, const char* const* labels)
         if (item->options == labels)
         {
             removeEntry(menu->items, listNode);
+            menuChanged(menu);
             if (menu->currentItem == listNode)
             {
                 if (NULL != listNode->next)
@@ -333,6 +358,7 @@ void addSettingsItemToMenu(menu_t* menu, const char* label, const settingParam_t
     newItem->maxSetting     = bounds->max;
     newItem->currentSetting = val;
     push(menu->items, newItem);
+    menuChanged(menu);
 
     // If this is the first item, set it as the current
     if (1 == menu->items->length)
@@ -357,6 +383,7 @@ void removeSettingsItemFromMenu(menu_t* menu, const char* label)
         if (item->label == label)
         {
             removeEntry(menu->items, listNode);
+            menuChanged(menu);
             if (menu->currentItem == listNode)
             {
                 if (NULL != listNode->next)
@@ -431,6 +458,7 @@ void addSettingsOptionsItemToMenu(menu_t* menu, const char* settingLabel, const
     }
 
     push(menu->items, newItem);
+    menuChanged(menu);
 
     // If this is the first item, set it as the current
     if (1 == menu->items->length)
@@ -455,6 +483,7 @@ void removeSettingsOptionsItemFromMenu(menu_t* menu, const char* const* optionLa
         if (item->options == optionLabels)
         {
             removeEntry(menu->items, listNode);
+            menuChanged(menu);
             if (menu->currentItem == listNode)
             {
                 if (NULL != listNode->next)
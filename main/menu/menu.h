@@ -182,6 +182,7 @@ typedef struct _menu_t
     bool showBattery;         ///< true if the battery measurement should be shown. false by default
     int32_t batteryReadTimer; ///< A timer to read the battery every 10s
     int batteryLevel;         ///< The current battery measurement
+    uint32_t revision;        ///< Unique to this menu and its items. Changes when items are added or removed
 } menu_t;
 
 /// @brief A string used to return to super-menus that says "Back"
@@ -2,6 +2,7 @@
 // Includes
 //==============================================================================
 
+#include <string.h>
 #include <esp_random.h>
 #include "hdw-battmon.h"
 #include "menuLogbookRenderer.h"
@@ -24,7 +25,7 @@
 #define ROW_SPACING         3
 #define TOP_LINE_SPACING    3
 #define TOP_LINE_THICKNESS  1
-#define ITEMS_PER_PAGE      5
+#define ITEMS_PER_PAGE      MENU_LOGBOOK_ITEMS_PER_PAGE
 #define PAGE_ARROW_X_OFFSET 60
 #define PAGE_ARROW_Y_OFFSET 5
 #define X_SECTION_MARGIN    16
@@ -35,12 +36,19 @@
 #define MENU_LED_TIME_STEP_US_MIN   8192
 #define MENU_LED_TIME_STEP_US_RANGE 16384
 
+#define ARROW_LEFT   (1 << 0)
+#define ARROW_RIGHT  (1 << 1)
+#define ARROW_DOUBLE (1 << 2)
+
 //==============================================================================
 // Function Prototypes
 //==============================================================================
 
 static void drawMenuText(menuLogbookRenderer_t* renderer, const char* text, int16_t x, int16_t y, bool isSelected,
                          bool leftArrow, bool rightArrow, bool doubleArrows);
+static node_t* findPageStart(menu_t* menu, menuLogbookRenderer_t* renderer);
+static void layoutMenuLogbook(menu_t* menu, menuLogbookRenderer_t* renderer, menuLogbookLayout_t* layout);
+static uint32_t hashDisplay(void);
 
 //==============================================================================
 // Functions
@@ -283,6 +291,16 @@ void drawMenuLogbook(menu_t* menu, menuLogbookRenderer_t* renderer, int64_t elap
     // Light the LEDs
     setLeds(renderer->leds, CONFIG_NUM_LEDS);
 
+    // Lay out this frame. If it's the same as what was last drawn, and nothing has drawn over it since, it's still on
+    // the display and there's nothing to do
+    menuLogbookLayout_t layout;
+    layoutMenuLogbook(menu, renderer, &layout);
+    if (renderer->drawn && hashDisplay() == renderer->drawnHash
+        && 0 == memcmp(&layout, &renderer->drawnLayout, sizeof(layout)))
+    {
+        return;
+    }
+
     // Clear the TFT with a background
     drawWsgTile(&renderer->menu_bg, 0, 0);
 
@@ -293,6 +311,77 @@ void drawMenuLogbook(menu_t* menu, menuLogbookRenderer_t* renderer, int64_t elap
         drawWsgSimple(&renderer->zip, TFT_WIDTH - renderer->zip.w, TFT_HEIGHT - renderer->zip.h);
     }
 
+    // Where to start drawing
+    int16_t x = X_SECTION_MARGIN;
+    int16_t y = Y_SECTION_MARGIN;
+
+    // Draw a title
+    drawText(renderer->font, c542, layout.title, x, y);
+    y += renderer->font->height + Y_SECTION_MARGIN;
+
+    // Shift the text a little after drawing the title
+    x = 10;
+
+    if (layout.pageArrows)
+    {
+        // Draw UP page indicator
+        int16_t arrowX = PAGE_ARROW_X_OFFSET;
+        int16_t arrowY = y - renderer->arrow.h - PAGE_ARROW_Y_OFFSET;
+        drawWsg(&renderer->arrow, arrowX, arrowY, false, false, 270);
+    }
+
+    // Draw a page-worth of items
+    for (uint8_t itemIdx = 0; itemIdx < ITEMS_PER_PAGE; itemIdx++)
+    {
+        if (itemIdx < layout.numItems)
+        {
+            uint8_t arrows = layout.arrows[itemIdx];
+            drawMenuText(renderer, layout.labels[itemIdx], x, y, (layout.selected == itemIdx), (arrows & ARROW_LEFT),
+                         (arrows & ARROW_RIGHT), (arrows & ARROW_DOUBLE));
+        }
+
+        // Move to the next row
+        y += (renderer->font->height + (TEXT_OFFSET * 2) + ROW_SPACING);
+    }
+
+    y -= ROW_SPACING;
+    if (layout.pageArrows)
+    {
+        // Draw DOWN page indicator
+        int16_t arrowX = PAGE_ARROW_X_OFFSET;
+        int16_t arrowY = y + PAGE_ARROW_Y_OFFSET;
+        drawWsg(&renderer->arrow, arrowX, arrowY, false, false, 90);
+    }
+
+    // Only draw the battery if requested
+    if (layout.battery)
+    {
+        drawWsg(layout.battery, 212, 3, false, false, 0);
+    }
+
+    // Remember what was drawn
+    memcpy(&renderer->drawnLayout, &layout, sizeof(layout));
+    renderer->drawnHash = hashDisplay();
+    renderer->drawn     = true;
+}
+
+/**
+ * @brief Find the first item on the page with the selected item. This is cached until the selection or menu changes.
+ * A menu's revision changes whenever items are added or removed, and a menu re-allocated at the same address gets a
+ * new one, so a cached node is never used after it's freed
+ *
+ * @param menu The menu to search
+ * @param renderer The renderer holding the cached page
+ * @return The first item on the page
+ */
+static node_t* findPageStart(menu_t* menu, menuLogbookRenderer_t* renderer)
+{
+    if (renderer->pageMenu == menu && renderer->pageItem == menu->currentItem
+        && renderer->pageMenuRevision == menu->revision && renderer->pageMenuLen == menu->items->length)
+    {
+        return renderer->pageStart;
+    }
+
     // Find the start of the 'page'
     node_t* pageStart = menu->items->first;
     uint8_t pageIdx   = 0;
@@ -317,82 +406,101 @@ void drawMenuLogbook(menu_t* menu, menuLogbookRenderer_t* renderer, int64_t elap
         }
     }
 
-    // Where to start drawing
-    int16_t x = X_SECTION_MARGIN;
-    int16_t y = Y_SECTION_MARGIN;
+    renderer->pageMenu         = menu;
+    renderer->pageItem         = menu->currentItem;
+    renderer->pageMenuRevision = menu->revision;
+    renderer->pageMenuLen      = menu->items->length;
+    renderer->pageStart        = pageStart;
+    return pageStart;
+}
 
-    // Draw a title
-    drawText(renderer->font, c542, menu->title, x, y);
-    y += renderer->font->height + Y_SECTION_MARGIN;
+/**
+ * @brief Lay out a frame of a logbook-style menu without drawing it
+ *
+ * @param menu The menu to lay out
+ * @param renderer The renderer to lay out with
+ * @param layout Written with the layout. Unused bytes are zeroed so layouts can be compared with memcmp()
+ */
+static void layoutMenuLogbook(menu_t* menu, menuLogbookRenderer_t* renderer, menuLogbookLayout_t* layout)
+{
+    memset(layout, 0, sizeof(menuLogbookLayout_t));
 
-    // Shift the text a little after drawing the title
-    x = 10;
+    layout->menu       = menu;
+    layout->title      = menu->title;
+    layout->pageArrows = (menu->items->length > ITEMS_PER_PAGE);
+    layout->selected   = UINT8_MAX;
 
-    if (menu->items->length > ITEMS_PER_PAGE)
+    node_t* pageNode = findPageStart(menu, renderer);
+    while (NULL != pageNode && layout->numItems < ITEMS_PER_PAGE)
     {
-        // Draw UP page indicator
-        int16_t arrowX = PAGE_ARROW_X_OFFSET;
-        int16_t arrowY = y - renderer->arrow.h - PAGE_ARROW_Y_OFFSET;
-        drawWsg(&renderer->arrow, arrowX, arrowY, false, false, 270);
-    }
+        menuItem_t* item = (menuItem_t*)pageNode->val;
+        uint8_t idx      = layout->numItems++;
 
-    // Draw a page-worth of items
-    for (uint8_t itemIdx = 0; itemIdx < ITEMS_PER_PAGE; itemIdx++)
-    {
-        if (NULL != pageStart)
+        if (menu->currentItem->val == item)
         {
-            menuItem_t* item = (menuItem_t*)pageStart->val;
-            bool isSelected  = (menu->currentItem->val == item);
-
-            char buffer[64]   = {0};
-            const char* label = getMenuItemLabelText(buffer, sizeof(buffer), item);
-
-            bool leftArrow    = menuItemHasPrev(item) || menuItemIsBack(item);
-            bool rightArrow   = menuItemHasNext(item) || menuItemHasSubMenu(item);
-            bool doubleArrows = menuItemIsBack(item) || menuItemHasSubMenu(item);
+            layout->selected = idx;
+        }
 
-            drawMenuText(renderer, label, x, y, isSelected, leftArrow, rightArrow, doubleArrows);
+        // The label may point into a temporary buffer, so copy it
+        char buffer[MENU_LOGBOOK_LABEL_LEN] = {0};
+        const char* label                   = getMenuItemLabelText(buffer, sizeof(buffer), item);
+        strncpy(layout->labels[idx], label, MENU_LOGBOOK_LABEL_LEN - 1);
 
-            // Move to the next item
-            pageStart = pageStart->next;
+        if (menuItemHasPrev(item) || menuItemIsBack(item))
+        {
+            layout->arrows[idx] |= ARROW_LEFT;
+        }
+        if (menuItemHasNext(item) || menuItemHasSubMenu(item))
+        {
+            layout->arrows[idx] |= ARROW_RIGHT;
+        }
+        if (menuItemIsBack(item) || menuItemHasSubMenu(item))
+        {
+            layout->arrows[idx] |= ARROW_DOUBLE;
         }
 
-        // Move to the next row
-        y += (renderer->font->height + (TEXT_OFFSET * 2) + ROW_SPACING);
-    }
-
-    y -= ROW_SPACING;
-    if (menu->items->length > ITEMS_PER_PAGE)
-    {
-        // Draw DOWN page indicator
-        int16_t arrowX = PAGE_ARROW_X_OFFSET;
-        int16_t arrowY = y + PAGE_ARROW_Y_OFFSET;
-        drawWsg(&renderer->arrow, arrowX, arrowY, false, false, 90);
+        pageNode = pageNode->next;
     }
 
     // Only draw the battery if requested
     if (menu->showBattery)
     {
         // Draw the battery indicator depending on the last read value
-        wsg_t* toDraw = NULL;
         // 872 is full
         if (menu->batteryLevel == 0 || menu->batteryLevel > 741)
         {
-            toDraw = &renderer->batt[3];
+            layout->battery = &renderer->batt[3];
         }
         else if (menu->batteryLevel > 695)
         {
-            toDraw = &renderer->batt[2];
+            layout->battery = &renderer->batt[2];
         }
         else if (menu->batteryLevel > 652)
         {
-            toDraw = &renderer->batt[1];
+            layout->battery = &renderer->batt[1];
         }
         else // 452 is dead
         {
-            toDraw = &renderer->batt[0];
+            layout->battery = &renderer->batt[0];
         }
+    }
+}
 
-        drawWsg(toDraw, 212, 3, false, false, 0);
+/**
+ * @brief Hash the whole display, to tell if anything has drawn over the menu since it was drawn
+ *
+ * @return A hash of every pixel on the display
+ */
+static uint32_t hashDisplay(void)
+{
+    uintptr_t fbAddr      = (uintptr_t)getPxTftFramebuffer();
+    const uint32_t* words = (const uint32_t*)fbAddr;
+
+    // FNV-1a, a word at a time
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < (TFT_WIDTH * TFT_HEIGHT) / sizeof(uint32_t); i++)
+    {
+        hash = (hash ^ words[i]) * 16777619u;
     }
+    return hash;
 }
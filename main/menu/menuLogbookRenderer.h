@@ -17,6 +17,11 @@
  * The menu is drawn with drawMenuLogbook(). This will both draw over the entire display and light LEDs. The menu may be
  * drawn on top of later.
  *
+ * The renderer is retained-mode. Each frame it lays the menu out and compares that layout to the one it last drew. It
+ * also checks that the display still holds exactly what it last drew. If both match, the menu is already on the display
+ * and nothing is drawn. A menu which nothing else draws on top of costs almost nothing between inputs. Anything drawn
+ * over the menu, even something the renderer doesn't know about, causes a full redraw on the next frame.
+ *
  * \section menuLogbookRenderer_example Example
  *
  * See menu.h for examples on how to use menuLogbookRenderer
@@ -30,6 +35,9 @@
 #include "spiffs_wsg.h"
 #include "hdw-led.h"
 
+#define MENU_LOGBOOK_ITEMS_PER_PAGE 5  ///< The number of menu items shown at once
+#define MENU_LOGBOOK_LABEL_LEN      64 ///< The longest menu item label which can be shown, including the terminator
+
 /**
  * @brief A struct containing state data for a single LED when a menu is being rendered
  */
@@ -44,6 +52,22 @@ typedef struct
     bool isLighting;       ///< true if the LED is fading in, false if it is fading out
 } menuLed_t;
 
+/**
+ * @brief Everything which determines how one frame of a logbook-style menu looks. If this is the same for two frames,
+ * they look the same
+ */
+typedef struct
+{
+    const menu_t* menu;                                               ///< The menu which was drawn
+    const char* title;                                                ///< The menu's title
+    const wsg_t* battery;                                             ///< The battery image, or NULL if not shown
+    bool pageArrows;                                                  ///< true if the page up and down arrows are drawn
+    uint8_t numItems;                                                 ///< The number of items on the page
+    uint8_t selected;                                                 ///< The index of the selected item on the page
+    uint8_t arrows[MENU_LOGBOOK_ITEMS_PER_PAGE];                      ///< Which arrows to draw next to each item
+    char labels[MENU_LOGBOOK_ITEMS_PER_PAGE][MENU_LOGBOOK_LABEL_LEN]; ///< The label of each item
+} menuLogbookLayout_t;
+
 /**
  * @brief A struct containing all the state data to render a logbook-style menu and LEDs
  */
@@ -58,6 +82,14 @@ typedef struct
     wsg_t menu_bg;                        ///< Background image for the menu
     wsg_t zip;                            ///< Unlockable image of Zip
     int32_t magtroidUnlocked;             ///< Whether or not Zip should be drawn
+    const menu_t* pageMenu;               ///< The menu which pageStart was found for
+    const node_t* pageItem;               ///< The selected item which pageStart was found for
+    uint32_t pageMenuRevision;            ///< The revision of the menu which pageStart was found for
+    uint16_t pageMenuLen;                 ///< The length of the menu which pageStart was found for
+    node_t* pageStart;                    ///< The first item on the page with the selected item
+    menuLogbookLayout_t drawnLayout;      ///< The layout which was last drawn
+    uint32_t drawnHash;                   ///< A hash of the display right after the menu was last drawn
+    bool drawn;                           ///< true if drawnLayout and drawnHash are valid
 } menuLogbookRenderer_t;
 
 menuLogbookRenderer_t* initMenuLogbookRenderer(font_t* menuFont);
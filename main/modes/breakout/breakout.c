@@ -342,6 +342,9 @@ static void breakoutEnterMode(void)
     loadFont("logbook.font", &breakout->logbook, false);
     loadFont("ibm_vga8.font", &breakout->ibm_vga8, false);
 
+    // The HUD is drawn in this font every frame
+    cacheFontGlyphs(&breakout->ibm_vga8);
+
     breakout->mRenderer = initMenuLogbookRenderer(&breakout->logbook);
 
     initializeGameData(&(breakout->gameData), &(breakout->soundManager));
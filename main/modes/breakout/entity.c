@@ -1031,7 +1031,7 @@ void destroyEntity(entity_t* self, bool respawn)
     }
 
     self->attachedToEntity = NULL;
-    self->entityManager->activeEntities--;
+    entityPoolFree(&self->entityManager->pool, self - self->entityManager->entities);
     self->active = false;
 }
 
@@ -1051,9 +1051,16 @@ void detectEntityCollisions(entity_t* self)
     box_t* checkEntitySpriteBox;
     box_t checkEntityBox;
 
-    for (uint8_t i = 0; i < MAX_ENTITIES; i++)
+    // The broadphase was built from collision boxes at the start of the tick, so pad the query by how far any other
+    // entity may have moved since then
+    int32_t margin = self->entityManager->broadphaseMargin;
+    uint16_t nearby[MAX_ENTITIES];
+    uint16_t numNearby = spatialHashQuery(&self->entityManager->broadphase, selfBox.x0 - margin, selfBox.y0 - margin,
+                                          selfBox.x1 + margin, selfBox.y1 + margin, nearby, MAX_ENTITIES);
+
+    for (uint16_t n = 0; n < numNearby; n++)
     {
-        checkEntity = &(self->entityManager->entities[i]);
+        checkEntity = &(self->entityManager->entities[nearby[n]]);
         if (checkEntity->active && checkEntity != self)
         {
             checkEntitySprite    = &(self->entityManager->sprites[checkEntity->spriteIndex]);
@@ -18,6 +18,112 @@
 //==============================================================================
 #define SUBPIXEL_RESOLUTION 4
 
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * @brief The initial state of a type of entity. Fields not listed here start as set by initializeEntity()
+ */
+typedef struct
+{
+    bool visible;
+    bool persistent;
+    uint8_t spriteIndex;
+    bool spriteFlipHorizontal;
+    bool spriteFlipVertical;
+    uint8_t animationTimer;
+    int16_t baseSpeed;
+    int16_t maxSpeed; ///< 0 to keep the default
+    int16_t breakInfiniteLoopBounceThreshold;
+    updateFunction_t updateFunction;
+    collisionHandler_t collisionHandler;
+    tileCollisionHandler_t tileCollisionHandler;
+    overlapTileHandler_t overlapTileHandler;
+    void (*spawnHook)(entity_t* entity, uint16_t x, uint16_t y); ///< Optional extra setup after spawning
+} archetype_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void spawnBall(entity_t* entity, uint16_t x, uint16_t y);
+static void spawnCaptiveBall(entity_t* entity, uint16_t x, uint16_t y);
+static void spawnCrawler(entity_t* entity, uint16_t x, uint16_t y);
+static void broadphaseInsert(entityManager_t* entityManager, int32_t slot);
+static void broadphaseTrackSpeed(entityManager_t* entityManager, const entity_t* entity);
+
+//==============================================================================
+// Macros
+//==============================================================================
+
+/// A paddle controlled by the player
+#define PADDLE(sprite, flipH, flipV, update)                                                                          \
+    {                                                                                                                 \
+        .visible = true, .spriteIndex = (sprite), .spriteFlipHorizontal = (flipH), .spriteFlipVertical = (flipV),     \
+        .breakInfiniteLoopBounceThreshold = -1, .updateFunction = (update),                                           \
+        .collisionHandler = &playerCollisionHandler, .tileCollisionHandler = &playerTileCollisionHandler,             \
+        .overlapTileHandler = &playerOverlapTileHandler,                                                              \
+    }
+
+/// A visual effect or bomb which doesn't collide with anything
+#define EFFECT(vis, sprite, timer, update)                                                                            \
+    {                                                                                                                 \
+        .visible = (vis), .spriteIndex = (sprite), .animationTimer = (timer),                                         \
+        .breakInfiniteLoopBounceThreshold = -1, .updateFunction = (update),                                           \
+        .collisionHandler = &dummyCollisionHandler, .tileCollisionHandler = &dummyTileCollisionHandler,               \
+        .overlapTileHandler = &defaultOverlapTileHandler,                                                             \
+    }
+
+//==============================================================================
+// Look Up Tables
+//==============================================================================
+
+// clang-format off
+/**
+ * @brief The initial state of every entity type, indexed by the ENTITY_* type. Types with no update function can't be
+ * spawned.
+ */
+static const archetype_t archetypes[] = {
+    [ENTITY_PLAYER_PADDLE_BOTTOM]  = PADDLE(SP_PADDLE_0, false, false, &updatePlayer),
+    [ENTITY_PLAYER_PADDLE_TOP]     = PADDLE(SP_PADDLE_0, false, true, &updatePlayer),
+    [ENTITY_PLAYER_PADDLE_LEFT]    = PADDLE(SP_PADDLE_VERTICAL_0, true, false, &updatePlayerVertical),
+    [ENTITY_PLAYER_PADDLE_RIGHT]   = PADDLE(SP_PADDLE_VERTICAL_0, false, false, &updatePlayerVertical),
+    [ENTITY_PLAYER_BALL] = {
+        .visible = true, .spriteIndex = SP_BALL_0,
+        .baseSpeed = 23, .maxSpeed = 127, .breakInfiniteLoopBounceThreshold = 8,
+        .updateFunction       = &updateBallAtStart,
+        .collisionHandler     = &dummyCollisionHandler,
+        .tileCollisionHandler = &ballTileCollisionHandler,
+        .overlapTileHandler   = &ballOverlapTileHandler,
+        .spawnHook            = &spawnBall,
+    },
+    [ENTITY_CAPTIVE_BALL] = {
+        .visible = true, .spriteIndex = SP_BALL,
+        .baseSpeed = 39, .maxSpeed = 127, .breakInfiniteLoopBounceThreshold = 8,
+        .updateFunction       = &updateCaptiveBallNotInPlay,
+        .collisionHandler     = &captiveBallCollisionHandler,
+        .tileCollisionHandler = &captiveBallTileCollisionHandler,
+        .overlapTileHandler   = &defaultOverlapTileHandler,
+        .spawnHook            = &spawnCaptiveBall,
+    },
+    [ENTITY_PLAYER_TIME_BOMB]      = EFFECT(true, SP_BOMB_0, 48, &updateTimeBomb),
+    [ENTITY_PLAYER_BOMB_EXPLOSION] = EFFECT(true, SP_EXPLOSION_0, 0, &updateExplosion),
+    [ENTITY_PLAYER_REMOTE_BOMB]    = EFFECT(true, SP_RBOMB_0, 24, &updateRemoteBomb),
+    [ENTITY_BALL_TRAIL]            = EFFECT(false, SP_BALL_TRAIL_0, 4, &updateBallTrail),
+    [ENTITY_CHO_INTRO]             = EFFECT(true, SP_CHO_WALK_0, 0, &updateChoIntro),
+    [ENTITY_CRAWLER] = {
+        .visible = true, .persistent = true, .spriteIndex = SP_CRAWLER_TOP,
+        .baseSpeed = 8, .maxSpeed = 8,
+        .updateFunction       = &updateCrawler,
+        .collisionHandler     = &crawlerCollisionHandler,
+        .tileCollisionHandler = &dummyTileCollisionHandler,
+        .overlapTileHandler   = &defaultOverlapTileHandler,
+        .spawnHook            = &spawnCrawler,
+    },
+};
+// clang-format on
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -32,8 +138,10 @@ void initializeEntityManager(entityManager_t* entityManager, tilemap_t* tilemap,
         initializeEntity(&(entityManager->entities[i]), entityManager, tilemap, gameData, soundManager);
     }
 
-    entityManager->activeEntities = 0;
-    entityManager->tilemap        = tilemap;
+    entityPoolInit(&entityManager->pool, MAX_ENTITIES);
+    spatialHashInit(&entityManager->broadphase, MAX_ENTITIES, BROADPHASE_CELL_SHIFT, BROADPHASE_BUCKETS);
+
+    entityManager->tilemap = tilemap;
 
     // entityManager->viewEntity = createPlayer(entityManager, entityManager->tilemap->warps[0].x * 16,
     // entityManager->tilemap->warps[0].y * 16); entityManager->playerEntity = entityManager->viewEntity;
@@ -309,26 +417,35 @@ void loadSprites(entityManager_t* entityManager)
 
 void updateEntities(entityManager_t* entityManager)
 {
-    for (uint8_t i = 0; i < MAX_ENTITIES; i++)
+    // Rebuild the collision broadphase from this tick's starting collision boxes
+    spatialHashClear(&entityManager->broadphase);
+    entityManager->broadphaseMargin = 0;
+    for (int32_t i = entityPoolNext(&entityManager->pool, -1); i >= 0; i = entityPoolNext(&entityManager->pool, i))
     {
-        if (entityManager->entities[i].active)
-        {
-            entityManager->entities[i].updateFunction(&(entityManager->entities[i]));
+        broadphaseInsert(entityManager, i);
+    }
+
+    // Entities spawned during this loop at higher slots are updated this tick too, same as before
+    for (int32_t i = entityPoolNext(&entityManager->pool, -1); i >= 0; i = entityPoolNext(&entityManager->pool, i))
+    {
+        entityManager->entities[i].updateFunction(&(entityManager->entities[i]));
+
+        // Speed may have changed, and later entities' queries must reach wherever this one moved to
+        broadphaseTrackSpeed(entityManager, &(entityManager->entities[i]));
 
-            if (&(entityManager->entities[i]) == entityManager->viewEntity)
-            {
-                viewFollowEntity(entityManager->tilemap, &(entityManager->entities[i]));
-            }
+        if (&(entityManager->entities[i]) == entityManager->viewEntity)
+        {
+            viewFollowEntity(entityManager->tilemap, &(entityManager->entities[i]));
         }
     }
 }
 
 void deactivateAllEntities(entityManager_t* entityManager, bool excludePlayer, bool excludePersistent, bool respawn)
 {
-    for (uint8_t i = 0; i < MAX_ENTITIES; i++)
+    for (int32_t i = entityPoolNext(&entityManager->pool, -1); i >= 0; i = entityPoolNext(&entityManager->pool, i))
     {
         entity_t* currentEntity = &(entityManager->entities[i]);
-        if (!currentEntity->active || (excludePersistent && currentEntity->persistent))
+        if (excludePersistent && currentEntity->persistent)
         {
             continue;
         }
@@ -338,52 +455,29 @@ void deactivateAllEntities(entityManager_t* entityManager, bool excludePlayer, b
         if (excludePlayer && currentEntity == entityManager->playerEntity)
         {
             currentEntity->active = true;
+            entityPoolAllocAt(&entityManager->pool, i);
         }
     }
 }
 
 void drawEntities(entityManager_t* entityManager)
 {
-    for (uint8_t i = 0; i < MAX_ENTITIES; i++)
+    for (int32_t i = entityPoolNext(&entityManager->pool, -1); i >= 0; i = entityPoolNext(&entityManager->pool, i))
     {
-        entity_t currentEntity = entityManager->entities[i];
+        const entity_t* currentEntity = &entityManager->entities[i];
 
-        if (currentEntity.active && currentEntity.visible)
+        if (currentEntity->visible)
         {
-            drawWsg(&(entityManager->sprites[currentEntity.spriteIndex].wsg),
-                    (currentEntity.x >> SUBPIXEL_RESOLUTION) - entityManager->sprites[currentEntity.spriteIndex].originX
-                        - entityManager->tilemap->mapOffsetX,
-                    (currentEntity.y >> SUBPIXEL_RESOLUTION) - entityManager->tilemap->mapOffsetY
-                        - entityManager->sprites[currentEntity.spriteIndex].originY,
-                    currentEntity.spriteFlipHorizontal, currentEntity.spriteFlipVertical,
-                    currentEntity.spriteRotateAngle);
+            const sprite_t* sprite = &entityManager->sprites[currentEntity->spriteIndex];
+            drawWsg(&(sprite->wsg),
+                    (currentEntity->x >> SUBPIXEL_RESOLUTION) - sprite->originX - entityManager->tilemap->mapOffsetX,
+                    (currentEntity->y >> SUBPIXEL_RESOLUTION) - entityManager->tilemap->mapOffsetY - sprite->originY,
+                    currentEntity->spriteFlipHorizontal, currentEntity->spriteFlipVertical,
+                    currentEntity->spriteRotateAngle);
         }
     }
 }
 
-entity_t* findInactiveEntity(entityManager_t* entityManager)
-{
-    if (entityManager->activeEntities == MAX_ENTITIES)
-    {
-        return NULL;
-    };
-
-    uint8_t entityIndex = 0;
-
-    while (entityManager->entities[entityIndex].active)
-    {
-        entityIndex++;
-
-        // Extra safeguard to make sure we don't get stuck here
-        if (entityIndex >= MAX_ENTITIES)
-        {
-            return NULL;
-        }
-    }
-
-    return &(entityManager->entities[entityIndex]);
-}
-
 void viewFollowEntity(tilemap_t* tilemap, entity_t* entity)
 {
     int16_t moveViewByX = (entity->x) >> SUBPIXEL_RESOLUTION;
@@ -405,484 +499,139 @@ void viewFollowEntity(tilemap_t* tilemap, entity_t* entity)
     //}
 }
 
+/**
+ * @brief Spawn an entity from its archetype in ::archetypes
+ *
+ * @param entityManager The entity manager to spawn in
+ * @param objectIndex The type of entity to spawn
+ * @param x The X position to spawn at, in pixels
+ * @param y The Y position to spawn at, in pixels
+ * @return The spawned entity, or NULL if the type can't be spawned or there are no free slots
+ */
 entity_t* createEntity(entityManager_t* entityManager, uint8_t objectIndex, uint16_t x, uint16_t y)
 {
-    if (entityManager->activeEntities == MAX_ENTITIES)
+    if (objectIndex >= ARRAY_SIZE(archetypes) || NULL == archetypes[objectIndex].updateFunction)
     {
         return NULL;
     }
 
-    entity_t* createdEntity;
-
-    switch (objectIndex)
-    {
-        case ENTITY_PLAYER_PADDLE_BOTTOM:
-            createdEntity = createPlayer(entityManager, x, y);
-            break;
-        case ENTITY_PLAYER_PADDLE_TOP:
-            createdEntity = createPlayerPaddleTop(entityManager, x, y);
-            break;
-        case ENTITY_PLAYER_PADDLE_LEFT:
-            createdEntity = createPlayerPaddleLeft(entityManager, x, y);
-            break;
-        case ENTITY_PLAYER_PADDLE_RIGHT:
-            createdEntity = createPlayerPaddleRight(entityManager, x, y);
-            break;
-        case ENTITY_PLAYER_BALL:
-            createdEntity = createBall(entityManager, x, y);
-            break;
-        case ENTITY_CAPTIVE_BALL:
-            createdEntity = createCaptiveBall(entityManager, x, y);
-            break;
-        case ENTITY_PLAYER_TIME_BOMB:
-            createdEntity = createTimeBomb(entityManager, x, y);
-            break;
-        case ENTITY_PLAYER_BOMB_EXPLOSION:
-            createdEntity = createExplosion(entityManager, x, y);
-            break;
-        case ENTITY_PLAYER_REMOTE_BOMB:
-            createdEntity = createRemoteBomb(entityManager, x, y);
-            break;
-        case ENTITY_BALL_TRAIL:
-            createdEntity = createBallTrail(entityManager, x, y);
-            break;
-        case ENTITY_CHO_INTRO:
-            createdEntity = createChoIntro(entityManager, x, y);
-            break;
-        case ENTITY_CRAWLER:
-            createdEntity = createCrawler(entityManager, x, y);
-            break;
-        default:
-            createdEntity = NULL;
-    }
-
-    if (createdEntity != NULL)
+    int32_t slot = entityPoolAlloc(&entityManager->pool);
+    if (slot < 0)
     {
-        entityManager->activeEntities++;
+        return NULL;
     }
 
-    return createdEntity;
-}
+    const archetype_t* arch = &archetypes[objectIndex];
+    entity_t* entity        = &(entityManager->entities[slot]);
 
-entity_t* createPlayer(entityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
+    // Start from a clean slot so nothing leaks from whatever used it last
+    initializeEntity(entity, entityManager, entity->tilemap, entity->gameData, entity->soundManager);
 
     entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = false;
+    entity->visible    = arch->visible;
+    entity->persistent = arch->persistent;
     entity->x          = x << SUBPIXEL_RESOLUTION;
     entity->y          = y << SUBPIXEL_RESOLUTION;
 
-    entity->xspeed             = 0;
-    entity->yspeed             = 0;
-    entity->spriteFlipVertical = false;
-    entity->spriteRotateAngle  = 0;
-    entity->animationTimer     = 0;
-
-    entity->type                 = ENTITY_PLAYER_PADDLE_BOTTOM;
-    entity->spriteIndex          = SP_PADDLE_0;
-    entity->updateFunction       = &updatePlayer;
-    entity->collisionHandler     = &playerCollisionHandler;
-    entity->tileCollisionHandler = &playerTileCollisionHandler;
-    entity->overlapTileHandler   = &playerOverlapTileHandler;
-    return entity;
-}
-
-entity_t* createPlayerPaddleTop(entityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
+    entity->xspeed                           = 0;
+    entity->yspeed                           = 0;
+    entity->spriteFlipHorizontal             = arch->spriteFlipHorizontal;
+    entity->spriteFlipVertical               = arch->spriteFlipVertical;
+    entity->animationTimer                   = arch->animationTimer;
+    entity->baseSpeed                        = arch->baseSpeed;
+    entity->maxSpeed                         = arch->maxSpeed ? arch->maxSpeed : entity->maxSpeed;
+    entity->breakInfiniteLoopBounceThreshold = arch->breakInfiniteLoopBounceThreshold;
+
+    entity->type                 = objectIndex;
+    entity->spriteIndex          = arch->spriteIndex;
+    entity->updateFunction       = arch->updateFunction;
+    entity->collisionHandler     = arch->collisionHandler;
+    entity->tileCollisionHandler = arch->tileCollisionHandler;
+    entity->overlapTileHandler   = arch->overlapTileHandler;
+
+    if (NULL != arch->spawnHook)
     {
-        return NULL;
+        arch->spawnHook(entity, x, y);
     }
 
-    entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = false;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
+    // Make it collidable right away rather than on the next tick
+    broadphaseInsert(entityManager, slot);
 
-    entity->xspeed             = 0;
-    entity->yspeed             = 0;
-    entity->spriteFlipVertical = true;
-    entity->spriteRotateAngle  = 0;
-    entity->animationTimer     = 0; // Used as a cooldown for shooting square wave balls
-
-    entity->type                 = ENTITY_PLAYER_PADDLE_TOP;
-    entity->spriteIndex          = SP_PADDLE_0;
-    entity->updateFunction       = &updatePlayer;
-    entity->collisionHandler     = &playerCollisionHandler;
-    entity->tileCollisionHandler = &playerTileCollisionHandler;
-    entity->overlapTileHandler   = &playerOverlapTileHandler;
     return entity;
 }
 
-entity_t* createPlayerPaddleLeft(entityManager_t* entityManager, uint16_t x, uint16_t y)
+/**
+ * @brief Put an entity's collision box in the collision broadphase
+ *
+ * @param entityManager The entity manager
+ * @param slot The entity's slot
+ */
+static void broadphaseInsert(entityManager_t* entityManager, int32_t slot)
 {
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = false;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->spriteFlipHorizontal = true;
-    entity->spriteFlipVertical   = false;
-    entity->spriteRotateAngle    = 0;
-    entity->animationTimer       = 0; // Used as a cooldown for shooting square wave balls
-
-    entity->type                 = ENTITY_PLAYER_PADDLE_LEFT;
-    entity->spriteIndex          = SP_PADDLE_VERTICAL_0;
-    entity->updateFunction       = &updatePlayerVertical;
-    entity->collisionHandler     = &playerCollisionHandler;
-    entity->tileCollisionHandler = &playerTileCollisionHandler;
-    entity->overlapTileHandler   = &playerOverlapTileHandler;
-    return entity;
+    entity_t* entity = &(entityManager->entities[slot]);
+    sprite_t* sprite = &(entityManager->sprites[entity->spriteIndex]);
+    int32_t x        = (entity->x >> SUBPIXEL_RESOLUTION) - sprite->originX;
+    int32_t y        = (entity->y >> SUBPIXEL_RESOLUTION) - sprite->originY;
+    spatialHashInsert(&entityManager->broadphase, slot, x + sprite->collisionBox.x0, y + sprite->collisionBox.y0,
+                      x + sprite->collisionBox.x1, y + sprite->collisionBox.y1);
+    broadphaseTrackSpeed(entityManager, entity);
 }
 
-entity_t* createPlayerPaddleRight(entityManager_t* entityManager, uint16_t x, uint16_t y)
+/**
+ * @brief Grow the broadphase query margin to cover how far an entity can move in one tick
+ *
+ * @param entityManager The entity manager
+ * @param entity The entity
+ */
+static void broadphaseTrackSpeed(entityManager_t* entityManager, const entity_t* entity)
 {
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
+    int32_t speed = MAX(MAX(abs(entity->xspeed), abs(entity->yspeed)), entity->maxSpeed);
+    // Round up to whole pixels
+    int32_t margin = (speed + (1 << SUBPIXEL_RESOLUTION) - 1) >> SUBPIXEL_RESOLUTION;
+    if (margin > entityManager->broadphaseMargin)
     {
-        return NULL;
+        entityManager->broadphaseMargin = margin;
     }
-
-    entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = false;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->spriteRotateAngle    = 0;
-    entity->animationTimer       = 0; // Used as a cooldown for shooting square wave balls
-
-    entity->type                 = ENTITY_PLAYER_PADDLE_RIGHT;
-    entity->spriteIndex          = SP_PADDLE_VERTICAL_0;
-    entity->updateFunction       = &updatePlayerVertical;
-    entity->collisionHandler     = &playerCollisionHandler;
-    entity->tileCollisionHandler = &playerTileCollisionHandler;
-    entity->overlapTileHandler   = &playerOverlapTileHandler;
-    return entity;
 }
 
-entity_t* createBall(entityManager_t* entityManager, uint16_t x, uint16_t y)
+/**
+ * @brief Count a newly spawned ball as in play
+ *
+ * @param entity The spawned ball
+ * @param x The X position it was spawned at, in pixels
+ * @param y The Y position it was spawned at, in pixels
+ */
+static void spawnBall(entity_t* entity, uint16_t x, uint16_t y)
 {
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = false;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->spriteRotateAngle    = 0;
-
-    entity->shouldAdvanceMultiplier          = false;
-    entity->baseSpeed                        = 23;
-    entity->bouncesToNextSpeedUp             = 5;
-    entity->speedUpLookupIndex               = 0;
-    entity->maxSpeed                         = 127;
-    entity->bouncesOffUnbreakableBlocks      = 0;
-    entity->breakInfiniteLoopBounceThreshold = 8;
-
-    entity->type                 = ENTITY_PLAYER_BALL;
-    entity->spriteIndex          = SP_BALL_0;
-    entity->updateFunction       = &updateBallAtStart;
-    entity->collisionHandler     = &dummyCollisionHandler;
-    entity->tileCollisionHandler = &ballTileCollisionHandler;
-    entity->overlapTileHandler   = &ballOverlapTileHandler;
-
     entity->gameData->ballsInPlay++;
-    return entity;
 }
 
-entity_t* createCaptiveBall(entityManager_t* entityManager, uint16_t x, uint16_t y)
+/**
+ * @brief Start a captive ball moving in a direction picked from its spawn position
+ *
+ * @param entity The spawned captive ball
+ * @param x The X position it was spawned at, in pixels
+ * @param y The Y position it was spawned at, in pixels
+ */
+static void spawnCaptiveBall(entity_t* entity, uint16_t x, uint16_t y)
 {
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = false;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
-
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->spriteRotateAngle    = 0;
-
-    entity->shouldAdvanceMultiplier          = false;
-    entity->baseSpeed                        = 39;
-    entity->bouncesToNextSpeedUp             = 5;
-    entity->speedUpLookupIndex               = 0;
-    entity->maxSpeed                         = 127;
-    entity->bouncesOffUnbreakableBlocks      = 0;
-    entity->breakInfiniteLoopBounceThreshold = 8;
-
     setVelocity(entity, (x + y) % 360, 39);
 
     if (entity->yspeed == 0)
     {
         entity->yspeed = -16;
     }
-
-    entity->type                 = ENTITY_CAPTIVE_BALL;
-    entity->spriteIndex          = SP_BALL;
-    entity->updateFunction       = &updateCaptiveBallNotInPlay;
-    entity->collisionHandler     = &captiveBallCollisionHandler;
-    entity->tileCollisionHandler = &captiveBallTileCollisionHandler;
-    entity->overlapTileHandler   = &defaultOverlapTileHandler;
-
-    return entity;
-}
-
-entity_t* createTimeBomb(entityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = false;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->spriteRotateAngle    = 0;
-    entity->animationTimer       = 48;
-
-    entity->type                 = ENTITY_PLAYER_TIME_BOMB;
-    entity->spriteIndex          = SP_BOMB_0;
-    entity->updateFunction       = &updateTimeBomb;
-    entity->collisionHandler     = &dummyCollisionHandler;
-    entity->tileCollisionHandler = &dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &defaultOverlapTileHandler;
-
-    // Entity cannot be respawned from the tilemap
-    entity->homeTileX = 0;
-    entity->homeTileY = 0;
-
-    return entity;
-}
-
-entity_t* createExplosion(entityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = false;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->spriteRotateAngle    = 0;
-
-    entity->type                 = ENTITY_PLAYER_BOMB_EXPLOSION;
-    entity->spriteIndex          = SP_EXPLOSION_0;
-    entity->updateFunction       = &updateExplosion;
-    entity->collisionHandler     = &dummyCollisionHandler;
-    entity->tileCollisionHandler = &dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &defaultOverlapTileHandler;
-
-    // Entity cannot be respawned from the tilemap
-    entity->homeTileX = 0;
-    entity->homeTileY = 0;
-
-    return entity;
 }
 
-entity_t* createRemoteBomb(entityManager_t* entityManager, uint16_t x, uint16_t y)
+/**
+ * @brief Set up a crawler's movement state
+ *
+ * @param entity The spawned crawler
+ * @param x The X position it was spawned at, in pixels
+ * @param y The Y position it was spawned at, in pixels
+ */
+static void spawnCrawler(entity_t* entity, uint16_t x, uint16_t y)
 {
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = false;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->spriteRotateAngle    = 0;
-    entity->animationTimer       = 24;
-
-    entity->type                 = ENTITY_PLAYER_REMOTE_BOMB;
-    entity->spriteIndex          = SP_RBOMB_0;
-    entity->updateFunction       = &updateRemoteBomb;
-    entity->collisionHandler     = &dummyCollisionHandler;
-    entity->tileCollisionHandler = &dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &defaultOverlapTileHandler;
-
-    // Entity cannot be respawned from the tilemap
-    entity->homeTileX = 0;
-    entity->homeTileY = 0;
-
-    return entity;
-}
-
-entity_t* createBallTrail(entityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active     = true;
-    entity->visible    = false;
-    entity->persistent = false;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->spriteRotateAngle    = 0;
-    entity->animationTimer       = 4;
-
-    entity->type                 = ENTITY_BALL_TRAIL;
-    entity->spriteIndex          = SP_BALL_TRAIL_0;
-    entity->updateFunction       = &updateBallTrail;
-    entity->collisionHandler     = &dummyCollisionHandler;
-    entity->tileCollisionHandler = &dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &defaultOverlapTileHandler;
-
-    // Entity cannot be respawned from the tilemap
-    entity->homeTileX = 0;
-    entity->homeTileY = 0;
-
-    return entity;
-}
-
-entity_t* createChoIntro(entityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = false;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->spriteRotateAngle    = 0;
-    entity->animationTimer       = 0;
-
-    entity->type                 = ENTITY_CHO_INTRO;
-    entity->spriteIndex          = SP_CHO_WALK_0;
-    entity->updateFunction       = &updateChoIntro;
-    entity->collisionHandler     = &dummyCollisionHandler;
-    entity->tileCollisionHandler = &dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &defaultOverlapTileHandler;
-
-    // Entity cannot be respawned from the tilemap
-    entity->homeTileX = 0;
-    entity->homeTileY = 0;
-
-    return entity;
-}
-
-entity_t* createCrawler(entityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    entity_t* entity = findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active     = true;
-    entity->visible    = true;
-    entity->persistent = true;
-    entity->x          = x << SUBPIXEL_RESOLUTION;
-    entity->y          = y << SUBPIXEL_RESOLUTION;
-
-    entity->baseSpeed            = 8;
-    entity->maxSpeed             = 8;
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->spriteRotateAngle    = 0;
-
-    entity->type                 = ENTITY_CRAWLER;
-    entity->spriteIndex          = SP_CRAWLER_TOP;
-    entity->updateFunction       = &updateCrawler;
-    entity->collisionHandler     = &crawlerCollisionHandler;
-    entity->tileCollisionHandler = &dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &defaultOverlapTileHandler;
-
-    // Entity cannot be respawned from the tilemap
-    entity->homeTileX = 0;
-    entity->homeTileY = 0;
-
     crawlerInitMoveState(entity);
 
     // This will be reused to track defeat condition
@@ -890,13 +639,13 @@ entity_t* createCrawler(entityManager_t* entityManager, uint16_t x, uint16_t y)
 
     // This will be reused as a cooldown for collisions with other crawlers.
     entity->breakInfiniteLoopBounceThreshold = 0;
-
-    return entity;
 }
 
 void freeEntityManager(entityManager_t* self)
 {
     free(self->entities);
+    entityPoolDeinit(&self->pool);
+    spatialHashDeinit(&self->broadphase);
     for (uint8_t i = 0; i < SPRITESET_SIZE; i++)
     {
         freeWsg(&(self->sprites[i].wsg));
@@ -14,13 +14,19 @@
 #include "hdw-tft.h"
 #include "sprite.h"
 #include "soundManager.h"
+#include "spatialHash.h"
+#include "entityPool.h"
 
 //==============================================================================
 // Constants
 //==============================================================================
-#define MAX_ENTITIES   32
+#define MAX_ENTITIES   128
 #define SPRITESET_SIZE 33
 
+// Broadphase cells are 32px on a side
+#define BROADPHASE_CELL_SHIFT 5
+#define BROADPHASE_BUCKETS    64
+
 //==============================================================================
 // Structs
 //==============================================================================
@@ -29,12 +35,21 @@ struct entityManager_t
 {
     sprite_t sprites[SPRITESET_SIZE];
     entity_t* entities;
-    uint8_t activeEntities;
+
+    /// Tracks which slots of entities are in use
+    entityPool_t pool;
 
     entity_t* viewEntity;
     entity_t* playerEntity;
 
     tilemap_t* tilemap;
+
+    /// Collision broadphase, rebuilt at the start of every updateEntities()
+    spatialHash_t broadphase;
+
+    /// How far, in pixels, an entity may have moved since it was put in the broadphase. Collision queries are padded
+    /// by this. It's the fastest speed of any entity this tick
+    int32_t broadphaseMargin;
 };
 
 //==============================================================================
@@ -46,24 +61,9 @@ void loadSprites(entityManager_t* entityManager);
 void updateEntities(entityManager_t* entityManager);
 void deactivateAllEntities(entityManager_t* entityManager, bool excludePlayer, bool excludePersistent, bool respawn);
 void drawEntities(entityManager_t* entityManager);
-entity_t* findInactiveEntity(entityManager_t* entityManager);
 
 void viewFollowEntity(tilemap_t* tilemap, entity_t* entity);
 entity_t* createEntity(entityManager_t* entityManager, uint8_t objectIndex, uint16_t x, uint16_t y);
-entity_t* createPlayer(entityManager_t* entityManager, uint16_t x, uint16_t y);
-entity_t* createPlayerPaddleTop(entityManager_t* entityManager, uint16_t x, uint16_t y);
-entity_t* createPlayerPaddleLeft(entityManager_t* entityManager, uint16_t x, uint16_t y);
-entity_t* createPlayerPaddleRight(entityManager_t* entityManager, uint16_t x, uint16_t y);
-
-entity_t* createBall(entityManager_t* entityManager, uint16_t x, uint16_t y);
-entity_t* createCaptiveBall(entityManager_t* entityManager, uint16_t x, uint16_t y);
-entity_t* createTimeBomb(entityManager_t* entityManager, uint16_t x, uint16_t y);
-entity_t* createExplosion(entityManager_t* entityManager, uint16_t x, uint16_t y);
-entity_t* createRemoteBomb(entityManager_t* entityManager, uint16_t x, uint16_t y);
-entity_t* createBallTrail(entityManager_t* entityManager, uint16_t x, uint16_t y);
-
-entity_t* createChoIntro(entityManager_t* entityManager, uint16_t x, uint16_t y);
-entity_t* createCrawler(entityManager_t* entityManager, uint16_t x, uint16_t y);
 
 void freeEntityManager(entityManager_t* entityManager);
 
@@ -1,24 +1,110 @@
 //==============================================================================
 // Includes
 //==============================================================================
+#include <string.h>
 #include "starfield.h"
 #include <esp_random.h>
 #include "hdw-tft.h"
 #include "palette.h"
-#include "fill.h"
+#include "macros.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+/// The number of fractional bits in the projection reciprocal table
+#define RECIP_SHIFT 20
+
+/// The number of rows in the largest star stamp
+#define MAX_STAMP_ROWS 6
+
+/// The furthest any stamp pixel is from the star's center
+#define MAX_STAMP_RADIUS 3
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/// One horizontal run of pixels in a star stamp, relative to the star's center
+typedef struct
+{
+    int8_t dy; ///< The row
+    int8_t x0; ///< The leftmost pixel, inclusive
+    int8_t x1; ///< The rightmost pixel, inclusive
+} starStampRow_t;
+
+/// The shape and default color of a star at some range of depths
+typedef struct
+{
+    int16_t maxZ;                        ///< Stars closer than this use this stamp
+    paletteColor_t color;                ///< The star's color when the starfield isn't using random colors
+    uint8_t numRows;                     ///< The number of rows in the stamp
+    starStampRow_t rows[MAX_STAMP_ROWS]; ///< The rows of the stamp
+} starStamp_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+static uint32_t starfieldRandom(starfield_t* self);
+static void spawnStar(starfield_t* self, uint16_t i);
+static void projectStar(starfield_t* self, uint16_t i);
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+/// Star shapes from closest to furthest
+static const starStamp_t starStamps[] = {
+    {
+        .maxZ    = 205,
+        .color   = c555,
+        .numRows = 6,
+        .rows    = {{-3, -1, 0}, {-2, -2, 1}, {-1, -3, 2}, {0, -3, 2}, {1, -2, 1}, {2, -1, 0}},
+    },
+    {
+        .maxZ    = 410,
+        .color   = c444,
+        .numRows = 4,
+        .rows    = {{-2, -1, 0}, {-1, -2, 1}, {0, -2, 1}, {1, -1, 0}},
+    },
+    {
+        .maxZ    = 614,
+        .color   = c333,
+        .numRows = 3,
+        .rows    = {{-1, 0, 0}, {0, -1, 1}, {1, 0, 0}},
+    },
+    {
+        .maxZ    = STARFIELD_DEPTH + 1,
+        .color   = c222,
+        .numRows = 1,
+        .rows    = {{0, 0, 0}},
+    },
+};
+
+/// (STARFIELD_DEPTH << RECIP_SHIFT) / z, rounded up, so projection is a multiply instead of a divide
+static uint32_t starfieldRecip[STARFIELD_DEPTH + 1];
 
 //==============================================================================
 // Functions
 //==============================================================================
 void initializeStarfield(starfield_t* self, bool randomColors)
 {
+    if (0 == starfieldRecip[1])
+    {
+        for (uint16_t z = 1; z <= STARFIELD_DEPTH; z++)
+        {
+            starfieldRecip[z] = (((uint32_t)STARFIELD_DEPTH << RECIP_SHIFT) + z - 1) / z;
+        }
+    }
+
+    self->randomColors = randomColors;
+    self->rngState     = esp_random() | 1;
+
     for (uint16_t i = 0; i < NUM_STARS; i++)
     {
-        self->stars[i].x     = randomInt(-TFT_WIDTH / 2, TFT_WIDTH / 2);
-        self->stars[i].y     = randomInt(-TFT_HEIGHT / 2, TFT_HEIGHT / 2);
-        self->stars[i].z     = 1 + esp_random() % 1023;
-        self->randomColors   = randomColors;
-        self->stars[i].color = esp_random() % cTransparent;
+        spawnStar(self, i);
+        self->z[i] = 1 + starfieldRandom(self) % (STARFIELD_DEPTH - 1);
+        projectStar(self, i);
     }
 }
 
@@ -26,14 +112,13 @@ void updateStarfield(starfield_t* self, int32_t scale)
 {
     for (uint16_t i = 0; i < NUM_STARS; i++)
     {
-        self->stars[i].z -= scale;
-        if (self->stars[i].z <= 0)
+        self->z[i] -= scale;
+        if (self->z[i] <= 0)
         {
-            self->stars[i].x = randomInt(-TFT_WIDTH / 2, TFT_WIDTH / 2);
-            self->stars[i].y = randomInt(-TFT_HEIGHT / 2, TFT_HEIGHT / 2);
-            self->stars[i].z += 1024;
-            self->stars[i].color = esp_random() % cTransparent;
+            spawnStar(self, i);
+            self->z[i] += STARFIELD_DEPTH;
         }
+        projectStar(self, i);
     }
 }
 
@@ -42,68 +127,116 @@ int randomInt(int lowerBound, int upperBound)
     return esp_random() % (upperBound - lowerBound + 1) + lowerBound;
 }
 
-void drawStarfield(starfield_t* self)
+/**
+ * @brief Get a random number from the starfield's own generator. Respawning stars happens every frame, so this is a
+ * cheap xorshift rather than the hardware RNG
+ *
+ * @param self The starfield
+ * @return A random 32 bit number
+ */
+static uint32_t starfieldRandom(starfield_t* self)
 {
-    // clearDisplay();
+    uint32_t s = self->rngState;
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    self->rngState = s;
+    return s;
+}
 
-    /* rendering */
-    for (uint16_t i = 0; i < NUM_STARS; i++)
+/**
+ * @brief Give a star a new random position and color. Its depth is left for the caller to set
+ *
+ * @param self The starfield
+ * @param i The star's index
+ */
+static void spawnStar(starfield_t* self, uint16_t i)
+{
+    self->x[i]     = (int16_t)(starfieldRandom(self) % (TFT_WIDTH + 1)) - TFT_WIDTH / 2;
+    self->y[i]     = (int16_t)(starfieldRandom(self) % (TFT_HEIGHT + 1)) - TFT_HEIGHT / 2;
+    self->color[i] = starfieldRandom(self) % cTransparent;
+}
+
+/**
+ * @brief Project a star onto the display and pick its stamp
+ *
+ * @param self The starfield
+ * @param i The star's index
+ */
+static void projectStar(starfield_t* self, uint16_t i)
+{
+    uint32_t recip = starfieldRecip[self->z[i]];
+
+    // Project the magnitude so this truncates towards zero, just like a divide
+    int32_t px = (int32_t)(((uint64_t)ABS(self->x[i]) * recip) >> RECIP_SHIFT);
+    int32_t py = (int32_t)(((uint64_t)ABS(self->y[i]) * recip) >> RECIP_SHIFT);
+
+    px = ((self->x[i] < 0) ? -px : px) + TFT_WIDTH / 2;
+    py = ((self->y[i] < 0) ? -py : py) + TFT_HEIGHT / 2;
+
+    // Close stars can project far off screen. Anything past the stamp radius isn't drawn, so clamp it to fit
+    self->screenX[i] = CLAMP(px, -MAX_STAMP_RADIUS - 1, TFT_WIDTH + MAX_STAMP_RADIUS);
+    self->screenY[i] = CLAMP(py, -MAX_STAMP_RADIUS - 1, TFT_HEIGHT + MAX_STAMP_RADIUS);
+
+    uint8_t stamp = 0;
+    while (self->z[i] >= starStamps[stamp].maxZ)
     {
-        /* Move and size the star */
-        int temp[2];
+        stamp++;
+    }
+    self->stamp[i] = stamp;
+}
 
-        temp[0] = ((1024 * self->stars[i].x) / self->stars[i].z) + TFT_WIDTH / 2;
-        temp[1] = ((1024 * self->stars[i].y) / self->stars[i].z) + TFT_HEIGHT / 2;
+void drawStarfield(starfield_t* self)
+{
+    drawStarfieldBand(self, 0, TFT_HEIGHT);
+}
 
-        // translate(&temp, TFT_WIDTH / 2, TFT_HEIGHT / 2);
+/**
+ * @brief Draw the part of a starfield which falls in a horizontal band of the display. This can be called from a
+ * background draw callback
+ *
+ * @param self The starfield
+ * @param y The first row of the band
+ * @param h The height of the band
+ */
+void drawStarfieldBand(starfield_t* self, int16_t y, int16_t h)
+{
+    int16_t yMin = MAX(y, 0);
+    int16_t yMax = MIN(y + h, TFT_HEIGHT);
 
-        /* Draw the star */
-        paletteColor_t col = self->stars[i].color;
-        if (self->stars[i].z < 205)
-        {
-            if (!self->randomColors)
-            {
-                col = c555;
-            }
-            fillDisplayArea(temp[0] - 3, temp[1] - 1, temp[0] + 3, temp[1] + 1, col);
-            fillDisplayArea(temp[0] - 1, temp[1] - 3, temp[0] + 1, temp[1] + 3, col);
-            fillDisplayArea(temp[0] - 2, temp[1] - 2, temp[0] + 2, temp[1] + 2, col);
-            setPxTft(temp[0], temp[1], col);
-        }
-        else if (self->stars[i].z < 410)
+    paletteColor_t* fb = getPxTftFramebuffer();
+
+    for (uint16_t i = 0; i < NUM_STARS; i++)
+    {
+        int16_t sx = self->screenX[i];
+        int16_t sy = self->screenY[i];
+
+        // Skip stars which are entirely outside the band or display
+        if (sy + MAX_STAMP_RADIUS < yMin || sy - MAX_STAMP_RADIUS >= yMax || sx + MAX_STAMP_RADIUS < 0
+            || sx - MAX_STAMP_RADIUS >= TFT_WIDTH)
         {
-            if (!self->randomColors)
-            {
-                col = c444;
-            }
-            fillDisplayArea(temp[0] - 2, temp[1] - 1, temp[0] + 2, temp[1] + 1, col);
-            fillDisplayArea(temp[0] - 1, temp[1] - 2, temp[0] + 1, temp[1] + 2, col);
-            setPxTft(temp[0], temp[1], col);
+            continue;
         }
-        else if (self->stars[i].z < 614)
-        {
-            if (!self->randomColors)
-            {
-                col = c333;
-            }
-            fillDisplayArea(temp[0] - 1, temp[1], temp[0] + 2, temp[1] + 1, col);
-            fillDisplayArea(temp[0], temp[1] - 1, temp[0] + 1, temp[1] + 2, col);
-        }
-        else if (self->stars[i].z < 819)
+
+        const starStamp_t* stamp = &starStamps[self->stamp[i]];
+        paletteColor_t col       = self->randomColors ? self->color[i] : stamp->color;
+
+        for (uint8_t r = 0; r < stamp->numRows; r++)
         {
-            if (!self->randomColors)
+            const starStampRow_t* row = &stamp->rows[r];
+
+            int16_t py = sy + row->dy;
+            if (py < yMin || py >= yMax)
             {
-                col = c222;
+                continue;
             }
-            fillDisplayArea(temp[0], temp[1], temp[0] + 1, temp[1] + 1, col);
-        }
-        else
-        {
-            if (!self->randomColors)
+
+            int16_t x0 = MAX(sx + row->x0, 0);
+            int16_t x1 = MIN(sx + row->x1, TFT_WIDTH - 1);
+            if (x0 <= x1)
             {
-                col = c222;
+                memset(&fb[py * TFT_WIDTH + x0], col, x1 - x0 + 1);
             }
-            setPxTft(temp[0], temp[1], col);
         }
     }
-}
\ No newline at end of file
+}
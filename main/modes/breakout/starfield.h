@@ -13,22 +13,31 @@
 //==============================================================================
 #define NUM_STARS 92
 
+/// Stars are spawned at most this far from the camera, and respawned this far back when they pass it
+#define STARFIELD_DEPTH 1024
+
 //==============================================================================
 // Structs
 //==============================================================================
-typedef struct
-{
-    int16_t x;
-    int16_t y;
-    int16_t z;
-
-    paletteColor_t color;
-} star_t;
 
+/**
+ * @brief A field of stars flying towards the camera
+ *
+ * Stars are kept as parallel arrays rather than an array of structs, so each pass over the field only touches the
+ * fields it needs. The screen position and stamp of each star is projected when the star moves, so drawing doesn't
+ * project anything and can be done as many times per frame as needed, such as once per display band.
+ */
 typedef struct
 {
-    star_t stars[NUM_STARS];
-    bool randomColors;
+    int16_t x[NUM_STARS];            ///< The star's X position in space, centered on the camera
+    int16_t y[NUM_STARS];            ///< The star's Y position in space, centered on the camera
+    int16_t z[NUM_STARS];            ///< The star's distance from the camera, 1 to STARFIELD_DEPTH
+    paletteColor_t color[NUM_STARS]; ///< The star's color when randomColors is set
+    int16_t screenX[NUM_STARS];      ///< The star's projected X position on the display
+    int16_t screenY[NUM_STARS];      ///< The star's projected Y position on the display
+    uint8_t stamp[NUM_STARS];        ///< The star's projected size, an index into the stamp table
+    bool randomColors;               ///< true to draw stars in their own color, false to draw them in grays
+    uint32_t rngState;               ///< The state of the generator used to respawn stars
 } starfield_t;
 
 //==============================================================================
@@ -38,5 +47,6 @@ void initializeStarfield(starfield_t* self, bool randomColors);
 void updateStarfield(starfield_t* self, int32_t scale);
 int randomInt(int lowerBound, int upperBound);
 void drawStarfield(starfield_t* self);
+void drawStarfieldBand(starfield_t* self, int16_t y, int16_t h);
 
 #endif
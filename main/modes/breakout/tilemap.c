@@ -19,6 +19,8 @@
 //==============================================================================
 
 // bool isInteractive(uint8_t tileId);
+static const wsg_t* lookupTile(void* ctx, int32_t tx, int32_t ty, uint8_t* tag);
+static void spawnVisibleTiles(tilemap_t* tilemap);
 
 //==============================================================================
 // Functions
@@ -37,8 +39,18 @@ void initializeTileMap(tilemap_t* tilemap)
     tilemap->animationTimer = 23;
 
     loadTiles(tilemap);
+
+    // Transparent, so the starfield shows through
+    tileLayerInit(&tilemap->layer, TILEMAP_DISPLAY_WIDTH_PIXELS, TILEMAP_DISPLAY_HEIGHT_PIXELS,
+                  TILE_SIZE_IN_POWERS_OF_2, lookupTile, tilemap);
 }
 
+/**
+ * @brief Draw the visible part of the map over whatever is already on the display, and spawn entities from tiles which
+ * scrolled into view
+ *
+ * @param tilemap The tilemap to draw
+ */
 void drawTileMap(tilemap_t* tilemap)
 {
     tilemap->animationTimer--;
@@ -48,58 +60,78 @@ void drawTileMap(tilemap_t* tilemap)
         tilemap->animationTimer = 23;
     }
 
-    for (uint16_t y = (tilemap->mapOffsetY >> TILE_SIZE_IN_POWERS_OF_2);
-         y < (tilemap->mapOffsetY >> TILE_SIZE_IN_POWERS_OF_2) + TILEMAP_DISPLAY_HEIGHT_TILES; y++)
+    tileLayerDraw(&tilemap->layer, tilemap->mapOffsetX, tilemap->mapOffsetY);
+
+    spawnVisibleTiles(tilemap);
+}
+
+/**
+ * @brief Look up how a tile looks, for the tile layer
+ *
+ * @param ctx The tilemap
+ * @param tx The tile's X coordinate
+ * @param ty The tile's Y coordinate
+ * @param tag Written with the tile ID, or 0 for tiles which aren't drawn
+ * @return The tile's image, or NULL if it isn't drawn
+ */
+static const wsg_t* lookupTile(void* ctx, int32_t tx, int32_t ty, uint8_t* tag)
+{
+    tilemap_t* tilemap = (tilemap_t*)ctx;
+    *tag               = 0;
+
+    if (tx < 0 || ty < 0 || tx >= tilemap->mapWidth || ty >= tilemap->mapHeight)
     {
-        if (y >= tilemap->mapHeight)
-        {
-            break;
-        }
+        return NULL;
+    }
 
-        for (int32_t x = (tilemap->mapOffsetX >> TILE_SIZE_IN_POWERS_OF_2);
-             x < (tilemap->mapOffsetX >> TILE_SIZE_IN_POWERS_OF_2) + TILEMAP_DISPLAY_WIDTH_TILES; x++)
-        {
-            if (x >= tilemap->mapWidth)
-            {
-                break;
-            }
-            else if (x < 0)
-            {
-                continue;
-            }
+    uint8_t tile = tilemap->map[(ty * tilemap->mapWidth) + tx];
 
-            uint8_t tile = tilemap->map[(y * tilemap->mapWidth) + x];
+    // Draw only non-garbage tiles
+    if (tile < TILE_BOUNDARY_1 || tile == TILE_INVISIBLE_BLOCK || tile > 127)
+    {
+        return NULL;
+    }
 
-            if (tile < TILE_BOUNDARY_1 || tile == TILE_INVISIBLE_BLOCK)
-            {
-                continue;
-            }
+    *tag = tile;
+    return &tilemap->tiles[tile - 1];
+}
 
-            // Test animated tiles
-            /*if (tile == 64 || tile == 67)
-            {
-                tile += tilemap->animationFrame;
-            }*/
+/**
+ * @brief Spawn entities from spawn tiles in the row or column which just scrolled into view, or from all visible tiles
+ * if requested
+ *
+ * @param tilemap The tilemap to spawn from
+ */
+static void spawnVisibleTiles(tilemap_t* tilemap)
+{
+    if (!tilemap->tileSpawnEnabled)
+    {
+        tilemap->executeTileSpawnAll = 0;
+        return;
+    }
 
-            // Draw only non-garbage tiles
-            if (tile > 0 && tile < 128)
-            {
-                if (needsTransparency(tile))
-                {
-                    // drawWsgSimpleFast(&tilemap->tiles[tile - 1], x * TILE_SIZE - tilemap->mapOffsetX, y * TILE_SIZE -
-                    // tilemap->mapOffsetY);
-                    drawWsgSimple(&tilemap->tiles[tile - 1], x * TILE_SIZE - tilemap->mapOffsetX,
-                                  y * TILE_SIZE - tilemap->mapOffsetY);
-                }
-                else
-                {
-                    drawWsgTile(&tilemap->tiles[tile - 1], x * TILE_SIZE - tilemap->mapOffsetX,
-                                y * TILE_SIZE - tilemap->mapOffsetY);
-                }
-            }
-            else if (tile > 127 && tilemap->tileSpawnEnabled
-                     && (tilemap->executeTileSpawnColumn == x || tilemap->executeTileSpawnRow == y
-                         || tilemap->executeTileSpawnAll))
+    int32_t tx0 = MAX(tilemap->mapOffsetX >> TILE_SIZE_IN_POWERS_OF_2, 0);
+    int32_t ty0 = MAX(tilemap->mapOffsetY >> TILE_SIZE_IN_POWERS_OF_2, 0);
+    int32_t tx1
+        = MIN((tilemap->mapOffsetX >> TILE_SIZE_IN_POWERS_OF_2) + TILEMAP_DISPLAY_WIDTH_TILES, tilemap->mapWidth);
+    int32_t ty1
+        = MIN((tilemap->mapOffsetY >> TILE_SIZE_IN_POWERS_OF_2) + TILEMAP_DISPLAY_HEIGHT_TILES, tilemap->mapHeight);
+
+    for (int32_t y = ty0; y < ty1; y++)
+    {
+        // Check the whole row if it is being spawned, otherwise only where it crosses the spawn column
+        bool wholeRow = tilemap->executeTileSpawnAll || tilemap->executeTileSpawnRow == y;
+        int32_t xs    = wholeRow ? tx0 : tilemap->executeTileSpawnColumn;
+        int32_t xe    = wholeRow ? tx1 : tilemap->executeTileSpawnColumn + 1;
+        if (!wholeRow && (tilemap->executeTileSpawnColumn < tx0 || tilemap->executeTileSpawnColumn >= tx1))
+        {
+            continue;
+        }
+
+        for (int32_t x = xs; x < xe; x++)
+        {
+            uint8_t tile = tilemap->map[(y * tilemap->mapWidth) + x];
+            if (tile > 127)
             {
                 tileSpawnEntity(tilemap, tile - 128, x, y);
             }
@@ -178,6 +210,7 @@ bool loadMapFromFile(tilemap_t* tilemap, const char* name)
 
     tilemap->mapWidth  = width;
     tilemap->mapHeight = height;
+    tileLayerInvalidate(&tilemap->layer);
 
     tilemap->minMapOffsetX = 0;
     tilemap->maxMapOffsetX = width * TILE_SIZE - TILEMAP_DISPLAY_WIDTH_PIXELS;
@@ -374,6 +407,7 @@ void setTile(tilemap_t* tilemap, uint8_t tx, uint8_t ty, uint8_t newTileId)
     }
 
     tilemap->map[ty * tilemap->mapWidth + tx] = newTileId;
+    tileLayerUpdateTile(&tilemap->layer, tx, ty);
 }
 
 bool isSolid(uint8_t tileId)
@@ -434,6 +468,7 @@ bool needsTransparency(uint8_t tileId)
 void freeTilemap(tilemap_t* tilemap)
 {
     free(tilemap->map);
+    tileLayerDeinit(&tilemap->layer);
     for (uint8_t i = 0; i < 127; i++)
     {
         switch (i)
@@ -8,6 +8,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "wsg.h"
+#include "tileLayer.h"
 #include "macros.h"
 #include "breakout_typedef.h"
 #include "entityManager.h"
@@ -195,6 +196,9 @@ struct tilemap_t
 
     uint8_t animationFrame;
     int16_t animationTimer;
+
+    /// The pre-rendered visible part of the map
+    tileLayer_t layer;
 };
 
 //==============================================================================
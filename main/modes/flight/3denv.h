@@ -1,1761 +1,6 @@
 #ifndef _MODEL3D_H
 #define _MODEL3D_H
 
-const unsigned short model3d[] = {
-    0x6d69, 0x6c64, 0x0116, 0x0018, 0x0008, 0x0003, 0xfa26, 0xff6f, 0xfbb1, 0x00da, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c,
-    0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0xfa07, 0xfea1, 0xfbf3, 0xfa07, 0x003c, 0xfb6e, 0xfa07,
-    0xfea1, 0xfb6e, 0xfa07, 0x003c, 0xfbf3, 0xfa45, 0x003c, 0xfbf3, 0xfa45, 0x003c, 0xfb6e, 0xfa45, 0xfea1, 0xfbf3,
-    0xfa45, 0xfea1, 0xfb6e, 0x0018, 0x0008, 0x0003, 0xfbdd, 0xff6f, 0xff92, 0x00da, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c,
-    0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0xfbf6, 0xfea1, 0xffd7, 0xfb98, 0x003c, 0xff79, 0xfb98,
-    0xfea1, 0xff79, 0xfbf6, 0x003c, 0xffd7, 0xfc22, 0x003c, 0xffab, 0xfbc3, 0x003c, 0xff4d, 0xfc22, 0xfea1, 0xffab,
-    0xfbc3, 0xfea1, 0xff4d, 0x0018, 0x0008, 0x0003, 0xfe7d, 0xff6f, 0x0115, 0x00da, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c,
-    0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0xfeb5, 0xfea1, 0x0144, 0xfe34, 0x003c, 0x0121, 0xfe34,
-    0xfea1, 0x0121, 0xfeb5, 0x003c, 0x0144, 0xfec5, 0x003c, 0x0108, 0xfe44, 0x003c, 0x00e6, 0xfec5, 0xfea1, 0x0108,
-    0xfe44, 0xfea1, 0x00e6, 0x0018, 0x0008, 0x0003, 0x0183, 0xff6f, 0x0115, 0x00da, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c,
-    0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0x01cc, 0xfea1, 0x0121, 0x014b, 0x003c, 0x0144, 0x014b,
-    0xfea1, 0x0144, 0x01cc, 0x003c, 0x0121, 0x01bc, 0x003c, 0x00e6, 0x013b, 0x003c, 0x0108, 0x01bc, 0xfea1, 0x00e6,
-    0x013b, 0xfea1, 0x0108, 0x0018, 0x0008, 0x0003, 0xfa98, 0xff6f, 0xfdac, 0x00da, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c,
-    0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0xfa95, 0xfea1, 0xfdf5, 0xfa62, 0x003c, 0xfd7a, 0xfa62,
-    0xfea1, 0xfd7a, 0xfa95, 0x003c, 0xfdf5, 0xface, 0x003c, 0xfddd, 0xfa9b, 0x003c, 0xfd62, 0xface, 0xfea1, 0xfddd,
-    0xfa9b, 0xfea1, 0xfd62, 0x0018, 0x0008, 0x0003, 0x0423, 0xff6f, 0xff92, 0x00da, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c,
-    0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0x0468, 0xfea1, 0xff79, 0x040a, 0x003c, 0xffd7, 0x040a,
-    0xfea1, 0xffd7, 0x0468, 0x003c, 0xff79, 0x043d, 0x003c, 0xff4d, 0x03de, 0x003c, 0xffab, 0x043d, 0xfea1, 0xff4d,
-    0x03de, 0xfea1, 0xffab, 0x0018, 0x0008, 0x0003, 0x05da, 0xff6f, 0xfbb1, 0x00da, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c,
-    0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0x05f9, 0xfea1, 0xfb6e, 0x05f9, 0x003c, 0xfbf3, 0x05f9,
-    0xfea1, 0xfbf3, 0x05f9, 0x003c, 0xfb6e, 0x05bb, 0x003c, 0xfb6e, 0x05bb, 0x003c, 0xfbf3, 0x05bb, 0xfea1, 0xfb6e,
-    0x05bb, 0xfea1, 0xfbf3, 0x0018, 0x0008, 0x0003, 0x0568, 0xff6f, 0xfdac, 0x00da, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x000c, 0x000f, 0x0012, 0x0009, 0x0000, 0x0009, 0x000f, 0x0003, 0x0006, 0x0003, 0x000f, 0x0012, 0x000c,
-    0x0009, 0x0000, 0x0009, 0x0003, 0x0006, 0x000f, 0x0015, 0x059e, 0xfea1, 0xfd7a, 0x056b, 0x003c, 0xfdf5, 0x056b,
-    0xfea1, 0xfdf5, 0x059e, 0x003c, 0xfd7a, 0x0565, 0x003c, 0xfd62, 0x0532, 0x003c, 0xfddd, 0x0565, 0xfea1, 0xfd62,
-    0x0532, 0xfea1, 0xfddd, 0x0030, 0x0014, 0x0003, 0xf8e1, 0xff73, 0xfbaf, 0x00de, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x000c, 0x000f, 0x0000, 0x0012, 0x0003, 0x0009, 0x0015, 0x000c, 0x0018, 0x0006, 0x0003, 0x001b, 0x0000,
-    0x0006, 0x001e, 0x0003, 0x0012, 0x001e, 0x0000, 0x0021, 0x0015, 0x0024, 0x000c, 0x0009, 0x0027, 0x0015, 0x000c,
-    0x002a, 0x000f, 0x0009, 0x002a, 0x002d, 0x0018, 0x001b, 0x0006, 0x001b, 0x0021, 0x0000, 0x001e, 0x0018, 0x0003,
-    0x001e, 0x0012, 0x0000, 0x0015, 0x0027, 0x0024, 0x0009, 0x002d, 0x0027, 0x000c, 0x0024, 0x002a, 0x0009, 0x000f,
-    0x002a, 0xf900, 0x0045, 0xfb6c, 0xf8c2, 0x0045, 0xfbf1, 0xf900, 0x0045, 0xfbf1, 0xf8c2, 0x0045, 0xfb6c, 0xf900,
-    0x0045, 0xfbf1, 0xf900, 0x0045, 0xfb6c, 0xf8c2, 0x0045, 0xfb6c, 0xf8c2, 0x0045, 0xfbf1, 0xf8c2, 0xfea1, 0xfbf1,
-    0xf900, 0xfea1, 0xfbf1, 0xf8c2, 0xfea1, 0xfb6c, 0xf900, 0xfea1, 0xfb6c, 0xf900, 0xfea1, 0xfbf1, 0xf8c2, 0xfea1,
-    0xfbf1, 0xf900, 0xfea1, 0xfb6c, 0xf8c2, 0xfea1, 0xfb6c, 0x0051, 0x0018, 0x0002, 0x0000, 0x06d8, 0x1289, 0x03d7,
-    0x0000, 0x000f, 0x004e, 0x003f, 0x004b, 0x0027, 0x0048, 0x0045, 0x0036, 0x0042, 0x0045, 0x0033, 0x003f, 0x0039,
-    0x003c, 0x003c, 0x0030, 0x0036, 0x0039, 0x0030, 0x0033, 0x002d, 0x002a, 0x002a, 0x001e, 0x001b, 0x0027, 0x0021,
-    0x0024, 0x0024, 0x0018, 0x001e, 0x0021, 0x0018, 0x001b, 0x0015, 0x0006, 0x0012, 0x0015, 0x0003, 0x000f, 0x0009,
-    0x000c, 0x000c, 0x0000, 0x0006, 0x0009, 0x0000, 0x0003, 0xff4e, 0x0688, 0x1289, 0xfea0, 0x0648, 0x1289, 0x0160,
-    0x0648, 0x1289, 0x00b2, 0x0688, 0x1289, 0x0000, 0x069e, 0x1289, 0xfe0b, 0x05e7, 0x1289, 0x0272, 0x0561, 0x1289,
-    0x01f5, 0x05e7, 0x1289, 0xff2e, 0x0745, 0x1289, 0xfe3e, 0x06ed, 0x1289, 0x01c2, 0x06ed, 0x1289, 0x00d2, 0x0745,
-    0x1289, 0x0000, 0x075e, 0x1289, 0xfd8f, 0x0679, 0x1289, 0x0271, 0x0679, 0x1289, 0x0311, 0x05ce, 0x1289, 0xfeee,
-    0x082e, 0x1289, 0xfdd9, 0x07c8, 0x1289, 0x0227, 0x07c8, 0x1289, 0x0112, 0x082e, 0x1289, 0x0000, 0x084f, 0x1289,
-    0xfcf4, 0x0732, 0x1289, 0x03d0, 0x0660, 0x1289, 0x030c, 0x0732, 0x1289, 0xfcef, 0x05ce, 0x1289, 0xfc30, 0x0660,
-    0x1289, 0xfd8e, 0x0561, 0x1289, 0x0018, 0x0008, 0x0002, 0x0000, 0x0118, 0x127f, 0x054f, 0x0000, 0x0015, 0x0003,
-    0x0000, 0x0012, 0x0006, 0x000f, 0x0012, 0x0015, 0x000f, 0x000c, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003,
-    0xfb6e, 0x03cc, 0x127f, 0x0492, 0x03cc, 0x127f, 0xfedc, 0xff89, 0x127f, 0xfedc, 0xfe64, 0x127f, 0x0124, 0xfe64,
-    0x127f, 0x0124, 0xff89, 0x127f, 0xfedc, 0xfffe, 0x127f, 0x0124, 0xfffe, 0x127f, 0x0018, 0x000c, 0x0002, 0xfe6a,
-    0xfde2, 0x0724, 0x00a0, 0x0000, 0x000c, 0x0009, 0x0015, 0x000c, 0x0015, 0x0006, 0x0015, 0x0000, 0x0000, 0x0012,
-    0x0006, 0x0012, 0x0012, 0x000f, 0x0009, 0x000f, 0x0003, 0x000f, 0x000c, 0x0003, 0x0006, 0x0009, 0x0000, 0x0003,
-    0xfe74, 0xfd42, 0x072e, 0xfe60, 0xfd42, 0x072e, 0xfe74, 0xfe82, 0x071a, 0xfe60, 0xfe82, 0x071a, 0xfe60, 0xfd42,
-    0x071a, 0xfe60, 0xfe82, 0x072e, 0xfe74, 0xfe82, 0x072e, 0xfe74, 0xfd42, 0x071a, 0x0018, 0x000c, 0x0002, 0x0196,
-    0xfde2, 0x0724, 0x00a0, 0x0000, 0x000c, 0x0009, 0x0015, 0x000c, 0x0015, 0x0006, 0x0015, 0x0000, 0x0000, 0x0012,
-    0x0006, 0x0012, 0x0012, 0x000f, 0x0009, 0x000f, 0x0003, 0x000f, 0x000c, 0x0003, 0x0006, 0x0009, 0x0000, 0x0003,
-    0x018c, 0xfd42, 0x072e, 0x01a0, 0xfd42, 0x072e, 0x018c, 0xfe82, 0x071a, 0x01a0, 0xfe82, 0x071a, 0x01a0, 0xfd42,
-    0x071a, 0x01a0, 0xfe82, 0x072e, 0x018c, 0xfe82, 0x072e, 0x018c, 0xfd42, 0x071a, 0x0030, 0x0010, 0x0002, 0x0000,
-    0xfdb3, 0x0592, 0x010e, 0x0000, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x0018,
-    0x001e, 0x0021, 0x001e, 0x001b, 0x0018, 0x001b, 0x0015, 0x000c, 0x0012, 0x0015, 0x000f, 0x0012, 0x000c, 0x000f,
-    0x0009, 0x0000, 0x0006, 0x0009, 0x0006, 0x0003, 0x0000, 0x0003, 0xff21, 0xfe23, 0x0592, 0xff0a, 0xfe23, 0x0592,
-    0xff0a, 0xfd42, 0x0592, 0xff21, 0xfd42, 0x0592, 0xff93, 0xfd42, 0x0592, 0xffa9, 0xfd42, 0x0592, 0xffa9, 0xfe23,
-    0x0592, 0xff93, 0xfe23, 0x0592, 0x00df, 0xfe23, 0x0592, 0x00f6, 0xfe23, 0x0592, 0x00f6, 0xfd42, 0x0592, 0x00df,
-    0xfd42, 0x0592, 0x006d, 0xfd42, 0x0592, 0x0057, 0xfd42, 0x0592, 0x0057, 0xfe23, 0x0592, 0x006d, 0xfe23, 0x0592,
-    0x000c, 0x0002, 0x0003, 0x0000, 0xfe2e, 0x05aa, 0x0101, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003,
-    0x00ff, 0xfe51, 0x05aa, 0xff01, 0xfe0a, 0x05aa, 0x00ff, 0xfe0a, 0x05aa, 0xff01, 0xfe51, 0x05aa, 0x0057, 0x001c,
-    0x0002, 0x0000, 0xfe83, 0x0661, 0x027e, 0x0000, 0x002a, 0x0054, 0x0054, 0x0051, 0x0051, 0x004e, 0x004e, 0x004b,
-    0x004b, 0x0048, 0x0048, 0x0045, 0x0045, 0x0042, 0x0042, 0x003f, 0x003f, 0x003c, 0x003c, 0x0039, 0x0039, 0x0036,
-    0x0036, 0x002d, 0x0030, 0x0033, 0x002d, 0x0030, 0x002a, 0x0027, 0x0027, 0x0024, 0x0024, 0x0021, 0x0021, 0x001e,
-    0x001e, 0x001b, 0x001b, 0x0018, 0x0018, 0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f, 0x000c, 0x000c, 0x0009,
-    0x0009, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xfdff, 0xfe82, 0x0707, 0xfdc0, 0xfe83, 0x0707, 0xfdbf, 0xfe83,
-    0x0550, 0xfdff, 0xfe82, 0x061d, 0xfe35, 0xfe83, 0x061d, 0xfe35, 0xfe83, 0x072e, 0xfea0, 0xfe82, 0x072e, 0xfea0,
-    0xfe82, 0x05f0, 0xfeeb, 0xfe83, 0x05f0, 0xfeeb, 0xfe83, 0x075b, 0xff70, 0xfe82, 0x075b, 0xff6f, 0xfe82, 0x05d9,
-    0xffc2, 0xfe83, 0x05d9, 0xffc3, 0xfe83, 0x0772, 0x0000, 0xfe82, 0x0772, 0x0201, 0xfe82, 0x0707, 0x0240, 0xfe83,
-    0x0707, 0x0241, 0xfe83, 0x0550, 0x0201, 0xfe82, 0x061d, 0x01cb, 0xfe83, 0x061d, 0x01cb, 0xfe83, 0x072e, 0x0160,
-    0xfe82, 0x072e, 0x0160, 0xfe82, 0x05f0, 0x0115, 0xfe83, 0x05f0, 0x0115, 0xfe83, 0x075b, 0x0090, 0xfe82, 0x075b,
-    0x0091, 0xfe82, 0x05d9, 0x003e, 0xfe83, 0x05d9, 0x003d, 0xfe83, 0x0772, 0x001b, 0x0006, 0x0003, 0x02a6, 0x0239,
-    0xf8d3, 0x0306, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0000, 0x000c, 0x000c, 0x0006, 0x000f, 0x0000, 0x0012,
-    0x0003, 0x0009, 0x0012, 0x0000, 0x000c, 0x0000, 0x0006, 0x054d, 0x0274, 0xfa42, 0x0379, 0x0274, 0xf763, 0x0379,
-    0x0274, 0xfa42, 0x054d, 0x01ff, 0xf763, 0x054d, 0x01ff, 0xfa42, 0x0379, 0x01ff, 0xfa42, 0x054d, 0x0274, 0xf763,
-    0x0000, 0x01ff, 0xf763, 0x0000, 0x0274, 0xf763, 0x001b, 0x0008, 0x0003, 0x029a, 0x0239, 0xf906, 0x01de, 0x0000,
-    0x0000, 0x0003, 0x0006, 0x0009, 0x0003, 0x000c, 0x000f, 0x0012, 0x0015, 0x0015, 0x0006, 0x0003, 0x0000, 0x000c,
-    0x0003, 0x0009, 0x0015, 0x0003, 0x000f, 0x0018, 0x0012, 0x0015, 0x0012, 0x0006, 0x01bc, 0x01ff, 0xfaa9, 0x0379,
-    0x0274, 0xfaa9, 0x01bc, 0x0274, 0xfaa9, 0x0379, 0x01ff, 0xfa42, 0x0379, 0x01ff, 0xfaa9, 0x0379, 0x0274, 0xf763,
-    0x01bc, 0x0274, 0xfa42, 0x0379, 0x0274, 0xfa42, 0x01bc, 0x0274, 0xf763, 0x0018, 0x0006, 0x0003, 0x00de, 0x0239,
-    0xf906, 0x01dd, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0000, 0x000f, 0x0006, 0x0003, 0x0000, 0x000c,
-    0x0003, 0x0009, 0x0012, 0x000c, 0x000f, 0x0015, 0x0006, 0x01bc, 0x0274, 0xfa42, 0x0000, 0x0274, 0xfaa9, 0x01bc,
-    0x0274, 0xfaa9, 0x01bc, 0x0274, 0xf763, 0x0000, 0x0274, 0xfa42, 0x0000, 0x01ff, 0xfaa9, 0x0000, 0x0274, 0xf763,
-    0x01bc, 0x01ff, 0xfaa9, 0x0018, 0x0006, 0x0003, 0xff22, 0x0239, 0xf906, 0x01dd, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x000c, 0x0003, 0x0006, 0x000f, 0x0000, 0x0000, 0x0009, 0x0003, 0x0009, 0x0012, 0x000c, 0x0006, 0x0015,
-    0x000f, 0x0000, 0x0274, 0xfaa9, 0xfe44, 0x0274, 0xfa42, 0xfe44, 0x0274, 0xfaa9, 0x0000, 0x0274, 0xfa42, 0xfe44,
-    0x0274, 0xf763, 0x0000, 0x01ff, 0xfaa9, 0x0000, 0x0274, 0xf763, 0xfe44, 0x01ff, 0xfaa9, 0x001b, 0x0008, 0x0003,
-    0xfd66, 0x0239, 0xf906, 0x01de, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x000c, 0x000f, 0x0012, 0x0015,
-    0x0006, 0x0015, 0x0000, 0x0000, 0x000c, 0x0003, 0x0000, 0x0015, 0x0009, 0x000f, 0x0018, 0x0012, 0x0006, 0x000f,
-    0x0015, 0xfc87, 0x0274, 0xfaa9, 0xfe44, 0x01ff, 0xfaa9, 0xfe44, 0x0274, 0xfaa9, 0xfc87, 0x01ff, 0xfa42, 0xfc87,
-    0x01ff, 0xfaa9, 0xfe44, 0x0274, 0xfa42, 0xfc87, 0x0274, 0xf763, 0xfc87, 0x0274, 0xfa42, 0xfe44, 0x0274, 0xf763,
-    0x0015, 0x0006, 0x0003, 0xfb9d, 0x0239, 0xf8d3, 0x01b8, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x000c,
-    0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0003, 0x0003, 0x0012, 0x0009, 0x0006, 0x0003, 0x000c, 0xfc87, 0x0274,
-    0xf763, 0xfab3, 0x0274, 0xfa42, 0xfc87, 0x0274, 0xfa42, 0xfab3, 0x01ff, 0xf763, 0xfab3, 0x01ff, 0xfa42, 0xfc87,
-    0x01ff, 0xfa42, 0xfab3, 0x0274, 0xf763, 0x0018, 0x000a, 0x0003, 0x030f, 0x027e, 0xfa57, 0x005a, 0x0000, 0x0000,
-    0x0003, 0x0006, 0x0009, 0x0000, 0x000c, 0x000f, 0x0006, 0x0012, 0x0009, 0x000c, 0x000f, 0x0000, 0x0006, 0x000c,
-    0x0012, 0x0015, 0x0009, 0x000f, 0x000c, 0x0006, 0x0006, 0x0015, 0x0012, 0x0012, 0x0009, 0x000f, 0x0006, 0x0003,
-    0x0015, 0x034f, 0x0274, 0xfa96, 0x034f, 0x0274, 0xfa18, 0x034f, 0x0289, 0xfa18, 0x02d0, 0x0274, 0xfa96, 0x034f,
-    0x0289, 0xfa96, 0x02d0, 0x0289, 0xfa96, 0x02d0, 0x0289, 0xfa18, 0x02d0, 0x0274, 0xfa18, 0x0018, 0x000a, 0x0003,
-    0x0104, 0x027e, 0xfa57, 0x005a, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0000, 0x000c, 0x000f, 0x0006, 0x0012,
-    0x0009, 0x000c, 0x000f, 0x0000, 0x0006, 0x000c, 0x0012, 0x0015, 0x0009, 0x000f, 0x000c, 0x0006, 0x0006, 0x0015,
-    0x0012, 0x0012, 0x0009, 0x000f, 0x0006, 0x0003, 0x0015, 0x0144, 0x0274, 0xfa96, 0x0144, 0x0274, 0xfa18, 0x0144,
-    0x0289, 0xfa18, 0x00c5, 0x0274, 0xfa96, 0x0144, 0x0289, 0xfa96, 0x00c5, 0x0289, 0xfa96, 0x00c5, 0x0289, 0xfa18,
-    0x00c5, 0x0274, 0xfa18, 0x0018, 0x000a, 0x0003, 0xfefa, 0x027e, 0xfa57, 0x005a, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0009, 0x0000, 0x000c, 0x000f, 0x0006, 0x0012, 0x0009, 0x000c, 0x000f, 0x0000, 0x0006, 0x000c, 0x0012, 0x0015,
-    0x0009, 0x000f, 0x000c, 0x0006, 0x0006, 0x0015, 0x0012, 0x0012, 0x0009, 0x000f, 0x0006, 0x0003, 0x0015, 0xff39,
-    0x0274, 0xfa96, 0xff39, 0x0274, 0xfa18, 0xff39, 0x0289, 0xfa18, 0xfeba, 0x0274, 0xfa96, 0xff39, 0x0289, 0xfa96,
-    0xfeba, 0x0289, 0xfa96, 0xfeba, 0x0289, 0xfa18, 0xfeba, 0x0274, 0xfa18, 0x0018, 0x000a, 0x0003, 0xfcef, 0x027e,
-    0xfa57, 0x005a, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0000, 0x000c, 0x000f, 0x0006, 0x0012, 0x0009, 0x000c,
-    0x000f, 0x0000, 0x0006, 0x000c, 0x0012, 0x0015, 0x0009, 0x000f, 0x000c, 0x0006, 0x0006, 0x0015, 0x0012, 0x0012,
-    0x0009, 0x000f, 0x0006, 0x0003, 0x0015, 0xfd2e, 0x0274, 0xfa96, 0xfd2e, 0x0274, 0xfa18, 0xfd2e, 0x0289, 0xfa18,
-    0xfcaf, 0x0274, 0xfa96, 0xfd2e, 0x0289, 0xfa96, 0xfcaf, 0x0289, 0xfa96, 0xfcaf, 0x0289, 0xfa18, 0xfcaf, 0x0274,
-    0xfa18, 0x0018, 0x0008, 0x0002, 0xfe3c, 0xfea2, 0x02d5, 0x0043, 0x0000, 0x0003, 0x0015, 0x0015, 0x0012, 0x0012,
-    0x000f, 0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xfdfe, 0xfea2, 0x02bb,
-    0xfe23, 0xfea2, 0x0297, 0xfdfe, 0xfea2, 0x02ef, 0xfe23, 0xfea2, 0x0313, 0xfe56, 0xfea2, 0x0313, 0xfe7a, 0xfea2,
-    0x02ef, 0xfe7a, 0xfea2, 0x02bb, 0xfe56, 0xfea2, 0x0297, 0x0018, 0x0008, 0x0002, 0xfd97, 0xfea2, 0x022f, 0x0044,
-    0x0000, 0x0003, 0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 0x0006,
-    0x0000, 0x0000, 0x0003, 0xfd59, 0xfea2, 0x0216, 0xfd7d, 0xfea2, 0x01f1, 0xfd59, 0xfea2, 0x0249, 0xfd7d, 0xfea2,
-    0x026e, 0xfdb1, 0xfea2, 0x026e, 0xfdd5, 0xfea2, 0x0249, 0xfdd5, 0xfea2, 0x0216, 0xfdb1, 0xfea2, 0x01f1, 0x0018,
-    0x0008, 0x0002, 0xfd97, 0xfea2, 0x037a, 0x0044, 0x0000, 0x0003, 0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f,
-    0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xfd59, 0xfea2, 0x0361, 0xfd7d, 0xfea2,
-    0x033c, 0xfd59, 0xfea2, 0x0394, 0xfd7d, 0xfea2, 0x03b9, 0xfdb1, 0xfea2, 0x03b9, 0xfdd5, 0xfea2, 0x0394, 0xfdd5,
-    0xfea2, 0x0361, 0xfdb1, 0xfea2, 0x033c, 0x0018, 0x0008, 0x0002, 0xfcf1, 0xfea2, 0x02d5, 0x0043, 0x0000, 0x0003,
-    0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000,
-    0x0003, 0xfcb3, 0xfea2, 0x02bb, 0xfcd7, 0xfea2, 0x0297, 0xfcb3, 0xfea2, 0x02ef, 0xfcd7, 0xfea2, 0x0313, 0xfd0b,
-    0xfea2, 0x0313, 0xfd2f, 0xfea2, 0x02ef, 0xfd2f, 0xfea2, 0x02bb, 0xfd0b, 0xfea2, 0x0297, 0x0024, 0x000c, 0x0002,
-    0x0269, 0xfea2, 0x02d5, 0x0106, 0x0000, 0x0021, 0x000c, 0x000f, 0x001b, 0x0015, 0x0000, 0x0003, 0x0018, 0x0009,
-    0x0021, 0x0012, 0x001e, 0x001b, 0x001e, 0x0018, 0x0006, 0x0012, 0x0015, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000,
-    0x0003, 0x0362, 0xfea2, 0x0328, 0x0362, 0xfea2, 0x0282, 0x02bc, 0xfea2, 0x01dd, 0x0216, 0xfea2, 0x01dd, 0x0171,
-    0xfea2, 0x0282, 0x0171, 0xfea2, 0x0328, 0x02bc, 0xfea2, 0x03cd, 0x02bc, 0xfea2, 0x0328, 0x02bc, 0xfea2, 0x0282,
-    0x0216, 0xfea2, 0x0328, 0x0216, 0xfea2, 0x03cd, 0x0216, 0xfea2, 0x0282, 0x0018, 0x0008, 0x0002, 0xffd9, 0xfea2,
-    0x02d5, 0x0095, 0x0000, 0x0009, 0x0003, 0x0006, 0x0000, 0x0015, 0x000f, 0x0012, 0x000c, 0x0012, 0x0015, 0x000c,
-    0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 0x0005, 0xfea2, 0x02ea, 0x0005, 0xfea2, 0x02c0, 0x006d, 0xfea2, 0x02ea,
-    0x006d, 0xfea2, 0x02c0, 0xffad, 0xfea2, 0x02c0, 0xffad, 0xfea2, 0x02ea, 0xff45, 0xfea2, 0x02c0, 0xff45, 0xfea2,
-    0x02ea, 0x0078, 0x0034, 0x0002, 0x00de, 0xff30, 0x012b, 0x00b2, 0x0000, 0x0069, 0x0072, 0x0075, 0x0072, 0x0063,
-    0x0075, 0x0066, 0x0075, 0x0072, 0x0060, 0x006f, 0x0066, 0x006c, 0x006f, 0x004e, 0x005d, 0x005d, 0x0051, 0x0054,
-    0x005a, 0x0069, 0x006c, 0x006f, 0x0063, 0x0060, 0x006c, 0x0066, 0x0069, 0x0060, 0x0063, 0x0057, 0x005a, 0x004b,
-    0x005d, 0x0051, 0x0057, 0x005a, 0x0048, 0x004b, 0x0057, 0x0054, 0x004e, 0x0051, 0x0054, 0x0048, 0x004e, 0x0048,
-    0x004b, 0x0045, 0x0030, 0x0039, 0x0045, 0x0042, 0x003c, 0x003f, 0x0042, 0x0033, 0x003f, 0x003c, 0x0036, 0x0036,
-    0x0039, 0x0030, 0x0033, 0x0021, 0x002d, 0x002d, 0x0018, 0x001b, 0x002a, 0x0027, 0x001e, 0x002a, 0x0024, 0x0024,
-    0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0006, 0x000c, 0x0000, 0x000f, 0x0003, 0x0009, 0x0015, 0x000f,
-    0x0015, 0x0015, 0x0012, 0x0012, 0x000c, 0x000c, 0x000f, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000,
-    0x0003, 0x0074, 0xfea1, 0x012b, 0x00df, 0xfea1, 0x0196, 0x00df, 0xfea1, 0x00c1, 0x0149, 0xfea1, 0x012b, 0x0074,
-    0xfecb, 0x012b, 0x00df, 0xfecb, 0x0196, 0x00df, 0xfecb, 0x00c1, 0x0149, 0xfecb, 0x012b, 0x010b, 0xfed7, 0x013e,
-    0x010b, 0xfed7, 0x0119, 0x00b3, 0xfed7, 0x013e, 0x00cc, 0xfed7, 0x0158, 0x00cc, 0xfed7, 0x00ff, 0x00b3, 0xfed7,
-    0x0119, 0x00f1, 0xfed7, 0x00ff, 0x00f1, 0xfed7, 0x0158, 0x00ec, 0xfee1, 0x014d, 0x0100, 0xfee1, 0x0139, 0x00be,
-    0xfee1, 0x011e, 0x00be, 0xfee1, 0x0139, 0x00d1, 0xfee1, 0x010a, 0x0100, 0xfee1, 0x011e, 0x00ec, 0xfee1, 0x010a,
-    0x00d1, 0xfee1, 0x014d, 0x00ee, 0xfee8, 0x011c, 0x00d0, 0xfee8, 0x011c, 0x00ee, 0xffbe, 0x011c, 0x00d0, 0xffbe,
-    0x013a, 0x00ee, 0xffbe, 0x013a, 0x00d0, 0xfee8, 0x013a, 0x00ee, 0xfee8, 0x013a, 0x00d0, 0xffbe, 0x011c, 0x00e7,
-    0xfecc, 0x017e, 0x00e7, 0xfecc, 0x016d, 0x00d6, 0xfed4, 0x016d, 0x00d6, 0xfed4, 0x017e, 0x00e7, 0xfed4, 0x017e,
-    0x00e7, 0xfed4, 0x016d, 0x00d6, 0xfecc, 0x017e, 0x00d6, 0xfecc, 0x016d, 0x0078, 0x0034, 0x0002, 0xff22, 0xff30,
-    0x012b, 0x00b2, 0x0000, 0x0069, 0x0072, 0x0075, 0x0072, 0x0063, 0x0075, 0x0066, 0x0075, 0x0072, 0x0060, 0x006f,
-    0x0066, 0x006c, 0x006f, 0x004e, 0x005d, 0x005d, 0x0051, 0x0054, 0x005a, 0x0069, 0x006c, 0x006f, 0x0063, 0x0060,
-    0x006c, 0x0066, 0x0069, 0x0060, 0x0063, 0x0057, 0x005a, 0x004b, 0x005d, 0x0051, 0x0057, 0x005a, 0x0048, 0x004b,
-    0x0057, 0x0054, 0x004e, 0x0051, 0x0054, 0x0048, 0x004e, 0x0048, 0x004b, 0x0045, 0x0030, 0x0039, 0x0045, 0x0042,
-    0x003c, 0x003f, 0x0042, 0x0033, 0x003f, 0x003c, 0x0036, 0x0036, 0x0039, 0x0030, 0x0033, 0x0021, 0x002d, 0x002d,
-    0x0018, 0x001b, 0x002a, 0x0027, 0x001e, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012,
-    0x0006, 0x000c, 0x0000, 0x000f, 0x0003, 0x0009, 0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0012, 0x000c, 0x000c,
-    0x000f, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xff8c, 0xfea1, 0x012b, 0xff21, 0xfea1,
-    0x0196, 0xff21, 0xfea1, 0x00c1, 0xfeb7, 0xfea1, 0x012b, 0xff8c, 0xfecb, 0x012b, 0xff21, 0xfecb, 0x0196, 0xff21,
-    0xfecb, 0x00c1, 0xfeb7, 0xfecb, 0x012b, 0xfef5, 0xfed7, 0x013e, 0xfef5, 0xfed7, 0x0119, 0xff4d, 0xfed7, 0x013e,
-    0xff34, 0xfed7, 0x0158, 0xff34, 0xfed7, 0x00ff, 0xff4d, 0xfed7, 0x0119, 0xff0f, 0xfed7, 0x00ff, 0xff0f, 0xfed7,
-    0x0158, 0xff14, 0xfee1, 0x014d, 0xff00, 0xfee1, 0x0139, 0xff42, 0xfee1, 0x011e, 0xff42, 0xfee1, 0x0139, 0xff2f,
-    0xfee1, 0x010a, 0xff00, 0xfee1, 0x011e, 0xff14, 0xfee1, 0x010a, 0xff2f, 0xfee1, 0x014d, 0xff12, 0xfee8, 0x011c,
-    0xff30, 0xfee8, 0x011c, 0xff12, 0xffbe, 0x011c, 0xff30, 0xffbe, 0x013a, 0xff12, 0xffbe, 0x013a, 0xff30, 0xfee8,
-    0x013a, 0xff12, 0xfee8, 0x013a, 0xff30, 0xffbe, 0x011c, 0xff19, 0xfecc, 0x017e, 0xff19, 0xfecc, 0x016d, 0xff2a,
-    0xfed4, 0x016d, 0xff2a, 0xfed4, 0x017e, 0xff19, 0xfed4, 0x017e, 0xff19, 0xfed4, 0x016d, 0xff2a, 0xfecc, 0x017e,
-    0xff2a, 0xfecc, 0x016d, 0x0078, 0x0034, 0x0002, 0xfc60, 0xff30, 0xfff8, 0x00b2, 0x0000, 0x0069, 0x0072, 0x0075,
-    0x0072, 0x0063, 0x0075, 0x0066, 0x0075, 0x0072, 0x0060, 0x006f, 0x0066, 0x006c, 0x006f, 0x004e, 0x005d, 0x005d,
-    0x0051, 0x0054, 0x005a, 0x0069, 0x006c, 0x006f, 0x0063, 0x0060, 0x006c, 0x0066, 0x0069, 0x0060, 0x0063, 0x0057,
-    0x005a, 0x004b, 0x005d, 0x0051, 0x0057, 0x005a, 0x0048, 0x004b, 0x0057, 0x0054, 0x004e, 0x0051, 0x0054, 0x0048,
-    0x004e, 0x0048, 0x004b, 0x0045, 0x0030, 0x0039, 0x0045, 0x0042, 0x003c, 0x003f, 0x0042, 0x0033, 0x003f, 0x003c,
-    0x0036, 0x0036, 0x0039, 0x0030, 0x0033, 0x0021, 0x002d, 0x002d, 0x0018, 0x001b, 0x002a, 0x0027, 0x001e, 0x002a,
-    0x0024, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0006, 0x000c, 0x0000, 0x000f, 0x0003, 0x0009,
-    0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0012, 0x000c, 0x000c, 0x000f, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006,
-    0x0000, 0x0000, 0x0003, 0xfcbc, 0xfea1, 0x002c, 0xfc2b, 0xfea1, 0x0053, 0xfc95, 0xfea1, 0xff9c, 0xfc04, 0xfea1,
-    0xffc3, 0xfcbc, 0xfecb, 0x002c, 0xfc2b, 0xfecb, 0x0053, 0xfc95, 0xfecb, 0xff9c, 0xfc04, 0xfecb, 0xffc3, 0xfc31,
-    0xfed7, 0xfff2, 0xfc43, 0xfed7, 0xffd2, 0xfc7d, 0xfed7, 0x001d, 0xfc5a, 0xfed7, 0x0026, 0xfc86, 0xfed7, 0xffdb,
-    0xfc8f, 0xfed7, 0xfffe, 0xfc66, 0xfed7, 0xffc9, 0xfc3a, 0xfed7, 0x0014, 0xfc44, 0xfee1, 0x000d, 0xfc3d, 0xfee1,
-    0xfff3, 0xfc84, 0xfee1, 0xfffd, 0xfc76, 0xfee1, 0x0013, 0xfc7d, 0xfee1, 0xffe2, 0xfc4a, 0xfee1, 0xffdb, 0xfc65,
-    0xfee1, 0xffd4, 0xfc5b, 0xfee1, 0x001a, 0xfc5b, 0xfee8, 0xffe3, 0xfc75, 0xfee8, 0xfff2, 0xfc5b, 0xffbe, 0xffe3,
-    0xfc66, 0xffbe, 0x000b, 0xfc4c, 0xffbe, 0xfffd, 0xfc66, 0xfee8, 0x000b, 0xfc4c, 0xfee8, 0xfffd, 0xfc75, 0xffbe,
-    0xfff2, 0xfc2f, 0xfecc, 0x003a, 0xfc38, 0xfecc, 0x002c, 0xfc47, 0xfed4, 0x0034, 0xfc3e, 0xfed4, 0x0043, 0xfc2f,
-    0xfed4, 0x003a, 0xfc38, 0xfed4, 0x002c, 0xfc3e, 0xfecc, 0x0043, 0xfc47, 0xfecc, 0x0034, 0x0078, 0x0034, 0x0002,
-    0xfde3, 0xff30, 0x00d6, 0x00b2, 0x0000, 0x0069, 0x0072, 0x0075, 0x0072, 0x0063, 0x0075, 0x0066, 0x0075, 0x0072,
-    0x0060, 0x006f, 0x0066, 0x006c, 0x006f, 0x004e, 0x005d, 0x005d, 0x0051, 0x0054, 0x005a, 0x0069, 0x006c, 0x006f,
-    0x0063, 0x0060, 0x006c, 0x0066, 0x0069, 0x0060, 0x0063, 0x0057, 0x005a, 0x004b, 0x005d, 0x0051, 0x0057, 0x005a,
-    0x0048, 0x004b, 0x0057, 0x0054, 0x004e, 0x0051, 0x0054, 0x0048, 0x004e, 0x0048, 0x004b, 0x0045, 0x0030, 0x0039,
-    0x0045, 0x0042, 0x003c, 0x003f, 0x0042, 0x0033, 0x003f, 0x003c, 0x0036, 0x0036, 0x0039, 0x0030, 0x0033, 0x0021,
-    0x002d, 0x002d, 0x0018, 0x001b, 0x002a, 0x0027, 0x001e, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018,
-    0x001b, 0x0012, 0x0006, 0x000c, 0x0000, 0x000f, 0x0003, 0x0009, 0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0012,
-    0x000c, 0x000c, 0x000f, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xfd86, 0xfea1, 0x00a1,
-    0xfdad, 0xfea1, 0x0132, 0xfe18, 0xfea1, 0x007a, 0xfe3f, 0xfea1, 0x010b, 0xfd86, 0xfecb, 0x00a1, 0xfdad, 0xfecb,
-    0x0132, 0xfe18, 0xfecb, 0x007a, 0xfe3f, 0xfecb, 0x010b, 0xfe00, 0xfed7, 0x00fc, 0xfe12, 0xfed7, 0x00dc, 0xfdb3,
-    0xfed7, 0x00d0, 0xfdbd, 0xfed7, 0x00f3, 0xfde9, 0xfed7, 0x00a7, 0xfdc5, 0xfed7, 0x00b0, 0xfe08, 0xfed7, 0x00b9,
-    0xfddc, 0xfed7, 0x0105, 0xfdde, 0xfee1, 0x00fa, 0xfdf8, 0xfee1, 0x00f2, 0xfdcd, 0xfee1, 0x00ba, 0xfdbf, 0xfee1,
-    0x00d1, 0xfde7, 0xfee1, 0x00b3, 0xfe06, 0xfee1, 0x00db, 0xfdff, 0xfee1, 0x00c0, 0xfdc6, 0xfee1, 0x00ec, 0xfdf7,
-    0xfee8, 0x00d1, 0xfddd, 0xfee8, 0x00c2, 0xfdf7, 0xffbe, 0x00d1, 0xfdce, 0xffbe, 0x00db, 0xfde8, 0xffbe, 0x00ea,
-    0xfdce, 0xfee8, 0x00db, 0xfde8, 0xfee8, 0x00ea, 0xfddd, 0xffbe, 0x00c2, 0xfdc1, 0xfecc, 0x0122, 0xfdc9, 0xfecc,
-    0x0113, 0xfdba, 0xfed4, 0x010b, 0xfdb2, 0xfed4, 0x0119, 0xfdc1, 0xfed4, 0x0122, 0xfdc9, 0xfed4, 0x0113, 0xfdb2,
-    0xfecc, 0x0119, 0xfdba, 0xfecc, 0x010b, 0x0078, 0x0034, 0x0002, 0x021d, 0xff30, 0x00d6, 0x00b2, 0x0000, 0x0069,
-    0x0072, 0x0075, 0x0072, 0x0063, 0x0075, 0x0066, 0x0075, 0x0072, 0x0060, 0x006f, 0x0066, 0x006c, 0x006f, 0x004e,
-    0x005d, 0x005d, 0x0051, 0x0054, 0x005a, 0x0069, 0x006c, 0x006f, 0x0063, 0x0060, 0x006c, 0x0066, 0x0069, 0x0060,
-    0x0063, 0x0057, 0x005a, 0x004b, 0x005d, 0x0051, 0x0057, 0x005a, 0x0048, 0x004b, 0x0057, 0x0054, 0x004e, 0x0051,
-    0x0054, 0x0048, 0x004e, 0x0048, 0x004b, 0x0045, 0x0030, 0x0039, 0x0045, 0x0042, 0x003c, 0x003f, 0x0042, 0x0033,
-    0x003f, 0x003c, 0x0036, 0x0036, 0x0039, 0x0030, 0x0033, 0x0021, 0x002d, 0x002d, 0x0018, 0x001b, 0x002a, 0x0027,
-    0x001e, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0006, 0x000c, 0x0000, 0x000f,
-    0x0003, 0x0009, 0x0015, 0x000f, 0x0015, 0x0015, 0x0012, 0x0012, 0x000c, 0x000c, 0x000f, 0x0003, 0x0009, 0x0009,
-    0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0x027a, 0xfea1, 0x00a1, 0x0253, 0xfea1, 0x0132, 0x01e8, 0xfea1, 0x007a,
-    0x01c1, 0xfea1, 0x010b, 0x027a, 0xfecb, 0x00a1, 0x0253, 0xfecb, 0x0132, 0x01e8, 0xfecb, 0x007a, 0x01c1, 0xfecb,
-    0x010b, 0x0200, 0xfed7, 0x00fc, 0x01ee, 0xfed7, 0x00dc, 0x024d, 0xfed7, 0x00d0, 0x0243, 0xfed7, 0x00f3, 0x0217,
-    0xfed7, 0x00a7, 0x023b, 0xfed7, 0x00b0, 0x01f8, 0xfed7, 0x00b9, 0x0224, 0xfed7, 0x0105, 0x0222, 0xfee1, 0x00fa,
-    0x0208, 0xfee1, 0x00f2, 0x0233, 0xfee1, 0x00ba, 0x0241, 0xfee1, 0x00d1, 0x0219, 0xfee1, 0x00b3, 0x01fa, 0xfee1,
-    0x00db, 0x0201, 0xfee1, 0x00c0, 0x023a, 0xfee1, 0x00ec, 0x0209, 0xfee8, 0x00d1, 0x0223, 0xfee8, 0x00c2, 0x0209,
-    0xffbe, 0x00d1, 0x0232, 0xffbe, 0x00db, 0x0218, 0xffbe, 0x00ea, 0x0232, 0xfee8, 0x00db, 0x0218, 0xfee8, 0x00ea,
-    0x0223, 0xffbe, 0x00c2, 0x023f, 0xfecc, 0x0122, 0x0237, 0xfecc, 0x0113, 0x0246, 0xfed4, 0x010b, 0x024e, 0xfed4,
-    0x0119, 0x023f, 0xfed4, 0x0122, 0x0237, 0xfed4, 0x0113, 0x024e, 0xfecc, 0x0119, 0x0246, 0xfecc, 0x010b, 0x0078,
-    0x0034, 0x0002, 0x03a0, 0xff30, 0xfff8, 0x00b2, 0x0000, 0x0072, 0x0066, 0x006c, 0x0060, 0x006f, 0x0063, 0x0069,
-    0x0075, 0x006f, 0x0075, 0x0075, 0x0072, 0x0072, 0x006c, 0x006c, 0x006f, 0x0063, 0x0069, 0x0069, 0x0066, 0x0066,
-    0x0060, 0x0060, 0x0063, 0x0051, 0x005a, 0x005d, 0x005a, 0x004b, 0x005d, 0x004e, 0x005d, 0x005a, 0x0048, 0x0057,
-    0x004e, 0x0054, 0x0057, 0x0036, 0x0045, 0x0045, 0x0039, 0x003c, 0x0042, 0x0051, 0x0054, 0x0057, 0x004b, 0x0048,
-    0x0054, 0x004e, 0x0051, 0x0048, 0x004b, 0x003f, 0x0042, 0x0033, 0x0045, 0x0039, 0x003f, 0x0042, 0x0030, 0x0033,
-    0x003f, 0x003c, 0x0036, 0x0039, 0x003c, 0x0030, 0x0036, 0x0030, 0x0033, 0x002d, 0x0018, 0x0021, 0x002d, 0x002a,
-    0x0024, 0x0027, 0x002a, 0x001b, 0x0027, 0x0024, 0x001e, 0x001e, 0x0021, 0x0018, 0x001b, 0x0009, 0x0015, 0x0015,
-    0x0000, 0x0003, 0x0012, 0x000f, 0x0006, 0x0012, 0x000c, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 0x03cf,
-    0xfed7, 0xfff2, 0x03bd, 0xfed7, 0xffd2, 0x0383, 0xfed7, 0x001d, 0x03a6, 0xfed7, 0x0026, 0x037a, 0xfed7, 0xffdb,
-    0x0371, 0xfed7, 0xfffe, 0x039a, 0xfed7, 0xffc9, 0x03c6, 0xfed7, 0x0014, 0x03bc, 0xfee1, 0x000d, 0x03c3, 0xfee1,
-    0xfff3, 0x037c, 0xfee1, 0xfffd, 0x038a, 0xfee1, 0x0013, 0x0383, 0xfee1, 0xffe2, 0x03b6, 0xfee1, 0xffdb, 0x039b,
-    0xfee1, 0xffd4, 0x03a5, 0xfee1, 0x001a, 0x03a5, 0xfee8, 0xffe3, 0x038b, 0xfee8, 0xfff2, 0x03a5, 0xffbe, 0xffe3,
-    0x039a, 0xffbe, 0x000b, 0x03b4, 0xffbe, 0xfffd, 0x039a, 0xfee8, 0x000b, 0x03b4, 0xfee8, 0xfffd, 0x038b, 0xffbe,
-    0xfff2, 0x03d1, 0xfecc, 0x003a, 0x03c8, 0xfecc, 0x002c, 0x03b9, 0xfed4, 0x0034, 0x03c2, 0xfed4, 0x0043, 0x03d1,
-    0xfed4, 0x003a, 0x03c8, 0xfed4, 0x002c, 0x03c2, 0xfecc, 0x0043, 0x03b9, 0xfecc, 0x0034, 0x0344, 0xfea1, 0x002c,
-    0x03d5, 0xfea1, 0x0053, 0x036b, 0xfea1, 0xff9c, 0x03fc, 0xfea1, 0xffc3, 0x0344, 0xfecb, 0x002c, 0x03d5, 0xfecb,
-    0x0053, 0x036b, 0xfecb, 0xff9c, 0x03fc, 0xfecb, 0xffc3, 0x0057, 0x001c, 0x0002, 0xfd19, 0xfeb0, 0x0086, 0x00ea,
-    0x0000, 0x0054, 0x004e, 0x0051, 0x0054, 0x0033, 0x0051, 0x004e, 0x0027, 0x0021, 0x004b, 0x004b, 0x0048, 0x0048,
-    0x0045, 0x0045, 0x003f, 0x003f, 0x0042, 0x000f, 0x003c, 0x003c, 0x0039, 0x0039, 0x0036, 0x0036, 0x0030, 0x0030,
-    0x0033, 0x002d, 0x0024, 0x002a, 0x002d, 0x0003, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x001e, 0x001b, 0x001b,
-    0x0018, 0x0018, 0x0012, 0x0012, 0x0015, 0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000,
-    0x0003, 0xfc75, 0xfeb5, 0x003e, 0xfc85, 0xfeb5, 0x001c, 0xfc80, 0xfeb5, 0x0064, 0xfc9f, 0xfeb5, 0x008e, 0xfcce,
-    0xfeb5, 0x00b6, 0xfcea, 0xfeb5, 0x00c6, 0xfc50, 0xfeab, 0x0032, 0xfc5b, 0xfeab, 0xfffd, 0xfc5c, 0xfeab, 0x0065,
-    0xfc80, 0xfeab, 0x009a, 0xfcb9, 0xfeab, 0x00cc, 0xfcdb, 0xfeab, 0x00e0, 0xfcfe, 0xfeb5, 0x0071, 0xfd13, 0xfeb5,
-    0x007f, 0xfca8, 0xfeb5, 0x0034, 0xfccc, 0xfeb5, 0x004d, 0xfd9a, 0xfeb5, 0x00e7, 0xfdb0, 0xfeb5, 0x00c8, 0xfd74,
-    0xfeb5, 0x00f1, 0xfd40, 0xfeb5, 0x00eb, 0xfd06, 0xfeb5, 0x00d6, 0xfdb7, 0xfeab, 0x0102, 0xfde1, 0xfeab, 0x00dd,
-    0xfd86, 0xfeab, 0x0110, 0xfd45, 0xfeab, 0x010c, 0xfcfd, 0xfeab, 0x00f4, 0xfd2a, 0xfeb5, 0x008a, 0xfd89, 0xfeb5,
-    0x00b6, 0xfd62, 0xfeb5, 0x00a4, 0x0057, 0x001c, 0x0002, 0x0000, 0xfeb0, 0x0175, 0x00e9, 0x0000, 0x0054, 0x004e,
-    0x0051, 0x0054, 0x0033, 0x0051, 0x004e, 0x0027, 0x0021, 0x004b, 0x004b, 0x0048, 0x0048, 0x0045, 0x0045, 0x003f,
-    0x003f, 0x0042, 0x000f, 0x003c, 0x003c, 0x0039, 0x0039, 0x0036, 0x0036, 0x0030, 0x0030, 0x0033, 0x002d, 0x0024,
-    0x002a, 0x002d, 0x0003, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x001e, 0x001b, 0x001b, 0x0018, 0x0018, 0x0012,
-    0x0012, 0x0015, 0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xff57, 0xfeb5,
-    0x015f, 0xff54, 0xfeb5, 0x0139, 0xff74, 0xfeb5, 0x017a, 0xffa4, 0xfeb5, 0x018f, 0xffe0, 0xfeb5, 0x019a, 0x0000,
-    0xfeb5, 0x019a, 0xff31, 0xfeab, 0x0167, 0xff20, 0xfeab, 0x0132, 0xff55, 0xfeab, 0x018c, 0xff8f, 0xfeab, 0x01a9,
-    0xffd9, 0xfeab, 0x01b8, 0x0000, 0xfeab, 0x01b8, 0xffe7, 0xfeb5, 0x0146, 0x0000, 0xfeb5, 0x0148, 0xff7f, 0xfeb5,
-    0x013d, 0xffaa, 0xfeb5, 0x0140, 0x00a9, 0xfeb5, 0x015f, 0x00ac, 0xfeb5, 0x0139, 0x008c, 0xfeb5, 0x017a, 0x005c,
-    0xfeb5, 0x018f, 0x0020, 0xfeb5, 0x019a, 0x00cf, 0xfeab, 0x0167, 0x00e0, 0xfeab, 0x0132, 0x00ab, 0xfeab, 0x018c,
-    0x0071, 0xfeab, 0x01a9, 0x0027, 0xfeab, 0x01b8, 0x0019, 0xfeb5, 0x0146, 0x0081, 0xfeb5, 0x013d, 0x0056, 0xfeb5,
-    0x0140, 0x0057, 0x001c, 0x0002, 0x02e7, 0xfeb0, 0x0086, 0x00ea, 0x0000, 0x0054, 0x004e, 0x0051, 0x0054, 0x0033,
-    0x0051, 0x004e, 0x0027, 0x0021, 0x004b, 0x004b, 0x0048, 0x0048, 0x0045, 0x0045, 0x003f, 0x003f, 0x0042, 0x000f,
-    0x003c, 0x003c, 0x0039, 0x0039, 0x0036, 0x0036, 0x0030, 0x0030, 0x0033, 0x002d, 0x0024, 0x002a, 0x002d, 0x0003,
-    0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x001e, 0x001b, 0x001b, 0x0018, 0x0018, 0x0012, 0x0012, 0x0015, 0x000f,
-    0x000c, 0x000c, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0x0266, 0xfeb5, 0x00e7, 0x0250, 0xfeb5,
-    0x00c8, 0x028c, 0xfeb5, 0x00f1, 0x02c0, 0xfeb5, 0x00eb, 0x02fa, 0xfeb5, 0x00d6, 0x0316, 0xfeb5, 0x00c6, 0x0249,
-    0xfeab, 0x0102, 0x021f, 0xfeab, 0x00dd, 0x027a, 0xfeab, 0x0110, 0x02bb, 0xfeab, 0x010c, 0x0303, 0xfeab, 0x00f4,
-    0x0325, 0xfeab, 0x00e0, 0x02d6, 0xfeb5, 0x008a, 0x02ed, 0xfeb5, 0x007f, 0x0277, 0xfeb5, 0x00b6, 0x029e, 0xfeb5,
-    0x00a4, 0x038b, 0xfeb5, 0x003e, 0x037b, 0xfeb5, 0x001c, 0x0380, 0xfeb5, 0x0064, 0x0361, 0xfeb5, 0x008e, 0x0332,
-    0xfeb5, 0x00b6, 0x03b0, 0xfeab, 0x0032, 0x03a5, 0xfeab, 0xfffd, 0x03a4, 0xfeab, 0x0065, 0x0380, 0xfeab, 0x009a,
-    0x0347, 0xfeab, 0x00cc, 0x0302, 0xfeb5, 0x0071, 0x0358, 0xfeb5, 0x0034, 0x0334, 0xfeb5, 0x004d, 0x000c, 0x0004,
-    0x0002, 0x079a, 0x004e, 0x0bce, 0x0561, 0x0000, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003,
-    0x079a, 0x0000, 0x066f, 0x079a, 0x009c, 0x066f, 0x079a, 0x009c, 0x112d, 0x079a, 0x0000, 0x112d, 0x000c, 0x0004,
-    0x0002, 0xf866, 0x004e, 0x0bce, 0x0561, 0x0000, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003,
-    0xf866, 0x0000, 0x066f, 0xf866, 0x009c, 0x066f, 0xf866, 0x009c, 0x112d, 0xf866, 0x0000, 0x112d, 0x002a, 0x000d,
-    0x0002, 0x0000, 0x0f3d, 0xfa15, 0x091a, 0x0000, 0x0018, 0x0027, 0x0003, 0x0012, 0x0006, 0x0024, 0x0021, 0x0012,
-    0x000f, 0x001e, 0x001b, 0x0015, 0x0018, 0x0015, 0x0015, 0x000f, 0x000f, 0x0012, 0x0003, 0x000c, 0x0009, 0x0000,
-    0x0006, 0x0000, 0x0000, 0x0003, 0xfa54, 0x0f72, 0xf763, 0xfd11, 0x0fe0, 0xf763, 0xf757, 0x0e75, 0xf763, 0xfa54,
-    0x0f72, 0xfcbf, 0xfd11, 0x0fe0, 0xfcc5, 0x02ef, 0x0fe0, 0xf763, 0x0000, 0x1005, 0xf763, 0x05ac, 0x0f72, 0xf763,
-    0x08a9, 0x0e75, 0xf763, 0x05ac, 0x0f72, 0xfcbf, 0x02ef, 0x0fe0, 0xfcc5, 0x0000, 0x1005, 0xfcc7, 0xf754, 0x0e77,
-    0xfcba, 0x08ac, 0x0e77, 0xfcba, 0x002a, 0x0013, 0x0002, 0x0000, 0x0c83, 0xfefc, 0x099c, 0x0000, 0x0000, 0x000f,
-    0x0009, 0x001e, 0x001b, 0x0006, 0x0018, 0x0027, 0x0015, 0x0024, 0x0024, 0x001e, 0x0027, 0x0015, 0x0021, 0x0027,
-    0x0021, 0x0024, 0x001b, 0x0021, 0x001b, 0x001e, 0x0012, 0x0018, 0x0012, 0x0015, 0x0003, 0x000c, 0x000f, 0x0009,
-    0x000c, 0x000f, 0x0006, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xf754, 0x0e77, 0xfcba, 0xf757, 0x0901, 0x013d,
-    0xfd22, 0x0aed, 0x013d, 0xfd11, 0x0fe0, 0xfcc5, 0xfa75, 0x0a82, 0x013d, 0xfa54, 0x0f72, 0xfcbf, 0x08ac, 0x0e77,
-    0xfcba, 0x05ac, 0x0f72, 0xfcbf, 0x08a9, 0x0901, 0x013d, 0x0000, 0x0b12, 0x013d, 0x0000, 0x1005, 0xfcc7, 0x02de,
-    0x0aed, 0x013d, 0x02ef, 0x0fe0, 0xfcc5, 0x058b, 0x0a82, 0x013d, 0x002a, 0x000d, 0x0002, 0x0000, 0x093d, 0x037a,
-    0x0921, 0x0000, 0x0018, 0x0006, 0x001e, 0x0015, 0x001e, 0x0027, 0x001b, 0x0024, 0x0018, 0x0021, 0x001b, 0x001e,
-    0x0018, 0x001b, 0x0012, 0x0015, 0x0009, 0x0003, 0x0009, 0x000f, 0x0006, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003,
-    0xf757, 0x0901, 0x013d, 0xf757, 0x0768, 0x05b7, 0xfd29, 0x0959, 0x05b7, 0xfa83, 0x08ef, 0x05b7, 0xfd22, 0x0aed,
-    0x013d, 0xfa75, 0x0a82, 0x013d, 0x08a9, 0x0901, 0x013d, 0x08a9, 0x0768, 0x05b7, 0x0000, 0x097e, 0x05b7, 0x02d7,
-    0x0959, 0x05b7, 0x057d, 0x08ef, 0x05b7, 0x0000, 0x0b12, 0x013d, 0x02de, 0x0aed, 0x013d, 0x058b, 0x0a82, 0x013d,
-    0x002a, 0x000d, 0x0002, 0x0000, 0x089d, 0x07c5, 0x08fb, 0x0000, 0x0018, 0x0006, 0x0015, 0x0024, 0x0024, 0x0027,
-    0x001e, 0x0024, 0x001e, 0x0021, 0x0018, 0x001e, 0x0018, 0x001b, 0x0012, 0x0015, 0x0003, 0x000c, 0x000c, 0x000f,
-    0x0006, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xf757, 0x0768, 0x05b7, 0xf757, 0x07bd, 0x09d3, 0xfd2a, 0x09af,
-    0x09d3, 0xfd29, 0x0959, 0x05b7, 0xfa85, 0x0944, 0x09d3, 0xfa83, 0x08ef, 0x05b7, 0x08a9, 0x0768, 0x05b7, 0x08a9,
-    0x07bd, 0x09d3, 0x0000, 0x09d3, 0x09d3, 0x0000, 0x097e, 0x05b7, 0x02d6, 0x09af, 0x09d3, 0x02d7, 0x0959, 0x05b7,
-    0x057b, 0x0944, 0x09d3, 0x057d, 0x08ef, 0x05b7, 0x002a, 0x000d, 0x0002, 0x0000, 0x0932, 0x0bb5, 0x08fb, 0x0000,
-    0x0018, 0x0006, 0x001e, 0x0015, 0x001e, 0x0027, 0x001b, 0x0024, 0x0018, 0x0021, 0x001b, 0x001e, 0x0018, 0x001b,
-    0x0012, 0x0015, 0x0009, 0x0003, 0x0009, 0x000f, 0x0006, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xf757, 0x07bd,
-    0x09d3, 0xf757, 0x0891, 0x0d97, 0xfd2a, 0x0a83, 0x0d97, 0xfa85, 0x0a19, 0x0d97, 0xfd2a, 0x09af, 0x09d3, 0xfa85,
-    0x0944, 0x09d3, 0x08a9, 0x07bd, 0x09d3, 0x08a9, 0x0891, 0x0d97, 0x0000, 0x0aa7, 0x0d97, 0x02d6, 0x0a83, 0x0d97,
-    0x057b, 0x0a19, 0x0d97, 0x0000, 0x09d3, 0x09d3, 0x02d6, 0x09af, 0x09d3, 0x057b, 0x0944, 0x09d3, 0x002a, 0x000d,
-    0x0002, 0x0000, 0x08c4, 0x1010, 0x0933, 0x0000, 0x0018, 0x0006, 0x0015, 0x0024, 0x0024, 0x0027, 0x001e, 0x0024,
-    0x001e, 0x0021, 0x0018, 0x001e, 0x0018, 0x001b, 0x0012, 0x0015, 0x0003, 0x000c, 0x000c, 0x000f, 0x0006, 0x000c,
-    0x0006, 0x0009, 0x0000, 0x0003, 0xf757, 0x0891, 0x0d97, 0xf757, 0x06e1, 0x128a, 0xfd27, 0x08d1, 0x128a, 0xfd2a,
-    0x0a83, 0x0d97, 0xfa80, 0x0867, 0x128a, 0xfa85, 0x0a19, 0x0d97, 0x08a9, 0x0891, 0x0d97, 0x08a9, 0x06e1, 0x128a,
-    0x0000, 0x08f5, 0x128a, 0x0000, 0x0aa7, 0x0d97, 0x02d9, 0x08d1, 0x128a, 0x02d6, 0x0a83, 0x0d97, 0x0580, 0x0867,
-    0x128a, 0x057b, 0x0a19, 0x0d97, 0x0012, 0x0007, 0x0002, 0xfcee, 0x00ff, 0xfa30, 0x0115, 0x0000, 0x0000, 0x0006,
-    0x0003, 0x0006, 0x0009, 0x000c, 0x000c, 0x000f, 0x0000, 0x000f, 0x0003, 0x000f, 0x0003, 0x0009, 0xfcac, 0x0000,
-    0xf9dd, 0xfcac, 0x01ff, 0xfa82, 0xfcac, 0x01ff, 0xf9dd, 0xfd30, 0x01ff, 0xfa82, 0xfd30, 0x0000, 0xfa82, 0xfcac,
-    0x0000, 0xfa82, 0x000c, 0x0004, 0x0002, 0xfefa, 0x00ff, 0xfa82, 0x0108, 0x0000, 0x0003, 0x0006, 0x0006, 0x0009,
-    0x0000, 0x0009, 0x0000, 0x0003, 0xfeb8, 0x01ff, 0xfa82, 0xff3c, 0x01ff, 0xfa82, 0xff3c, 0x0000, 0xfa82, 0xfeb8,
-    0x0000, 0xfa82, 0x000c, 0x0004, 0x0002, 0x0104, 0x00ff, 0xfa82, 0x0108, 0x0000, 0x0003, 0x0006, 0x0006, 0x0009,
-    0x0000, 0x0009, 0x0000, 0x0003, 0x00c2, 0x01ff, 0xfa82, 0x0146, 0x01ff, 0xfa82, 0x0146, 0x0000, 0xfa82, 0x00c2,
-    0x0000, 0xfa82, 0x000c, 0x0004, 0x0002, 0x0310, 0x00ff, 0xfa82, 0x0108, 0x0000, 0x0003, 0x0006, 0x0006, 0x0009,
-    0x0000, 0x0009, 0x0000, 0x0003, 0x02ce, 0x01ff, 0xfa82, 0x0352, 0x01ff, 0xfa82, 0x0352, 0x0000, 0xfa82, 0x02ce,
-    0x0000, 0xfa82, 0x0018, 0x0006, 0x0003, 0xfaf3, 0x0105, 0xf9cb, 0x010f, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009,
-    0x000c, 0x000f, 0x0009, 0x0012, 0x0000, 0x0000, 0x0012, 0x0003, 0x0009, 0x0015, 0x000c, 0x0009, 0x000f, 0x0012,
-    0xfabd, 0x0000, 0xf9fb, 0xfabc, 0x020a, 0xf99a, 0xfabd, 0x0000, 0xf99a, 0xfb2a, 0x0000, 0xf9fb, 0xfb2a, 0x020a,
-    0xf99a, 0xfb2a, 0x020a, 0xf9fc, 0xfabc, 0x020a, 0xf9fc, 0xfb2a, 0x0000, 0xf99a, 0x0012, 0x0004, 0x0003, 0xfc84,
-    0x0105, 0xf9ef, 0x0109, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003, 0x0000, 0x0009, 0x0003, 0x0009,
-    0x000f, 0x000c, 0xfcb1, 0x020a, 0xf9fd, 0xfc58, 0x0000, 0xf9fd, 0xfcac, 0x0000, 0xf9fd, 0xfc57, 0x020a, 0xf9fd,
-    0xfc58, 0x0000, 0xf9e0, 0xfc57, 0x020a, 0xf9e0, 0x0012, 0x0004, 0x0003, 0x037c, 0x0105, 0xf9ef, 0x0109, 0x0000,
-    0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003, 0x0000, 0x0009, 0x0003, 0x0009, 0x000f, 0x000c, 0x0354, 0x0000,
-    0xf9fd, 0x03a9, 0x020a, 0xf9fd, 0x034f, 0x020a, 0xf9fd, 0x03a8, 0x0000, 0xf9fd, 0x03a9, 0x020a, 0xf9e0, 0x03a8,
-    0x0000, 0xf9e0, 0x0018, 0x0006, 0x0003, 0x050d, 0x0105, 0xf9cb, 0x010f, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009,
-    0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0000, 0x0012, 0x0003, 0x0009, 0x0015, 0x000c, 0x0006, 0x0015, 0x0009,
-    0x0543, 0x0000, 0xf9fb, 0x0544, 0x020a, 0xf99a, 0x0544, 0x020a, 0xf9fc, 0x04d6, 0x0000, 0xf9fb, 0x04d6, 0x020a,
-    0xf99a, 0x04d6, 0x0000, 0xf99a, 0x0543, 0x0000, 0xf99a, 0x04d6, 0x020a, 0xf9fc, 0x0018, 0x0010, 0x0002, 0xf8c3,
-    0xfff6, 0x0033, 0x0159, 0x0000, 0x0003, 0x000c, 0x0009, 0x000f, 0x0006, 0x0012, 0x0000, 0x0015, 0x0015, 0x0003,
-    0x0015, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0x0000, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c,
-    0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0xf89c, 0xfea1, 0x0059, 0xf89c, 0xfea1, 0x000e,
-    0xf8ea, 0xfea1, 0x0059, 0xf8ea, 0xfea1, 0x000e, 0xf8ea, 0x014b, 0x000e, 0xf8ea, 0x014b, 0x0059, 0xf89c, 0x014b,
-    0x0059, 0xf89c, 0x014b, 0x000e, 0x0018, 0x0010, 0x0002, 0xf8c3, 0xfff6, 0xfdec, 0x0159, 0x0000, 0x0003, 0x000c,
-    0x0009, 0x000f, 0x0006, 0x0012, 0x0000, 0x0015, 0x0015, 0x0003, 0x0015, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012,
-    0x0012, 0x0015, 0x0000, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000,
-    0x0000, 0x0003, 0xf89c, 0xfea1, 0xfe11, 0xf89c, 0xfea1, 0xfdc6, 0xf8ea, 0xfea1, 0xfe11, 0xf8ea, 0xfea1, 0xfdc6,
-    0xf8ea, 0x014b, 0xfdc6, 0xf8ea, 0x014b, 0xfe11, 0xf89c, 0x014b, 0xfe11, 0xf89c, 0x014b, 0xfdc6, 0x0018, 0x0010,
-    0x0002, 0x073d, 0xfff6, 0xfdec, 0x0159, 0x0000, 0x000c, 0x0003, 0x000f, 0x0009, 0x0012, 0x0006, 0x0015, 0x0000,
-    0x0015, 0x0003, 0x0015, 0x000c, 0x000c, 0x000f, 0x000f, 0x0012, 0x0012, 0x0015, 0x0000, 0x0012, 0x0006, 0x000f,
-    0x0009, 0x000c, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0000, 0x0003, 0x0764, 0xfea1, 0xfe11, 0x0764,
-    0xfea1, 0xfdc6, 0x0716, 0xfea1, 0xfe11, 0x0716, 0xfea1, 0xfdc6, 0x0716, 0x014b, 0xfdc6, 0x0716, 0x014b, 0xfe11,
-    0x0764, 0x014b, 0xfe11, 0x0764, 0x014b, 0xfdc6, 0x0018, 0x0010, 0x0002, 0x073d, 0xfff6, 0x0033, 0x0159, 0x0000,
-    0x000c, 0x0003, 0x000f, 0x0009, 0x0012, 0x0006, 0x0015, 0x0000, 0x0015, 0x0003, 0x0015, 0x000c, 0x000c, 0x000f,
-    0x000f, 0x0012, 0x0012, 0x0015, 0x0000, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x0003, 0x0009, 0x0009, 0x0006,
-    0x0006, 0x0000, 0x0000, 0x0003, 0x0764, 0xfea1, 0x0059, 0x0764, 0xfea1, 0x000e, 0x0716, 0xfea1, 0x0059, 0x0716,
-    0xfea1, 0x000e, 0x0716, 0x014b, 0x000e, 0x0716, 0x014b, 0x0059, 0x0764, 0x014b, 0x0059, 0x0764, 0x014b, 0x000e,
-    0x0018, 0x000c, 0x0002, 0x07c7, 0xfeef, 0x09a8, 0x01b2, 0x0000, 0x000f, 0x0015, 0x0012, 0x0003, 0x0000, 0x0015,
-    0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 0x0003, 0x0009, 0x0000, 0x0006, 0x000c, 0x0009,
-    0x0006, 0x0009, 0x0000, 0x0003, 0x0802, 0xfd42, 0x09cb, 0x078d, 0xfd42, 0x09cb, 0x0802, 0xfd42, 0x0986, 0x078d,
-    0xfd42, 0x0986, 0x078d, 0x009c, 0x0986, 0x0802, 0x009c, 0x0986, 0x078d, 0x009c, 0x09cb, 0x0802, 0x009c, 0x09cb,
-    0x0018, 0x0008, 0x0003, 0x0456, 0xfe15, 0x0456, 0x0107, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0006, 0x000c,
-    0x000f, 0x000c, 0x0006, 0x0012, 0x000f, 0x0003, 0x0000, 0x0006, 0x0009, 0x0009, 0x000c, 0x0015, 0x000f, 0x0006,
-    0x0003, 0x0012, 0x0003, 0x0000, 0x0475, 0xfd42, 0x04f1, 0x0475, 0xfee7, 0x04f1, 0x0437, 0xfee7, 0x04f1, 0x0437,
-    0xfd42, 0x04f1, 0x0437, 0xfee7, 0x03bc, 0x0475, 0xfee7, 0x03bc, 0x0475, 0xfd42, 0x03bc, 0x0437, 0xfd42, 0x03bc,
-    0x0018, 0x000a, 0x0003, 0xfbaa, 0xfe15, 0x0456, 0x0107, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003,
-    0x000f, 0x0003, 0x000c, 0x0012, 0x0006, 0x000f, 0x0012, 0x000c, 0x0015, 0x0000, 0x0009, 0x0003, 0x0009, 0x0015,
-    0x000c, 0x000f, 0x0006, 0x0003, 0x0012, 0x0000, 0x0006, 0x0012, 0x000f, 0x000c, 0xfb8b, 0xfd42, 0x04f1, 0xfbc9,
-    0xfee7, 0x04f1, 0xfb8b, 0xfee7, 0x04f1, 0xfbc9, 0xfd42, 0x04f1, 0xfbc9, 0xfee7, 0x03bc, 0xfb8b, 0xfee7, 0x03bc,
-    0xfb8b, 0xfd42, 0x03bc, 0xfbc9, 0xfd42, 0x03bc, 0x0018, 0x000a, 0x0003, 0xfa60, 0xfe15, 0x03fe, 0x00df, 0x0000,
-    0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003, 0x000f, 0x0003, 0x000c, 0x0012, 0x0006, 0x000f, 0x0012, 0x000c,
-    0x0015, 0x0000, 0x0009, 0x0003, 0x0009, 0x0015, 0x000c, 0x000f, 0x0006, 0x0003, 0x0012, 0x0000, 0x0006, 0x0012,
-    0x000f, 0x000c, 0xfa41, 0xfd42, 0x0441, 0xfa7f, 0xfee7, 0x0441, 0xfa41, 0xfee7, 0x0441, 0xfa7f, 0xfd42, 0x0441,
-    0xfa7f, 0xfee7, 0x03bc, 0xfa41, 0xfee7, 0x03bc, 0xfa41, 0xfd42, 0x03bc, 0xfa7f, 0xfd42, 0x03bc, 0x0018, 0x000a,
-    0x0003, 0x05a0, 0xfe15, 0x03fe, 0x00df, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0006, 0x000c, 0x000f, 0x000c,
-    0x0006, 0x0012, 0x000f, 0x0003, 0x0012, 0x0015, 0x000c, 0x0000, 0x0006, 0x0009, 0x0009, 0x000c, 0x0015, 0x000f,
-    0x0006, 0x0003, 0x0012, 0x0003, 0x0000, 0x0012, 0x000c, 0x000f, 0x05bf, 0xfd42, 0x0441, 0x05bf, 0xfee7, 0x0441,
-    0x0581, 0xfee7, 0x0441, 0x0581, 0xfd42, 0x0441, 0x0581, 0xfee7, 0x03bc, 0x05bf, 0xfee7, 0x03bc, 0x05bf, 0xfd42,
-    0x03bc, 0x0581, 0xfd42, 0x03bc, 0x0018, 0x000c, 0x0002, 0x07c7, 0xfeef, 0x0c2b, 0x01b2, 0x0000, 0x000f, 0x0015,
-    0x0012, 0x0003, 0x0000, 0x0015, 0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 0x0003, 0x0009,
-    0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 0x0802, 0xfd42, 0x0c4d, 0x078d, 0xfd42, 0x0c4d,
-    0x0802, 0xfd42, 0x0c09, 0x078d, 0xfd42, 0x0c09, 0x078d, 0x009c, 0x0c09, 0x0802, 0x009c, 0x0c09, 0x078d, 0x009c,
-    0x0c4d, 0x0802, 0x009c, 0x0c4d, 0x0018, 0x000c, 0x0002, 0x07c7, 0xfeef, 0x0ead, 0x01b2, 0x0000, 0x000f, 0x0015,
-    0x0012, 0x0003, 0x0000, 0x0015, 0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 0x0003, 0x0009,
-    0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 0x0802, 0xfd42, 0x0ecf, 0x078d, 0xfd42, 0x0ecf,
-    0x0802, 0xfd42, 0x0e8b, 0x078d, 0xfd42, 0x0e8b, 0x078d, 0x009c, 0x0e8b, 0x0802, 0x009c, 0x0e8b, 0x078d, 0x009c,
-    0x0ecf, 0x0802, 0x009c, 0x0ecf, 0x0018, 0x000c, 0x0002, 0x07c7, 0xfeef, 0x115e, 0x01b3, 0x0000, 0x0003, 0x000c,
-    0x0012, 0x0006, 0x000c, 0x0000, 0x0009, 0x0015, 0x000f, 0x0012, 0x0015, 0x000c, 0x0012, 0x0015, 0x000c, 0x000f,
-    0x0003, 0x0006, 0x0009, 0x0000, 0x0006, 0x0009, 0x0000, 0x0003, 0x078d, 0x009c, 0x118f, 0x0802, 0x009c, 0x118f,
-    0x0802, 0x009c, 0x112d, 0x078d, 0x009c, 0x112d, 0x078d, 0xfd42, 0x118f, 0x0802, 0xfd42, 0x118f, 0x0802, 0xfd42,
-    0x112d, 0x078d, 0xfd42, 0x112d, 0x0018, 0x000c, 0x0002, 0xf839, 0xfeef, 0x115e, 0x01b3, 0x0000, 0x0012, 0x0006,
-    0x000c, 0x0000, 0x0003, 0x000f, 0x0009, 0x0015, 0x000f, 0x0012, 0x0015, 0x000c, 0x0012, 0x0015, 0x000c, 0x000f,
-    0x0003, 0x0006, 0x0009, 0x0000, 0x0006, 0x0009, 0x0000, 0x0003, 0xf873, 0x009c, 0x118f, 0xf7fe, 0x009c, 0x118f,
-    0xf7fe, 0x009c, 0x112d, 0xf873, 0x009c, 0x112d, 0xf873, 0xfd42, 0x118f, 0xf7fe, 0xfd42, 0x118f, 0xf7fe, 0xfd42,
-    0x112d, 0xf873, 0xfd42, 0x112d, 0x0018, 0x000c, 0x0002, 0xf839, 0xfeef, 0x0ead, 0x01b2, 0x0000, 0x000f, 0x0015,
-    0x0012, 0x0003, 0x0000, 0x0015, 0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 0x0003, 0x0009,
-    0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 0xf7fe, 0xfd42, 0x0ecf, 0xf873, 0xfd42, 0x0ecf,
-    0xf7fe, 0xfd42, 0x0e8b, 0xf873, 0xfd42, 0x0e8b, 0xf873, 0x009c, 0x0e8b, 0xf7fe, 0x009c, 0x0e8b, 0xf873, 0x009c,
-    0x0ecf, 0xf7fe, 0x009c, 0x0ecf, 0x0018, 0x000c, 0x0002, 0xf839, 0xfeef, 0x0c2b, 0x01b2, 0x0000, 0x000f, 0x0015,
-    0x0012, 0x0003, 0x0000, 0x0015, 0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 0x0003, 0x0009,
-    0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 0xf7fe, 0xfd42, 0x0c4d, 0xf873, 0xfd42, 0x0c4d,
-    0xf7fe, 0xfd42, 0x0c09, 0xf873, 0xfd42, 0x0c09, 0xf873, 0x009c, 0x0c09, 0xf7fe, 0x009c, 0x0c09, 0xf873, 0x009c,
-    0x0c4d, 0xf7fe, 0x009c, 0x0c4d, 0x0018, 0x000c, 0x0002, 0xf839, 0xfeef, 0x09a8, 0x01b2, 0x0000, 0x000f, 0x0015,
-    0x0012, 0x0003, 0x0000, 0x0015, 0x0015, 0x0012, 0x000f, 0x000c, 0x000c, 0x0012, 0x0006, 0x000f, 0x0003, 0x0009,
-    0x0000, 0x0006, 0x000c, 0x0009, 0x0006, 0x0009, 0x0000, 0x0003, 0xf7fe, 0xfd42, 0x09cb, 0xf873, 0xfd42, 0x09cb,
-    0xf7fe, 0xfd42, 0x0986, 0xf873, 0xfd42, 0x0986, 0xf873, 0x009c, 0x0986, 0xf7fe, 0x009c, 0x0986, 0xf873, 0x009c,
-    0x09cb, 0xf7fe, 0x009c, 0x09cb, 0x0018, 0x000c, 0x0002, 0x082b, 0xfdf0, 0x065a, 0x00b6, 0x0000, 0x0000, 0x000f,
-    0x000f, 0x0012, 0x0012, 0x0015, 0x0015, 0x0000, 0x000c, 0x0015, 0x0009, 0x0012, 0x0006, 0x000f, 0x000c, 0x0003,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 0x0000, 0x0003, 0x0805, 0xfd42, 0x0635, 0x0805, 0xfe9e, 0x0635,
-    0x0851, 0xfe9e, 0x0635, 0x0851, 0xfe9e, 0x0680, 0x0805, 0xfe9e, 0x0680, 0x0851, 0xfd42, 0x0635, 0x0851, 0xfd42,
-    0x0680, 0x0805, 0xfd42, 0x0680, 0x0018, 0x000c, 0x0002, 0x082b, 0xfdf0, 0x082e, 0x00b6, 0x0000, 0x0000, 0x000f,
-    0x000f, 0x0012, 0x0012, 0x0015, 0x0015, 0x0000, 0x000c, 0x0015, 0x0009, 0x0012, 0x0006, 0x000f, 0x000c, 0x0003,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 0x0000, 0x0003, 0x0805, 0xfd42, 0x0809, 0x0805, 0xfe9e, 0x0809,
-    0x0851, 0xfe9e, 0x0809, 0x0851, 0xfe9e, 0x0854, 0x0805, 0xfe9e, 0x0854, 0x0851, 0xfd42, 0x0809, 0x0851, 0xfd42,
-    0x0854, 0x0805, 0xfd42, 0x0854, 0x0018, 0x000c, 0x0002, 0x0719, 0xfdf2, 0x05a7, 0x00b8, 0x0000, 0x0000, 0x000f,
-    0x000f, 0x0012, 0x0012, 0x0015, 0x0015, 0x0000, 0x000c, 0x0015, 0x0009, 0x0012, 0x0006, 0x000f, 0x000c, 0x0003,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 0x0000, 0x0003, 0x06f3, 0xfd42, 0x0581, 0x06f3, 0xfea1, 0x0581,
-    0x073f, 0xfea1, 0x0581, 0x073f, 0xfea1, 0x05cd, 0x06f3, 0xfea1, 0x05cd, 0x073f, 0xfd42, 0x0581, 0x073f, 0xfd42,
-    0x05cd, 0x06f3, 0xfd42, 0x05cd, 0x0006, 0x0001, 0x0002, 0x08a9, 0x0211, 0x128a, 0x04d0, 0x0000, 0x0000, 0x0003,
-    0x08a9, 0x06e1, 0x128a, 0x08a9, 0xfd42, 0x128a, 0x0006, 0x0001, 0x0002, 0xf757, 0x0211, 0x128a, 0x04d0, 0x0000,
-    0x0000, 0x0003, 0xf757, 0x06e1, 0x128a, 0xf757, 0xfd42, 0x128a, 0x0036, 0x0019, 0x0002, 0xfdf6, 0x0089, 0xfa4e,
-    0x00cf, 0x0000, 0x001e, 0x002a, 0x0027, 0x0018, 0x000c, 0x0030, 0x0033, 0x0024, 0x002d, 0x0006, 0x001b, 0x0021,
-    0x0015, 0x0033, 0x0012, 0x0030, 0x001e, 0x0030, 0x0003, 0x002d, 0x000f, 0x002a, 0x0021, 0x002a, 0x0027, 0x0012,
-    0x0024, 0x000f, 0x0021, 0x0003, 0x001e, 0x0015, 0x001b, 0x0000, 0x0018, 0x0009, 0x000f, 0x0015, 0x0012, 0x0009,
-    0x0012, 0x0015, 0x000f, 0x0003, 0x0009, 0x000c, 0x0000, 0x0006, 0x0000, 0x0003, 0xfd5b, 0x00f7, 0xfa4e, 0xfd74,
-    0x00f7, 0xfa4e, 0xfd5b, 0x0000, 0xfa4e, 0xfe90, 0x00f7, 0xfa4e, 0xfe90, 0x0113, 0xfa4e, 0xfdeb, 0x00f7, 0xfa4e,
-    0xfe77, 0x00f7, 0xfa4e, 0xfe01, 0x00f7, 0xfa4e, 0xfe90, 0x0000, 0xfa4e, 0xfd5b, 0x0113, 0xfa4e, 0xfe01, 0x0113,
-    0xfa4e, 0xfd74, 0x0113, 0xfa4e, 0xfdeb, 0x0000, 0xfa4e, 0xfe77, 0x0000, 0xfa4e, 0xfdeb, 0x0113, 0xfa4e, 0xfd74,
-    0x0000, 0xfa4e, 0xfe77, 0x0113, 0xfa4e, 0xfe01, 0x0000, 0xfa4e, 0x0036, 0x0019, 0x0002, 0x0000, 0x0089, 0xfa4e,
-    0x00ce, 0x0000, 0x001e, 0x002a, 0x0027, 0x0018, 0x000c, 0x0030, 0x0033, 0x0024, 0x002d, 0x0006, 0x001b, 0x0021,
-    0x0015, 0x0033, 0x0012, 0x0030, 0x001e, 0x0030, 0x0003, 0x002d, 0x000f, 0x002a, 0x0021, 0x002a, 0x0027, 0x0012,
-    0x0024, 0x000f, 0x0021, 0x0003, 0x001e, 0x0015, 0x001b, 0x0000, 0x0018, 0x0009, 0x000f, 0x0015, 0x0012, 0x0009,
-    0x0012, 0x0015, 0x000f, 0x0003, 0x0009, 0x000c, 0x0000, 0x0006, 0x0000, 0x0003, 0xff66, 0x00f7, 0xfa4e, 0xff7f,
-    0x00f7, 0xfa4e, 0xff66, 0x0000, 0xfa4e, 0x009a, 0x00f7, 0xfa4e, 0x009a, 0x0113, 0xfa4e, 0xfff5, 0x00f7, 0xfa4e,
-    0x0081, 0x00f7, 0xfa4e, 0x000b, 0x00f7, 0xfa4e, 0x009a, 0x0000, 0xfa4e, 0xff66, 0x0113, 0xfa4e, 0x000b, 0x0113,
-    0xfa4e, 0xff7f, 0x0113, 0xfa4e, 0xfff5, 0x0000, 0xfa4e, 0x0081, 0x0000, 0xfa4e, 0xfff5, 0x0113, 0xfa4e, 0xff7f,
-    0x0000, 0xfa4e, 0x0081, 0x0113, 0xfa4e, 0x000b, 0x0000, 0xfa4e, 0x0036, 0x0019, 0x0002, 0x020a, 0x0089, 0xfa4e,
-    0x00cf, 0x0000, 0x001e, 0x002a, 0x0027, 0x0018, 0x000c, 0x0030, 0x0033, 0x0024, 0x002d, 0x0006, 0x001b, 0x0021,
-    0x0015, 0x0033, 0x0012, 0x0030, 0x001e, 0x0030, 0x0003, 0x002d, 0x000f, 0x002a, 0x0021, 0x002a, 0x0027, 0x0012,
-    0x0024, 0x000f, 0x0021, 0x0003, 0x001e, 0x0015, 0x001b, 0x0000, 0x0018, 0x0009, 0x000f, 0x0015, 0x0012, 0x0009,
-    0x0012, 0x0015, 0x000f, 0x0003, 0x0009, 0x000c, 0x0000, 0x0006, 0x0000, 0x0003, 0x0170, 0x00f7, 0xfa4e, 0x0189,
-    0x00f7, 0xfa4e, 0x0170, 0x0000, 0xfa4e, 0x02a5, 0x00f7, 0xfa4e, 0x02a5, 0x0113, 0xfa4e, 0x01ff, 0x00f7, 0xfa4e,
-    0x028c, 0x00f7, 0xfa4e, 0x0215, 0x00f7, 0xfa4e, 0x02a5, 0x0000, 0xfa4e, 0x0170, 0x0113, 0xfa4e, 0x0215, 0x0113,
-    0xfa4e, 0x0189, 0x0113, 0xfa4e, 0x01ff, 0x0000, 0xfa4e, 0x028c, 0x0000, 0xfa4e, 0x01ff, 0x0113, 0xfa4e, 0x0189,
-    0x0000, 0xfa4e, 0x028c, 0x0113, 0xfa4e, 0x0215, 0x0000, 0xfa4e, 0x000c, 0x0002, 0x0003, 0x0683, 0x0000, 0xfa84,
-    0x011e, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0729, 0x0000, 0xfb6e, 0x0729, 0x0000, 0xf99a,
-    0x05de, 0x0000, 0xf99a, 0x05de, 0x0000, 0xfb6e, 0x006c, 0x0012, 0x0002, 0x0000, 0xfea1, 0xff48, 0x0bc9, 0x0000,
-    0x0066, 0x0069, 0x0060, 0x0063, 0x005a, 0x005d, 0x0054, 0x0057, 0x004e, 0x0051, 0x0048, 0x004b, 0x0042, 0x0045,
-    0x003c, 0x003f, 0x0036, 0x0039, 0x0030, 0x0033, 0x002a, 0x002d, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b,
-    0x0012, 0x0015, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 0xf625, 0xfea1, 0xfbe3, 0xf625, 0xfea1, 0xf8d1,
-    0xf625, 0xfea1, 0xfbe3, 0xf656, 0xfea1, 0xfdcf, 0xf656, 0xfea1, 0xfdcf, 0xf6e5, 0xfea1, 0xffa9, 0xf6e5, 0xfea1,
-    0xffa9, 0xf7ce, 0xfea1, 0x015c, 0xf7ce, 0xfea1, 0x015c, 0xf908, 0xfea1, 0x02da, 0xf908, 0xfea1, 0x02da, 0xfa87,
-    0xfea1, 0x0414, 0xfb8c, 0xfea1, 0x04a0, 0xfc3b, 0xfea1, 0x04fd, 0xfc3b, 0xfea1, 0x04fd, 0xfe14, 0xfea1, 0x058d,
-    0xfe14, 0xfea1, 0x058d, 0x0000, 0xfea1, 0x05be, 0x01ec, 0xfea1, 0x058d, 0x0000, 0xfea1, 0x05be, 0x03c5, 0xfea1,
-    0x04fd, 0x01ec, 0xfea1, 0x058d, 0x0474, 0xfea1, 0x04a0, 0x03c5, 0xfea1, 0x04fd, 0x06f8, 0xfea1, 0x02da, 0x0579,
-    0xfea1, 0x0414, 0x0832, 0xfea1, 0x015c, 0x06f8, 0xfea1, 0x02da, 0x091b, 0xfea1, 0xffa9, 0x0832, 0xfea1, 0x015c,
-    0x09aa, 0xfea1, 0xfdcf, 0x091b, 0xfea1, 0xffa9, 0x09db, 0xfea1, 0xfbe3, 0x09aa, 0xfea1, 0xfdcf, 0x09db, 0xfea1,
-    0xfbe3, 0x09db, 0xfea1, 0xf8d1, 0x0045, 0x0016, 0x0002, 0x0000, 0xfd63, 0x1190, 0x081c, 0x0000, 0x0003, 0x0042,
-    0x0042, 0x003f, 0x003c, 0x0027, 0x003f, 0x0039, 0x0036, 0x003c, 0x0039, 0x0021, 0x0033, 0x0036, 0x001e, 0x0033,
-    0x0024, 0x0030, 0x0030, 0x0015, 0x002d, 0x001b, 0x002a, 0x002d, 0x0018, 0x002a, 0x0027, 0x0000, 0x0021, 0x0024,
-    0x001b, 0x001e, 0x0015, 0x0018, 0x0012, 0x000f, 0x000f, 0x0009, 0x000c, 0x0006, 0x0006, 0x0009, 0x0000, 0x0003,
-    0xfc31, 0xfd84, 0x12eb, 0xfc31, 0xfd84, 0x11b3, 0x0802, 0xfd42, 0x12d7, 0x0000, 0xfd42, 0x12d7, 0x0802, 0xfd42,
-    0x118f, 0xf7fe, 0xfd42, 0x12d7, 0xf7fe, 0xfd42, 0x118f, 0x02db, 0xfd84, 0x1040, 0x03cf, 0xfd84, 0x11b3, 0x01e7,
-    0xfd84, 0x12eb, 0x00f3, 0xfd84, 0x12eb, 0x0000, 0xfd84, 0x1117, 0x00f3, 0xfd84, 0x1104, 0xfd25, 0xfd84, 0x12eb,
-    0x03cf, 0xfd84, 0x12eb, 0x02db, 0xfd84, 0x12eb, 0x01e7, 0xfd84, 0x10b5, 0x0000, 0xfd84, 0x12eb, 0xff0d, 0xfd84,
-    0x12eb, 0xff0d, 0xfd84, 0x1104, 0xfe19, 0xfd84, 0x12eb, 0xfe19, 0xfd84, 0x10b5, 0xfd2a, 0xfd84, 0x1036, 0x000c,
-    0x0002, 0x0003, 0xf7cd, 0x0000, 0xfa84, 0x014f, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xf8bc,
-    0x0000, 0xfb6e, 0xf6dd, 0x0000, 0xf99a, 0xf6dd, 0x0000, 0xfb6e, 0xf8bc, 0x0000, 0xf99a, 0x000c, 0x0002, 0x0003,
-    0xf7cd, 0x0000, 0xfcbb, 0x019a, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xf8bc, 0x0000, 0xfe07,
-    0xf6dd, 0x0000, 0xfb6e, 0xf6dd, 0x0000, 0xfe07, 0xf8bc, 0x0000, 0xfb6e, 0x000f, 0x0003, 0x0003, 0xf7cd, 0x0000,
-    0xff21, 0x0172, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0003, 0x000c, 0x0006, 0x0003, 0xf6dd, 0x0000,
-    0x003b, 0xf8bc, 0x0000, 0x003b, 0xf6dd, 0x0000, 0x0028, 0xf8bc, 0x0000, 0xfe07, 0xf6dd, 0x0000, 0xfe07, 0x000c,
-    0x0002, 0x0003, 0xf7cd, 0x0000, 0x015a, 0x0176, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0xf8bc,
-    0x0000, 0x003b, 0xf6dd, 0x0000, 0x003b, 0xf8bc, 0x0000, 0x0279, 0xf6dd, 0x0000, 0x0279, 0x000c, 0x0002, 0x0003,
-    0x07a7, 0x0000, 0xfa84, 0x010a, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0826, 0x0000, 0xfb6e,
-    0x0826, 0x0000, 0xf99a, 0x0729, 0x0000, 0xfb6e, 0x0729, 0x0000, 0xf99a, 0x000c, 0x0002, 0x0003, 0x07a7, 0x0000,
-    0xfc50, 0x0103, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0729, 0x0000, 0xfd31, 0x0826, 0x0000,
-    0xfb6e, 0x0729, 0x0000, 0xfb6e, 0x0826, 0x0000, 0xfd31, 0x000c, 0x0002, 0x0003, 0x07a7, 0x0000, 0xfe13, 0x0103,
-    0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0729, 0x0000, 0xfef4, 0x0826, 0x0000, 0xfd31, 0x0729,
-    0x0000, 0xfd31, 0x0826, 0x0000, 0xfef4, 0x000c, 0x0002, 0x0003, 0x07a7, 0x0000, 0xffd5, 0x0102, 0x0000, 0x0000,
-    0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x0729, 0x0000, 0x00b6, 0x0826, 0x0000, 0xfef4, 0x0729, 0x0000, 0xfef4,
-    0x0826, 0x0000, 0x00b6, 0x000c, 0x0002, 0x0003, 0x07a7, 0x0000, 0x0197, 0x0103, 0x0000, 0x0000, 0x0003, 0x0006,
-    0x0000, 0x0009, 0x0003, 0x0729, 0x0000, 0x0279, 0x0826, 0x0000, 0x00b6, 0x0729, 0x0000, 0x00b6, 0x0826, 0x0000,
-    0x0279, 0x000c, 0x0002, 0x0003, 0xfd20, 0x0000, 0xfeac, 0x01d6, 0x0000, 0x0003, 0x0009, 0x0000, 0x0000, 0x0009,
-    0x0006, 0xfbda, 0x0000, 0xff94, 0xfd2a, 0x0000, 0x0081, 0xfd11, 0x0000, 0xfcd6, 0xfe65, 0x0000, 0xfe19, 0x000c,
-    0x0002, 0x0003, 0xf96f, 0x0000, 0xfa84, 0x0126, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xf8bc,
-    0x0000, 0xfb6e, 0xfa22, 0x0000, 0xf99a, 0xf8bc, 0x0000, 0xf99a, 0xfa22, 0x0000, 0xfb6e, 0x00e4, 0x004c, 0x0002,
-    0x0000, 0x05ca, 0x0000, 0x040a, 0x0000, 0x00d5, 0x00de, 0x00cc, 0x00e1, 0x00e1, 0x00d8, 0x00db, 0x00de, 0x00d8,
-    0x00db, 0x00c3, 0x00d5, 0x00d2, 0x00c0, 0x00c6, 0x0060, 0x0054, 0x00cf, 0x00cf, 0x00d2, 0x00c9, 0x00cc, 0x00c6,
-    0x00c9, 0x00c0, 0x00c3, 0x00bd, 0x00ba, 0x00b7, 0x00bd, 0x00ba, 0x008d, 0x00a2, 0x0027, 0x009f, 0x00b7, 0x00a5,
-    0x009c, 0x0099, 0x00ae, 0x00ab, 0x0087, 0x00b4, 0x0096, 0x002a, 0x00b1, 0x00b1, 0x00b4, 0x00ae, 0x00a8, 0x00a8,
-    0x00ab, 0x00a2, 0x00a5, 0x009c, 0x009f, 0x0096, 0x0099, 0x0093, 0x0090, 0x008a, 0x0093, 0x0090, 0x005a, 0x0072,
-    0x008d, 0x006f, 0x008a, 0x0075, 0x006c, 0x0069, 0x007e, 0x007b, 0x0051, 0x0084, 0x0066, 0x0087, 0x0081, 0x0081,
-    0x0084, 0x007e, 0x0078, 0x0078, 0x007b, 0x0072, 0x0075, 0x006c, 0x006f, 0x0066, 0x0069, 0x0063, 0x005d, 0x0057,
-    0x0063, 0x005d, 0x0060, 0x003c, 0x005a, 0x0039, 0x0057, 0x003f, 0x0036, 0x0033, 0x0048, 0x0045, 0x0054, 0x004e,
-    0x0030, 0x0051, 0x004b, 0x004b, 0x004e, 0x0048, 0x0042, 0x0042, 0x0045, 0x003c, 0x003f, 0x0036, 0x0039, 0x0030,
-    0x0033, 0x002d, 0x0024, 0x0021, 0x002d, 0x001b, 0x002a, 0x0024, 0x0027, 0x0015, 0x000f, 0x0009, 0x0021, 0x001e,
-    0x000c, 0x0018, 0x001e, 0x0012, 0x0006, 0x0018, 0x001b, 0x0015, 0x0000, 0x0003, 0x0012, 0x000c, 0x000f, 0x0006,
-    0x0009, 0x0000, 0x0003, 0xffed, 0x09d4, 0x0000, 0xffed, 0x0986, 0x0000, 0xff78, 0x0986, 0x0000, 0xff78, 0x095f,
-    0x0000, 0x0013, 0x095f, 0x0000, 0x0013, 0x0986, 0x0000, 0xff9f, 0x0986, 0x0000, 0x0013, 0x09d4, 0x0000, 0xff9f,
-    0x095f, 0x0000, 0xff9f, 0x089c, 0x0000, 0xffed, 0x095f, 0x0000, 0xff78, 0x089c, 0x0000, 0xff9f, 0x0875, 0x0000,
-    0x0061, 0x0875, 0x0000, 0x0061, 0x089c, 0x0000, 0xff78, 0x0875, 0x0000, 0x0088, 0x0409, 0x0000, 0x0088, 0x03e2,
-    0x0000, 0xff78, 0x0409, 0x0000, 0xff78, 0x03e2, 0x0000, 0x0061, 0x0409, 0x0000, 0xff9f, 0x0409, 0x0000, 0xff9f,
-    0x03e2, 0x0000, 0xff9f, 0x031f, 0x0000, 0x0061, 0x03e2, 0x0000, 0x0088, 0x04f3, 0x0000, 0x0088, 0x04cc, 0x0000,
-    0x0061, 0x04f3, 0x0000, 0x0061, 0x031f, 0x0000, 0xff78, 0x031f, 0x0000, 0x0061, 0x04cc, 0x0000, 0xff9f, 0x02f8,
-    0x0000, 0x0061, 0x02f8, 0x0000, 0xff78, 0x02f8, 0x0000, 0x0088, 0x05de, 0x0000, 0x0088, 0x05b7, 0x0000, 0xff78,
-    0x05de, 0x0000, 0xff78, 0x05b7, 0x0000, 0x0061, 0x05de, 0x0000, 0xff9f, 0x05de, 0x0000, 0xff9f, 0x05b7, 0x0000,
-    0xff9f, 0x04f3, 0x0000, 0x0061, 0x05b7, 0x0000, 0x0088, 0x06c8, 0x0000, 0x0088, 0x06a1, 0x0000, 0x0061, 0x06c8,
-    0x0000, 0xff78, 0x04f3, 0x0000, 0x0061, 0x06a1, 0x0000, 0xff9f, 0x04cc, 0x0000, 0xff78, 0x04cc, 0x0000, 0x0088,
-    0x07b2, 0x0000, 0x0088, 0x078b, 0x0000, 0xff78, 0x07b2, 0x0000, 0xff78, 0x078b, 0x0000, 0x0061, 0x07b2, 0x0000,
-    0xff9f, 0x07b2, 0x0000, 0xff9f, 0x078b, 0x0000, 0xff9f, 0x06c8, 0x0000, 0x0061, 0x078b, 0x0000, 0x0088, 0x089c,
-    0x0000, 0x0088, 0x0875, 0x0000, 0xff78, 0x06c8, 0x0000, 0xff9f, 0x06a1, 0x0000, 0xff78, 0x06a1, 0x0000, 0x0088,
-    0x0235, 0x0000, 0x0088, 0x020e, 0x0000, 0x0061, 0x0235, 0x0000, 0x0013, 0x0235, 0x0000, 0xffed, 0x0235, 0x0000,
-    0x0088, 0x031f, 0x0000, 0x0088, 0x02f8, 0x0000, 0x0061, 0x020e, 0x0000, 0xffed, 0x01c0, 0x0000, 0x0013, 0x01c0,
-    0x0000, 0x0013, 0x020e, 0x0000, 0xffed, 0x020e, 0x0000, 0x0156, 0x00a1, 0x0002, 0x0000, 0x00ee, 0x0000, 0x0123,
-    0x03e7, 0x0045, 0x003c, 0x0057, 0x0045, 0x0060, 0x0057, 0x0069, 0x0060, 0x0072, 0x0069, 0x0075, 0x0072, 0x004e,
-    0x0075, 0x003c, 0x004e, 0x006c, 0x0075, 0x0063, 0x0072, 0x005a, 0x0069, 0x0051, 0x0060, 0x0054, 0x0057, 0x0048,
-    0x004e, 0x0042, 0x0045, 0x0033, 0x003c, 0x0126, 0x0144, 0x0129, 0x0147, 0x013b, 0x014a, 0x0138, 0x014d, 0x0135,
-    0x0150, 0x013e, 0x012c, 0x0141, 0x012f, 0x0132, 0x0153, 0x0141, 0x0153, 0x0153, 0x0150, 0x0150, 0x014d, 0x014d,
-    0x014a, 0x014a, 0x0147, 0x0147, 0x0144, 0x0144, 0x013e, 0x013e, 0x0141, 0x0129, 0x013b, 0x013b, 0x0138, 0x0138,
-    0x0135, 0x0135, 0x0132, 0x0132, 0x012f, 0x012f, 0x012c, 0x012c, 0x0126, 0x0126, 0x0129, 0x0114, 0x00ba, 0x00c3,
-    0x011d, 0x00b1, 0x010b, 0x011a, 0x00c0, 0x00ab, 0x0105, 0x010e, 0x00b4, 0x00a5, 0x00ff, 0x00bd, 0x0117, 0x0111,
-    0x00b7, 0x00fc, 0x00a2, 0x0108, 0x00ae, 0x0120, 0x00c6, 0x00c9, 0x0123, 0x0102, 0x00a8, 0x011a, 0x0123, 0x0120,
-    0x0123, 0x011d, 0x0120, 0x011a, 0x011d, 0x0114, 0x0117, 0x010e, 0x0111, 0x0108, 0x010b, 0x0102, 0x0105, 0x00fc,
-    0x00ff, 0x00f0, 0x00cc, 0x00f6, 0x00d2, 0x00f3, 0x00cf, 0x00f9, 0x00d5, 0x00f6, 0x00f9, 0x00f0, 0x00f3, 0x00ea,
-    0x00ed, 0x009f, 0x00e7, 0x0093, 0x00db, 0x00d8, 0x0090, 0x009c, 0x00e4, 0x0099, 0x00e1, 0x00de, 0x0096, 0x00e4,
-    0x00e7, 0x00e1, 0x00e4, 0x00de, 0x00e1, 0x00db, 0x00de, 0x00d8, 0x00db, 0x00d2, 0x00d5, 0x00c0, 0x00c9, 0x00cc,
-    0x00cf, 0x00c6, 0x00c9, 0x00c3, 0x00c6, 0x00c0, 0x00c3, 0x00ba, 0x00bd, 0x00b4, 0x00b7, 0x00ae, 0x00b1, 0x00a8,
-    0x00ab, 0x00a2, 0x00a5, 0x009c, 0x009f, 0x0099, 0x009c, 0x0096, 0x0099, 0x0093, 0x0096, 0x0090, 0x0093, 0x007b,
-    0x002d, 0x000c, 0x0078, 0x0084, 0x0012, 0x0024, 0x007e, 0x008a, 0x002a, 0x001b, 0x0087, 0x0081, 0x001e, 0x0027,
-    0x008d, 0x001e, 0x0027, 0x0027, 0x002a, 0x002a, 0x001b, 0x001b, 0x0012, 0x0012, 0x0024, 0x002d, 0x001e, 0x0024,
-    0x000c, 0x000c, 0x002d, 0x0081, 0x008d, 0x008d, 0x008a, 0x008a, 0x0087, 0x0087, 0x0084, 0x0084, 0x007e, 0x007b,
-    0x0081, 0x007e, 0x0078, 0x0078, 0x007b, 0x0075, 0x004b, 0x006f, 0x004b, 0x0048, 0x006c, 0x0072, 0x006f, 0x0066,
-    0x006f, 0x006c, 0x0063, 0x0069, 0x0066, 0x005d, 0x0066, 0x0063, 0x005a, 0x0060, 0x005d, 0x0054, 0x005d, 0x005a,
-    0x0051, 0x0057, 0x003f, 0x0042, 0x0054, 0x0051, 0x003f, 0x004e, 0x0036, 0x004b, 0x0036, 0x0033, 0x0048, 0x0045,
-    0x0030, 0x0039, 0x0042, 0x003f, 0x0030, 0x003c, 0x0039, 0x0036, 0x0039, 0x0030, 0x0033, 0x000f, 0x0000, 0x0018,
-    0x0015, 0x0015, 0x0021, 0x002d, 0x0000, 0x0003, 0x0006, 0x002a, 0x0009, 0x0006, 0x0027, 0x0021, 0x0024, 0x0021,
-    0x000f, 0x0009, 0x0018, 0x0003, 0x001e, 0x0018, 0x001b, 0x0012, 0x0015, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000,
-    0x0003, 0xfff1, 0x01dc, 0xffdc, 0xffdc, 0x01dc, 0xfff1, 0xffdc, 0x01dc, 0x000f, 0xfff1, 0x01dc, 0x0024, 0x001c,
-    0x01ce, 0xffbb, 0x000f, 0x01dc, 0xffdc, 0x0045, 0x01ce, 0x001c, 0x0024, 0x01dc, 0x000f, 0x000f, 0x01dc, 0x0024,
-    0x001c, 0x01ce, 0x0045, 0xffbb, 0x01ce, 0xffe4, 0x0024, 0x01dc, 0xfff1, 0x0045, 0x01ce, 0xffe4, 0xffbb, 0x01ce,
-    0x001c, 0xffe4, 0x01ce, 0x0045, 0xffe4, 0x01ce, 0xffbb, 0x001c, 0x019a, 0xffbb, 0xffe4, 0x019a, 0xffbb, 0xff27,
-    0x0135, 0xffa6, 0xffa6, 0x0135, 0xff27, 0xffc5, 0x0167, 0xff71, 0x0045, 0x019a, 0xffe4, 0x005a, 0x0135, 0xff27,
-    0x003b, 0x0167, 0xff71, 0xffbb, 0x019a, 0xffe4, 0xff27, 0x0135, 0x005a, 0xff71, 0x0167, 0xffc5, 0x0045, 0x019a,
-    0x001c, 0x00d9, 0x0135, 0xffa6, 0x008f, 0x0167, 0xffc5, 0x001c, 0x019a, 0x0045, 0x00d9, 0x0135, 0x005a, 0x008f,
-    0x0167, 0x003b, 0xffe4, 0x019a, 0x0045, 0x005a, 0x0135, 0x00d9, 0x003b, 0x0167, 0x008f, 0xffbb, 0x019a, 0x001c,
-    0xffa6, 0x0135, 0x00d9, 0xffc5, 0x0167, 0x008f, 0xff71, 0x0167, 0x003b, 0x001c, 0x01a0, 0xffbb, 0xffe4, 0x01a0,
-    0xffbb, 0x0045, 0x01a0, 0xffe4, 0xffbb, 0x01a0, 0xffe4, 0x0045, 0x01a0, 0x001c, 0x001c, 0x01a0, 0x0045, 0xffe4,
-    0x01a0, 0x0045, 0xffbb, 0x01a0, 0x001c, 0xff60, 0x0026, 0xffbe, 0xff60, 0x0026, 0x0043, 0xffbe, 0x0026, 0x00a1,
-    0x0042, 0x0026, 0x00a1, 0x00a0, 0x0026, 0x0043, 0x00a0, 0x0026, 0xffbe, 0x00a2, 0x0000, 0xffd1, 0x0094, 0x0000,
-    0xffb0, 0x0094, 0x0000, 0x0050, 0x00a2, 0x0000, 0x002f, 0x002f, 0x0000, 0x00a2, 0x0050, 0x0000, 0x0094, 0xffb0,
-    0x0000, 0x0094, 0xffd1, 0x0000, 0x00a2, 0xff5e, 0x0000, 0x002f, 0xff6c, 0x0000, 0x0050, 0xff6c, 0x0000, 0xffb0,
-    0xff5e, 0x0000, 0xffd1, 0xff6f, 0x0000, 0xffd5, 0xff7b, 0x0000, 0xffb8, 0x0050, 0x014a, 0xff6c, 0x002f, 0x014a,
-    0xff5e, 0xffd1, 0x014a, 0xff5e, 0xffb0, 0x014a, 0xff6c, 0xff60, 0x0013, 0xffbe, 0xff60, 0x0013, 0x0043, 0xffbe,
-    0x0013, 0x00a1, 0x0042, 0x0013, 0x00a1, 0x00a0, 0x0013, 0x0043, 0x00a0, 0x0013, 0xffbe, 0x002f, 0x0027, 0x00a2,
-    0xffd1, 0x0027, 0x00a2, 0x0050, 0x010b, 0xff6c, 0x002f, 0x010b, 0xff5e, 0xffd1, 0x010b, 0xff5e, 0xffb0, 0x010b,
-    0xff6c, 0x00a2, 0x014a, 0xffd1, 0x0094, 0x014a, 0xffb0, 0x0094, 0x014a, 0x0050, 0x00a2, 0x014a, 0x002f, 0x002f,
-    0x014a, 0x00a2, 0x0050, 0x014a, 0x0094, 0xffb0, 0x014a, 0x0094, 0xffd1, 0x014a, 0x00a2, 0xff5e, 0x014a, 0x002f,
-    0xff6c, 0x014a, 0x0050, 0xff6c, 0x014a, 0xffb0, 0xff5e, 0x014a, 0xffd1, 0xff6f, 0x014a, 0xffd5, 0xff7b, 0x014a,
-    0xffb8, 0xffba, 0x010b, 0xff55, 0x0046, 0x010b, 0xff55, 0xff55, 0x010b, 0xffba, 0xff55, 0x010b, 0x0046, 0xffba,
-    0x010b, 0x00ab, 0x0046, 0x010b, 0x00ab, 0x00ab, 0x010b, 0x0046, 0x00ab, 0x010b, 0xffba, 0xff55, 0x011e, 0xffba,
-    0xff55, 0x011e, 0x0046, 0xffba, 0x011e, 0xff55, 0x0046, 0x011e, 0xff55, 0x00ab, 0x011e, 0xffba, 0x00ab, 0x011e,
-    0x0046, 0x0046, 0x011e, 0x00ab, 0xffba, 0x011e, 0x00ab, 0x0018, 0x0008, 0x0002, 0x0000, 0x0000, 0xfb64, 0x012d,
-    0x0000, 0x0015, 0x0009, 0x0012, 0x0015, 0x0006, 0x0012, 0x000f, 0x0003, 0x000c, 0x000f, 0x0000, 0x000c, 0x0006,
-    0x0009, 0x0000, 0x0003, 0x0052, 0x0000, 0xfad8, 0x0052, 0x0000, 0xfb2c, 0x0052, 0x0000, 0xfb36, 0x010b, 0x0000,
-    0xfbef, 0xffae, 0x0000, 0xfad8, 0xffae, 0x0000, 0xfb2c, 0xffae, 0x0000, 0xfb36, 0xfef5, 0x0000, 0xfbef, 0x0063,
-    0x001e, 0x0002, 0x0000, 0x0000, 0xfd38, 0x022b, 0x0000, 0x0060, 0x005a, 0x005d, 0x0057, 0x005a, 0x0054, 0x0057,
-    0x0051, 0x0054, 0x004e, 0x0051, 0x004b, 0x004e, 0x0048, 0x004b, 0x0045, 0x0048, 0x001b, 0x0045, 0x0015, 0x0042,
-    0x000f, 0x003f, 0x0042, 0x003c, 0x003f, 0x0039, 0x003c, 0x0036, 0x0039, 0x0033, 0x002d, 0x0030, 0x002a, 0x002d,
-    0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x0024, 0x001e, 0x0021, 0x0018, 0x001e, 0x0012, 0x0018, 0x001b, 0x0012,
-    0x0015, 0x000c, 0x000f, 0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 0x0000, 0x0003, 0x017d, 0x0000, 0xfc6d,
-    0x0144, 0x0000, 0xfcb3, 0x00ff, 0x0000, 0xfcec, 0x00af, 0x0000, 0xfd16, 0x0059, 0x0000, 0xfd31, 0x0000, 0x0000,
-    0xfd39, 0x0080, 0x0000, 0xfdf5, 0x0000, 0x0000, 0xfe02, 0x006d, 0x0000, 0xfd93, 0x0000, 0x0000, 0xfd9e, 0x00fc,
-    0x0000, 0xfdd0, 0x00d6, 0x0000, 0xfd73, 0x016e, 0x0000, 0xfd93, 0x0136, 0x0000, 0xfd3f, 0x01d2, 0x0000, 0xfd41,
-    0x018b, 0x0000, 0xfcfa, 0x0224, 0x0000, 0xfcdd, 0x01d1, 0x0000, 0xfca5, 0xfe83, 0x0000, 0xfc6d, 0xfebc, 0x0000,
-    0xfcb3, 0xff01, 0x0000, 0xfcec, 0xff51, 0x0000, 0xfd16, 0xffa7, 0x0000, 0xfd31, 0xff80, 0x0000, 0xfdf5, 0xff93,
-    0x0000, 0xfd93, 0xff04, 0x0000, 0xfdd0, 0xff2a, 0x0000, 0xfd73, 0xfe92, 0x0000, 0xfd93, 0xfeca, 0x0000, 0xfd3f,
-    0xfe2e, 0x0000, 0xfd41, 0xfe75, 0x0000, 0xfcfa, 0xfddc, 0x0000, 0xfcdd, 0xfe2f, 0x0000, 0xfca5, 0x0024, 0x0010,
-    0x0003, 0xfcc5, 0x001d, 0xfeaa, 0x0067, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c,
-    0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003,
-    0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009,
-    0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 0xfd07, 0x003a,
-    0xfeec, 0xfd21, 0x003a, 0xfe84, 0xfc69, 0x003a, 0xfed0, 0xfd07, 0x0000, 0xfeec, 0xfc83, 0x003a, 0xfe68, 0xfc83,
-    0x0000, 0xfe68, 0xfcc5, 0x003a, 0xff07, 0xfcc5, 0x0000, 0xff07, 0xfcc5, 0x003a, 0xfe4c, 0xfcc5, 0x0000, 0xfe4c,
-    0xfd21, 0x0000, 0xfe84, 0xfc69, 0x0000, 0xfed0, 0x0024, 0x0010, 0x0003, 0xfe41, 0x001d, 0xffa7, 0x0067, 0x0000,
-    0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018,
-    0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003,
-    0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e,
-    0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 0xfe83, 0x003a, 0xffea, 0xfe9c, 0x003a, 0xff81, 0xfde5, 0x003a,
-    0xffcd, 0xfe83, 0x0000, 0xffea, 0xfdfe, 0x003a, 0xff65, 0xfdfe, 0x0000, 0xff65, 0xfe41, 0x003a, 0x0004, 0xfe41,
-    0x0000, 0x0004, 0xfe41, 0x003a, 0xff4a, 0xfe41, 0x0000, 0xff4a, 0xfe9c, 0x0000, 0xff81, 0xfde5, 0x0000, 0xffcd,
-    0x0024, 0x0010, 0x0003, 0x01bf, 0x001d, 0xffa7, 0x0067, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009,
-    0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012,
-    0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000,
-    0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006,
-    0x0202, 0x003a, 0xffea, 0x021b, 0x003a, 0xff81, 0x0164, 0x003a, 0xffcd, 0x0202, 0x0000, 0xffea, 0x017d, 0x003a,
-    0xff65, 0x017d, 0x0000, 0xff65, 0x01bf, 0x003a, 0x0004, 0x01bf, 0x0000, 0x0004, 0x01bf, 0x003a, 0xff4a, 0x01bf,
-    0x0000, 0xff4a, 0x021b, 0x0000, 0xff81, 0x0164, 0x0000, 0xffcd, 0x0024, 0x0010, 0x0003, 0x033b, 0x001d, 0xfeaa,
-    0x0067, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015,
-    0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006,
-    0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b,
-    0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 0x037d, 0x003a, 0xfeec, 0x0397, 0x003a, 0xfe84,
-    0x02df, 0x003a, 0xfed0, 0x037d, 0x0000, 0xfeec, 0x02f9, 0x003a, 0xfe68, 0x02f9, 0x0000, 0xfe68, 0x033b, 0x003a,
-    0xff07, 0x033b, 0x0000, 0xff07, 0x033b, 0x003a, 0xfe4c, 0x033b, 0x0000, 0xfe4c, 0x0397, 0x0000, 0xfe84, 0x02df,
-    0x0000, 0xfed0, 0x0024, 0x0010, 0x0003, 0x0439, 0x001d, 0xfd2e, 0x0067, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003,
-    0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003,
-    0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f,
-    0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003,
-    0x000c, 0x0006, 0x047b, 0x003a, 0xfd70, 0x0495, 0x003a, 0xfd08, 0x03dd, 0x003a, 0xfd54, 0x047b, 0x0000, 0xfd70,
-    0x03f7, 0x003a, 0xfcec, 0x03f7, 0x0000, 0xfcec, 0x0439, 0x003a, 0xfd8b, 0x0439, 0x0000, 0xfd8b, 0x0439, 0x003a,
-    0xfcd0, 0x0439, 0x0000, 0xfcd0, 0x0495, 0x0000, 0xfd08, 0x03dd, 0x0000, 0xfd54, 0x0024, 0x0010, 0x0003, 0x0603,
-    0xfd60, 0x050b, 0x0067, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000,
-    0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c,
-    0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b,
-    0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 0x0645, 0xfd7d, 0x054d, 0x065f,
-    0xfd7d, 0x04e5, 0x05a7, 0xfd7d, 0x0531, 0x0645, 0xfd42, 0x054d, 0x05c1, 0xfd7d, 0x04c9, 0x05c1, 0xfd42, 0x04c9,
-    0x0603, 0xfd7d, 0x0569, 0x0603, 0xfd42, 0x0569, 0x0603, 0xfd7d, 0x04ae, 0x0603, 0xfd42, 0x04ae, 0x065f, 0xfd42,
-    0x04e5, 0x05a7, 0xfd42, 0x0531, 0x0024, 0x0010, 0x0003, 0xf9fa, 0xfd60, 0x050b, 0x0067, 0x0000, 0x0000, 0x0003,
-    0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c, 0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b,
-    0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003, 0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e,
-    0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009, 0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006,
-    0x0021, 0x0003, 0x000c, 0x0006, 0xfa3c, 0xfd7d, 0x054d, 0xfa56, 0xfd7d, 0x04e5, 0xf99e, 0xfd7d, 0x0531, 0xfa3c,
-    0xfd42, 0x054d, 0xf9b8, 0xfd7d, 0x04c9, 0xf9b8, 0xfd42, 0x04c9, 0xf9fa, 0xfd7d, 0x0569, 0xf9fa, 0xfd42, 0x0569,
-    0xf9fa, 0xfd7d, 0x04ae, 0xf9fa, 0xfd42, 0x04ae, 0xfa56, 0xfd42, 0x04e5, 0xf99e, 0xfd42, 0x0531, 0x0024, 0x0010,
-    0x0003, 0xfbc7, 0x001d, 0xfd2e, 0x0067, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0000, 0x0009, 0x0006, 0x000c,
-    0x000f, 0x0000, 0x0012, 0x0015, 0x000c, 0x0018, 0x001b, 0x001b, 0x0018, 0x0003, 0x0015, 0x0012, 0x0006, 0x0003,
-    0x0018, 0x000c, 0x0000, 0x0006, 0x0012, 0x0003, 0x0009, 0x001e, 0x0006, 0x000f, 0x0021, 0x0000, 0x0015, 0x0009,
-    0x000c, 0x001b, 0x000f, 0x001b, 0x0003, 0x001e, 0x0015, 0x0006, 0x0021, 0x0003, 0x000c, 0x0006, 0xfc09, 0x003a,
-    0xfd70, 0xfc23, 0x003a, 0xfd08, 0xfb6b, 0x003a, 0xfd54, 0xfc09, 0x0000, 0xfd70, 0xfb85, 0x003a, 0xfcec, 0xfb85,
-    0x0000, 0xfcec, 0xfbc7, 0x003a, 0xfd8b, 0xfbc7, 0x0000, 0xfd8b, 0xfbc7, 0x003a, 0xfcd0, 0xfbc7, 0x0000, 0xfcd0,
-    0xfc23, 0x0000, 0xfd08, 0xfb6b, 0x0000, 0xfd54, 0x000c, 0x0004, 0x0002, 0x08b8, 0xfea1, 0x0bdf, 0x058d, 0x0000,
-    0x0006, 0x0003, 0x0009, 0x0000, 0x0006, 0x0009, 0x0000, 0x0003, 0x09d7, 0xfea1, 0x066f, 0x09d7, 0xfea1, 0x114f,
-    0x079a, 0xfea1, 0x114f, 0x079a, 0xfea1, 0x066f, 0x000c, 0x0004, 0x0002, 0xf748, 0xfea1, 0x0bdf, 0x058d, 0x0000,
-    0x0006, 0x0003, 0x0009, 0x0000, 0x0006, 0x0009, 0x0000, 0x0003, 0xf629, 0xfea1, 0x066f, 0xf629, 0xfea1, 0x114f,
-    0xf866, 0xfea1, 0x114f, 0xf866, 0xfea1, 0x066f, 0x0030, 0x0010, 0x0002, 0x0000, 0xfd44, 0x0c0d, 0x031d, 0x0000,
-    0x0003, 0x002d, 0x002d, 0x002a, 0x002a, 0x0027, 0x0027, 0x0024, 0x0024, 0x0021, 0x0021, 0x001e, 0x001e, 0x001b,
-    0x001b, 0x0018, 0x0018, 0x0015, 0x0015, 0x0012, 0x0012, 0x000f, 0x000f, 0x000c, 0x000c, 0x0009, 0x0009, 0x0006,
-    0x0006, 0x0000, 0x0000, 0x0003, 0x0131, 0xfd44, 0x0eed, 0x0000, 0xfd44, 0x0f2a, 0x0233, 0xfd44, 0x0e41, 0x02e0,
-    0xfd44, 0x0d3e, 0x031d, 0xfd44, 0x0c0d, 0x02e0, 0xfd44, 0x0adc, 0x0233, 0xfd44, 0x09d9, 0x0131, 0xfd44, 0x092d,
-    0x0000, 0xfd44, 0x08f0, 0xfecf, 0xfd44, 0x092d, 0xfdcd, 0xfd44, 0x09d9, 0xfd20, 0xfd44, 0x0adc, 0xfce3, 0xfd44,
-    0x0c0d, 0xfd20, 0xfd44, 0x0d3e, 0xfdcd, 0xfd44, 0x0e41, 0xfecf, 0xfd44, 0x0eed, 0x0024, 0x000c, 0x0002, 0x0174,
-    0xfd44, 0x0d17, 0x0095, 0x0000, 0x0021, 0x0000, 0x001e, 0x0021, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018,
-    0x0012, 0x0015, 0x000f, 0x0012, 0x000c, 0x000f, 0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 0x0000, 0x0003,
-    0x0175, 0xfd44, 0x0dac, 0x012b, 0xfd44, 0x0d98, 0x00f4, 0xfd44, 0x0d62, 0x00e0, 0xfd44, 0x0d18, 0x00f4, 0xfd44,
-    0x0ccd, 0x012b, 0xfd44, 0x0c97, 0x0175, 0xfd44, 0x0c83, 0x01bf, 0xfd44, 0x0c97, 0x01f5, 0xfd44, 0x0ccd, 0x0209,
-    0xfd44, 0x0d18, 0x01f5, 0xfd44, 0x0d62, 0x01bf, 0xfd44, 0x0d98, 0x0024, 0x000c, 0x0002, 0xfe8c, 0xfd44, 0x0d17,
-    0x0095, 0x0000, 0x0021, 0x0000, 0x001e, 0x0021, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015,
-    0x000f, 0x0012, 0x000c, 0x000f, 0x0009, 0x000c, 0x0006, 0x0009, 0x0003, 0x0006, 0x0000, 0x0003, 0xfe8b, 0xfd44,
-    0x0dac, 0xfed5, 0xfd44, 0x0d98, 0xff0c, 0xfd44, 0x0d62, 0xff20, 0xfd44, 0x0d18, 0xff0c, 0xfd44, 0x0ccd, 0xfed5,
-    0xfd44, 0x0c97, 0xfe8b, 0xfd44, 0x0c83, 0xfe41, 0xfd44, 0x0c97, 0xfe0b, 0xfd44, 0x0ccd, 0xfdf7, 0xfd44, 0x0d18,
-    0xfe0b, 0xfd44, 0x0d62, 0xfe41, 0xfd44, 0x0d98, 0x0030, 0x0010, 0x0002, 0x0000, 0xfd44, 0x0bda, 0x0107, 0x0000,
-    0x002d, 0x0000, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x0024, 0x001e, 0x0021, 0x001b, 0x001e,
-    0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x0012, 0x000c, 0x000f, 0x0009, 0x000c, 0x0006, 0x0009,
-    0x0003, 0x0006, 0x0000, 0x0003, 0x0000, 0xfd44, 0x0cb1, 0x005f, 0xfd44, 0x0cab, 0x00b1, 0xfd44, 0x0c90, 0x00e7,
-    0xfd44, 0x0c56, 0x00fa, 0xfd44, 0x0c04, 0x00e7, 0xfd44, 0x0ba6, 0x00b1, 0xfd44, 0x0b52, 0x005f, 0xfd44, 0x0b19,
-    0x0000, 0xfd44, 0x0b03, 0xffa1, 0xfd44, 0x0b19, 0xff4f, 0xfd44, 0x0b53, 0xff19, 0xfd44, 0x0ba6, 0xff06, 0xfd44,
-    0x0c05, 0xff19, 0xfd44, 0x0c58, 0xff4f, 0xfd44, 0x0c91, 0xffa1, 0xfd44, 0x0cab, 0x0036, 0x0010, 0x0002, 0x0000,
-    0xfd6b, 0x0bee, 0x0528, 0x0000, 0x0021, 0x001b, 0x0027, 0x0033, 0x0033, 0x001e, 0x0015, 0x0030, 0x0030, 0x002a,
-    0x002a, 0x002d, 0x0024, 0x0027, 0x001e, 0x0021, 0x001b, 0x0003, 0x0009, 0x0018, 0x0018, 0x0000, 0x0015, 0x0012,
-    0x0012, 0x000c, 0x000c, 0x000f, 0x0006, 0x0009, 0x0000, 0x0003, 0xfcbc, 0xfd6b, 0x07f0, 0xfe82, 0xfd6b, 0x06fe,
-    0xfae1, 0xfd6b, 0x0c6c, 0xfae1, 0xfd6b, 0x0b6a, 0xfc5c, 0xfd6b, 0x0f8f, 0xfb3f, 0xfd6b, 0x0de3, 0xfe08, 0xfd6b,
-    0x10ad, 0x0000, 0xfd6b, 0x1111, 0xfb76, 0xfd6b, 0x097e, 0x0000, 0xfd6b, 0x06cb, 0x0344, 0xfd6b, 0x07f0, 0x017e,
-    0xfd6b, 0x06fe, 0x051f, 0xfd6b, 0x0c6c, 0x051f, 0xfd6b, 0x0b6a, 0x03a4, 0xfd6b, 0x0f8f, 0x04c1, 0xfd6b, 0x0de3,
-    0x01f8, 0xfd6b, 0x10ad, 0x048a, 0xfd6b, 0x097e, 0x0012, 0x0005, 0x0002, 0x0387, 0xfd44, 0x0c23, 0x018f, 0x0000,
-    0x000f, 0x0006, 0x000c, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0388, 0xfd44, 0x0d73, 0x02f3,
-    0xfd44, 0x0d96, 0x03d5, 0xfd44, 0x0b66, 0x041b, 0xfd44, 0x0c26, 0x0405, 0xfd44, 0x0ced, 0x0316, 0xfd44, 0x0ab1,
-    0x0012, 0x0005, 0x0002, 0xfc79, 0xfd44, 0x0c23, 0x018f, 0x0000, 0x000f, 0x0006, 0x000c, 0x0000, 0x0009, 0x000c,
-    0x0006, 0x0009, 0x0000, 0x0003, 0xfc78, 0xfd44, 0x0d73, 0xfd0d, 0xfd44, 0x0d96, 0xfc2b, 0xfd44, 0x0b66, 0xfbe5,
-    0xfd44, 0x0c26, 0xfbfb, 0xfd44, 0x0ced, 0xfcea, 0xfd44, 0x0ab1, 0x0018, 0x0006, 0x0003, 0x0447, 0xfd5d, 0x0d03,
-    0x0135, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x000f, 0x0012, 0x0015, 0x0006, 0x000f,
-    0x0015, 0x0000, 0x0006, 0x000c, 0x0015, 0x000f, 0x0457, 0xfd71, 0x0da0, 0x055e, 0xfd44, 0x0c80, 0x04be, 0xfd73,
-    0x0c5a, 0x04f8, 0xfd45, 0x0dfa, 0x0330, 0xfd4f, 0x0cef, 0x0410, 0xfd75, 0x0c2d, 0x0397, 0xfd4e, 0x0c0d, 0x03aa,
-    0xfd73, 0x0d3a, 0x0018, 0x0006, 0x0003, 0xfbb9, 0xfd5d, 0x0d03, 0x0135, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000,
-    0x0006, 0x0009, 0x000c, 0x000f, 0x0012, 0x0015, 0x0012, 0x0003, 0x0015, 0x0003, 0x0000, 0x000c, 0x0012, 0x0015,
-    0xfba9, 0xfd71, 0x0da0, 0xfb42, 0xfd73, 0x0c5a, 0xfaa2, 0xfd44, 0x0c80, 0xfb08, 0xfd45, 0x0dfa, 0xfcd0, 0xfd4f,
-    0x0cef, 0xfc69, 0xfd4e, 0x0c0d, 0xfbf0, 0xfd75, 0x0c2d, 0xfc56, 0xfd73, 0x0d3a, 0x0024, 0x000b, 0x0002, 0x0002,
-    0xfd44, 0x0fb6, 0x01bf, 0x0000, 0x001e, 0x0021, 0x001b, 0x001e, 0x001b, 0x0018, 0x0015, 0x0018, 0x0012, 0x0015,
-    0x000f, 0x0012, 0x000f, 0x000c, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003, 0x01c0, 0xfd44,
-    0x0fd5, 0x0189, 0xfd44, 0x0f47, 0x0111, 0xfd44, 0x100a, 0x00f0, 0xfd44, 0x0f76, 0x0051, 0xfd44, 0x0f8d, 0x005d,
-    0xfd44, 0x1025, 0xffa7, 0xfd44, 0x1025, 0xffb2, 0xfd44, 0x0f8e, 0xff14, 0xfd44, 0x0f76, 0xfef3, 0xfd44, 0x100b,
-    0xfe44, 0xfd44, 0x0fd6, 0xfe7a, 0xfd44, 0x0f48, 0x0018, 0x0007, 0x0002, 0x01cd, 0xfd44, 0x094b, 0x0165, 0x0000,
-    0x000f, 0x0015, 0x0015, 0x0006, 0x0012, 0x000c, 0x0003, 0x000f, 0x000c, 0x0000, 0x0006, 0x0009, 0x0000, 0x0003,
-    0x01e1, 0xfd44, 0x085f, 0x02ae, 0xfd44, 0x0878, 0x02d1, 0xfd44, 0x09e6, 0x0277, 0xfd44, 0x0a38, 0x0107, 0xfd44,
-    0x0898, 0x031d, 0xfd44, 0x08d2, 0x007e, 0xfd44, 0x0904, 0x0319, 0xfd44, 0x0960, 0x0018, 0x0007, 0x0002, 0xfe33,
-    0xfd44, 0x094b, 0x0165, 0x0000, 0x000f, 0x0015, 0x0015, 0x0006, 0x0012, 0x000c, 0x0003, 0x000f, 0x000c, 0x0000,
-    0x0006, 0x0009, 0x0000, 0x0003, 0xfe1f, 0xfd44, 0x085f, 0xfd52, 0xfd44, 0x0878, 0xfd2f, 0xfd44, 0x09e6, 0xfd89,
-    0xfd44, 0x0a38, 0xfef9, 0xfd44, 0x0898, 0xfce3, 0xfd44, 0x08d2, 0xff82, 0xfd44, 0x0904, 0xfce7, 0xfd44, 0x0960,
-    0x0024, 0x0014, 0x0003, 0xf668, 0x0065, 0xffc8, 0x0005, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f,
-    0x000c, 0x0012, 0x0015, 0x0018, 0x001b, 0x0012, 0x000f, 0x0015, 0x001e, 0x001e, 0x0012, 0x001b, 0x0000, 0x0021,
-    0x0003, 0x0009, 0x0018, 0x000c, 0x000c, 0x0018, 0x0012, 0x0018, 0x0009, 0x001b, 0x000f, 0x000c, 0x0015, 0x001e,
-    0x0015, 0x0012, 0x0006, 0x0009, 0x0000, 0x001b, 0x0003, 0x001e, 0x000f, 0x0000, 0x0009, 0x001e, 0x0021, 0x000f,
-    0x0006, 0x001b, 0x0009, 0x001b, 0x0006, 0x0003, 0x000f, 0x0021, 0x0000, 0x001e, 0x0003, 0x0021, 0xf667, 0x006a,
-    0xffca, 0xf667, 0x0061, 0xffc5, 0xf667, 0x0061, 0xffca, 0xf667, 0x006a, 0xffca, 0xf668, 0x006a, 0xffc5, 0xf667,
-    0x006a, 0xffc5, 0xf668, 0x0061, 0xffca, 0xf668, 0x0061, 0xffc5, 0xf668, 0x006a, 0xffca, 0xf667, 0x0061, 0xffca,
-    0xf667, 0x0061, 0xffc5, 0xf667, 0x006a, 0xffc5, 0x0024, 0x000a, 0x0003, 0xfd02, 0xfd62, 0x05fe, 0x0181, 0x0000,
-    0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0006, 0x0012, 0x0015, 0x0018, 0x001b, 0x0009, 0x0015, 0x001e,
-    0x0018, 0x0000, 0x0021, 0x0003, 0x0009, 0x001b, 0x000c, 0x0006, 0x0003, 0x0012, 0x0018, 0x001e, 0x001b, 0x0015,
-    0x0012, 0x001e, 0xfe73, 0xfd44, 0x0596, 0xfe1c, 0xfd7f, 0x05ac, 0xfe1c, 0xfd44, 0x05ac, 0xfc88, 0xfd44, 0x0666,
-    0xfb90, 0xfd7f, 0x0666, 0xfb90, 0xfd44, 0x0666, 0xfd81, 0xfd7f, 0x05e4, 0xfd81, 0xfd44, 0x05e4, 0xfced, 0xfd44,
-    0x062a, 0xfc88, 0xfd7f, 0x0666, 0xfced, 0xfd7f, 0x062a, 0xfe73, 0xfd7f, 0x0596, 0x0024, 0x000a, 0x0003, 0x02fe,
-    0xfd62, 0x05fe, 0x0181, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x0003, 0x0012, 0x0015, 0x0018,
-    0x0009, 0x001b, 0x0012, 0x0018, 0x001e, 0x0000, 0x0006, 0x0021, 0x0009, 0x000f, 0x001b, 0x0003, 0x0015, 0x0006,
-    0x0018, 0x001b, 0x001e, 0x0012, 0x001e, 0x0015, 0x018d, 0xfd44, 0x0596, 0x01e4, 0xfd44, 0x05ac, 0x01e4, 0xfd7f,
-    0x05ac, 0x0378, 0xfd44, 0x0666, 0x0470, 0xfd44, 0x0666, 0x0470, 0xfd7f, 0x0666, 0x027f, 0xfd44, 0x05e4, 0x027f,
-    0xfd7f, 0x05e4, 0x0313, 0xfd44, 0x062a, 0x0378, 0xfd7f, 0x0666, 0x0313, 0xfd7f, 0x062a, 0x018d, 0xfd7f, 0x0596,
-    0x002a, 0x000c, 0x0003, 0x0632, 0xfd60, 0x0f6d, 0x01ac, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f,
-    0x0006, 0x000c, 0x0012, 0x000f, 0x0015, 0x0009, 0x0018, 0x001b, 0x001e, 0x001b, 0x0021, 0x001e, 0x0000, 0x0024,
-    0x0003, 0x0009, 0x0012, 0x000c, 0x0006, 0x0003, 0x000c, 0x0000, 0x0018, 0x0024, 0x0018, 0x001e, 0x0024, 0x0015,
-    0x0027, 0x0009, 0x050b, 0xfd42, 0x100f, 0x056c, 0xfd7d, 0x0f8b, 0x056c, 0xfd42, 0x0f8b, 0x0607, 0xfd44, 0x0e6a,
-    0x05c1, 0xfd7d, 0x0efe, 0x0607, 0xfd7d, 0x0e6a, 0x05c1, 0xfd42, 0x0efe, 0x0786, 0xfd7d, 0x0e6a, 0x04de, 0xfd42,
-    0x1049, 0x04de, 0xfd42, 0x1070, 0x04de, 0xfd7d, 0x1049, 0x04de, 0xfd7d, 0x1070, 0x050b, 0xfd7d, 0x100f, 0x0786,
-    0xfd44, 0x0e6a, 0x002a, 0x000c, 0x0003, 0xf9ce, 0xfd60, 0x0f6d, 0x01ac, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009,
-    0x000c, 0x000f, 0x0003, 0x0012, 0x000f, 0x000c, 0x0009, 0x0015, 0x0018, 0x001b, 0x001e, 0x001e, 0x001b, 0x0021,
-    0x0000, 0x0006, 0x0024, 0x0009, 0x000f, 0x0012, 0x0003, 0x000f, 0x0006, 0x0000, 0x0024, 0x0018, 0x0018, 0x0024,
-    0x001b, 0x0015, 0x0009, 0x0027, 0xfaf5, 0xfd42, 0x100f, 0xfa94, 0xfd42, 0x0f8b, 0xfa94, 0xfd7d, 0x0f8b, 0xf9f9,
-    0xfd44, 0x0e6a, 0xf9f9, 0xfd7d, 0x0e6a, 0xfa3f, 0xfd7d, 0x0efe, 0xfa3f, 0xfd42, 0x0efe, 0xf87a, 0xfd7d, 0x0e6a,
-    0xfb22, 0xfd42, 0x1049, 0xfb22, 0xfd7d, 0x1049, 0xfb22, 0xfd42, 0x1070, 0xfb22, 0xfd7d, 0x1070, 0xfaf5, 0xfd7d,
-    0x100f, 0xf87a, 0xfd44, 0x0e6a, 0x000c, 0x0002, 0x0003, 0x0000, 0x02d3, 0x0c39, 0x0228, 0x0000, 0x0000, 0x0003,
-    0x0006, 0x0000, 0x0009, 0x0003, 0xfe7a, 0x02d3, 0x0dc0, 0x0186, 0x02d3, 0x0ab3, 0xfe7a, 0x02d3, 0x0ab3, 0x0186,
-    0x02d3, 0x0dc0, 0x0018, 0x0008, 0x0003, 0x0000, 0x0462, 0x0c39, 0x0127, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009,
-    0x000c, 0x000f, 0x0009, 0x0006, 0x0012, 0x0015, 0x000c, 0x0003, 0x0000, 0x0015, 0x0003, 0x0009, 0x0012, 0x000c,
-    0x0009, 0x0000, 0x0006, 0x0015, 0x000f, 0x000c, 0xffcd, 0x0340, 0x0c35, 0x0004, 0x0585, 0x0c6d, 0xffcd, 0x0585,
-    0x0c35, 0xfffc, 0x0340, 0x0c06, 0x0033, 0x0585, 0x0c3e, 0x0033, 0x0340, 0x0c3e, 0xfffc, 0x0585, 0x0c06, 0x0004,
-    0x0340, 0x0c6d, 0x0036, 0x0012, 0x0002, 0x0000, 0x0310, 0x0c39, 0x00ab, 0x0000, 0x0033, 0x0030, 0x002d, 0x0024,
-    0x0021, 0x001e, 0x001b, 0x0012, 0x000f, 0x000c, 0x0009, 0x0000, 0x0027, 0x0033, 0x0030, 0x002a, 0x002a, 0x002d,
-    0x0024, 0x0027, 0x0015, 0x0021, 0x001e, 0x0018, 0x0018, 0x001b, 0x0012, 0x0015, 0x0003, 0x000f, 0x000c, 0x0006,
-    0x0006, 0x0009, 0x0000, 0x0003, 0xff62, 0x02f4, 0x0c39, 0xffa5, 0x02f4, 0x0bab, 0x005b, 0x02f4, 0x0cc8, 0xffa5,
-    0x02f4, 0x0cc8, 0x009e, 0x02f4, 0x0c39, 0x005b, 0x02f4, 0x0bab, 0xff8b, 0x030f, 0x0c39, 0xffbc, 0x030f, 0x0bcf,
-    0x0044, 0x030f, 0x0ca3, 0xffbc, 0x030f, 0x0ca3, 0x0075, 0x030f, 0x0c39, 0x0044, 0x030f, 0x0bcf, 0xffb0, 0x032d,
-    0x0c39, 0xffd2, 0x032d, 0x0bf1, 0x002e, 0x032d, 0x0c82, 0xffd2, 0x032d, 0x0c82, 0x0050, 0x032d, 0x0c39, 0x002e,
-    0x032d, 0x0bf1, 0x0012, 0x0006, 0x0002, 0x00c9, 0x02f8, 0x0d14, 0x0045, 0x0000, 0x000c, 0x000f, 0x0003, 0x0006,
-    0x000f, 0x0000, 0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x00ac, 0x02f8, 0x0cd8, 0x00e6, 0x02f8, 0x0cd8,
-    0x010e, 0x02f8, 0x0d14, 0x00e6, 0x02f8, 0x0d50, 0x00ac, 0x02f8, 0x0d50, 0x0084, 0x02f8, 0x0d14, 0x000c, 0x0002,
-    0x0003, 0xf83a, 0x02bb, 0x0c39, 0x018c, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xf97a, 0x02bb,
-    0x0b4f, 0xf6fa, 0x02bb, 0x0d23, 0xf97a, 0x02bb, 0x0d23, 0xf6fa, 0x02bb, 0x0b4f, 0x000c, 0x0002, 0x0003, 0xfaba,
-    0x02bb, 0x0c39, 0x018c, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfbfa, 0x02bb, 0x0b4f, 0xf97a,
-    0x02bb, 0x0d23, 0xfbfa, 0x02bb, 0x0d23, 0xf97a, 0x02bb, 0x0b4f, 0x000c, 0x0002, 0x0003, 0xfd3a, 0x02bb, 0x0c39,
-    0x018c, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfe7a, 0x02bb, 0x0b4f, 0xfbfa, 0x02bb, 0x0d23,
-    0xfe7a, 0x02bb, 0x0d23, 0xfbfa, 0x02bb, 0x0b4f, 0x000c, 0x0002, 0x0003, 0x02c6, 0x02bb, 0x0c39, 0x018c, 0x0000,
-    0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0186, 0x02bb, 0x0b4f, 0x0186, 0x02bb, 0x0d23, 0x0406, 0x02bb,
-    0x0d23, 0x0406, 0x02bb, 0x0b4f, 0x000c, 0x0002, 0x0003, 0x0546, 0x02bb, 0x0c39, 0x018c, 0x0000, 0x0000, 0x0003,
-    0x0006, 0x0000, 0x0006, 0x0009, 0x0406, 0x02bb, 0x0b4f, 0x0406, 0x02bb, 0x0d23, 0x0686, 0x02bb, 0x0d23, 0x0686,
-    0x02bb, 0x0b4f, 0x000c, 0x0002, 0x0003, 0x07c6, 0x02bb, 0x0c39, 0x018c, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000,
-    0x0006, 0x0009, 0x0686, 0x02bb, 0x0b4f, 0x0686, 0x02bb, 0x0d23, 0x0906, 0x02bb, 0x0d23, 0x0906, 0x02bb, 0x0b4f,
-    0x000c, 0x0004, 0x0002, 0x0392, 0xfd5a, 0x10b7, 0x0073, 0x0000, 0x0000, 0x0006, 0x0009, 0x0003, 0x0006, 0x0009,
-    0x0000, 0x0003, 0x03b7, 0xfd5a, 0x1124, 0x033d, 0xfd5a, 0x106a, 0x03e7, 0xfd5a, 0x1104, 0x036e, 0xfd5a, 0x104a,
-    0x000c, 0x0004, 0x0002, 0x0361, 0xfd6f, 0x10d7, 0x0073, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0003,
-    0x0000, 0x0003, 0x033d, 0xfd6f, 0x106a, 0x030c, 0xfd6f, 0x108b, 0x0386, 0xfd6f, 0x1144, 0x03b7, 0xfd6f, 0x1124,
-    0x000c, 0x0004, 0x0002, 0xfc9f, 0xfd6f, 0x10d7, 0x0073, 0x0000, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0003,
-    0x0000, 0x0003, 0xfcc3, 0xfd6f, 0x106a, 0xfcf4, 0xfd6f, 0x108b, 0xfc7a, 0xfd6f, 0x1144, 0xfc49, 0xfd6f, 0x1124,
-    0x000c, 0x0004, 0x0002, 0xfc6e, 0xfd5a, 0x10b7, 0x0073, 0x0000, 0x0000, 0x0006, 0x0009, 0x0003, 0x0006, 0x0009,
-    0x0000, 0x0003, 0xfc49, 0xfd5a, 0x1124, 0xfcc3, 0xfd5a, 0x106a, 0xfc19, 0xfd5a, 0x1104, 0xfc92, 0xfd5a, 0x104a,
-    0x000c, 0x0002, 0x0003, 0xf99b, 0xffd7, 0xfc1e, 0x00f4, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006,
-    0xfa3f, 0xffad, 0xfc93, 0xfa22, 0x0000, 0xfb6e, 0xf919, 0xffad, 0xfcce, 0xf8f6, 0x0000, 0xfb6e, 0x000c, 0x0002,
-    0x0003, 0xf9d7, 0xff83, 0xfd5a, 0x00ef, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfa3f, 0xffad,
-    0xfc93, 0xf97f, 0xff59, 0xfe20, 0xfa95, 0xff59, 0xfdad, 0xf919, 0xffad, 0xfcce, 0x000c, 0x0002, 0x0003, 0xfa50,
-    0xff30, 0xfe82, 0x00ea, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfa95, 0xff59, 0xfdad, 0xfa26,
-    0xff06, 0xff57, 0xfb20, 0xff06, 0xfeb1, 0xf97f, 0xff59, 0xfe20, 0x000c, 0x0002, 0x0003, 0xfb00, 0xfed4, 0xff8d,
-    0x00e6, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0xfa26, 0xff06, 0xff57, 0xfb06, 0xfea1, 0x0068,
-    0xfb20, 0xff06, 0xfeb1, 0xfbda, 0xfea1, 0xff94, 0x000c, 0x0002, 0x0003, 0x0500, 0xfed4, 0xff8d, 0x00e6, 0x0000,
-    0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x05da, 0xff06, 0xff57, 0x04e0, 0xff06, 0xfeb1, 0x04fa, 0xfea1,
-    0x0068, 0x0426, 0xfea1, 0xff94, 0x000c, 0x0002, 0x0003, 0x05b0, 0xff30, 0xfe82, 0x00ea, 0x0000, 0x0000, 0x0003,
-    0x0006, 0x0000, 0x0009, 0x0003, 0x05da, 0xff06, 0xff57, 0x056b, 0xff59, 0xfdad, 0x04e0, 0xff06, 0xfeb1, 0x0681,
-    0xff59, 0xfe20, 0x000c, 0x0002, 0x0003, 0x0629, 0xff83, 0xfd5a, 0x00ef, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003,
-    0x0009, 0x0006, 0x056b, 0xff59, 0xfdad, 0x0681, 0xff59, 0xfe20, 0x05c1, 0xffad, 0xfc93, 0x06e7, 0xffad, 0xfcce,
-    0x000c, 0x0002, 0x0003, 0x0665, 0xffd7, 0xfc1e, 0x00f4, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006,
-    0x070a, 0x0000, 0xfb6e, 0x05de, 0x0000, 0xfb6e, 0x06e7, 0xffad, 0xfcce, 0x05c1, 0xffad, 0xfc93, 0x001e, 0x0008,
-    0x0003, 0xfa18, 0xff82, 0xfe24, 0x02c9, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x000f, 0x000f, 0x0012,
-    0x0009, 0x0015, 0x0018, 0x0012, 0x0000, 0x000c, 0x0003, 0x0009, 0x0003, 0x000c, 0x000f, 0x0015, 0x0012, 0x0015,
-    0x001b, 0x0018, 0xf8fd, 0x000c, 0xfbb4, 0xf919, 0x0002, 0xfcce, 0xf8fd, 0x0047, 0xfbb4, 0xf97f, 0xffb0, 0xfe20,
-    0xf919, 0xffc9, 0xfcce, 0xf97f, 0xff75, 0xfe20, 0xfa26, 0xff5c, 0xff57, 0xfa26, 0xff22, 0xff57, 0xfb33, 0xfef6,
-    0x0094, 0xfb33, 0xfebc, 0x0094, 0x001e, 0x0008, 0x0003, 0x05e8, 0xff82, 0xfe24, 0x02c9, 0x0000, 0x0000, 0x0003,
-    0x0006, 0x0009, 0x0003, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0012, 0x0015, 0x0000, 0x0018, 0x0003, 0x0009,
-    0x0006, 0x0003, 0x000c, 0x001b, 0x000f, 0x000f, 0x001b, 0x0012, 0x0703, 0x000c, 0xfbb4, 0x06e7, 0x0002, 0xfcce,
-    0x06e7, 0xffc9, 0xfcce, 0x0681, 0xff75, 0xfe20, 0x0681, 0xffb0, 0xfe20, 0x05da, 0xff22, 0xff57, 0x04cd, 0xfef6,
-    0x0094, 0x04cd, 0xfebc, 0x0094, 0x0703, 0x0047, 0xfbb4, 0x05da, 0xff5c, 0xff57, 0x0012, 0x0004, 0x0003, 0xfb0b,
-    0xfdf2, 0x04d5, 0x0198, 0x0000, 0x0000, 0x0003, 0x0006, 0x0003, 0x0009, 0x0006, 0x0000, 0x000c, 0x0003, 0x0003,
-    0x000f, 0x0009, 0xfa86, 0xfd42, 0x062d, 0xfb8d, 0xfea1, 0x03ad, 0xfa86, 0xfea1, 0x03ad, 0xfa86, 0xfea1, 0x037e,
-    0xfb8f, 0xfd42, 0x062d, 0xfb8d, 0xfea1, 0x037e, 0x0012, 0x0004, 0x0003, 0x04f5, 0xfdf2, 0x04d5, 0x0198, 0x0000,
-    0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x000c, 0x0000, 0x000f, 0x0003, 0x0000, 0x0006, 0x0009, 0x0473, 0xfea1,
-    0x03ad, 0x057a, 0xfd42, 0x062d, 0x057a, 0xfea1, 0x03ad, 0x057a, 0xfea1, 0x037e, 0x0473, 0xfea1, 0x037e, 0x0471,
-    0xfd42, 0x062d, 0x0144, 0x00cc, 0x0002, 0xfb09, 0xfe0e, 0x04f1, 0x01bb, 0x0000, 0x000f, 0x0000, 0x0132, 0x0135,
-    0x013e, 0x0141, 0x0141, 0x0114, 0x0123, 0x012c, 0x0141, 0x0132, 0x0135, 0x013e, 0x0117, 0x0138, 0x0129, 0x013e,
-    0x012f, 0x0120, 0x0126, 0x013b, 0x013b, 0x0138, 0x012f, 0x013b, 0x0138, 0x012c, 0x0135, 0x010e, 0x0111, 0x0132,
-    0x012c, 0x012f, 0x00f3, 0x0102, 0x0126, 0x0117, 0x0102, 0x0126, 0x00f3, 0x0117, 0x0120, 0x0126, 0x0123, 0x0117,
-    0x00fc, 0x0102, 0x00ff, 0x00f3, 0x0105, 0x00ea, 0x010e, 0x0129, 0x0105, 0x0129, 0x00ea, 0x010e, 0x0114, 0x0129,
-    0x010b, 0x010e, 0x00f0, 0x0105, 0x00e7, 0x00ea, 0x010b, 0x00e7, 0x00e4, 0x0108, 0x0114, 0x00f0, 0x00ed, 0x0111,
-    0x0123, 0x00ff, 0x00fc, 0x0120, 0x011a, 0x00f6, 0x00f9, 0x011d, 0x0129, 0x011d, 0x011d, 0x011a, 0x0126, 0x011a,
-    0x0120, 0x0123, 0x010b, 0x011d, 0x011a, 0x0108, 0x0117, 0x0108, 0x0111, 0x0114, 0x010e, 0x0111, 0x0108, 0x010b,
-    0x0105, 0x00f9, 0x00f9, 0x00f6, 0x0102, 0x00f6, 0x00fc, 0x00ff, 0x00e7, 0x00f9, 0x00f6, 0x00e4, 0x00f3, 0x00e4,
-    0x00ed, 0x00f0, 0x00ea, 0x00ed, 0x00e4, 0x00e7, 0x00d5, 0x00d2, 0x00e1, 0x00de, 0x00e1, 0x00b4, 0x00c3, 0x00cf,
-    0x00d2, 0x00e1, 0x00d5, 0x00de, 0x00b7, 0x00d8, 0x00c9, 0x00de, 0x00cc, 0x00c0, 0x00c6, 0x00db, 0x00db, 0x00d8,
-    0x00cc, 0x00db, 0x00cf, 0x00d8, 0x00d5, 0x00ae, 0x00b1, 0x00d2, 0x00cc, 0x00cf, 0x0093, 0x00a2, 0x00c6, 0x00b7,
-    0x00a2, 0x00c6, 0x0093, 0x00b7, 0x00c0, 0x00c6, 0x00c3, 0x00b7, 0x009c, 0x00a2, 0x009f, 0x0093, 0x00a5, 0x008a,
-    0x00ae, 0x00c9, 0x00a5, 0x00c9, 0x008a, 0x00ae, 0x00b4, 0x00c9, 0x00ab, 0x00ae, 0x0090, 0x00a5, 0x0087, 0x008a,
-    0x00ab, 0x0087, 0x0084, 0x00a8, 0x00b4, 0x0090, 0x008d, 0x00b1, 0x00c3, 0x009f, 0x009c, 0x00c0, 0x00ba, 0x0096,
-    0x0099, 0x00bd, 0x00c9, 0x00bd, 0x00bd, 0x00ba, 0x00c6, 0x00ba, 0x00c0, 0x00c3, 0x00ab, 0x00bd, 0x00ba, 0x00a8,
-    0x00b7, 0x00a8, 0x00b1, 0x00b4, 0x00ae, 0x00b1, 0x00a8, 0x00ab, 0x00a5, 0x0099, 0x0099, 0x0096, 0x00a2, 0x0096,
-    0x009c, 0x009f, 0x0087, 0x0099, 0x0096, 0x0084, 0x0093, 0x0084, 0x008d, 0x0090, 0x008a, 0x008d, 0x0084, 0x0087,
-    0x0006, 0x000c, 0x0018, 0x0003, 0x0021, 0x0009, 0x002a, 0x0030, 0x0030, 0x0027, 0x0027, 0x0024, 0x0024, 0x002a,
-    0x001b, 0x0030, 0x0015, 0x002a, 0x0039, 0x0027, 0x0036, 0x0024, 0x0081, 0x0039, 0x004b, 0x007e, 0x007e, 0x0081,
-    0x007b, 0x0048, 0x003c, 0x0072, 0x0075, 0x003f, 0x0033, 0x0078, 0x0078, 0x007b, 0x006f, 0x0075, 0x0072, 0x006c,
-    0x006c, 0x0036, 0x002d, 0x006f, 0x0081, 0x006c, 0x007e, 0x0072, 0x0078, 0x0081, 0x007b, 0x007e, 0x0075, 0x007b,
-    0x006f, 0x0078, 0x0072, 0x0075, 0x006c, 0x006f, 0x0063, 0x004e, 0x0003, 0x0060, 0x0060, 0x0063, 0x0000, 0x0054,
-    0x0069, 0x0021, 0x0006, 0x0057, 0x005a, 0x0045, 0x0054, 0x005a, 0x0051, 0x0066, 0x005d, 0x0042, 0x0066, 0x0069,
-    0x0057, 0x005d, 0x0057, 0x0069, 0x005d, 0x0066, 0x0069, 0x0060, 0x0066, 0x0063, 0x0063, 0x005a, 0x0060, 0x0054,
-    0x005a, 0x005d, 0x0054, 0x0057, 0x004e, 0x004b, 0x0045, 0x003c, 0x0048, 0x0051, 0x0042, 0x003f, 0x0051, 0x0042,
-    0x003f, 0x0048, 0x004b, 0x003c, 0x0045, 0x004e, 0x004e, 0x0051, 0x0048, 0x004b, 0x0042, 0x0045, 0x003c, 0x003f,
-    0x002d, 0x0033, 0x0033, 0x0039, 0x0039, 0x0036, 0x0036, 0x002d, 0x0030, 0x0033, 0x002a, 0x002d, 0x0027, 0x001e,
-    0x0024, 0x0012, 0x0021, 0x0006, 0x0003, 0x0021, 0x001e, 0x001b, 0x0012, 0x001e, 0x0015, 0x001b, 0x0009, 0x0018,
-    0x000f, 0x0018, 0x0012, 0x0015, 0x000c, 0x000f, 0x0009, 0x000c, 0x0006, 0x0000, 0x0000, 0x0003, 0xfa90, 0xfd58,
-    0x0665, 0xfa90, 0xfd5b, 0x065f, 0xfa89, 0xfd58, 0x0665, 0xfa89, 0xfd41, 0x0655, 0xfa89, 0xfd41, 0x065b, 0xfa90,
-    0xfd41, 0x065b, 0xfa90, 0xfea0, 0x038b, 0xfa89, 0xfea0, 0x038b, 0xfa90, 0xfd41, 0x0655, 0xfa89, 0xfea0, 0x0392,
-    0xfa90, 0xfea0, 0x0392, 0xfa89, 0xfd5b, 0x065f, 0xfa90, 0xfeb9, 0x037e, 0xfa90, 0xfeba, 0x0382, 0xfa89, 0xfeb9,
-    0x037e, 0xfa89, 0xfeb7, 0x037e, 0xfa89, 0xfeba, 0x0382, 0xfa89, 0xfeba, 0x0382, 0xfa90, 0xfeb7, 0x037e, 0xfa90,
-    0xfeba, 0x0382, 0xfa90, 0xfeda, 0x03a7, 0xfa89, 0xfeda, 0x03a7, 0xfa89, 0xfd79, 0x0632, 0xfa90, 0xfd79, 0x0632,
-    0xfa89, 0xfed4, 0x03a7, 0xfa90, 0xfed4, 0x03a7, 0xfa90, 0xfd73, 0x0632, 0xfa89, 0xfd73, 0x0632, 0xfa90, 0xfd6e,
-    0x0662, 0xfa89, 0xfd6e, 0x0662, 0xfa90, 0xfd79, 0x0656, 0xfa89, 0xfd79, 0x0656, 0xfa90, 0xfd6b, 0x065c, 0xfa90,
-    0xfd73, 0x0653, 0xfa89, 0xfd73, 0x0653, 0xfa89, 0xfd6b, 0x065c, 0xfa90, 0xfecb, 0x037e, 0xfa89, 0xfecb, 0x037e,
-    0xfa90, 0xfed6, 0x0383, 0xfa89, 0xfed6, 0x0383, 0xfa89, 0xfec7, 0x0382, 0xfa89, 0xfed0, 0x0386, 0xfa90, 0xfed0,
-    0x0386, 0xfa90, 0xfec7, 0x0382, 0xfb89, 0xfeda, 0x03ad, 0xfb89, 0xfd79, 0x062d, 0xfb89, 0xfd79, 0x065f, 0xfb89,
-    0xfd79, 0x0665, 0xfb84, 0xfd79, 0x0665, 0xfb89, 0xfed8, 0x0382, 0xfb84, 0xfeda, 0x03ad, 0xfb84, 0xfd79, 0x062d,
-    0xfb84, 0xfed8, 0x037e, 0xfb89, 0xfed8, 0x037e, 0xfb84, 0xfed8, 0x0382, 0xfb84, 0xfd79, 0x065f, 0xfb89, 0xfed4,
-    0x03ad, 0xfb89, 0xfd73, 0x062d, 0xfb89, 0xfd73, 0x065f, 0xfb89, 0xfd73, 0x0665, 0xfb84, 0xfd73, 0x0665, 0xfb89,
-    0xfed2, 0x0382, 0xfb84, 0xfed4, 0x03ad, 0xfb84, 0xfd73, 0x062d, 0xfb84, 0xfed2, 0x037e, 0xfb89, 0xfed2, 0x037e,
-    0xfb84, 0xfed2, 0x0382, 0xfb84, 0xfd73, 0x065f, 0xfb84, 0xfea0, 0x037e, 0xfb89, 0xfea0, 0x037e, 0xfb89, 0xfd42,
-    0x0665, 0xfb89, 0xfd42, 0x065f, 0xfb89, 0xfea0, 0x0382, 0xfb84, 0xfea0, 0x0382, 0xfb84, 0xfd42, 0x065f, 0xfb84,
-    0xfd42, 0x0665, 0xfaf6, 0xfeda, 0x03ad, 0xfaf6, 0xfd79, 0x062d, 0xfaf6, 0xfd79, 0x065f, 0xfaf6, 0xfd79, 0x0665,
-    0xfaf1, 0xfd79, 0x0665, 0xfaf6, 0xfed8, 0x0382, 0xfaf1, 0xfeda, 0x03ad, 0xfaf1, 0xfd79, 0x062d, 0xfaf1, 0xfed8,
-    0x037e, 0xfaf6, 0xfed8, 0x037e, 0xfaf1, 0xfed8, 0x0382, 0xfaf1, 0xfd79, 0x065f, 0xfaf6, 0xfed4, 0x03ad, 0xfaf6,
-    0xfd73, 0x062d, 0xfaf6, 0xfd73, 0x065f, 0xfaf6, 0xfd73, 0x0665, 0xfaf1, 0xfd73, 0x0665, 0xfaf6, 0xfed2, 0x0382,
-    0xfaf1, 0xfed4, 0x03ad, 0xfaf1, 0xfd73, 0x062d, 0xfaf1, 0xfed2, 0x037e, 0xfaf6, 0xfed2, 0x037e, 0xfaf1, 0xfed2,
-    0x0382, 0xfaf1, 0xfd73, 0x065f, 0xfaf6, 0xfea0, 0x037e, 0xfaf1, 0xfea0, 0x037e, 0xfaf6, 0xfd42, 0x0665, 0xfaf6,
-    0xfd42, 0x065f, 0xfaf6, 0xfea0, 0x0382, 0xfaf1, 0xfea0, 0x0382, 0xfaf1, 0xfd42, 0x065f, 0xfaf1, 0xfd42, 0x0665,
-    0x003c, 0x002a, 0x0002, 0x0438, 0x010d, 0xfd2e, 0x00ef, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036,
-    0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d,
-    0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015,
-    0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009,
-    0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012,
-    0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009,
-    0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0x0403, 0x0134, 0xfdd4, 0x0439, 0x00e8, 0xfd2e,
-    0x04c6, 0x0134, 0xfd95, 0x04c6, 0x0134, 0xfcc7, 0x038a, 0x0134, 0xfd2e, 0x0403, 0x0134, 0xfc88, 0x04e7, 0x01b0,
-    0xfd2e, 0x046f, 0x01b0, 0xfdd4, 0x03ac, 0x01b0, 0xfd95, 0x03ac, 0x01b0, 0xfcc7, 0x046f, 0x01b0, 0xfc88, 0x0439,
-    0x01fc, 0xfd2e, 0x0431, 0x001e, 0xfd27, 0x0431, 0x001e, 0xfd35, 0x0431, 0x010b, 0xfd35, 0x0431, 0x010b, 0xfd27,
-    0x0440, 0x001e, 0xfd27, 0x0440, 0x010b, 0xfd27, 0x0440, 0x001e, 0xfd35, 0x0440, 0x010b, 0xfd35, 0x003c, 0x002a,
-    0x0002, 0x033b, 0x010d, 0xfeaa, 0x00ef, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039,
-    0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a,
-    0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012,
-    0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b,
-    0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006,
-    0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006,
-    0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0x0305, 0x0134, 0xff50, 0x033b, 0x00e8, 0xfeaa, 0x03c8, 0x0134,
-    0xff10, 0x03c8, 0x0134, 0xfe43, 0x028d, 0x0134, 0xfeaa, 0x0305, 0x0134, 0xfe04, 0x03ea, 0x01b0, 0xfeaa, 0x0371,
-    0x01b0, 0xff50, 0x02ae, 0x01b0, 0xff10, 0x02ae, 0x01b0, 0xfe43, 0x0371, 0x01b0, 0xfe04, 0x033b, 0x01fc, 0xfeaa,
-    0x0334, 0x001e, 0xfea2, 0x0334, 0x001e, 0xfeb1, 0x0334, 0x010b, 0xfeb1, 0x0334, 0x010b, 0xfea2, 0x0343, 0x001e,
-    0xfea2, 0x0343, 0x010b, 0xfea2, 0x0343, 0x001e, 0xfeb1, 0x0343, 0x010b, 0xfeb1, 0x003c, 0x002a, 0x0002, 0x01bf,
-    0x010d, 0xffa7, 0x00ef, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030,
-    0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027,
-    0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e,
-    0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f,
-    0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009,
-    0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000,
-    0x0003, 0x0006, 0x0000, 0x0003, 0x0189, 0x0134, 0x004c, 0x01bf, 0x00e8, 0xffa7, 0x024d, 0x0134, 0x000d, 0x024d,
-    0x0134, 0xff41, 0x0111, 0x0134, 0xffa7, 0x0189, 0x0134, 0xff01, 0x026e, 0x01b0, 0xffa7, 0x01f5, 0x01b0, 0x004c,
-    0x0132, 0x01b0, 0x000d, 0x0132, 0x01b0, 0xff41, 0x01f5, 0x01b0, 0xff01, 0x01bf, 0x01fc, 0xffa7, 0x01b8, 0x001e,
-    0xffa0, 0x01b8, 0x001e, 0xffaf, 0x01b8, 0x010b, 0xffaf, 0x01b8, 0x010b, 0xffa0, 0x01c7, 0x001e, 0xffa0, 0x01c7,
-    0x010b, 0xffa0, 0x01c7, 0x001e, 0xffaf, 0x01c7, 0x010b, 0xffaf, 0x003c, 0x002a, 0x0002, 0xfe41, 0x010d, 0xffa7,
-    0x00ef, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030,
-    0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e,
-    0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b,
-    0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018,
-    0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f,
-    0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006,
-    0x0000, 0x0003, 0xfe0b, 0x0134, 0x004c, 0xfe41, 0x00e8, 0xffa7, 0xfece, 0x0134, 0x000d, 0xfece, 0x0134, 0xff41,
-    0xfd92, 0x0134, 0xffa7, 0xfe0b, 0x0134, 0xff01, 0xfeef, 0x01b0, 0xffa7, 0xfe77, 0x01b0, 0x004c, 0xfdb3, 0x01b0,
-    0x000d, 0xfdb3, 0x01b0, 0xff41, 0xfe77, 0x01b0, 0xff01, 0xfe41, 0x01fc, 0xffa7, 0xfe39, 0x001e, 0xffa0, 0xfe39,
-    0x001e, 0xffaf, 0xfe39, 0x010b, 0xffaf, 0xfe39, 0x010b, 0xffa0, 0xfe48, 0x001e, 0xffa0, 0xfe48, 0x010b, 0xffa0,
-    0xfe48, 0x001e, 0xffaf, 0xfe48, 0x010b, 0xffaf, 0x003c, 0x002a, 0x0002, 0xfcc5, 0x010d, 0xfeaa, 0x00ef, 0x0000,
-    0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033,
-    0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b,
-    0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018,
-    0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c,
-    0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003,
-    0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003,
-    0xfc8f, 0x0134, 0xff50, 0xfcc5, 0x00e8, 0xfeaa, 0xfd52, 0x0134, 0xff10, 0xfd52, 0x0134, 0xfe43, 0xfc16, 0x0134,
-    0xfeaa, 0xfc8f, 0x0134, 0xfe04, 0xfd73, 0x01b0, 0xfeaa, 0xfcfb, 0x01b0, 0xff50, 0xfc38, 0x01b0, 0xff10, 0xfc38,
-    0x01b0, 0xfe43, 0xfcfb, 0x01b0, 0xfe04, 0xfcc5, 0x01fc, 0xfeaa, 0xfcbd, 0x001e, 0xfea2, 0xfcbd, 0x001e, 0xfeb1,
-    0xfcbd, 0x010b, 0xfeb1, 0xfcbd, 0x010b, 0xfea2, 0xfccc, 0x001e, 0xfea2, 0xfccc, 0x010b, 0xfea2, 0xfccc, 0x001e,
-    0xfeb1, 0xfccc, 0x010b, 0xfeb1, 0x003c, 0x002a, 0x0002, 0xfbc8, 0x010d, 0xfd2e, 0x00ef, 0x0000, 0x0039, 0x002a,
-    0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024,
-    0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018,
-    0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015,
-    0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015,
-    0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c,
-    0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xfb91, 0x0134,
-    0xfdd4, 0xfbc7, 0x00e8, 0xfd2e, 0xfc54, 0x0134, 0xfd95, 0xfc54, 0x0134, 0xfcc7, 0xfb19, 0x0134, 0xfd2e, 0xfb91,
-    0x0134, 0xfc88, 0xfc76, 0x01b0, 0xfd2e, 0xfbfd, 0x01b0, 0xfdd4, 0xfb3a, 0x01b0, 0xfd95, 0xfb3a, 0x01b0, 0xfcc7,
-    0xfbfd, 0x01b0, 0xfc88, 0xfbc7, 0x01fc, 0xfd2e, 0xfbc0, 0x001e, 0xfd27, 0xfbc0, 0x001e, 0xfd35, 0xfbc0, 0x010b,
-    0xfd35, 0xfbc0, 0x010b, 0xfd27, 0xfbcf, 0x001e, 0xfd27, 0xfbcf, 0x010b, 0xfd27, 0xfbcf, 0x001e, 0xfd35, 0xfbcf,
-    0x010b, 0xfd35, 0x003c, 0x002a, 0x0002, 0xfc32, 0xfe45, 0x05cf, 0x00ef, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036,
-    0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024,
-    0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021,
-    0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e,
-    0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000,
-    0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003,
-    0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xfbfc, 0xfe6c, 0x0675, 0xfc32,
-    0xfe20, 0x05cf, 0xfcbf, 0xfe6c, 0x0636, 0xfcbf, 0xfe6c, 0x0568, 0xfb83, 0xfe6c, 0x05cf, 0xfbfc, 0xfe6c, 0x0529,
-    0xfce0, 0xfee8, 0x05cf, 0xfc68, 0xfee8, 0x0675, 0xfba5, 0xfee8, 0x0636, 0xfba5, 0xfee8, 0x0568, 0xfc68, 0xfee8,
-    0x0529, 0xfc32, 0xff34, 0x05cf, 0xfc2a, 0xfd56, 0x05c8, 0xfc2a, 0xfd56, 0x05d6, 0xfc2a, 0xfe43, 0x05d6, 0xfc2a,
-    0xfe43, 0x05c8, 0xfc39, 0xfd56, 0x05c8, 0xfc39, 0xfe43, 0x05c8, 0xfc39, 0xfd56, 0x05d6, 0xfc39, 0xfe43, 0x05d6,
-    0x003c, 0x002a, 0x0002, 0xf9fa, 0xfe17, 0x050b, 0x00b4, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036,
-    0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d,
-    0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015,
-    0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009,
-    0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012,
-    0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009,
-    0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xf9d1, 0xfe34, 0x0588, 0xf9fa, 0xfdfb, 0x050b,
-    0xfa64, 0xfe34, 0x0558, 0xfa64, 0xfe34, 0x04be, 0xf977, 0xfe34, 0x050b, 0xf9d1, 0xfe34, 0x048e, 0xfa7d, 0xfe90,
-    0x050b, 0xfa22, 0xfe90, 0x0588, 0xf990, 0xfe90, 0x0558, 0xf990, 0xfe90, 0x04be, 0xfa22, 0xfe90, 0x048e, 0xf9fa,
-    0xfeca, 0x050b, 0xf9f4, 0xfd63, 0x0505, 0xf9f4, 0xfd63, 0x0511, 0xf9f4, 0xfe15, 0x0511, 0xf9f4, 0xfe15, 0x0505,
-    0xf9ff, 0xfd63, 0x0505, 0xf9ff, 0xfe15, 0x0505, 0xf9ff, 0xfd63, 0x0511, 0xf9ff, 0xfe15, 0x0511, 0x003c, 0x002a,
-    0x0002, 0x03d4, 0xfe4a, 0x05cf, 0x00f0, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039,
-    0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a,
-    0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012,
-    0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b,
-    0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006,
-    0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006,
-    0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0x039e, 0xfe71, 0x0675, 0x03d4, 0xfe25, 0x05cf, 0x0462, 0xfe71,
-    0x0636, 0x0462, 0xfe71, 0x0568, 0x0326, 0xfe71, 0x05cf, 0x039e, 0xfe71, 0x0529, 0x0483, 0xfeec, 0x05cf, 0x040a,
-    0xfeec, 0x0675, 0x0347, 0xfeec, 0x0636, 0x0347, 0xfeec, 0x0568, 0x040a, 0xfeec, 0x0529, 0x03d4, 0xff39, 0x05cf,
-    0x03cd, 0xfd5a, 0x05c8, 0x03cd, 0xfd5a, 0x05d6, 0x03cd, 0xfe48, 0x05d6, 0x03cd, 0xfe48, 0x05c8, 0x03dc, 0xfd5a,
-    0x05c8, 0x03dc, 0xfe48, 0x05c8, 0x03dc, 0xfd5a, 0x05d6, 0x03dc, 0xfe48, 0x05d6, 0x003c, 0x002a, 0x0002, 0x0603,
-    0xfe17, 0x050b, 0x00b4, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030,
-    0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027,
-    0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e,
-    0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f,
-    0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009,
-    0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000,
-    0x0003, 0x0006, 0x0000, 0x0003, 0x05da, 0xfe34, 0x0588, 0x0603, 0xfdfb, 0x050b, 0x066d, 0xfe34, 0x0558, 0x066d,
-    0xfe34, 0x04be, 0x0580, 0xfe34, 0x050b, 0x05da, 0xfe34, 0x048e, 0x0686, 0xfe90, 0x050b, 0x062b, 0xfe90, 0x0588,
-    0x0599, 0xfe90, 0x0558, 0x0599, 0xfe90, 0x04be, 0x062b, 0xfe90, 0x048e, 0x0603, 0xfeca, 0x050b, 0x05fd, 0xfd63,
-    0x0505, 0x05fd, 0xfd63, 0x0511, 0x05fd, 0xfe15, 0x0511, 0x05fd, 0xfe15, 0x0505, 0x0608, 0xfd63, 0x0505, 0x0608,
-    0xfe15, 0x0505, 0x0608, 0xfd63, 0x0511, 0x0608, 0xfe15, 0x0511, 0x003c, 0x002a, 0x0002, 0x0672, 0xfe7a, 0x0f1d,
-    0x011f, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030,
-    0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e,
-    0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b,
-    0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018,
-    0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f,
-    0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006,
-    0x0000, 0x0003, 0x0632, 0xfea9, 0x0fe4, 0x0673, 0xfe4e, 0x0f1d, 0x071c, 0xfea9, 0x0f98, 0x071c, 0xfea9, 0x0ea2,
-    0x05a1, 0xfea9, 0x0f1d, 0x0632, 0xfea9, 0x0e56, 0x0744, 0xff3e, 0x0f1d, 0x06b3, 0xff3e, 0x0fe4, 0x05c9, 0xff3e,
-    0x0f98, 0x05c9, 0xff3e, 0x0ea2, 0x06b3, 0xff3e, 0x0e56, 0x0673, 0xff99, 0x0f1d, 0x066a, 0xfd5b, 0x0f14, 0x066a,
-    0xfd5b, 0x0f26, 0x066a, 0xfe78, 0x0f26, 0x066a, 0xfe78, 0x0f14, 0x067c, 0xfd5b, 0x0f14, 0x067c, 0xfe78, 0x0f14,
-    0x067c, 0xfd5b, 0x0f26, 0x067c, 0xfe78, 0x0f26, 0x003c, 0x002a, 0x0002, 0x0611, 0xfe07, 0x0fbf, 0x00b4, 0x0000,
-    0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033,
-    0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b,
-    0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018,
-    0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c,
-    0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003,
-    0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003,
-    0x05e8, 0xfe24, 0x103c, 0x0611, 0xfdeb, 0x0fbf, 0x067b, 0xfe24, 0x100c, 0x067b, 0xfe24, 0x0f72, 0x058e, 0xfe24,
-    0x0fbf, 0x05e8, 0xfe24, 0x0f43, 0x0694, 0xfe81, 0x0fbf, 0x0639, 0xfe81, 0x103c, 0x05a7, 0xfe81, 0x100c, 0x05a7,
-    0xfe81, 0x0f72, 0x0639, 0xfe81, 0x0f43, 0x0611, 0xfeba, 0x0fbf, 0x060b, 0xfd53, 0x0fba, 0x060b, 0xfd53, 0x0fc5,
-    0x060b, 0xfe05, 0x0fc5, 0x060b, 0xfe05, 0x0fba, 0x0616, 0xfd53, 0x0fba, 0x0616, 0xfe05, 0x0fba, 0x0616, 0xfd53,
-    0x0fc5, 0x0616, 0xfe05, 0x0fc5, 0x003c, 0x002a, 0x0002, 0x06ec, 0xfe32, 0x0fbf, 0x00e1, 0x0000, 0x0039, 0x002a,
-    0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024,
-    0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018,
-    0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015,
-    0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015,
-    0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c,
-    0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0x06ba, 0xfe57,
-    0x105b, 0x06ed, 0xfe0f, 0x0fbf, 0x0771, 0xfe57, 0x1020, 0x0771, 0xfe57, 0x0f5f, 0x0649, 0xfe57, 0x0fbf, 0x06ba,
-    0xfe57, 0x0f24, 0x0790, 0xfeca, 0x0fbf, 0x071f, 0xfeca, 0x105b, 0x0668, 0xfeca, 0x1020, 0x0668, 0xfeca, 0x0f5f,
-    0x071f, 0xfeca, 0x0f24, 0x06ed, 0xff12, 0x0fbf, 0x06e6, 0xfd51, 0x0fb8, 0x06e6, 0xfd51, 0x0fc6, 0x06e6, 0xfe30,
-    0x0fc6, 0x06e6, 0xfe30, 0x0fb8, 0x06f3, 0xfd51, 0x0fb8, 0x06f3, 0xfe30, 0x0fb8, 0x06f3, 0xfd51, 0x0fc6, 0x06f3,
-    0xfe30, 0x0fc6, 0x003c, 0x002a, 0x0002, 0xf963, 0xfe7a, 0x0f1d, 0x011f, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036,
-    0x0039, 0x0036, 0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024,
-    0x002a, 0x002d, 0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021,
-    0x0021, 0x0015, 0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e,
-    0x001e, 0x0009, 0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000,
-    0x0009, 0x0012, 0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003,
-    0x0003, 0x0009, 0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xf922, 0xfea9, 0x0fe4, 0xf962,
-    0xfe4e, 0x0f1d, 0xfa0c, 0xfea9, 0x0f98, 0xfa0c, 0xfea9, 0x0ea2, 0xf891, 0xfea9, 0x0f1d, 0xf922, 0xfea9, 0x0e56,
-    0xfa34, 0xff3e, 0x0f1d, 0xf9a3, 0xff3e, 0x0fe4, 0xf8b9, 0xff3e, 0x0f98, 0xf8b9, 0xff3e, 0x0ea2, 0xf9a3, 0xff3e,
-    0x0e56, 0xf962, 0xff99, 0x0f1d, 0xf95a, 0xfd5b, 0x0f14, 0xf95a, 0xfd5b, 0x0f26, 0xf95a, 0xfe78, 0x0f26, 0xf95a,
-    0xfe78, 0x0f14, 0xf96b, 0xfd5b, 0x0f14, 0xf96b, 0xfe78, 0x0f14, 0xf96b, 0xfd5b, 0x0f26, 0xf96b, 0xfe78, 0x0f26,
-    0x003c, 0x002a, 0x0002, 0xf9e6, 0xfe07, 0x0fbf, 0x00b4, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036,
-    0x0033, 0x0039, 0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d,
-    0x0027, 0x002a, 0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015,
-    0x001e, 0x0012, 0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009,
-    0x000c, 0x001b, 0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012,
-    0x0012, 0x0006, 0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009,
-    0x0009, 0x0006, 0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xf9bd, 0xfe24, 0x103c, 0xf9e6, 0xfdeb, 0x0fbf,
-    0xfa50, 0xfe24, 0x100c, 0xfa50, 0xfe24, 0x0f72, 0xf963, 0xfe24, 0x0fbf, 0xf9bd, 0xfe24, 0x0f43, 0xfa69, 0xfe81,
-    0x0fbf, 0xfa0e, 0xfe81, 0x103c, 0xf97c, 0xfe81, 0x100c, 0xf97c, 0xfe81, 0x0f72, 0xfa0e, 0xfe81, 0x0f43, 0xf9e6,
-    0xfeba, 0x0fbf, 0xf9e0, 0xfd53, 0x0fba, 0xf9e0, 0xfd53, 0x0fc5, 0xf9e0, 0xfe05, 0x0fc5, 0xf9e0, 0xfe05, 0x0fba,
-    0xf9eb, 0xfd53, 0x0fba, 0xf9eb, 0xfe05, 0x0fba, 0xf9eb, 0xfd53, 0x0fc5, 0xf9eb, 0xfe05, 0x0fc5, 0x003c, 0x002a,
-    0x0002, 0xf90a, 0xfe32, 0x0fbf, 0x00e1, 0x0000, 0x0039, 0x002a, 0x0027, 0x0036, 0x0039, 0x0036, 0x0033, 0x0039,
-    0x0036, 0x0030, 0x0033, 0x0030, 0x002d, 0x0033, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x002d, 0x0027, 0x002a,
-    0x0024, 0x0027, 0x0021, 0x001e, 0x0021, 0x001b, 0x0021, 0x0018, 0x0012, 0x0021, 0x0021, 0x0015, 0x001e, 0x0012,
-    0x001b, 0x001e, 0x0018, 0x001b, 0x0015, 0x0018, 0x0012, 0x0015, 0x000f, 0x001e, 0x001e, 0x0009, 0x000c, 0x001b,
-    0x001b, 0x000f, 0x0000, 0x0018, 0x0018, 0x000c, 0x0006, 0x0015, 0x0015, 0x0000, 0x0009, 0x0012, 0x0012, 0x0006,
-    0x000f, 0x0009, 0x000c, 0x000f, 0x000f, 0x0003, 0x0000, 0x000c, 0x000c, 0x0003, 0x0003, 0x0009, 0x0009, 0x0006,
-    0x0006, 0x0000, 0x0003, 0x0006, 0x0000, 0x0003, 0xf8d7, 0xfe57, 0x105b, 0xf90a, 0xfe0f, 0x0fbf, 0xf98e, 0xfe57,
-    0x1020, 0xf98e, 0xfe57, 0x0f5f, 0xf866, 0xfe57, 0x0fbf, 0xf8d7, 0xfe57, 0x0f24, 0xf9ad, 0xfeca, 0x0fbf, 0xf93c,
-    0xfeca, 0x105b, 0xf885, 0xfeca, 0x1020, 0xf885, 0xfeca, 0x0f5f, 0xf93c, 0xfeca, 0x0f24, 0xf90a, 0xff12, 0x0fbf,
-    0xf903, 0xfd51, 0x0fb8, 0xf903, 0xfd51, 0x0fc6, 0xf903, 0xfe30, 0x0fc6, 0xf903, 0xfe30, 0x0fb8, 0xf911, 0xfd51,
-    0x0fb8, 0xf911, 0xfe30, 0x0fb8, 0xf911, 0xfd51, 0x0fc6, 0xf911, 0xfe30, 0x0fc6, 0x0018, 0x0004, 0x0003, 0x0000,
-    0xff51, 0xfea1, 0x058b, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0x000c, 0x000f, 0x0012, 0x000c,
-    0x0012, 0x0015, 0x0426, 0x0000, 0xff94, 0x056b, 0xfea1, 0xfdad, 0x056b, 0x0000, 0xfdad, 0x0426, 0xfea1, 0xff94,
-    0xfbda, 0x0000, 0xff94, 0xfa95, 0x0000, 0xfdad, 0xfa95, 0xfea1, 0xfdad, 0xfbda, 0xfea1, 0xff94, 0x0012, 0x0004,
-    0x0003, 0x05a4, 0xff51, 0xfc8e, 0x0156, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x000c, 0x0000, 0x0000, 0x000c,
-    0x0003, 0x0009, 0x000f, 0x000c, 0x05b5, 0x0000, 0xfc8d, 0x05de, 0xfea1, 0xfb6e, 0x05de, 0x0000, 0xfb6e, 0x056b,
-    0x0000, 0xfdad, 0x05b5, 0xfea1, 0xfc8d, 0x056b, 0xfea1, 0xfdad, 0x000c, 0x0005, 0x0002, 0x05de, 0xff51, 0xfa84,
-    0x0124, 0x0000, 0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0003, 0x0000, 0x0003, 0x05de, 0x0000,
-    0xf99a, 0x05de, 0x0000, 0xfb6e, 0x05de, 0xfea1, 0xfb6e, 0x05de, 0xfea1, 0xf99a, 0x0012, 0x0004, 0x0003, 0xfa5c,
-    0xff51, 0xfc8e, 0x0156, 0x0000, 0x0000, 0x0003, 0x0006, 0x0009, 0x0000, 0x000c, 0x0000, 0x0006, 0x000c, 0x0009,
-    0x000c, 0x000f, 0xfa4b, 0x0000, 0xfc8d, 0xfa22, 0x0000, 0xfb6e, 0xfa22, 0xfea1, 0xfb6e, 0xfa95, 0x0000, 0xfdad,
-    0xfa4b, 0xfea1, 0xfc8d, 0xfa95, 0xfea1, 0xfdad, 0x000c, 0x0005, 0x0002, 0xfa22, 0xff51, 0xfa84, 0x0124, 0x0000,
-    0x0009, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0003, 0x0000, 0x0003, 0xfa22, 0x0000, 0xf99a, 0xfa22,
-    0x0000, 0xfb6e, 0xfa22, 0xfea1, 0xfb6e, 0xfa22, 0xfea1, 0xf99a, 0x006c, 0x0029, 0x0002, 0xf8a8, 0x059d, 0xffde,
-    0x0b27, 0x0000, 0x0030, 0x0009, 0x0015, 0x0027, 0x0009, 0x0069, 0x0057, 0x004e, 0x005a, 0x0045, 0x0039, 0x0042,
-    0x0033, 0x003f, 0x0030, 0x003c, 0x0066, 0x000c, 0x0069, 0x000f, 0x001b, 0x0066, 0x0054, 0x0060, 0x0063, 0x005d,
-    0x0060, 0x0063, 0x005a, 0x005d, 0x0039, 0x0051, 0x0054, 0x0057, 0x0051, 0x0054, 0x004e, 0x004b, 0x0048, 0x004b,
-    0x004b, 0x0036, 0x0045, 0x0048, 0x0042, 0x0036, 0x003f, 0x002d, 0x003c, 0x002a, 0x0033, 0x0039, 0x0018, 0x0015,
-    0x0036, 0x0000, 0x0030, 0x0033, 0x002d, 0x001e, 0x0003, 0x0021, 0x0021, 0x0027, 0x002a, 0x0024, 0x0024, 0x0027,
-    0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0015, 0x000f, 0x0012, 0x000c, 0x0006, 0x0006, 0x0009, 0x0000, 0x0003,
-    0xf976, 0x0000, 0x0279, 0xf976, 0xfe67, 0x0279, 0xf7da, 0x07ef, 0x0857, 0xf873, 0x07ef, 0x0857, 0xf7da, 0x049d,
-    0x0857, 0xf873, 0x014b, 0x0857, 0xf873, 0x0000, 0x0857, 0xf873, 0xfe67, 0x0857, 0xf7da, 0xfe67, 0x0857, 0xf7da,
-    0x0000, 0x0857, 0xf976, 0x0000, 0x04e3, 0xf976, 0xfe67, 0x04e3, 0xf873, 0x0000, 0x04e3, 0xf873, 0xfe67, 0x04e3,
-    0xf873, 0x014b, 0x04e3, 0xf976, 0x014b, 0x04e3, 0xf873, 0x07f0, 0x04e3, 0xf976, 0x07f0, 0x04e3, 0xf976, 0x014b,
-    0x0279, 0xf976, 0x07f0, 0x0279, 0xf873, 0x049d, 0x04e3, 0xf976, 0x049d, 0x04e3, 0xf976, 0x049d, 0x0279, 0xf976,
-    0x049d, 0xf765, 0xf976, 0x014b, 0xf765, 0xf976, 0x014b, 0xfb82, 0xf976, 0x049d, 0xfb82, 0xf976, 0x09d1, 0x0279,
-    0xf976, 0x09d1, 0xfb82, 0xf976, 0x07f0, 0xfb82, 0xf976, 0x07f0, 0xf765, 0xf976, 0x09d1, 0xf765, 0xf976, 0x0cd3,
-    0xfb82, 0xf976, 0x0cd3, 0xf765, 0xf7da, 0x014b, 0x0857, 0xf873, 0x049d, 0x0857, 0x0144, 0x00cc, 0x0002, 0x04f7,
-    0xfe0e, 0x04f1, 0x01bb, 0x0000, 0x000f, 0x0000, 0x0132, 0x0135, 0x013e, 0x0141, 0x0141, 0x0114, 0x0123, 0x012c,
-    0x0141, 0x0132, 0x0135, 0x013e, 0x0117, 0x0138, 0x0129, 0x013e, 0x012f, 0x0120, 0x0126, 0x013b, 0x013b, 0x0138,
-    0x012f, 0x013b, 0x0138, 0x012c, 0x0135, 0x010e, 0x0111, 0x0132, 0x012c, 0x012f, 0x00f3, 0x0102, 0x0126, 0x0117,
-    0x0102, 0x0126, 0x00f3, 0x0117, 0x0120, 0x0126, 0x0123, 0x0117, 0x00fc, 0x0102, 0x00ff, 0x00f3, 0x0105, 0x00ea,
-    0x010e, 0x0129, 0x0105, 0x0129, 0x00ea, 0x010e, 0x0114, 0x0129, 0x010b, 0x010e, 0x00f0, 0x0105, 0x00e7, 0x00ea,
-    0x010b, 0x00e7, 0x00e4, 0x0108, 0x0114, 0x00f0, 0x00ed, 0x0111, 0x0123, 0x00ff, 0x00fc, 0x0120, 0x011a, 0x00f6,
-    0x00f9, 0x011d, 0x0129, 0x011d, 0x011d, 0x011a, 0x0126, 0x011a, 0x0120, 0x0123, 0x010b, 0x011d, 0x011a, 0x0108,
-    0x0117, 0x0108, 0x0111, 0x0114, 0x010e, 0x0111, 0x0108, 0x010b, 0x0105, 0x00f9, 0x00f9, 0x00f6, 0x0102, 0x00f6,
-    0x00fc, 0x00ff, 0x00e7, 0x00f9, 0x00f6, 0x00e4, 0x00f3, 0x00e4, 0x00ed, 0x00f0, 0x00ea, 0x00ed, 0x00e4, 0x00e7,
-    0x00d5, 0x00d2, 0x00e1, 0x00de, 0x00e1, 0x00b4, 0x00c3, 0x00cf, 0x00d2, 0x00e1, 0x00d5, 0x00de, 0x00b7, 0x00d8,
-    0x00c9, 0x00de, 0x00cc, 0x00c0, 0x00c6, 0x00db, 0x00db, 0x00d8, 0x00cc, 0x00db, 0x00cf, 0x00d8, 0x00d5, 0x00ae,
-    0x00b1, 0x00d2, 0x00cc, 0x00cf, 0x0093, 0x00a2, 0x00c6, 0x00b7, 0x00a2, 0x00c6, 0x0093, 0x00b7, 0x00c0, 0x00c6,
-    0x00c3, 0x00b7, 0x009c, 0x00a2, 0x009f, 0x0093, 0x00a5, 0x008a, 0x00ae, 0x00c9, 0x00a5, 0x00c9, 0x008a, 0x00ae,
-    0x00b4, 0x00c9, 0x00ab, 0x00ae, 0x0090, 0x00a5, 0x0087, 0x008a, 0x00ab, 0x0087, 0x0084, 0x00a8, 0x00b4, 0x0090,
-    0x008d, 0x00b1, 0x00c3, 0x009f, 0x009c, 0x00c0, 0x00ba, 0x0096, 0x0099, 0x00bd, 0x00c9, 0x00bd, 0x00bd, 0x00ba,
-    0x00c6, 0x00ba, 0x00c0, 0x00c3, 0x00ab, 0x00bd, 0x00ba, 0x00a8, 0x00b7, 0x00a8, 0x00b1, 0x00b4, 0x00ae, 0x00b1,
-    0x00a8, 0x00ab, 0x00a5, 0x0099, 0x0099, 0x0096, 0x00a2, 0x0096, 0x009c, 0x009f, 0x0087, 0x0099, 0x0096, 0x0084,
-    0x0093, 0x0084, 0x008d, 0x0090, 0x008a, 0x008d, 0x0084, 0x0087, 0x0006, 0x000c, 0x0018, 0x0003, 0x0021, 0x0009,
-    0x002a, 0x0030, 0x0030, 0x0027, 0x0027, 0x0024, 0x0024, 0x002a, 0x001b, 0x0030, 0x0015, 0x002a, 0x0039, 0x0027,
-    0x0036, 0x0024, 0x0081, 0x0039, 0x004b, 0x007e, 0x007e, 0x0081, 0x007b, 0x0048, 0x003c, 0x0072, 0x0075, 0x003f,
-    0x0033, 0x0078, 0x0078, 0x007b, 0x006f, 0x0075, 0x0072, 0x006c, 0x006c, 0x0036, 0x002d, 0x006f, 0x0081, 0x006c,
-    0x007e, 0x0072, 0x0078, 0x0081, 0x007b, 0x007e, 0x0075, 0x007b, 0x006f, 0x0078, 0x0072, 0x0075, 0x006c, 0x006f,
-    0x0063, 0x004e, 0x0003, 0x0060, 0x0060, 0x0063, 0x0000, 0x0054, 0x0069, 0x0021, 0x0006, 0x0057, 0x005a, 0x0045,
-    0x0054, 0x005a, 0x0051, 0x0066, 0x005d, 0x0042, 0x0066, 0x0069, 0x0057, 0x005d, 0x0057, 0x0069, 0x005d, 0x0066,
-    0x0069, 0x0060, 0x0066, 0x0063, 0x0063, 0x005a, 0x0060, 0x0054, 0x005a, 0x005d, 0x0054, 0x0057, 0x004e, 0x004b,
-    0x0045, 0x003c, 0x0048, 0x0051, 0x0042, 0x003f, 0x0051, 0x0042, 0x003f, 0x0048, 0x004b, 0x003c, 0x0045, 0x004e,
-    0x004e, 0x0051, 0x0048, 0x004b, 0x0042, 0x0045, 0x003c, 0x003f, 0x002d, 0x0033, 0x0033, 0x0039, 0x0039, 0x0036,
-    0x0036, 0x002d, 0x0030, 0x0033, 0x002a, 0x002d, 0x0027, 0x001e, 0x0024, 0x0012, 0x0021, 0x0006, 0x0003, 0x0021,
-    0x001e, 0x001b, 0x0012, 0x001e, 0x0015, 0x001b, 0x0009, 0x0018, 0x000f, 0x0018, 0x0012, 0x0015, 0x000c, 0x000f,
-    0x0009, 0x000c, 0x0006, 0x0000, 0x0000, 0x0003, 0x0570, 0xfd58, 0x0665, 0x0570, 0xfd5b, 0x065f, 0x0577, 0xfd58,
-    0x0665, 0x0577, 0xfd41, 0x0655, 0x0577, 0xfd41, 0x065b, 0x0570, 0xfd41, 0x065b, 0x0570, 0xfea0, 0x038b, 0x0577,
-    0xfea0, 0x038b, 0x0570, 0xfd41, 0x0655, 0x0577, 0xfea0, 0x0392, 0x0570, 0xfea0, 0x0392, 0x0577, 0xfd5b, 0x065f,
-    0x0570, 0xfeb9, 0x037e, 0x0570, 0xfeba, 0x0382, 0x0577, 0xfeb9, 0x037e, 0x0577, 0xfeb7, 0x037e, 0x0577, 0xfeba,
-    0x0382, 0x0577, 0xfeba, 0x0382, 0x0570, 0xfeb7, 0x037e, 0x0570, 0xfeba, 0x0382, 0x0570, 0xfeda, 0x03a7, 0x0577,
-    0xfeda, 0x03a7, 0x0577, 0xfd79, 0x0632, 0x0570, 0xfd79, 0x0632, 0x0577, 0xfed4, 0x03a7, 0x0570, 0xfed4, 0x03a7,
-    0x0570, 0xfd73, 0x0632, 0x0577, 0xfd73, 0x0632, 0x0570, 0xfd6e, 0x0662, 0x0577, 0xfd6e, 0x0662, 0x0570, 0xfd79,
-    0x0656, 0x0577, 0xfd79, 0x0656, 0x0570, 0xfd6b, 0x065c, 0x0570, 0xfd73, 0x0653, 0x0577, 0xfd73, 0x0653, 0x0577,
-    0xfd6b, 0x065c, 0x0570, 0xfecb, 0x037e, 0x0577, 0xfecb, 0x037e, 0x0570, 0xfed6, 0x0383, 0x0577, 0xfed6, 0x0383,
-    0x0577, 0xfec7, 0x0382, 0x0577, 0xfed0, 0x0386, 0x0570, 0xfed0, 0x0386, 0x0570, 0xfec7, 0x0382, 0x0477, 0xfeda,
-    0x03ad, 0x0477, 0xfd79, 0x062d, 0x0477, 0xfd79, 0x065f, 0x0477, 0xfd79, 0x0665, 0x047c, 0xfd79, 0x0665, 0x0477,
-    0xfed8, 0x0382, 0x047c, 0xfeda, 0x03ad, 0x047c, 0xfd79, 0x062d, 0x047c, 0xfed8, 0x037e, 0x0477, 0xfed8, 0x037e,
-    0x047c, 0xfed8, 0x0382, 0x047c, 0xfd79, 0x065f, 0x0477, 0xfed4, 0x03ad, 0x0477, 0xfd73, 0x062d, 0x0477, 0xfd73,
-    0x065f, 0x0477, 0xfd73, 0x0665, 0x047c, 0xfd73, 0x0665, 0x0477, 0xfed2, 0x0382, 0x047c, 0xfed4, 0x03ad, 0x047c,
-    0xfd73, 0x062d, 0x047c, 0xfed2, 0x037e, 0x0477, 0xfed2, 0x037e, 0x047c, 0xfed2, 0x0382, 0x047c, 0xfd73, 0x065f,
-    0x047c, 0xfea0, 0x037e, 0x0477, 0xfea0, 0x037e, 0x0477, 0xfd42, 0x0665, 0x0477, 0xfd42, 0x065f, 0x0477, 0xfea0,
-    0x0382, 0x047c, 0xfea0, 0x0382, 0x047c, 0xfd42, 0x065f, 0x047c, 0xfd42, 0x0665, 0x050a, 0xfeda, 0x03ad, 0x050a,
-    0xfd79, 0x062d, 0x050a, 0xfd79, 0x065f, 0x050a, 0xfd79, 0x0665, 0x050f, 0xfd79, 0x0665, 0x050a, 0xfed8, 0x0382,
-    0x050f, 0xfeda, 0x03ad, 0x050f, 0xfd79, 0x062d, 0x050f, 0xfed8, 0x037e, 0x050a, 0xfed8, 0x037e, 0x050f, 0xfed8,
-    0x0382, 0x050f, 0xfd79, 0x065f, 0x050a, 0xfed4, 0x03ad, 0x050a, 0xfd73, 0x062d, 0x050a, 0xfd73, 0x065f, 0x050a,
-    0xfd73, 0x0665, 0x050f, 0xfd73, 0x0665, 0x050a, 0xfed2, 0x0382, 0x050f, 0xfed4, 0x03ad, 0x050f, 0xfd73, 0x062d,
-    0x050f, 0xfed2, 0x037e, 0x050a, 0xfed2, 0x037e, 0x050f, 0xfed2, 0x0382, 0x050f, 0xfd73, 0x065f, 0x050a, 0xfea0,
-    0x037e, 0x050f, 0xfea0, 0x037e, 0x050a, 0xfd42, 0x0665, 0x050a, 0xfd42, 0x065f, 0x050a, 0xfea0, 0x0382, 0x050f,
-    0xfea0, 0x0382, 0x050f, 0xfd42, 0x065f, 0x050f, 0xfd42, 0x0665, 0x0090, 0x0030, 0x0002, 0x0766, 0x0371, 0x0c39,
-    0x054b, 0x0000, 0x0042, 0x005d, 0x0069, 0x0051, 0x0057, 0x0087, 0x001e, 0x002a, 0x008a, 0x0060, 0x008d, 0x0081,
-    0x0084, 0x007e, 0x007b, 0x008d, 0x0078, 0x0066, 0x0087, 0x008a, 0x0081, 0x0084, 0x007e, 0x006c, 0x0063, 0x007b,
-    0x0072, 0x0075, 0x0075, 0x0078, 0x006f, 0x0072, 0x006c, 0x006f, 0x0066, 0x0069, 0x0060, 0x0063, 0x005d, 0x0015,
-    0x005a, 0x0054, 0x004b, 0x005a, 0x003f, 0x001b, 0x0054, 0x0057, 0x0051, 0x002d, 0x0021, 0x0045, 0x0048, 0x0027,
-    0x0039, 0x004e, 0x004e, 0x0003, 0x0024, 0x000c, 0x0018, 0x004b, 0x0033, 0x003c, 0x0045, 0x0048, 0x0042, 0x0036,
-    0x003c, 0x003f, 0x0036, 0x0039, 0x0030, 0x0033, 0x002d, 0x0030, 0x0012, 0x002a, 0x0000, 0x0027, 0x0021, 0x0024,
-    0x001b, 0x001e, 0x0015, 0x0018, 0x000f, 0x0012, 0x0009, 0x000f, 0x000c, 0x0006, 0x0006, 0x0009, 0x0000, 0x0003,
-    0x0766, 0x0409, 0x0749, 0x0766, 0x0409, 0x0909, 0x0766, 0x0451, 0x0749, 0x0766, 0x0451, 0x0909, 0x0766, 0x0451,
-    0x0701, 0x0766, 0x0451, 0x0951, 0x0766, 0x0409, 0x0951, 0x0766, 0x02d9, 0x0b59, 0x0766, 0x0409, 0x0b59, 0x0766,
-    0x0409, 0x0b12, 0x0766, 0x02d9, 0x0b12, 0x0766, 0x02d9, 0x0701, 0x0766, 0x0409, 0x0701, 0x0766, 0x02d9, 0x0749,
-    0x0766, 0x02d9, 0x0951, 0x0766, 0x0409, 0x0d61, 0x0766, 0x0451, 0x0d61, 0x0766, 0x0451, 0x0d1a, 0x0766, 0x0292,
-    0x0951, 0x0766, 0x0292, 0x0909, 0x0766, 0x0451, 0x0b59, 0x0766, 0x0451, 0x0b12, 0x0766, 0x0292, 0x0b12, 0x0766,
-    0x0292, 0x0701, 0x0766, 0x0292, 0x0749, 0x0766, 0x0409, 0x0d1a, 0x0766, 0x02d9, 0x0909, 0x0766, 0x02d9, 0x0d61,
-    0x0766, 0x0292, 0x0d1a, 0x0766, 0x0292, 0x0d61, 0x0766, 0x02d9, 0x0d1a, 0x0766, 0x0292, 0x0b59, 0x0766, 0x02d9,
-    0x0f69, 0x0766, 0x0409, 0x0f69, 0x0766, 0x0409, 0x0f22, 0x0766, 0x02d9, 0x0f22, 0x0766, 0x0409, 0x1172, 0x0766,
-    0x0451, 0x1172, 0x0766, 0x0451, 0x112a, 0x0766, 0x0451, 0x0f69, 0x0766, 0x0451, 0x0f22, 0x0766, 0x0409, 0x112a,
-    0x0766, 0x02d9, 0x1172, 0x0766, 0x0292, 0x112a, 0x0766, 0x0292, 0x1172, 0x0766, 0x0292, 0x0f22, 0x0766, 0x0292,
-    0x0f69, 0x0766, 0x02d9, 0x112a, 0x0090, 0x0030, 0x0002, 0xf89a, 0x0371, 0x0c39, 0x054b, 0x0000, 0x0042, 0x005d,
-    0x0069, 0x0051, 0x0057, 0x0087, 0x001e, 0x002a, 0x008a, 0x0060, 0x008d, 0x0081, 0x0084, 0x007e, 0x007b, 0x008d,
-    0x0078, 0x0066, 0x0087, 0x008a, 0x0081, 0x0084, 0x007e, 0x006c, 0x0063, 0x007b, 0x0072, 0x0075, 0x0075, 0x0078,
-    0x006f, 0x0072, 0x006c, 0x006f, 0x0066, 0x0069, 0x0060, 0x0063, 0x005d, 0x0015, 0x005a, 0x0054, 0x004b, 0x005a,
-    0x003f, 0x001b, 0x0054, 0x0057, 0x0051, 0x002d, 0x0021, 0x0045, 0x0048, 0x0027, 0x0039, 0x004e, 0x004e, 0x0003,
-    0x0024, 0x000c, 0x0018, 0x004b, 0x0033, 0x003c, 0x0045, 0x0048, 0x0042, 0x0036, 0x003c, 0x003f, 0x0036, 0x0039,
-    0x0030, 0x0033, 0x002d, 0x0030, 0x0012, 0x002a, 0x0000, 0x0027, 0x0021, 0x0024, 0x001b, 0x001e, 0x0015, 0x0018,
-    0x000f, 0x0012, 0x0009, 0x000f, 0x000c, 0x0006, 0x0006, 0x0009, 0x0000, 0x0003, 0xf89a, 0x0409, 0x0749, 0xf89a,
-    0x0409, 0x0909, 0xf89a, 0x0451, 0x0749, 0xf89a, 0x0451, 0x0909, 0xf89a, 0x0451, 0x0701, 0xf89a, 0x0451, 0x0951,
-    0xf89a, 0x0409, 0x0951, 0xf89a, 0x02d9, 0x0b59, 0xf89a, 0x0409, 0x0b59, 0xf89a, 0x0409, 0x0b12, 0xf89a, 0x02d9,
-    0x0b12, 0xf89a, 0x02d9, 0x0701, 0xf89a, 0x0409, 0x0701, 0xf89a, 0x02d9, 0x0749, 0xf89a, 0x02d9, 0x0951, 0xf89a,
-    0x0409, 0x0d61, 0xf89a, 0x0451, 0x0d61, 0xf89a, 0x0451, 0x0d1a, 0xf89a, 0x0292, 0x0951, 0xf89a, 0x0292, 0x0909,
-    0xf89a, 0x0451, 0x0b59, 0xf89a, 0x0451, 0x0b12, 0xf89a, 0x0292, 0x0b12, 0xf89a, 0x0292, 0x0701, 0xf89a, 0x0292,
-    0x0749, 0xf89a, 0x0409, 0x0d1a, 0xf89a, 0x02d9, 0x0909, 0xf89a, 0x02d9, 0x0d61, 0xf89a, 0x0292, 0x0d1a, 0xf89a,
-    0x0292, 0x0d61, 0xf89a, 0x02d9, 0x0d1a, 0xf89a, 0x0292, 0x0b59, 0xf89a, 0x02d9, 0x0f69, 0xf89a, 0x0409, 0x0f69,
-    0xf89a, 0x0409, 0x0f22, 0xf89a, 0x02d9, 0x0f22, 0xf89a, 0x0409, 0x1172, 0xf89a, 0x0451, 0x1172, 0xf89a, 0x0451,
-    0x112a, 0xf89a, 0x0451, 0x0f69, 0xf89a, 0x0451, 0x0f22, 0xf89a, 0x0409, 0x112a, 0xf89a, 0x02d9, 0x1172, 0xf89a,
-    0x0292, 0x112a, 0xf89a, 0x0292, 0x1172, 0xf89a, 0x0292, 0x0f22, 0xf89a, 0x0292, 0x0f69, 0xf89a, 0x02d9, 0x112a,
-    0x000c, 0x0002, 0x0003, 0xf83a, 0x027b, 0x0c39, 0x018c, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003,
-    0xf97a, 0x027b, 0x0d23, 0xf6fa, 0x027b, 0x0b4f, 0xf97a, 0x027b, 0x0b4f, 0xf6fa, 0x027b, 0x0d23, 0x000c, 0x0002,
-    0x0003, 0xfaba, 0x027b, 0x0c39, 0x018c, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfbfa, 0x027b,
-    0x0d23, 0xf97a, 0x027b, 0x0b4f, 0xfbfa, 0x027b, 0x0b4f, 0xf97a, 0x027b, 0x0d23, 0x000c, 0x0002, 0x0003, 0xfd3a,
-    0x027b, 0x0c39, 0x018c, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfe7a, 0x027b, 0x0d23, 0xfbfa,
-    0x027b, 0x0b4f, 0xfe7a, 0x027b, 0x0b4f, 0xfbfa, 0x027b, 0x0d23, 0x000c, 0x0002, 0x0003, 0x0000, 0x0293, 0x0c39,
-    0x0228, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000, 0x0009, 0x0003, 0xfe7a, 0x0293, 0x0ab3, 0x0186, 0x0293, 0x0dc0,
-    0xfe7a, 0x0293, 0x0dc0, 0x0186, 0x0293, 0x0ab3, 0x000c, 0x0002, 0x0003, 0x02c6, 0x027b, 0x0c39, 0x018c, 0x0000,
-    0x0000, 0x0003, 0x0006, 0x0000, 0x0006, 0x0009, 0x0186, 0x027b, 0x0d23, 0x0186, 0x027b, 0x0b4f, 0x0406, 0x027b,
-    0x0b4f, 0x0406, 0x027b, 0x0d23, 0x000c, 0x0002, 0x0003, 0x0546, 0x027b, 0x0c39, 0x018c, 0x0000, 0x0000, 0x0003,
-    0x0006, 0x0000, 0x0006, 0x0009, 0x0406, 0x027b, 0x0d23, 0x0406, 0x027b, 0x0b4f, 0x0686, 0x027b, 0x0b4f, 0x0686,
-    0x027b, 0x0d23, 0x000c, 0x0002, 0x0003, 0x07c6, 0x027b, 0x0c39, 0x018c, 0x0000, 0x0000, 0x0003, 0x0006, 0x0000,
-    0x0006, 0x0009, 0x0686, 0x027b, 0x0d23, 0x0686, 0x027b, 0x0b4f, 0x0906, 0x027b, 0x0b4f, 0x0906, 0x027b, 0x0d23,
-    0x006c, 0x0029, 0x0002, 0x0758, 0x059d, 0xffde, 0x0b27, 0x0000, 0x0030, 0x0009, 0x0015, 0x0027, 0x0009, 0x0069,
-    0x0057, 0x004e, 0x005a, 0x0045, 0x0039, 0x0042, 0x0033, 0x003f, 0x0030, 0x003c, 0x0066, 0x000c, 0x0069, 0x000f,
-    0x001b, 0x0066, 0x0054, 0x0060, 0x0063, 0x005d, 0x0060, 0x0063, 0x005a, 0x005d, 0x0039, 0x0051, 0x0054, 0x0057,
-    0x0051, 0x0054, 0x004e, 0x004b, 0x0048, 0x004b, 0x004b, 0x0036, 0x0045, 0x0048, 0x0042, 0x0036, 0x003f, 0x002d,
-    0x003c, 0x002a, 0x0033, 0x0039, 0x0018, 0x0015, 0x0036, 0x0000, 0x0030, 0x0033, 0x002d, 0x001e, 0x0003, 0x0021,
-    0x0021, 0x0027, 0x002a, 0x0024, 0x0024, 0x0027, 0x001e, 0x0021, 0x0018, 0x001b, 0x0012, 0x0015, 0x000f, 0x0012,
-    0x000c, 0x0006, 0x0006, 0x0009, 0x0000, 0x0003, 0x068a, 0x0000, 0x0279, 0x068a, 0xfe67, 0x0279, 0x0826, 0x07ef,
-    0x0857, 0x078d, 0x07ef, 0x0857, 0x0826, 0x049d, 0x0857, 0x078d, 0x014b, 0x0857, 0x078d, 0x0000, 0x0857, 0x078d,
-    0xfe67, 0x0857, 0x0826, 0xfe67, 0x0857, 0x0826, 0x0000, 0x0857, 0x068a, 0x0000, 0x04e3, 0x068a, 0xfe67, 0x04e3,
-    0x078d, 0x0000, 0x04e3, 0x078d, 0xfe67, 0x04e3, 0x078d, 0x014b, 0x04e3, 0x068a, 0x014b, 0x04e3, 0x078d, 0x07f0,
-    0x04e3, 0x068a, 0x07f0, 0x04e3, 0x068a, 0x014b, 0x0279, 0x068a, 0x07f0, 0x0279, 0x078d, 0x049d, 0x04e3, 0x068a,
-    0x049d, 0x04e3, 0x068a, 0x049d, 0x0279, 0x068a, 0x049d, 0xf765, 0x068a, 0x014b, 0xf765, 0x068a, 0x014b, 0xfb82,
-    0x068a, 0x049d, 0xfb82, 0x068a, 0x09d1, 0x0279, 0x068a, 0x09d1, 0xfb82, 0x068a, 0x07f0, 0xfb82, 0x068a, 0x07f0,
-    0xf765, 0x068a, 0x09d1, 0xf765, 0x068a, 0x0cd3, 0xfb82, 0x068a, 0x0cd3, 0xf765, 0x0826, 0x014b, 0x0857, 0x078d,
-    0x049d, 0x0857, 0x000c, 0x0002, 0x0003, 0x05fd, 0x04a8, 0x0f19, 0x0010, 0x03e6, 0x0000, 0x0003, 0x0009, 0x0000,
-    0x0009, 0x0006, 0x05fd, 0x04a8, 0x0f29, 0x05fd, 0x04a8, 0x0f09, 0x05fd, 0x04a8, 0x0f29, 0x05fd, 0x04a8, 0x0f09,
-    0x0024, 0x0014, 0x0002, 0x05ce, 0x027a, 0x07c9, 0x0025, 0x03e8, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x05d3, 0x0260, 0x07e4, 0x05d3, 0x0256, 0x07d1, 0x05dc, 0x0270,
-    0x07b8, 0x05d2, 0x0294, 0x07ae, 0x05d3, 0x029e, 0x07c0, 0x05dd, 0x0283, 0x07d8, 0x05c1, 0x0269, 0x07df, 0x05c1,
-    0x0295, 0x07c6, 0x05c5, 0x0280, 0x07d5, 0x05c0, 0x025f, 0x07cd, 0x05c0, 0x028b, 0x07b4, 0x05c4, 0x0274, 0x07be,
-    0x0024, 0x0014, 0x0002, 0x05b5, 0x0172, 0x0600, 0x0025, 0x03e9, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x05bb, 0x0158, 0x061b, 0x05ba, 0x014e, 0x0609, 0x05c2, 0x0168,
-    0x05ef, 0x05b9, 0x018c, 0x05e5, 0x05ba, 0x0196, 0x05f8, 0x05c4, 0x017b, 0x0610, 0x05a8, 0x0161, 0x0616, 0x05a8,
-    0x018d, 0x05fe, 0x05ac, 0x0178, 0x060c, 0x05a7, 0x0157, 0x0604, 0x05a7, 0x0183, 0x05eb, 0x05ab, 0x016c, 0x05f5,
-    0x0024, 0x0014, 0x0002, 0x059d, 0x0081, 0x042c, 0x0025, 0x03ea, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x05a2, 0x0064, 0x0444, 0x05a2, 0x005c, 0x0431, 0x05ab, 0x0079,
-    0x041a, 0x05a1, 0x009d, 0x0414, 0x05a2, 0x00a6, 0x0427, 0x05ac, 0x0088, 0x043d, 0x0590, 0x006e, 0x0440, 0x0590,
-    0x009c, 0x042c, 0x0594, 0x0086, 0x0438, 0x058f, 0x0065, 0x042d, 0x058f, 0x0094, 0x0419, 0x0593, 0x007c, 0x0420,
-    0x0024, 0x0014, 0x0002, 0x059a, 0xffde, 0x0238, 0x0025, 0x03eb, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x059e, 0xffbd, 0x024a, 0x059f, 0xffb9, 0x0235, 0x05a9, 0xffda,
-    0x0226, 0x059f, 0xffff, 0x0227, 0x059e, 0x0002, 0x023b, 0x05a8, 0xffe2, 0x024b, 0x058c, 0xffc7, 0x0247, 0x058c,
-    0xfff9, 0x023d, 0x0590, 0xffe0, 0x0244, 0x058d, 0xffc3, 0x0233, 0x058d, 0xfff4, 0x0228, 0x0591, 0xffdb, 0x022b,
-    0x0024, 0x0014, 0x0002, 0x05c7, 0xffb5, 0x0030, 0x0026, 0x03ec, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x05cb, 0xff90, 0x0038, 0x05ce, 0xff91, 0x0023, 0x05d8, 0xffb6,
-    0x001e, 0x05cc, 0xffd9, 0x0027, 0x05c9, 0xffd7, 0x003c, 0x05d2, 0xffb3, 0x0043, 0x05b9, 0xff9a, 0x0036, 0x05b7,
-    0xffcd, 0x0038, 0x05bc, 0xffb3, 0x003a, 0x05bc, 0xff9b, 0x0021, 0x05ba, 0xffce, 0x0024, 0x05bf, 0xffb5, 0x0020,
-    0x0024, 0x0014, 0x0002, 0x069b, 0x00d0, 0xfc57, 0x0026, 0x03f2, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x06a4, 0x00ab, 0xfc55, 0x06a2, 0x00b2, 0xfc41, 0x06a8, 0x00d7,
-    0xfc44, 0x069c, 0x00f5, 0xfc58, 0x069d, 0x00ee, 0xfc6c, 0x06ab, 0x00cb, 0xfc68, 0x0691, 0x00b3, 0xfc59, 0x068c,
-    0x00e3, 0xfc69, 0x0693, 0x00ca, 0xfc63, 0x068f, 0x00ba, 0xfc45, 0x068b, 0x00e9, 0xfc55, 0x0691, 0x00d3, 0xfc4a,
-    0x0024, 0x0014, 0x0002, 0x0512, 0x00fc, 0xfb4d, 0x0027, 0x03f3, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x051e, 0x00da, 0xfb3d, 0x0509, 0x00da, 0xfb3a, 0x0500, 0x00ff,
-    0xfb3a, 0x0506, 0x011e, 0xfb4e, 0x051a, 0x011f, 0xfb51, 0x0525, 0x00ff, 0xfb3f, 0x051b, 0x00df, 0xfb51, 0x0519,
-    0x010f, 0xfb5f, 0x051d, 0x00f8, 0xfb54, 0x0507, 0x00df, 0xfb4e, 0x0504, 0x010f, 0xfb5c, 0x0503, 0x00f8, 0xfb51,
-    0x0024, 0x0014, 0x0002, 0x031b, 0x00e1, 0xfbc3, 0x0027, 0x03f4, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0321, 0x00bf, 0xfbb0, 0x030f, 0x00be, 0xfbbc, 0x0306, 0x00e2,
-    0xfbc1, 0x0316, 0x0103, 0xfbcd, 0x0327, 0x0104, 0xfbc1, 0x0325, 0x00e5, 0xfbad, 0x032c, 0x00c5, 0xfbc1, 0x0330,
-    0x00f6, 0xfbcd, 0x032e, 0x00de, 0xfbc2, 0x031a, 0x00c3, 0xfbcd, 0x031f, 0x00f4, 0xfbd9, 0x0318, 0x00dd, 0xfbd1,
-    0x0024, 0x0014, 0x0002, 0x0185, 0x00c7, 0xfd12, 0x0027, 0x03f5, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0189, 0x00a4, 0xfd01, 0x0178, 0x00a4, 0xfd0d, 0x0170, 0x00c8,
-    0xfd12, 0x0181, 0x00e9, 0xfd1c, 0x0192, 0x00ea, 0xfd10, 0x018e, 0x00ca, 0xfcfc, 0x0195, 0x00aa, 0xfd11, 0x019b,
-    0x00db, 0xfd1b, 0x0198, 0x00c4, 0xfd12, 0x0184, 0x00a9, 0xfd1d, 0x018a, 0x00da, 0xfd28, 0x0183, 0x00c3, 0xfd21,
-    0x0024, 0x0014, 0x0002, 0xffa6, 0x00c7, 0xfd90, 0x0028, 0x03f6, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xffb0, 0x00a4, 0xfd85, 0xff9c, 0x00a4, 0xfd7e, 0xff95, 0x00ca,
-    0xfd7b, 0xff99, 0x00ea, 0xfd8f, 0xffad, 0x00e9, 0xfd96, 0xffb9, 0x00c8, 0xfd87, 0xffa9, 0x00a9, 0xfd98, 0xffa7,
-    0x00db, 0xfda4, 0xffac, 0x00c3, 0xfd9b, 0xff96, 0x00aa, 0xfd92, 0xff94, 0x00db, 0xfd9d, 0xff93, 0x00c4, 0xfd93,
-    0x0024, 0x0014, 0x0002, 0xfc23, 0x0109, 0xfb7e, 0x0029, 0x03fc, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfc2a, 0x00e6, 0xfb70, 0xfc16, 0x00e7, 0xfb6b, 0xfc11, 0x010d,
-    0xfb6a, 0xfc17, 0x012c, 0xfb7e, 0xfc2b, 0x012a, 0xfb83, 0xfc35, 0x010a, 0xfb73, 0xfc26, 0x00eb, 0xfb84, 0xfc27,
-    0x011c, 0xfb91, 0xfc2a, 0x0104, 0xfb87, 0xfc12, 0x00ed, 0xfb7f, 0xfc12, 0x011e, 0xfb8c, 0xfc11, 0x0106, 0xfb81,
-    0x0024, 0x0014, 0x0002, 0xfa23, 0x0133, 0xfbad, 0x0026, 0x03fd, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfa22, 0x0111, 0xfb9c, 0xfa10, 0x0112, 0xfba7, 0xfa0d, 0x0138,
-    0xfbad, 0xfa21, 0x0156, 0xfbb7, 0xfa32, 0x0155, 0xfbac, 0xfa2c, 0x0135, 0xfb97, 0xfa2d, 0x0115, 0xfbac, 0xfa39,
-    0x0145, 0xfbb8, 0xfa33, 0x012e, 0xfbad, 0xfa1c, 0x0117, 0xfbb8, 0xfa28, 0x0147, 0xfbc3, 0xfa1e, 0x0130, 0xfbbc,
-    0x0024, 0x0014, 0x0002, 0xf9a6, 0x0137, 0xfd8d, 0x0028, 0x03fe, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xf991, 0x0116, 0xfd81, 0xf995, 0x0115, 0xfd95, 0xf99a, 0x0139,
-    0xfd9f, 0xf9ad, 0x0158, 0xfd94, 0xf9aa, 0x0159, 0xfd80, 0xf993, 0x013b, 0xfd7a, 0xf9a5, 0x011a, 0xfd7d, 0xf9b7,
-    0x0149, 0xfd7d, 0xf9aa, 0x0133, 0xfd7b, 0xf9a9, 0x0119, 0xfd92, 0xf9ba, 0x0148, 0xfd91, 0xf9ae, 0x0132, 0xfd95,
-    0x0024, 0x0014, 0x0002, 0xfa2d, 0x0106, 0xff89, 0x0028, 0x03ff, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfa17, 0x00e6, 0xff7c, 0xfa1d, 0x00e3, 0xff90, 0xfa23, 0x0107,
-    0xff9c, 0xfa36, 0x0126, 0xff92, 0xfa30, 0x0129, 0xff7e, 0xfa19, 0x010b, 0xff78, 0xfa2b, 0x00ea, 0xff77, 0xfa3d,
-    0x0119, 0xff78, 0xfa2f, 0x0103, 0xff76, 0xfa30, 0x00e7, 0xff8b, 0xfa42, 0x0116, 0xff8c, 0xfa37, 0x00ff, 0xff8f,
-    0x0024, 0x0014, 0x0002, 0xfab0, 0x00af, 0x017f, 0x0028, 0x0400, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfa9a, 0x0090, 0x0171, 0xfa9f, 0x008c, 0x0185, 0xfaa6, 0x00af,
-    0x0192, 0xfaba, 0x00ce, 0x018b, 0xfab5, 0x00d2, 0x0177, 0xfa9d, 0x00b6, 0x016f, 0xfaae, 0x0094, 0x016c, 0xfac1,
-    0x00c3, 0x0171, 0xfab4, 0x00ad, 0x016d, 0xfab3, 0x0090, 0x0180, 0xfac6, 0x00bf, 0x0185, 0xfaba, 0x00a8, 0x0186,
-    0x0024, 0x0014, 0x0002, 0xfbe7, 0x0000, 0x0560, 0x0027, 0x0406, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfbd1, 0xffe1, 0x0555, 0xfbd9, 0xffde, 0x0568, 0xfbe0, 0x0000,
-    0x0573, 0xfbf1, 0x0020, 0x0568, 0xfbe9, 0x0023, 0x0555, 0xfbd2, 0x0005, 0x0551, 0xfbe4, 0xffe5, 0x054e, 0xfbf5,
-    0x0013, 0x054e, 0xfbe8, 0xfffe, 0x054d, 0xfbec, 0xffe2, 0x0561, 0xfbfd, 0x0011, 0x0561, 0xfbf2, 0xfffb, 0x0565,
-    0x0024, 0x0014, 0x0002, 0xfcbc, 0xffc3, 0x073f, 0x0028, 0x0407, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfca6, 0xffa2, 0x0736, 0xfcaf, 0xffa0, 0x0748, 0xfcb6, 0xffc4,
-    0x0753, 0xfcc6, 0xffe4, 0x0746, 0xfcbd, 0xffe6, 0x0733, 0xfca6, 0xffc8, 0x0731, 0xfcb9, 0xffa7, 0x072d, 0xfcc9,
-    0xffd6, 0x072b, 0xfcbd, 0xffc0, 0x072c, 0xfcc2, 0xffa4, 0x0740, 0xfcd2, 0xffd4, 0x073e, 0xfcc8, 0xffbd, 0x0743,
-    0x0024, 0x0014, 0x0002, 0xfd9c, 0xff8a, 0x0919, 0x0027, 0x0408, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfd86, 0xff6a, 0x0910, 0xfd8f, 0xff67, 0x0923, 0xfd96, 0xff8b,
-    0x092d, 0xfda6, 0xffab, 0x0921, 0xfd9d, 0xffad, 0x090e, 0xfd86, 0xff8f, 0x090c, 0xfd99, 0xff6e, 0x0908, 0xfda9,
-    0xff9e, 0x0906, 0xfd9d, 0xff87, 0x0907, 0xfda2, 0xff6c, 0x091b, 0xfdb2, 0xff9c, 0x0919, 0xfda8, 0xff85, 0x091e,
-    0x0024, 0x0014, 0x0002, 0xfe75, 0xff4c, 0x0af7, 0x0028, 0x0409, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfe5f, 0xff2c, 0x0aed, 0xfe67, 0xff29, 0x0b00, 0xfe6e, 0xff4d,
-    0x0b0b, 0xfe7f, 0xff6d, 0x0aff, 0xfe77, 0xff6f, 0x0aec, 0xfe5f, 0xff52, 0x0ae9, 0xfe72, 0xff30, 0x0ae5, 0xfe83,
-    0xff60, 0x0ae4, 0xfe76, 0xff49, 0x0ae4, 0xfe7a, 0xff2d, 0x0af8, 0xfe8b, 0xff5d, 0x0af7, 0xfe80, 0xff46, 0x0afc,
-    0x0024, 0x0014, 0x0002, 0xff42, 0xff01, 0x0cd8, 0x0029, 0x040a, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xff2b, 0xfee1, 0x0ccc, 0xff34, 0xfede, 0x0cdf, 0xff3b, 0xff01,
-    0x0ceb, 0xff4c, 0xff21, 0x0ce1, 0xff44, 0xff24, 0x0cce, 0xff2d, 0xff07, 0x0cca, 0xff3f, 0xfee5, 0x0cc5, 0xff50,
-    0xff15, 0x0cc6, 0xff43, 0xfeff, 0x0cc5, 0xff47, 0xfee2, 0x0cd8, 0xff58, 0xff11, 0x0cd9, 0xff4d, 0xfefa, 0x0cdc,
-    0x0024, 0x0014, 0x0002, 0x0159, 0xfe3b, 0x103c, 0x0026, 0x0410, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0145, 0xfe1a, 0x103b, 0x0156, 0xfe16, 0x1047, 0x0161, 0xfe39,
-    0x1051, 0x0169, 0xfe5b, 0x1042, 0x0158, 0xfe5f, 0x1037, 0x0143, 0xfe40, 0x103c, 0x0151, 0xfe20, 0x102b, 0x015f,
-    0xfe51, 0x1028, 0x0154, 0xfe3a, 0x102c, 0x0162, 0xfe1c, 0x1037, 0x0170, 0xfe4d, 0x1034, 0x0169, 0xfe35, 0x103a,
-    0x0024, 0x0014, 0x0002, 0x034e, 0xfdf3, 0x1075, 0x0026, 0x0411, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0341, 0xfdd0, 0x1080, 0x0355, 0xfdcf, 0x1079, 0x0361, 0xfdf3,
-    0x107c, 0x0357, 0xfe16, 0x1072, 0x0344, 0xfe17, 0x1079, 0x033e, 0xfdf5, 0x1088, 0x033b, 0xfdd9, 0x106e, 0x033d,
-    0xfe0b, 0x1069, 0x033b, 0xfdf3, 0x1070, 0x034f, 0xfdd8, 0x1067, 0x0351, 0xfe0a, 0x1062, 0x0354, 0xfdf1, 0x1067,
-    0x0024, 0x0014, 0x0002, 0x04cf, 0xfded, 0x0f21, 0x0026, 0x0412, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x04cf, 0xfdc9, 0x0f2a, 0x04da, 0xfdc9, 0x0f18, 0x04e3, 0xfdee,
-    0x0f15, 0x04d4, 0xfe11, 0x0f17, 0x04ca, 0xfe10, 0x0f29, 0x04d0, 0xfded, 0x0f35, 0x04bf, 0xfdd2, 0x0f21, 0x04bb,
-    0xfe05, 0x0f20, 0x04bf, 0xfdec, 0x0f24, 0x04c9, 0xfdd3, 0x0f0f, 0x04c6, 0xfe05, 0x0f0e, 0x04cc, 0xfdec, 0x0f0e,
-    0x0024, 0x0014, 0x0002, 0x057c, 0xfe06, 0x0d32, 0x0027, 0x0413, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0582, 0xfde2, 0x0d39, 0x0586, 0xfde3, 0x0d24, 0x058d, 0xfe08,
-    0x0d20, 0x057f, 0xfe2a, 0x0d27, 0x057b, 0xfe29, 0x0d3c, 0x0586, 0xfe05, 0x0d44, 0x056f, 0xfdeb, 0x0d36, 0x056b,
-    0xfe1d, 0x0d38, 0x0570, 0xfe04, 0x0d3a, 0x0573, 0xfdec, 0x0d21, 0x056e, 0xfe1e, 0x0d24, 0x0575, 0xfe05, 0x0d21,
-    0x0024, 0x0014, 0x0002, 0x05ab, 0xfe2d, 0x0b23, 0x0026, 0x0414, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x05b4, 0xfe09, 0x0b2b, 0x05b5, 0xfe0a, 0x0b16, 0x05bb, 0xfe30,
-    0x0b11, 0x05ae, 0xfe51, 0x0b1c, 0x05ad, 0xfe50, 0x0b31, 0x05ba, 0xfe2c, 0x0b36, 0x05a1, 0xfe11, 0x0b2b, 0x059c,
-    0xfe43, 0x0b30, 0x05a3, 0xfe2b, 0x0b30, 0x05a2, 0xfe13, 0x0b17, 0x059d, 0xfe45, 0x0b1b, 0x05a3, 0xfe2d, 0x0b16,
-    0x0024, 0x0014, 0x0002, 0x059f, 0xfe62, 0x0915, 0x0026, 0x0415, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x05a9, 0xfe3d, 0x091c, 0x05a8, 0xfe3f, 0x0907, 0x05ad, 0xfe64,
-    0x0903, 0x05a1, 0xfe86, 0x0910, 0x05a2, 0xfe83, 0x0925, 0x05af, 0xfe60, 0x0928, 0x0596, 0xfe45, 0x091e, 0x0591,
-    0xfe77, 0x0924, 0x0597, 0xfe5e, 0x0924, 0x0595, 0xfe47, 0x0909, 0x0590, 0xfe79, 0x090f, 0x0596, 0xfe61, 0x090a,
-    0x0024, 0x0014, 0x0002, 0x0579, 0xfea8, 0x070b, 0x0026, 0x0416, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0583, 0xfe83, 0x0711, 0x0581, 0xfe86, 0x06fc, 0x0586, 0xfeab,
-    0x06f9, 0x057a, 0xfecc, 0x0708, 0x057c, 0xfec9, 0x071c, 0x058a, 0xfea6, 0x071e, 0x0570, 0xfe8b, 0x0714, 0x056b,
-    0xfebd, 0x071c, 0x0571, 0xfea4, 0x071a, 0x056e, 0xfe8e, 0x06ff, 0x0569, 0xfec0, 0x0707, 0x056f, 0xfea8, 0x0700,
-    0x0024, 0x0014, 0x0002, 0x0539, 0xff0d, 0x050a, 0x0026, 0x0417, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0543, 0xfee8, 0x050b, 0x053f, 0xfeec, 0x04f7, 0x0543, 0xff12,
-    0x04f7, 0x0539, 0xff31, 0x0509, 0x053d, 0xff2d, 0x051d, 0x054b, 0xff0a, 0x051a, 0x0530, 0xfef0, 0x0511, 0x052c,
-    0xff20, 0x051d, 0x0532, 0xff08, 0x0519, 0x052c, 0xfef4, 0x04fd, 0x0528, 0xff25, 0x050a, 0x052d, 0xff0e, 0x0500,
-    0x0024, 0x0014, 0x0002, 0x023e, 0xff87, 0x02c0, 0x0028, 0x041a, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0249, 0xff64, 0x02b1, 0x0234, 0xff65, 0x02ad, 0x022c, 0xff8a,
-    0x02ad, 0x0230, 0xffa9, 0x02c2, 0x0245, 0xffa9, 0x02c6, 0x0251, 0xff89, 0x02b5, 0x0244, 0xff69, 0x02c5, 0x0242,
-    0xff99, 0x02d4, 0x0246, 0xff82, 0x02ca, 0x0230, 0xff69, 0x02c1, 0x022d, 0xff99, 0x02d0, 0x022d, 0xff83, 0x02c4,
-    0x0024, 0x0014, 0x0002, 0x0036, 0xff91, 0x0260, 0x0028, 0x041b, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0040, 0xff6e, 0x0250, 0x002c, 0xff6f, 0x024d, 0x0024, 0xff94,
-    0x024e, 0x002a, 0xffb3, 0x0263, 0x003f, 0xffb2, 0x0266, 0x0049, 0xff93, 0x0253, 0x003d, 0xff73, 0x0265, 0x003c,
-    0xffa3, 0x0274, 0x0040, 0xff8c, 0x0269, 0x0029, 0xff73, 0x0261, 0x0028, 0xffa4, 0x0271, 0x0026, 0xff8d, 0x0265,
-    0x0024, 0x0014, 0x0002, 0xfe2a, 0xffa1, 0x0225, 0x0028, 0x041c, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfe34, 0xff7e, 0x0214, 0xfe1f, 0xff7f, 0x0213, 0xfe17, 0xffa4,
-    0x0215, 0xfe1f, 0xffc3, 0x0229, 0xfe34, 0xffc2, 0x022a, 0xfe3c, 0xffa3, 0x0216, 0xfe33, 0xff83, 0x0228, 0xfe33,
-    0xffb3, 0x0238, 0xfe36, 0xff9c, 0x022d, 0xfe1e, 0xff83, 0x0228, 0xfe1e, 0xffb3, 0x0237, 0xfe1c, 0xff9c, 0x022b,
-    0x0024, 0x0014, 0x0002, 0xfc21, 0xff91, 0x026b, 0x0028, 0x041d, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfc2a, 0xff70, 0x0256, 0xfc18, 0xff6e, 0x025f, 0xfc0d, 0xff92,
-    0x0266, 0xfc19, 0xffb2, 0x0275, 0xfc2c, 0xffb4, 0x026c, 0xfc2e, 0xff96, 0x0256, 0xfc33, 0xff75, 0x0269, 0xfc34,
-    0xffa5, 0x0278, 0xfc34, 0xff8f, 0x026c, 0xfc20, 0xff73, 0x0272, 0xfc21, 0xffa3, 0x0281, 0xfc1c, 0xff8c, 0x0277,
-    0x0024, 0x0014, 0x0002, 0xfab0, 0xfe90, 0x05f1, 0x0025, 0x0424, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfaac, 0xfe6f, 0x05df, 0xfaa9, 0xfe6b, 0x05f3, 0xfaa0, 0xfe8c,
-    0x0602, 0xfaab, 0xfeb0, 0x0604, 0xfaae, 0xfeb5, 0x05ef, 0xfaa5, 0xfe95, 0x05de, 0xfabe, 0xfe78, 0x05e4, 0xfac0,
-    0xfeaa, 0x05ef, 0xfabb, 0xfe92, 0x05e7, 0xfabb, 0xfe74, 0x05f8, 0xfabd, 0xfea5, 0x0604, 0xfab8, 0xfe8c, 0x0600,
-    0x0024, 0x0014, 0x0002, 0xfa53, 0xfe36, 0x07ee, 0x0026, 0x0425, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfa4f, 0xfe13, 0x07e1, 0xfa4b, 0xfe11, 0x07f5, 0xfa41, 0xfe34,
-    0x0800, 0xfa4e, 0xfe58, 0x07ff, 0xfa53, 0xfe5a, 0x07eb, 0xfa4a, 0xfe38, 0x07dc, 0xfa61, 0xfe1c, 0x07e6, 0xfa64,
-    0xfe4e, 0x07ed, 0xfa5f, 0xfe36, 0x07e6, 0xfa5d, 0xfe1a, 0x07fb, 0xfa5f, 0xfe4c, 0x0801, 0xfa5a, 0xfe33, 0x0800,
-    0x0024, 0x0014, 0x0002, 0xf9d3, 0xfe14, 0x09ec, 0x0026, 0x0426, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xf9ce, 0xfdf0, 0x09e3, 0xf9c9, 0xfdf0, 0x09f7, 0xf9c1, 0xfe14,
-    0x09fe, 0xf9cf, 0xfe37, 0x09fa, 0xf9d3, 0xfe37, 0x09e5, 0xf9c9, 0xfe15, 0x09da, 0xf9e0, 0xfdf9, 0x09e7, 0xf9e4,
-    0xfe2c, 0x09e9, 0xf9df, 0xfe13, 0x09e5, 0xf9dc, 0xfdf9, 0x09fc, 0xf9df, 0xfe2b, 0x09fd, 0xf9d9, 0xfe12, 0x09fe,
-    0x0024, 0x0014, 0x0002, 0xf9d8, 0xfe21, 0x0bf6, 0x0026, 0x0427, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xf9cd, 0xfdfd, 0x0bef, 0xf9d7, 0xfdfe, 0x0c02, 0xf9d5, 0xfe22,
-    0x0c0a, 0xf9dc, 0xfe45, 0x0bfc, 0xf9d2, 0xfe44, 0x0be9, 0xf9c4, 0xfe21, 0x0be9, 0xf9de, 0xfe05, 0x0be6, 0xf9e2,
-    0xfe37, 0x0be2, 0xf9db, 0xfe1e, 0x0be3, 0xf9e8, 0xfe06, 0x0bf9, 0xf9eb, 0xfe38, 0x0bf4, 0xf9e7, 0xfe20, 0x0bfa,
-    0x0024, 0x0014, 0x0002, 0xfba2, 0xfe17, 0x0cb5, 0x0026, 0x0428, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfb95, 0xfdf4, 0x0cbf, 0xfbaa, 0xfdf2, 0x0cbe, 0xfbb5, 0xfe16,
-    0x0cc3, 0xfbae, 0xfe39, 0x0cb6, 0xfb9a, 0xfe3b, 0x0cb7, 0xfb8f, 0xfe19, 0x0cc5, 0xfb94, 0xfdfc, 0x0cac, 0xfb98,
-    0xfe2e, 0x0ca7, 0xfb94, 0xfe16, 0x0cad, 0xfba9, 0xfdfb, 0x0cab, 0xfbad, 0xfe2d, 0x0ca6, 0xfbae, 0xfe14, 0x0cac,
-    0x0024, 0x0014, 0x0002, 0xffbb, 0xfdf9, 0x0c53, 0x0026, 0x042f, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xffb1, 0xfdd5, 0x0c5c, 0xffc6, 0xfdd5, 0x0c5c, 0xffce, 0xfdfa,
-    0x0c62, 0xffc5, 0xfe1c, 0x0c55, 0xffb0, 0xfe1c, 0x0c55, 0xffa8, 0xfdf9, 0x0c62, 0xffb0, 0xfddd, 0x0c49, 0xffb0,
-    0xfe10, 0x0c44, 0xffae, 0xfdf7, 0x0c4b, 0xffc5, 0xfdde, 0x0c49, 0xffc5, 0xfe10, 0x0c44, 0xffc8, 0xfdf7, 0x0c4a,
-    0x0024, 0x0014, 0x0002, 0x01c6, 0xfe02, 0x0c6a, 0x0026, 0x0430, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x01be, 0xfdde, 0x0c72, 0x01d3, 0xfddf, 0x0c74, 0x01d9, 0xfe03,
-    0x0c7b, 0x01d2, 0xfe26, 0x0c6d, 0x01bd, 0xfe25, 0x0c6b, 0x01b4, 0xfe03, 0x0c77, 0x01c0, 0xfde7, 0x0c5f, 0x01bf,
-    0xfe19, 0x0c5a, 0x01bd, 0xfe00, 0x0c60, 0x01d5, 0xfde7, 0x0c61, 0x01d4, 0xfe1a, 0x0c5c, 0x01d7, 0xfe01, 0x0c63,
-    0x0024, 0x0014, 0x0002, 0x03cd, 0xfe12, 0x0cc7, 0x0026, 0x0431, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x03c5, 0xfdee, 0x0ccd, 0x03da, 0xfdef, 0x0cd1, 0x03df, 0xfe13,
-    0x0cd9, 0x03d8, 0xfe36, 0x0cca, 0x03c4, 0xfe35, 0x0cc6, 0x03bb, 0xfe12, 0x0cd1, 0x03c9, 0xfdf6, 0x0cba, 0x03c8,
-    0xfe29, 0x0cb5, 0x03c5, 0xfe10, 0x0cbb, 0x03dd, 0xfdf7, 0x0cbe, 0x03dc, 0xfe2a, 0x0cb9, 0x03df, 0xfe11, 0x0cc0,
-    0x0024, 0x0014, 0x0002, 0x05d7, 0xfe41, 0x0cea, 0x0026, 0x0432, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x05d5, 0xfe1c, 0x0cf5, 0x05e8, 0xfe1f, 0x0cef, 0x05eb, 0xfe45,
-    0x0cf3, 0x05da, 0xfe65, 0x0ce8, 0x05c6, 0xfe62, 0x0cee, 0x05c8, 0xfe3f, 0x0cfd, 0x05ce, 0xfe24, 0x0ce2, 0x05c4,
-    0xfe55, 0x0cdd, 0x05c8, 0xfe3c, 0x0ce4, 0x05e2, 0xfe27, 0x0cdd, 0x05d8, 0xfe58, 0x0cd8, 0x05e0, 0xfe41, 0x0cde,
-    0x0024, 0x0014, 0x0002, 0x0706, 0xfecd, 0x0b81, 0x0028, 0x0433, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x071c, 0xfeab, 0x0b82, 0x071e, 0xfeb2, 0x0b6f, 0x0716, 0xfed7,
-    0x0b72, 0x06fc, 0xfeee, 0x0b81, 0x06fa, 0xfee7, 0x0b94, 0x0713, 0xfeca, 0x0b95, 0x0707, 0xfeac, 0x0b81, 0x06ef,
-    0xfed7, 0x0b8e, 0x06fe, 0xfec2, 0x0b8b, 0x0709, 0xfeb3, 0x0b6d, 0x06f1, 0xfede, 0x0b7a, 0x0701, 0xfecb, 0x0b72,
-    0x0024, 0x0014, 0x0002, 0x0561, 0x0029, 0x0812, 0x0026, 0x0438, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0579, 0x000e, 0x0804, 0x056d, 0x0015, 0x07f5, 0x0563, 0x0037,
-    0x0801, 0x0554, 0x0048, 0x0820, 0x0560, 0x0041, 0x082f, 0x0578, 0x002a, 0x081d, 0x0568, 0x000a, 0x0810, 0x0556,
-    0x002e, 0x082e, 0x0564, 0x001e, 0x0820, 0x055c, 0x0011, 0x0800, 0x054a, 0x0035, 0x081f, 0x0555, 0x0026, 0x080c,
-    0x0024, 0x0014, 0x0002, 0x042a, 0x00e2, 0x0692, 0x0026, 0x0439, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0441, 0x00c7, 0x0683, 0x0435, 0x00cf, 0x0674, 0x042b, 0x00f1,
-    0x0682, 0x041d, 0x0101, 0x06a1, 0x0429, 0x00f9, 0x06b0, 0x0441, 0x00e3, 0x069d, 0x0431, 0x00c4, 0x068f, 0x041f,
-    0x00e7, 0x06af, 0x042c, 0x00d7, 0x06a0, 0x0424, 0x00cb, 0x0680, 0x0413, 0x00ee, 0x06a0, 0x041d, 0x00e0, 0x068d,
-    0x0024, 0x0014, 0x0002, 0x02ec, 0x019e, 0x0519, 0x0026, 0x043a, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0304, 0x0185, 0x050a, 0x02f7, 0x018c, 0x04fb, 0x02ec, 0x01ad,
-    0x0509, 0x02df, 0x01bd, 0x0528, 0x02ec, 0x01b6, 0x0537, 0x0303, 0x01a1, 0x0523, 0x02f3, 0x0180, 0x0516, 0x02e2,
-    0x01a4, 0x0536, 0x02ef, 0x0194, 0x0527, 0x02e6, 0x0188, 0x0507, 0x02d5, 0x01ab, 0x0528, 0x02df, 0x019d, 0x0514,
-    0x0024, 0x0014, 0x0002, 0x018d, 0x023a, 0x03b0, 0x0026, 0x043b, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x01a4, 0x0222, 0x03a0, 0x0195, 0x0226, 0x0393, 0x0189, 0x0248,
-    0x03a0, 0x017d, 0x0258, 0x03c0, 0x018c, 0x0254, 0x03cd, 0x01a4, 0x023f, 0x03b8, 0x0196, 0x021d, 0x03af, 0x0185,
-    0x0240, 0x03ce, 0x0192, 0x0230, 0x03be, 0x0187, 0x0221, 0x03a1, 0x0176, 0x0245, 0x03c1, 0x017f, 0x0236, 0x03ad,
-    0x0024, 0x0014, 0x0002, 0xffef, 0x0284, 0x0276, 0x0026, 0x043c, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0005, 0x026e, 0x0264, 0xfff5, 0x026f, 0x0258, 0xffe5, 0x028f,
-    0x0265, 0xffdb, 0x02a1, 0x0285, 0xffed, 0x02a0, 0x0290, 0x0003, 0x028d, 0x0279, 0xfffb, 0x0268, 0x0274, 0xffe9,
-    0x028c, 0x0294, 0xfff6, 0x027d, 0x0283, 0xffea, 0x026a, 0x0269, 0xffd8, 0x028d, 0x0288, 0xffe0, 0x027e, 0x0275,
-    0x0024, 0x0014, 0x0002, 0xfc58, 0x0250, 0x0075, 0x0026, 0x0442, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfc70, 0x023b, 0x0063, 0xfc5e, 0x0239, 0x0058, 0xfc4b, 0x0258,
-    0x0063, 0xfc40, 0x026b, 0x0082, 0xfc52, 0x026d, 0x008d, 0xfc6b, 0x025b, 0x0076, 0xfc66, 0x0235, 0x0074, 0xfc51,
-    0x0258, 0x0092, 0xfc5f, 0x024a, 0x0082, 0xfc54, 0x0234, 0x006a, 0xfc3f, 0x0257, 0x0087, 0xfc49, 0x0248, 0x0075,
-    0x0024, 0x0014, 0x0002, 0xfad1, 0x024e, 0xff1e, 0x0026, 0x0443, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfaed, 0x0237, 0xff17, 0xfae3, 0x023a, 0xff05, 0xfad1, 0x025b,
-    0xff0b, 0xfaba, 0x026c, 0xff24, 0xfac5, 0x0269, 0xff36, 0xfae3, 0x0255, 0xff2b, 0xfadb, 0x0231, 0xff20, 0xfabf,
-    0x0255, 0xff36, 0xfad1, 0x0245, 0xff2c, 0xfad1, 0x0234, 0xff0e, 0xfab4, 0x0258, 0xff24, 0xfac4, 0x0249, 0xff16,
-    0x0024, 0x0014, 0x0002, 0xfa9b, 0x02d1, 0xfd30, 0x0027, 0x0444, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfab3, 0x02b3, 0xfd35, 0xfab6, 0x02b8, 0xfd21, 0xfaa9, 0x02dc,
-    0xfd20, 0xfa8b, 0x02f1, 0xfd29, 0xfa88, 0x02eb, 0xfd3d, 0xfaa4, 0x02d3, 0xfd43, 0xfa9f, 0x02b1, 0xfd31, 0xfa80,
-    0x02d9, 0xfd37, 0xfa92, 0x02c7, 0xfd38, 0xfaa2, 0x02b6, 0xfd1d, 0xfa83, 0x02de, 0xfd23, 0xfa96, 0x02cd, 0xfd1f,
-    0x0024, 0x0014, 0x0002, 0xfb24, 0x0327, 0xfb3c, 0x0026, 0x0445, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfb35, 0x030a, 0xfb4e, 0xfb3f, 0x030b, 0xfb3c, 0xfb38, 0x032f,
-    0xfb31, 0xfb1c, 0x0347, 0xfb2c, 0xfb11, 0x0345, 0xfb3e, 0xfb25, 0x032c, 0xfb51, 0xfb23, 0x0308, 0xfb43, 0xfb09,
-    0x0333, 0xfb38, 0xfb17, 0x0320, 0xfb42, 0xfb2d, 0x030a, 0xfb31, 0xfb14, 0x0334, 0xfb26, 0xfb25, 0x0321, 0xfb2b,
-    0x0024, 0x0014, 0x0002, 0xfefd, 0x0321, 0xfa4a, 0x0027, 0x044c, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfef3, 0x0304, 0xfa62, 0xff08, 0x0304, 0xfa62, 0xff0f, 0x0327,
-    0xfa56, 0xff06, 0x0340, 0xfa3b, 0xfef2, 0x0340, 0xfa3c, 0xfeea, 0x0327, 0xfa57, 0xfef2, 0x0303, 0xfa4d, 0xfef1,
-    0x032d, 0xfa32, 0xfeef, 0x031a, 0xfa43, 0xff07, 0x0303, 0xfa4d, 0xff06, 0x032d, 0xfa31, 0xff09, 0x031a, 0xfa42,
-    0x0024, 0x0014, 0x0002, 0x010b, 0x031f, 0xfa3e, 0x0027, 0x044d, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0101, 0x0302, 0xfa56, 0x0116, 0x0302, 0xfa56, 0x011e, 0x0325,
-    0xfa4b, 0x0116, 0x033e, 0xfa2f, 0x0101, 0x033e, 0xfa2f, 0x00f9, 0x0325, 0xfa4b, 0x0101, 0x0301, 0xfa41, 0x0101,
-    0x032b, 0xfa26, 0x00fe, 0x0318, 0xfa37, 0x0115, 0x0301, 0xfa41, 0x0116, 0x032b, 0xfa26, 0x0118, 0x0318, 0xfa37,
-    0x0024, 0x0014, 0x0002, 0x0317, 0x0309, 0xfa5e, 0x0027, 0x044e, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0306, 0x02ee, 0xfa73, 0x031a, 0x02eb, 0xfa78, 0x0329, 0x030d,
-    0xfa6f, 0x032a, 0x0326, 0xfa53, 0x0316, 0x0329, 0xfa4e, 0x0305, 0x0311, 0xfa66, 0x030a, 0x02ec, 0xfa5e, 0x0316,
-    0x0316, 0xfa44, 0x030d, 0x0304, 0xfa54, 0x031f, 0x02ea, 0xfa63, 0x032a, 0x0313, 0xfa49, 0x0326, 0x0300, 0xfa5a,
-    0x0024, 0x0014, 0x0002, 0x052f, 0x01d1, 0xfd78, 0x0028, 0x0456, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x050f, 0x01c2, 0xfd6e, 0x0515, 0x01bb, 0xfd81, 0x052e, 0x01d6,
-    0xfd8b, 0x054d, 0x01e7, 0xfd7f, 0x0548, 0x01ee, 0xfd6c, 0x0524, 0x01e1, 0xfd69, 0x0522, 0x01bb, 0xfd66, 0x054a,
-    0x01da, 0xfd65, 0x0533, 0x01ce, 0xfd65, 0x0527, 0x01b5, 0xfd79, 0x054f, 0x01d4, 0xfd78, 0x053a, 0x01c6, 0xfd7d,
-    0x0024, 0x0014, 0x0002, 0x05a9, 0x013d, 0xff64, 0x0027, 0x0457, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x058a, 0x012e, 0xff58, 0x058e, 0x0129, 0xff6c, 0x05a6, 0x0144,
-    0xff76, 0x05c7, 0x0154, 0xff6b, 0x05c2, 0x0159, 0xff57, 0x059f, 0x014d, 0xff53, 0x059c, 0x0127, 0xff52, 0x05c4,
-    0x0145, 0xff52, 0x05ad, 0x013a, 0xff51, 0x05a1, 0x0121, 0xff66, 0x05c9, 0x0140, 0xff65, 0x05b3, 0x0133, 0xff6a,
-    0x0024, 0x0014, 0x0002, 0x060d, 0x00cd, 0x015c, 0x0027, 0x0458, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x05ee, 0x00be, 0x0151, 0x05f1, 0x00ba, 0x0166, 0x0609, 0x00d6,
-    0x016f, 0x062a, 0x00e6, 0x0163, 0x0626, 0x00e9, 0x014f, 0x0603, 0x00dc, 0x014b, 0x0600, 0x00b6, 0x014d, 0x0628,
-    0x00d5, 0x014b, 0x0612, 0x00c9, 0x014a, 0x0604, 0x00b2, 0x0161, 0x062c, 0x00d1, 0x015f, 0x0616, 0x00c5, 0x0164,
-    0x0024, 0x0014, 0x0002, 0x069f, 0x0070, 0x056a, 0x0026, 0x0460, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0681, 0x005e, 0x0562, 0x0683, 0x005e, 0x0576, 0x069a, 0x007c,
-    0x057d, 0x06bb, 0x008a, 0x0571, 0x06b8, 0x008a, 0x055c, 0x0696, 0x007c, 0x0558, 0x0694, 0x0056, 0x0560, 0x06bb,
-    0x0076, 0x055c, 0x06a5, 0x0069, 0x055b, 0x0696, 0x0056, 0x0574, 0x06be, 0x0075, 0x0570, 0x06a8, 0x0069, 0x0575,
-    0x0024, 0x0014, 0x0002, 0x06ce, 0x007b, 0x0776, 0x0026, 0x0461, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x06b0, 0x0068, 0x076f, 0x06b1, 0x0069, 0x0784, 0x06c8, 0x0087,
-    0x0789, 0x06e9, 0x0095, 0x077e, 0x06e8, 0x0094, 0x0769, 0x06c5, 0x0086, 0x0764, 0x06c3, 0x0061, 0x076e, 0x06eb,
-    0x0080, 0x076a, 0x06d4, 0x0073, 0x0769, 0x06c5, 0x0062, 0x0783, 0x06ec, 0x0081, 0x077f, 0x06d6, 0x0074, 0x0783,
-    0x0024, 0x0014, 0x0002, 0x06eb, 0x009e, 0x0983, 0x0027, 0x0462, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x06cd, 0x008b, 0x097d, 0x06ce, 0x008d, 0x0992, 0x06e5, 0x00ab,
-    0x0996, 0x0706, 0x00b9, 0x098c, 0x0705, 0x00b7, 0x0977, 0x06e3, 0x00a8, 0x0971, 0x06e1, 0x0083, 0x097d, 0x0708,
-    0x00a3, 0x0978, 0x06f2, 0x0096, 0x0978, 0x06e2, 0x0085, 0x0992, 0x0709, 0x00a4, 0x098d, 0x06f3, 0x0098, 0x0992,
-    0x0024, 0x0014, 0x0002, 0x06fa, 0x00db, 0x0b8e, 0x0027, 0x0463, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x06dc, 0x00c8, 0x0b89, 0x06dd, 0x00cb, 0x0b9e, 0x06f3, 0x00ea,
-    0x0ba1, 0x0714, 0x00f7, 0x0b96, 0x0714, 0x00f4, 0x0b81, 0x06f2, 0x00e4, 0x0b7c, 0x06f0, 0x00c0, 0x0b8a, 0x0717,
-    0x00df, 0x0b85, 0x0701, 0x00d3, 0x0b84, 0x06f0, 0x00c4, 0x0b9f, 0x0718, 0x00e3, 0x0b99, 0x0701, 0x00d7, 0x0b9e,
-    0x0024, 0x0014, 0x0002, 0x0704, 0x015a, 0x0d8e, 0x0026, 0x0464, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x06e6, 0x0145, 0x0d8d, 0x06e7, 0x014c, 0x0da0, 0x06fd, 0x016b,
-    0x0d9d, 0x071e, 0x0176, 0x0d90, 0x071e, 0x016e, 0x0d7c, 0x06fc, 0x015e, 0x0d7a, 0x06fa, 0x013e, 0x0d8f, 0x0721,
-    0x015b, 0x0d83, 0x070b, 0x014e, 0x0d86, 0x06fa, 0x0145, 0x0da2, 0x0722, 0x0162, 0x0d97, 0x070b, 0x0157, 0x0d9e,
-    0x0024, 0x0014, 0x0002, 0x06e0, 0x0265, 0x0f4d, 0x0025, 0x0465, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x06c7, 0x024a, 0x0f4c, 0x06c1, 0x0258, 0x0f5b, 0x06d4, 0x0277,
-    0x0f52, 0x06f7, 0x0283, 0x0f4a, 0x06fd, 0x0275, 0x0f3b, 0x06df, 0x025f, 0x0f37, 0x06d9, 0x0248, 0x0f55, 0x0700,
-    0x0267, 0x0f49, 0x06eb, 0x0258, 0x0f4b, 0x06d3, 0x0256, 0x0f64, 0x06fa, 0x0274, 0x0f58, 0x06e4, 0x0268, 0x0f5d,
-    0x0024, 0x0014, 0x0002, 0x0385, 0x0414, 0x0fdc, 0x0025, 0x046a, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x0386, 0x03ef, 0x0fdb, 0x0372, 0x03f4, 0x0fd6, 0x0376, 0x0418,
-    0x0fcb, 0x0385, 0x0439, 0x0fd6, 0x0399, 0x0434, 0x0fdb, 0x0399, 0x040f, 0x0fd4, 0x0384, 0x03fa, 0x0fed, 0x0392,
-    0x042b, 0x0fed, 0x038e, 0x0412, 0x0fe9, 0x0371, 0x0400, 0x0fe7, 0x037e, 0x0430, 0x0fe8, 0x0376, 0x0418, 0x0fe3,
-    0x0024, 0x0014, 0x0002, 0x01a7, 0x0498, 0x0f28, 0x0025, 0x046b, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0x01a8, 0x0473, 0x0f2b, 0x0196, 0x0479, 0x0f22, 0x019c, 0x049c,
-    0x0f16, 0x01a9, 0x04bd, 0x0f22, 0x01bb, 0x04b8, 0x0f2b, 0x01bd, 0x0493, 0x0f26, 0x01a4, 0x0480, 0x0f3b, 0x01b1,
-    0x04b0, 0x0f3b, 0x01ae, 0x0497, 0x0f39, 0x0191, 0x0485, 0x0f32, 0x019f, 0x04b5, 0x0f32, 0x0198, 0x049d, 0x0f2e,
-    0x0024, 0x0014, 0x0002, 0xfff3, 0x0511, 0x0e1c, 0x0026, 0x046c, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfff5, 0x04ed, 0x0e21, 0xffe4, 0x04f1, 0x0e15, 0xffed, 0x0514,
-    0x0e08, 0xfff7, 0x0536, 0x0e14, 0x0006, 0x0532, 0x0e21, 0x0009, 0x050c, 0x0e1e, 0xffed, 0x04fa, 0x0e30, 0xfffa,
-    0x052b, 0x0e2f, 0xfff8, 0x0511, 0x0e2e, 0xffdd, 0x04fe, 0x0e23, 0xffe9, 0x052f, 0x0e23, 0xffe3, 0x0516, 0x0e1e,
-    0x0024, 0x0014, 0x0002, 0xfe8e, 0x0550, 0x0ca3, 0x0026, 0x046d, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfe91, 0x052d, 0x0cb0, 0xfe87, 0x052d, 0x0c9e, 0xfe91, 0x054e,
-    0x0c8f, 0xfe92, 0x0573, 0x0c96, 0xfe9d, 0x0573, 0x0ca8, 0xfea3, 0x054e, 0x0caf, 0xfe84, 0x053b, 0x0cb8, 0xfe8c,
-    0x056c, 0x0cb2, 0xfe8d, 0x0553, 0x0cb6, 0xfe79, 0x053a, 0x0ca6, 0xfe81, 0x056c, 0x0ca0, 0xfe7f, 0x0552, 0x0c9f,
-    0x0024, 0x0014, 0x0002, 0xfe0e, 0x04f4, 0x0ab7, 0x0026, 0x046e, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfe10, 0x04d5, 0x0acc, 0xfe0f, 0x04cf, 0x0ab8, 0xfe1c, 0x04ee,
-    0x0aa6, 0xfe17, 0x0513, 0x0aa3, 0xfe18, 0x0519, 0x0ab8, 0xfe1e, 0x04f8, 0x0ac9, 0xfdff, 0x04e1, 0x0ac9, 0xfe05,
-    0x0511, 0x0abb, 0xfe06, 0x04f9, 0x0ac4, 0xfdfe, 0x04db, 0x0ab5, 0xfe04, 0x050b, 0x0aa6, 0xfe05, 0x04f2, 0x0aab,
-    0x0048, 0x0030, 0x0002, 0x05df, 0x0378, 0x0997, 0x0077, 0x0064, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f,
-    0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c,
-    0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 0x002d, 0x0033, 0x002a, 0x0033,
-    0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 0x0027, 0x002a,
-    0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e,
-    0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015,
-    0x0006, 0x0012, 0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009,
-    0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003, 0x05b2, 0x03d9, 0x0965, 0x05c0, 0x03c6, 0x0984, 0x0572, 0x03a1,
-    0x0985, 0x0592, 0x039f, 0x099c, 0x05be, 0x03b4, 0x0962, 0x0591, 0x038c, 0x0979, 0x0573, 0x0351, 0x09b0, 0x0592,
-    0x0365, 0x09ba, 0x0591, 0x0353, 0x0998, 0x05b3, 0x0318, 0x09cc, 0x05c0, 0x033c, 0x09ce, 0x05bf, 0x032a, 0x09ac,
-    0x060e, 0x0317, 0x09ca, 0x0601, 0x033c, 0x09cd, 0x0600, 0x0329, 0x09aa, 0x064d, 0x034f, 0x09aa, 0x062f, 0x0364,
-    0x09b5, 0x062e, 0x0351, 0x0993, 0x064d, 0x039f, 0x097f, 0x062f, 0x039d, 0x0997, 0x062d, 0x038b, 0x0975, 0x060d,
-    0x03d8, 0x0962, 0x0600, 0x03c6, 0x0983, 0x05ff, 0x03b4, 0x0960, 0x0048, 0x0030, 0x0002, 0x0632, 0x0015, 0xfe37,
-    0x0076, 0x0065, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045,
-    0x0039, 0x0042, 0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039,
-    0x0036, 0x0039, 0x002d, 0x0036, 0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030,
-    0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024,
-    0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018,
-    0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 0x0006, 0x000f, 0x0000, 0x000c,
-    0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003,
-    0x05fe, 0x007d, 0xfe4b, 0x0608, 0x0059, 0xfe57, 0x05c5, 0x0040, 0xfe27, 0x05df, 0x002e, 0xfe3d, 0x0612, 0x0065,
-    0xfe33, 0x05e9, 0x0039, 0xfe1a, 0x05cc, 0xffeb, 0xfe0c, 0x05e4, 0xfff1, 0xfe2a, 0x05ed, 0xfffc, 0xfe07, 0x060e,
-    0xffad, 0xfe0a, 0x0613, 0xffc5, 0xfe29, 0x061d, 0xffd0, 0xfe05, 0x0666, 0xffad, 0xfe22, 0x0652, 0xffc4, 0xfe3a,
-    0x065c, 0xffd0, 0xfe16, 0x069f, 0xffe9, 0xfe46, 0x067b, 0xfff0, 0xfe53, 0x0685, 0xfffc, 0xfe2f, 0x0698, 0x003f,
-    0xfe60, 0x0676, 0x002d, 0xfe66, 0x0680, 0x0039, 0xfe42, 0x0655, 0x007c, 0xfe62, 0x0646, 0x0059, 0xfe68, 0x0650,
-    0x0065, 0xfe44, 0x0048, 0x0030, 0x0002, 0xfdf1, 0x00de, 0xfc6a, 0x0076, 0x0066, 0x000c, 0x0045, 0x0003, 0x0042,
-    0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 0x003f, 0x0042, 0x0036, 0x003f,
-    0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 0x002d, 0x0033,
-    0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a,
-    0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021,
-    0x0015, 0x001e, 0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015,
-    0x0012, 0x0015, 0x0006, 0x0012, 0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c,
-    0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003, 0xfdcc, 0x013e, 0xfca4, 0xfde6, 0x0122, 0xfc9f,
-    0xfdab, 0x00f2, 0xfcc8, 0xfdce, 0x00eb, 0xfcb9, 0xfdc7, 0x0124, 0xfc88, 0xfdaf, 0x00ed, 0xfca1, 0xfdb3, 0x009a,
-    0xfcb4, 0xfdd4, 0x00ac, 0xfcab, 0xfdb5, 0x00ae, 0xfc93, 0xfdde, 0x006a, 0xfc75, 0xfdf3, 0x0089, 0xfc7e, 0xfdd4,
-    0x008c, 0xfc66, 0xfe15, 0x007e, 0xfc2f, 0xfe1a, 0x0098, 0xfc4c, 0xfdfb, 0x009a, 0xfc34, 0xfe36, 0x00ca, 0xfc0c,
-    0xfe31, 0x00cf, 0xfc32, 0xfe13, 0x00d1, 0xfc1b, 0xfe2e, 0x0122, 0xfc1f, 0xfe2c, 0x010e, 0xfc40, 0xfe0d, 0x0110,
-    0xfc29, 0xfe02, 0x0153, 0xfc5e, 0xfe0d, 0x0130, 0xfc6d, 0xfdee, 0x0133, 0xfc56, 0x0048, 0x0030, 0x0002, 0xfb34,
-    0x004a, 0x0371, 0x0077, 0x0067, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045,
-    0x0042, 0x0045, 0x0039, 0x0042, 0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c,
-    0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030,
-    0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027,
-    0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 0x001b, 0x001e, 0x0012, 0x001b,
-    0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 0x0006, 0x000f,
-    0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006,
-    0x0000, 0x0003, 0xfb83, 0x00a1, 0x0369, 0xfb67, 0x008c, 0x0359, 0xfba5, 0x0051, 0x0350, 0xfb7f, 0x0052, 0x0347,
-    0xfb72, 0x0085, 0x037d, 0xfb8a, 0x004b, 0x036c, 0xfb84, 0xfffd, 0x034b, 0xfb67, 0x0016, 0x0343, 0xfb73, 0x000f,
-    0x0368, 0xfb34, 0xffd6, 0x035c, 0xfb2e, 0xfffb, 0x0350, 0xfb39, 0xfff4, 0x0375, 0xfae4, 0xfff4, 0x037a, 0xfaf5,
-    0x000f, 0x0366, 0xfb00, 0x0008, 0x038a, 0xfac2, 0x0043, 0x0393, 0xfadc, 0x0048, 0x0377, 0xfae8, 0x0042, 0x039c,
-    0xfae3, 0x0097, 0x0398, 0xfaf4, 0x0085, 0x037b, 0xfaff, 0x007e, 0x03a0, 0xfb33, 0x00be, 0x0387, 0xfb2d, 0x00a1,
-    0x036e, 0xfb38, 0x009a, 0x0393, 0x0048, 0x0030, 0x0002, 0x0018, 0xfea0, 0x0eac, 0x0077, 0x0068, 0x000c, 0x0045,
-    0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 0x003f, 0x0042,
-    0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036,
-    0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a,
-    0x0021, 0x002a, 0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021,
-    0x001e, 0x0021, 0x0015, 0x001e, 0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018,
-    0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f,
-    0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003, 0x0063, 0xfef9, 0x0e98, 0x0044,
-    0xfee3, 0x0e8d, 0x0080, 0xfeaa, 0x0e76, 0x005a, 0xfeab, 0x0e75, 0x0056, 0xfedc, 0x0eae, 0x006c, 0xfea3, 0x0e96,
-    0x0061, 0xfe55, 0x0e74, 0x0043, 0xfe6e, 0x0e74, 0x0055, 0xfe66, 0x0e95, 0x0016, 0xfe2c, 0x0e93, 0x000d, 0xfe50,
-    0x0e8a, 0x001f, 0xfe49, 0x0eab, 0xffcd, 0xfe46, 0x0ec1, 0xffda, 0xfe63, 0x0eaa, 0xffec, 0xfe5c, 0x0ecc, 0xffb0,
-    0xfe95, 0x0ee2, 0xffc4, 0xfe9c, 0x0ec2, 0xffd6, 0xfe94, 0x0ee4, 0xffcf, 0xfeea, 0x0ee4, 0xffdb, 0xfed9, 0x0ec4,
-    0xffed, 0xfed1, 0x0ee5, 0x0019, 0xff13, 0x0ec5, 0x000f, 0xfef6, 0x0ead, 0x0021, 0xfeef, 0x0ecf, 0x0048, 0x0030,
-    0x0002, 0x042d, 0xff71, 0x0365, 0x0077, 0x0069, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045,
-    0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c,
-    0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033,
-    0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 0x0027, 0x002a, 0x001e, 0x0027,
-    0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 0x001b, 0x001e,
-    0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012,
-    0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009,
-    0x0000, 0x0006, 0x0000, 0x0003, 0x040e, 0xffcc, 0x03aa, 0x0427, 0xffb1, 0x03a1, 0x03f1, 0xff7d, 0x03cb, 0x0413,
-    0xff78, 0x03b8, 0x0406, 0xffb4, 0x038d, 0x03f2, 0xff7b, 0x03a4, 0x03f7, 0xff27, 0x03b1, 0x0417, 0xff3a, 0x03a5,
-    0x03f6, 0xff3e, 0x0391, 0x041d, 0xfefc, 0x036a, 0x0432, 0xff1b, 0x0373, 0x0411, 0xff1f, 0x035f, 0x044c, 0xff15,
-    0x0321, 0x0454, 0xff2e, 0x033f, 0x0433, 0xff31, 0x032b, 0x0469, 0xff65, 0x0300, 0x0468, 0xff66, 0x0327, 0x0447,
-    0xff6a, 0x0313, 0x0463, 0xffbb, 0x031b, 0x0464, 0xffa4, 0x033a, 0x0443, 0xffa8, 0x0326, 0x043d, 0xffe6, 0x0361,
-    0x0449, 0xffc3, 0x036d, 0x0428, 0xffc7, 0x0359, 0x0048, 0x0030, 0x0002, 0xfb04, 0xff14, 0x03fa, 0x0077, 0x006a,
-    0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042,
-    0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039,
-    0x002d, 0x0036, 0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d,
-    0x0024, 0x002a, 0x0021, 0x002a, 0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021,
-    0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018,
-    0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f,
-    0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003, 0xfb32, 0xff79,
-    0x0425, 0xfb2a, 0xff61, 0x0407, 0xfb6f, 0xff35, 0x0420, 0xfb55, 0xff31, 0x0404, 0xfb20, 0xff57, 0x042b, 0xfb4c,
-    0xff27, 0x0428, 0xfb6d, 0xfedf, 0x0406, 0xfb54, 0xfef3, 0x03f1, 0xfb4a, 0xfee8, 0x0415, 0xfb2d, 0xfea7, 0x03e5,
-    0xfb26, 0xfecc, 0x03d9, 0xfb1d, 0xfec1, 0x03fd, 0xfad5, 0xfeb0, 0x03d0, 0xfae7, 0xfed2, 0x03ca, 0xfade, 0xfec7,
-    0x03ee, 0xfa99, 0xfef3, 0x03d4, 0xfabc, 0xff02, 0x03cd, 0xfab2, 0xfef7, 0x03f1, 0xfa9b, 0xff4a, 0x03ef, 0xfabd,
-    0xff40, 0x03e0, 0xfab4, 0xff35, 0x0404, 0xfada, 0xff81, 0x0410, 0xfaeb, 0xff67, 0x03f8, 0xfae1, 0xff5d, 0x041c,
-    0x0048, 0x0030, 0x0002, 0xfdad, 0xfdf7, 0x0c76, 0x0076, 0x006b, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f,
-    0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c,
-    0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 0x002d, 0x0033, 0x002a, 0x0033,
-    0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 0x0027, 0x002a,
-    0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e,
-    0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015,
-    0x0006, 0x0012, 0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009,
-    0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003, 0xfda9, 0xfe60, 0x0c3f, 0xfd96, 0xfe42, 0x0c51, 0xfda0, 0xfe1a,
-    0x0c06, 0xfd91, 0xfe10, 0x0c28, 0xfdbd, 0xfe41, 0x0c4d, 0xfdb7, 0xfe0f, 0x0c24, 0xfd9f, 0xfdc0, 0x0c0f, 0xfd90,
-    0xfdd0, 0x0c2e, 0xfdb6, 0xfdcf, 0x0c2a, 0xfda6, 0xfd86, 0x0c54, 0xfd94, 0xfda6, 0x0c60, 0xfdbb, 0xfda6, 0x0c5c,
-    0xfdb0, 0xfd8f, 0x0cae, 0xfd9c, 0xfdad, 0x0ca1, 0xfdc2, 0xfdac, 0x0c9c, 0xfdb8, 0xfdd4, 0x0ce7, 0xfda2, 0xfddf,
-    0x0cc9, 0xfdc8, 0xfdde, 0x0cc5, 0xfdb9, 0xfe2f, 0x0cde, 0xfda2, 0xfe1f, 0x0cc3, 0xfdc9, 0xfe1e, 0x0cbf, 0xfdb3,
-    0xfe68, 0x0c99, 0xfd9e, 0xfe49, 0x0c91, 0xfdc4, 0xfe48, 0x0c8d, 0x0048, 0x0030, 0x0002, 0x0681, 0xff77, 0x09a9,
-    0x0076, 0x006c, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045,
-    0x0039, 0x0042, 0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039,
-    0x0036, 0x0039, 0x002d, 0x0036, 0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030,
-    0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024,
-    0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018,
-    0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 0x0006, 0x000f, 0x0000, 0x000c,
-    0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003,
-    0x0631, 0xffae, 0x09ed, 0x0651, 0xff98, 0x09e9, 0x0619, 0xff59, 0x09d8, 0x0640, 0xff5b, 0x09db, 0x063f, 0xffa4,
-    0x09ca, 0x062e, 0xff68, 0x09bb, 0x063e, 0xff15, 0x09a8, 0x065a, 0xff2b, 0x09b8, 0x0648, 0xff37, 0x0999, 0x068b,
-    0xff0b, 0x0979, 0x0691, 0xff24, 0x0996, 0x067f, 0xff30, 0x0976, 0x06d2, 0xff40, 0x0966, 0x06c4, 0xff49, 0x0989,
-    0x06b2, 0xff56, 0x0969, 0x06ea, 0xff95, 0x097a, 0x06d5, 0xff86, 0x0997, 0x06c3, 0xff93, 0x0977, 0x06c4, 0xffd9,
-    0x09aa, 0x06ba, 0xffb6, 0x09ba, 0x06a8, 0xffc3, 0x099a, 0x0678, 0xffe3, 0x09da, 0x0684, 0xffbe, 0x09dc, 0x0671,
-    0xffca, 0x09bc, 0x0048, 0x0030, 0x0002, 0xfe26, 0x0279, 0x016f, 0x0077, 0x006d, 0x000c, 0x0045, 0x0003, 0x0042,
-    0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 0x003f, 0x0042, 0x0036, 0x003f,
-    0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 0x002d, 0x0033,
-    0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a,
-    0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021,
-    0x0015, 0x001e, 0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015,
-    0x0012, 0x0015, 0x0006, 0x0012, 0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c,
-    0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003, 0xfdf0, 0x02a6, 0x01cf, 0xfe10, 0x029b, 0x01bd,
-    0xfdf6, 0x024c, 0x01d1, 0xfe14, 0x025a, 0x01bf, 0xfdee, 0x0298, 0x01ab, 0xfdf2, 0x0258, 0x01ac, 0xfe18, 0x020c,
-    0x019a, 0xfe2d, 0x022d, 0x0197, 0xfe0b, 0x022a, 0x0185, 0xfe42, 0x020d, 0x014a, 0xfe4b, 0x022d, 0x015e, 0xfe29,
-    0x022b, 0x014c, 0xfe5c, 0x024e, 0x0110, 0xfe5e, 0x025b, 0x0134, 0xfe3b, 0x0259, 0x0122, 0xfe56, 0x02a8, 0x010e,
-    0xfe5a, 0x029c, 0x0132, 0xfe37, 0x029a, 0x0120, 0xfe34, 0x02e7, 0x0145, 0xfe41, 0x02ca, 0x015a, 0xfe1f, 0x02c7,
-    0x0148, 0xfe0a, 0x02e7, 0x0195, 0xfe23, 0x02c9, 0x0193, 0xfe01, 0x02c7, 0x0181, 0x0048, 0x0030, 0x0002, 0xfcee,
-    0x0320, 0xfa69, 0x0077, 0x006e, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045,
-    0x0042, 0x0045, 0x0039, 0x0042, 0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c,
-    0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030,
-    0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027,
-    0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 0x001b, 0x001e, 0x0012, 0x001b,
-    0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 0x0006, 0x000f,
-    0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006,
-    0x0000, 0x0003, 0xfce4, 0x0364, 0xfa08, 0xfcd4, 0x0351, 0xfa25, 0xfce1, 0x030b, 0xf9f5, 0xfcd1, 0x0312, 0xfa18,
-    0xfcfa, 0x0351, 0xfa21, 0xfcf8, 0x0311, 0xfa14, 0xfce5, 0x02bf, 0xfa26, 0xfcd4, 0x02db, 0xfa3b, 0xfcfb, 0x02db,
-    0xfa37, 0xfcee, 0x02ac, 0xfa7e, 0xfcda, 0x02ce, 0xfa7a, 0xfd01, 0x02cd, 0xfa76, 0xfcf7, 0x02dd, 0xfaca, 0xfce1,
-    0x02f1, 0xfab0, 0xfd07, 0x02f0, 0xfaac, 0xfcfa, 0x0336, 0xfadc, 0xfce3, 0x0330, 0xfabe, 0xfd0a, 0x0330, 0xfaba,
-    0xfcf6, 0x0382, 0xfaab, 0xfce0, 0x0367, 0xfa9b, 0xfd07, 0x0366, 0xfa96, 0xfced, 0x0395, 0xfa53, 0xfcda, 0x0374,
-    0xfa5b, 0xfd00, 0x0374, 0xfa57, 0x0048, 0x0030, 0x0002, 0x0486, 0x027a, 0xfb9f, 0x0077, 0x006f, 0x000c, 0x0045,
-    0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 0x003f, 0x0042,
-    0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036,
-    0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a,
-    0x0021, 0x002a, 0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021,
-    0x001e, 0x0021, 0x0015, 0x001e, 0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018,
-    0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f,
-    0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003, 0x04f0, 0x02a2, 0xfb7a, 0x04ca,
-    0x029d, 0xfb74, 0x04e0, 0x024d, 0xfb60, 0x04bf, 0x0260, 0xfb62, 0x04da, 0x0290, 0xfb95, 0x04cf, 0x0253, 0xfb82,
-    0x049c, 0x0212, 0xfb6b, 0x048e, 0x0236, 0xfb69, 0x049e, 0x0229, 0xfb8a, 0x044b, 0x0214, 0xfb94, 0x0454, 0x0237,
-    0xfb87, 0x0464, 0x022a, 0xfba7, 0x041d, 0x0252, 0xfbc4, 0x0433, 0x0264, 0xfba9, 0x0443, 0x0257, 0xfbca, 0x042d,
-    0x02a7, 0xfbde, 0x043e, 0x02a1, 0xfbbc, 0x044f, 0x0294, 0xfbdc, 0x0471, 0x02e2, 0xfbd3, 0x046f, 0x02cb, 0xfbb4,
-    0x047f, 0x02be, 0xfbd5, 0x04c2, 0x02e0, 0xfbaa, 0x04a9, 0x02c9, 0xfb96, 0x04b9, 0x02bc, 0xfbb7, 0x0048, 0x0030,
-    0x0002, 0x065f, 0x0086, 0x035e, 0x0076, 0x0070, 0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045,
-    0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042, 0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c,
-    0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039, 0x002d, 0x0036, 0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033,
-    0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d, 0x0024, 0x002a, 0x0021, 0x002a, 0x0027, 0x002a, 0x001e, 0x0027,
-    0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021, 0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 0x001b, 0x001e,
-    0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018, 0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012,
-    0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f, 0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009,
-    0x0000, 0x0006, 0x0000, 0x0003, 0x06d0, 0x00a7, 0x0351, 0x06ad, 0x009f, 0x0341, 0x06c5, 0x004d, 0x034a, 0x06a5,
-    0x005f, 0x033d, 0x06b3, 0x009c, 0x0368, 0x06aa, 0x005c, 0x0363, 0x067d, 0x0015, 0x034f, 0x0672, 0x0037, 0x0340,
-    0x0677, 0x0034, 0x0367, 0x0624, 0x0020, 0x035d, 0x0632, 0x003f, 0x034a, 0x0638, 0x003b, 0x0370, 0x05ee, 0x0067,
-    0x036b, 0x060b, 0x0071, 0x0354, 0x0611, 0x006e, 0x037a, 0x05f9, 0x00c0, 0x0371, 0x0613, 0x00b2, 0x0359, 0x0619,
-    0x00ae, 0x037f, 0x0640, 0x00f8, 0x036c, 0x0646, 0x00da, 0x0355, 0x064c, 0x00d6, 0x037b, 0x0699, 0x00ed, 0x035f,
-    0x0686, 0x00d2, 0x034b, 0x068c, 0x00cf, 0x0372, 0x0048, 0x0030, 0x0002, 0x0577, 0x037b, 0x1019, 0x0077, 0x0071,
-    0x000c, 0x0045, 0x0003, 0x0042, 0x0000, 0x003f, 0x003f, 0x0045, 0x003c, 0x0045, 0x0042, 0x0045, 0x0039, 0x0042,
-    0x003f, 0x0042, 0x0036, 0x003f, 0x0036, 0x003c, 0x0033, 0x003c, 0x0039, 0x003c, 0x0030, 0x0039, 0x0036, 0x0039,
-    0x002d, 0x0036, 0x002d, 0x0033, 0x002a, 0x0033, 0x0030, 0x0033, 0x0027, 0x0030, 0x002d, 0x0030, 0x0024, 0x002d,
-    0x0024, 0x002a, 0x0021, 0x002a, 0x0027, 0x002a, 0x001e, 0x0027, 0x0024, 0x0027, 0x001b, 0x0024, 0x001b, 0x0021,
-    0x0018, 0x0021, 0x001e, 0x0021, 0x0015, 0x001e, 0x001b, 0x001e, 0x0012, 0x001b, 0x0012, 0x0018, 0x000f, 0x0018,
-    0x0015, 0x0018, 0x0009, 0x0015, 0x0012, 0x0015, 0x0006, 0x0012, 0x0006, 0x000f, 0x0000, 0x000c, 0x000c, 0x000f,
-    0x0009, 0x000f, 0x0003, 0x000c, 0x0003, 0x0009, 0x0006, 0x0009, 0x0000, 0x0006, 0x0000, 0x0003, 0x05a1, 0x03e1,
-    0x1047, 0x05a8, 0x03bd, 0x1039, 0x058e, 0x03a3, 0x1087, 0x059a, 0x0391, 0x1066, 0x0583, 0x03cb, 0x103b, 0x0575,
-    0x039f, 0x1069, 0x056d, 0x034e, 0x1086, 0x0582, 0x0354, 0x1066, 0x055e, 0x0362, 0x1068, 0x0553, 0x0314, 0x1046,
-    0x056f, 0x032b, 0x1038, 0x054b, 0x0339, 0x103a, 0x054d, 0x0317, 0x0feb, 0x056b, 0x032d, 0x0ff7, 0x0547, 0x033a,
-    0x0ffa, 0x0561, 0x0354, 0x0fac, 0x0579, 0x0359, 0x0fca, 0x0555, 0x0367, 0x0fcc, 0x0581, 0x03a9, 0x0fac, 0x0591,
-    0x0395, 0x0fca, 0x056d, 0x03a3, 0x0fcc, 0x059c, 0x03e3, 0x0fed, 0x05a4, 0x03bf, 0x0ff8, 0x0580, 0x03cd, 0x0ffa,
-    0x0024, 0x0014, 0x0002, 0xfe2b, 0x0440, 0x08a6, 0x0026, 0x046f, 0x0006, 0x000f, 0x000f, 0x0018, 0x0018, 0x0021,
-    0x0021, 0x0006, 0x001e, 0x0021, 0x0015, 0x0018, 0x000c, 0x000f, 0x0003, 0x0006, 0x001e, 0x0009, 0x0003, 0x001b,
-    0x0021, 0x001b, 0x0015, 0x001e, 0x001b, 0x0012, 0x0018, 0x0012, 0x000c, 0x0015, 0x0012, 0x0000, 0x000f, 0x0000,
-    0x0009, 0x000c, 0x0006, 0x0009, 0x0000, 0x0003, 0xfe28, 0x0421, 0x08b9, 0xfe2c, 0x041b, 0x08a6, 0xfe3d, 0x0439,
-    0x0897, 0xfe38, 0x045f, 0x0894, 0xfe34, 0x0465, 0x08a8, 0xfe36, 0x0444, 0x08ba, 0xfe18, 0x042d, 0x08b3, 0xfe21,
-    0x045d, 0x08a6, 0xfe20, 0x0445, 0x08b0, 0xfe1c, 0x0427, 0x089f, 0xfe25, 0x0457, 0x0893, 0xfe25, 0x043e, 0x0897,
-    0x000c, 0x0002, 0x0003, 0xfb9a, 0x0000, 0xfb38, 0x022f, 0x0000, 0x0000, 0x0006, 0x0003, 0x0003, 0x0006, 0x0009,
-    0xfa22, 0x0000, 0xfb6e, 0xfa22, 0x0000, 0xf99a, 0xfd11, 0x0000, 0xfcd6, 0xfd11, 0x0000, 0xf99a, 0x000f, 0x0003,
-    0x0003, 0xfb9a, 0x0000, 0xfd81, 0x028a, 0x0000, 0x0009, 0x0000, 0x000c, 0x0009, 0x000c, 0x0006, 0x0006, 0x000c,
-    0x0003, 0xfbda, 0x0000, 0xff94, 0xfa22, 0x0000, 0xfb6e, 0xfa4b, 0x0000, 0xfc8d, 0xfa95, 0x0000, 0xfdad, 0xfd11,
-    0x0000, 0xfcd6, 0x000c, 0x0002, 0x0003, 0x0466, 0x0000, 0xfb34, 0x022c, 0x0000, 0x0000, 0x0006, 0x0009, 0x0003,
-    0x0006, 0x0000, 0x02ef, 0x0000, 0xfcce, 0x05de, 0x0000, 0xfb6e, 0x05de, 0x0000, 0xf99a, 0x02ef, 0x0000, 0xf99a,
-    0x000f, 0x0003, 0x0003, 0x0466, 0x0000, 0xfd81, 0x028a, 0x0000, 0x0009, 0x0003, 0x000c, 0x0006, 0x0009, 0x000c,
-    0x0000, 0x0006, 0x000c, 0x0426, 0x0000, 0xff94, 0x05de, 0x0000, 0xfb6e, 0x056b, 0x0000, 0xfdad, 0x05b5, 0x0000,
-    0xfc8d, 0x02ef, 0x0000, 0xfcce, 0x000c, 0x0002, 0x0003, 0x016f, 0x0005, 0xff8f, 0x01c4, 0x0000, 0x0000, 0x0003,
-    0x0006, 0x0009, 0x0006, 0x0003, 0x0187, 0x0000, 0x011e, 0x02d6, 0x0000, 0x0081, 0x0009, 0x000b, 0xfe7a, 0x0197,
-    0x0000, 0xfdff, 0x000c, 0x0002, 0x0003, 0x02de, 0x0000, 0xfea8, 0x01da, 0x0000, 0x0003, 0x0000, 0x0006, 0x0006,
-    0x0009, 0x0003, 0x0426, 0x0000, 0xff94, 0x02d6, 0x0000, 0x0081, 0x02ef, 0x0000, 0xfcce, 0x0197, 0x0000, 0xfdff,
-    0x000c, 0x0002, 0x0003, 0x0000, 0x0005, 0xffe1, 0x01f7, 0x0000, 0x0003, 0x0009, 0x0000, 0x0003, 0x0006, 0x0009,
-    0xfe79, 0x0000, 0x011e, 0x0000, 0x0000, 0x0148, 0x0187, 0x0000, 0x011e, 0x0009, 0x000b, 0xfe7a, 0x000c, 0x0002,
-    0x0003, 0xfe9a, 0x0005, 0xff9c, 0x01d3, 0x0000, 0x0000, 0x0006, 0x0003, 0x0006, 0x0009, 0x0003, 0xfe79, 0x0000,
-    0x011e, 0xfd2a, 0x0000, 0x0081, 0x0009, 0x000b, 0xfe7a, 0xfe65, 0x0000, 0xfe19,
-};
 const unsigned short ship3d[] = {
     0x6d69, 0x6c64, 0x0001, 0x0057, 0x0037, 0x0002, 0x0000, 0xffff, 0x000c, 0x0047, 0x0000, 0x002d, 0x0051, 0x0000,
     0x0003, 0x0009, 0x003f, 0x003c, 0x0048, 0x000c, 0x0000, 0x0000, 0x000f, 0x0012, 0x0000, 0x0015, 0x000f, 0x001e,
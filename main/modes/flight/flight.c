@@ -28,6 +28,7 @@
 #include "textEntry.h"
 #include "3denv.h"
 #include "color_utils.h"
+#include "depthSort.h"
 
 /*============================================================================
  * Defines
@@ -46,6 +47,12 @@
 #define VIEWPORT_DIV         4
 #define OOBMUX               1.3333 // based on 48 bams/m
 
+// Fractional bits in the per-vertex perspective reciprocal
+#define TD_RECIP_SHIFT 24
+
+// The most models in one leaf of the environment's bounding sphere tree
+#define ENV_CULL_LEAF_SIZE 4
+
 #define BOOLET_SPEED_DIVISOR 11
 
 // XXX TODO: Refactor - these should probably be unified.
@@ -98,22 +105,15 @@ typedef enum
     FLIGHT_FREEFLIGHT,
 } flightModeScreen;
 
+// A bounding sphere around a cluster of environment models, so the whole cluster can be culled at once
 typedef struct
 {
-    uint16_t nrvertnums;
-    uint16_t nrfaces;
-    uint16_t indices_per_face;
     int16_t center[3];
     int16_t radius;
-    uint16_t label;
-    int16_t indices_and_vertices[0];
-} tdModel;
-
-typedef struct
-{
-    const tdModel* model;
-    int mrange;
-} modelRangePair_t;
+    uint16_t first; // The first model in the cluster, an index into flight->environment
+    uint16_t count; // The number of models if this is a leaf, or 0 if the models are in the nodes after it
+    uint16_t skip;  // The node after this one and all of the nodes under it
+} envCullNode_t;
 
 typedef enum
 {
@@ -134,6 +134,22 @@ typedef enum
 #define FSNET_CODE_SERVER 0x73534653
 #define FSNET_CODE_PEER   0x66534653
 
+// Peer packets with this protocol version send ships as deltas from a keyframe, see flightNetWriteShip()
+#define FSNET_PROTOCOL_DELTA 2
+
+#define FSNET_UPDATE_US      100000  // How often we send our ship
+#define FSNET_KEY_INTERVAL   10      // Send a keyframe every this many updates
+#define FSNET_KEY_MAX_AGE_US 3000000 // Deltas from keyframes older than this are ignored
+#define FSNET_BOOLET_SENDS   2       // Boolets are sent in this many updates after they are fired
+
+// Which fields follow a ship's field mask. Fields which aren't sent are the same as the keyframe's
+#define FSNET_SHIP_KEY    0x01 // This is a keyframe, and the fields are deltas from zero instead of the last keyframe
+#define FSNET_SHIP_POS8   0x02 // int8_t[3] position, relative to where the keyframe's velocity would put the ship
+#define FSNET_SHIP_POS16  0x04 // int16_t[3] position, relative the same way
+#define FSNET_SHIP_VEL    0x08 // int8_t[3] velocity
+#define FSNET_SHIP_ROT    0x10 // int8_t[3] rotation
+#define FSNET_SHIP_STATUS 0x20 // uint8_t flags, uint16_t ID of the boolet which killed the ship, uint8_t color
+
 #define MAX_PEERS \
     103 // Best if it's a prime number. Better if it's more than you will ever see, since this is used as a hashtable.
 #define BOOLETSPERPLAYER      4
@@ -141,7 +157,26 @@ typedef enum
 #define MAX_BOOLETS           (MAX_PEERS * BOOLETSPERPLAYER + MAX_BOOLETS_FROM_HOST)
 #define MAX_NETWORK_MODELS    172 // 84 + 24(guns) = 108 + 48 = baddies too.
 
-typedef struct // 32 bytes.
+// Depth sort IDs for things which aren't environment models start after the environment models' indices
+#define FLIGHT_SORT_BOOLETS    0
+#define FLIGHT_SORT_MY_BOOLETS (FLIGHT_SORT_BOOLETS + MAX_BOOLETS)
+#define FLIGHT_SORT_PEERS      (FLIGHT_SORT_MY_BOOLETS + BOOLETSPERPLAYER)
+#define FLIGHT_SORT_NET_MODELS (FLIGHT_SORT_PEERS + MAX_PEERS)
+#define FLIGHT_SORT_IDS        (FLIGHT_SORT_NET_MODELS + MAX_NETWORK_MODELS)
+
+typedef struct // 24 bytes.
+{
+    uint32_t time; // When it was sent, in the sender's timestamp
+    int16_t pos[3];
+    int8_t vel[3];
+    int8_t rot[3];
+    uint16_t aux;  // auxPeerFlags
+    uint8_t flags; // basePeerFlags. If zero, there is no keyframe
+    uint8_t color;
+    uint8_t seq; // Which keyframe this is, or is a delta from
+} flightNetShip_t;
+
+typedef struct // 56 bytes.
 {
     uint32_t timeOffsetOfPeerFromNow;
     uint32_t timeOfUpdate; // In our timestamp
@@ -156,6 +191,7 @@ typedef struct // 32 bytes.
     uint16_t auxPeerFlags; // If dead, is ID of boolet which killed "me"
     uint8_t framesDead;
     uint8_t reqColor;
+    flightNetShip_t netKey; // The last keyframe received from this peer
 } multiplayerpeer_t;
 
 typedef struct // Rounds up to 16 bytes.
@@ -199,8 +235,12 @@ typedef struct
     bool oob;
     uint32_t lastFlightUpdate;
 
+    model3d_t envModel;
     int enviromodels;
     const tdModel** environment;
+    int enviroLabelled;     // Labelled models have game logic, so they're first in environment and not in envCull
+    envCullNode_t* envCull; // Bounding spheres around the unlabelled models, depth first
+    int envCullNodes;
     const tdModel* otherShip;
 
     menu_t* menu;
@@ -228,10 +268,14 @@ typedef struct
 
     int16_t ModelviewMatrix[16];
     int16_t ProjectionMatrix[16];
+    int32_t MVPMatrix[16]; // ProjectionMatrix * ModelviewMatrix, see tdConcatenate()
     int renderlinecolor;
+#ifdef PROFILING
+    uint32_t profVertices; // Vertices taken to screen space this frame
+#endif
 
     // Boolets for multiplayer.
-    multiplayerpeer_t allPeers[MAX_PEERS]; // 32x103 = 3296 bytes.
+    multiplayerpeer_t allPeers[MAX_PEERS]; // 56x103 = 5768 bytes.
     multiplayerpeer_t serverPeer;
     boolet_t allBoolets[MAX_BOOLETS]; // ~8kB
     network_model_t* networkModels[MAX_NETWORK_MODELS];
@@ -239,6 +283,7 @@ typedef struct
     int nNetworkMode;
 
     boolet_t myBoolets[BOOLETSPERPLAYER];
+    uint8_t myBooletSends[BOOLETSPERPLAYER]; // How many more updates each of our boolets will be sent in
     uint16_t booletHitHistory[BOOLETSPERPLAYER]; // For boolets that collide with us.
     int booletHitHistoryHead;
     int myBooletHead;
@@ -246,12 +291,14 @@ typedef struct
     int myHealth;
     uint32_t timeOfDeath;
     uint32_t lastNetUpdate;
+    flightNetShip_t netKey;  // The last keyframe we sent
+    uint8_t netUpdatesToKey; // Updates until the next keyframe. If zero, the next update is one
     uint16_t killedByBooletID;
 
     int kills;
     int deaths;
 
-    modelRangePair_t* mrp;
+    depthSort_t depthSort;
 
     uint8_t bgcolor;
     uint8_t was_hit_by_boolet;
@@ -285,11 +332,15 @@ static void flightStartGame(flightModeScreen mode);
 static void flightGameUpdate(flight_t* tflight);
 static void flightUpdateLEDs(flight_t* tflight);
 static void flightLEDAnimate(flLEDAnimation anim);
+static void flightBuildEnvCull(void);
+static uint16_t flightBuildEnvCullNode(uint16_t first, uint16_t count);
+static void flightCullEnvironment(void);
+static void flightQueueModel(uint16_t id, int range, const tdModel* m);
 int tdModelVisibilitycheck(const tdModel* m);
 void tdDrawModel(const tdModel* m);
 static int flightTimeHighScorePlace(int wintime, bool is100percent);
 static void flightTimeHighScoreInsert(int insertplace, bool is100percent, char* name, int timeCentiseconds);
-static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePair_t** mrp);
+static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now);
 static void FlightfnEspNowRecvCb(const esp_now_recv_info_t* esp_now_info, const uint8_t* data, uint8_t len,
                                  int8_t rssi);
 static void FlightfnEspNowSendCb(const uint8_t* mac_addr, esp_now_send_status_t status);
@@ -304,6 +355,10 @@ static uint32_t ReadBitQ(uint32_t* rin);
 static uint32_t ReadUEQ(uint32_t* rin);
 static int WriteUQ(uint32_t* v, uint32_t number, int bits);
 static int WriteUEQ(uint32_t* v, uint32_t number);
+static void flightNetPredict(const flightNetShip_t* key, uint32_t time, int16_t* pos);
+static uint8_t* flightNetWriteShip(flight_t* tflight, uint8_t* pp, uint32_t now);
+static const uint8_t* flightNetReadShip(multiplayerpeer_t* tp, const uint8_t* data, const uint8_t* dataend,
+                                       uint32_t timeOnPeer, bool* applied);
 
 // Forward libc declarations.
 #ifndef EMULATOR
@@ -430,21 +485,39 @@ static void flightEnterMode(void)
     flight->mode            = FLIGHT_MENU;
     flight->renderlinecolor = CNDRAW_WHITE;
 
-    const uint16_t* data = model3d; //(uint16_t*)getAsset( "3denv.obj", &retlen );
-    data += 2;                      // header
-    flight->enviromodels = *(data++);
-    flight->environment  = malloc(sizeof(const tdModel*) * flight->enviromodels);
+    // The environment is used in place, straight from the file. If it can't be loaded, fly around in the void
+    if (!loadModel("3denv.mdl", &flight->envModel, true))
+    {
+        ESP_LOGE("FLIGHT", "Couldn't load the environment, it will be empty");
+    }
+    else if (flight->envModel.nrParts > UINT16_MAX - FLIGHT_SORT_IDS)
+    {
+        // Every part needs a depth sort ID after the environment, and those are 16 bits
+        ESP_LOGE("FLIGHT", "The environment has %d parts, more than %d, it will be empty", flight->envModel.nrParts,
+                 UINT16_MAX - FLIGHT_SORT_IDS);
+        freeModel(&flight->envModel);
+    }
+    else
+    {
+        flight->enviromodels = flight->envModel.nrParts;
+        flight->environment  = malloc(sizeof(const tdModel*) * flight->enviromodels);
+    }
 
-    flight->mrp
-        = malloc(sizeof(modelRangePair_t) * (flight->enviromodels + MAX_PEERS + MAX_BOOLETS + MAX_NETWORK_MODELS));
+    if (NULL == flight->environment)
+    {
+        flight->enviromodels = 0;
+    }
+
+    depthSortInit(&flight->depthSort, flight->enviromodels + FLIGHT_SORT_IDS);
 
     int i;
     for (i = 0; i < flight->enviromodels; i++)
     {
-        const tdModel* m = flight->environment[i] = (const tdModel*)data;
-        data += 8 + m->nrvertnums + m->nrfaces * m->indices_per_face;
+        flight->environment[i] = flight->envModel.parts[i].model;
     }
 
+    flightBuildEnvCull();
+
     flight->otherShip = (const tdModel*)(ship3d + 3); //+ header(3)
 
     loadFont("ibm_vga8.font", &flight->ibm, false);
@@ -483,10 +556,9 @@ static void flightExitMode(void)
     {
         free(flight->environment);
     }
-    if (flight->mrp)
-    {
-        free(flight->mrp);
-    }
+    depthSortDeinit(&flight->depthSort);
+    freeModel(&flight->envModel);
+    free(flight->envCull);
     free(flight);
 }
 
@@ -835,6 +907,8 @@ void Perspective(int fovx, int aspect, int zNear, int zFar, int16_t* out);
 int LocalToScreenspace(const int16_t* coords_3v, int16_t* o1, int16_t* o2);
 void SetupMatrix(void);
 void tdMultiply(int16_t* fin1, int16_t* fin2, int16_t* fout);
+void tdConcatenate(int32_t* restrict mvp, const int16_t* restrict proj, const int16_t* restrict mv);
+void tdTransformVertices(int16_t* restrict out, const int16_t* restrict pin, int nrv);
 void tdRotateNoMulEA(int16_t* f, int16_t x, int16_t y, int16_t z);
 void tdRotateEA(int16_t* f, int16_t x, int16_t y, int16_t z);
 // void tdScale( int16_t * f, int16_t x, int16_t y, int16_t z );
@@ -1040,6 +1114,28 @@ void tdMultiply(int16_t* fin1, int16_t* fin2, int16_t* fout)
     memcpy(fout, fotmp, sizeof(fotmp));
 }
 
+/**
+ * @brief Concatenate the projection and modelview matrices, so points can be taken to clip space with one transform.
+ * The rotation columns are 8.8 fixed point like the inputs. The translation column keeps 8 more fractional bits, which
+ * makes the result match transforming by the modelview and then the projection
+ *
+ * @param mvp The concatenated matrix
+ * @param proj The projection matrix
+ * @param mv The modelview matrix
+ */
+void tdConcatenate(int32_t* restrict mvp, const int16_t* restrict proj, const int16_t* restrict mv)
+{
+    for (int r = 0; r < 16; r += 4)
+    {
+        const int16_t* p = &proj[r];
+        for (int c = 0; c < 3; c++)
+        {
+            mvp[r + c] = (p[0] * mv[m00 + c] + p[1] * mv[m10 + c] + p[2] * mv[m20 + c] + p[3] * mv[m30 + c]) >> 8;
+        }
+        mvp[r + 3] = p[0] * mv[m03] + p[1] * mv[m13] + p[2] * mv[m23] + p[3] * mv[m33];
+    }
+}
+
 void tdTranslate(int16_t* f, int16_t x, int16_t y, int16_t z)
 {
     //    int16_t ftmp[16];
@@ -1138,17 +1234,46 @@ void tdPt3Transform(int16_t* pout, const int16_t* restrict f, const int16_t* res
     pout[2] = (pin[0] * f[m20] + pin[1] * f[m21] + pin[2] * f[m22] + 256 * f[m23]) >> 8;
 }
 
-int LocalToScreenspace(const int16_t* coords_3v, int16_t* o1, int16_t* o2)
+/**
+ * @brief Take a point in model space to clip space, using a matrix from tdConcatenate(). Z isn't needed by anything,
+ * so it isn't computed
+ *
+ * @param clip The point's X, Y and W in clip space
+ * @param mvp The concatenated matrix
+ * @param pin The point in model space
+ */
+static inline void tdClipTransform(int32_t* restrict clip, const int32_t* restrict mvp, const int16_t* restrict pin)
 {
-    int16_t tmppt[4];
-    tdPtTransform(tmppt, flight->ModelviewMatrix, coords_3v);
-    td4Transform(tmppt, flight->ProjectionMatrix, tmppt);
-    if (tmppt[3] >= -4)
+    clip[0] = (pin[0] * mvp[m00] + pin[1] * mvp[m01] + pin[2] * mvp[m02] + mvp[m03]) >> 8;
+    clip[1] = (pin[0] * mvp[m10] + pin[1] * mvp[m11] + pin[2] * mvp[m12] + mvp[m13]) >> 8;
+    clip[2] = (pin[0] * mvp[m30] + pin[1] * mvp[m31] + pin[2] * mvp[m32] + mvp[m33]) >> 8;
+}
+
+/**
+ * @brief Take a point in model space to screen space, using a matrix from tdConcatenate()
+ *
+ * @param mvp The concatenated matrix
+ * @param pin The point in model space
+ * @param o1 Written with the point's X on screen
+ * @param o2 Written with the point's Y on screen
+ * @return 0 if the point is in front of the camera, -1 if it's behind, -2 if it's too far off screen
+ */
+static inline int tdProjectPoint(const int32_t* restrict mvp, const int16_t* restrict pin, int16_t* o1, int16_t* o2)
+{
+    int32_t clip[3];
+    tdClipTransform(clip, mvp, pin);
+    if (clip[2] >= -4)
     {
         return -1;
     }
-    int calcx = ((256 * tmppt[0] / tmppt[3]) / VIEWPORT_DIV + (TFT_WIDTH / 2));
-    int calcy = ((256 * tmppt[1] / tmppt[3]) / VIEWPORT_DIV + (TFT_HEIGHT / 2));
+
+    // Divide once for a reciprocal of -W with the viewport scale folded in, then multiply by it for X and Y. It's
+    // rounded up and the magnitudes are projected, so this truncates towards zero just like dividing would
+    int32_t recip = (((256 / VIEWPORT_DIV) << TD_RECIP_SHIFT) - clip[2] - 1) / -clip[2];
+    int32_t px    = (int32_t)(((uint64_t)ABS(clip[0]) * recip) >> TD_RECIP_SHIFT);
+    int32_t py    = (int32_t)(((uint64_t)ABS(clip[1]) * recip) >> TD_RECIP_SHIFT);
+    int32_t calcx = (TFT_WIDTH / 2) + ((clip[0] < 0) ? px : -px);
+    int32_t calcy = (TFT_HEIGHT / 2) + ((clip[1] < 0) ? py : -py);
     if (calcx < -16000 || calcx > 16000 || calcy < -16000 || calcy > 16000)
         return -2;
     *o1 = calcx;
@@ -1156,6 +1281,34 @@ int LocalToScreenspace(const int16_t* coords_3v, int16_t* o1, int16_t* o2)
     return 0;
 }
 
+int LocalToScreenspace(const int16_t* coords_3v, int16_t* o1, int16_t* o2)
+{
+    return tdProjectPoint(flight->MVPMatrix, coords_3v, o1, o2);
+}
+
+/**
+ * @brief Take an array of points in model space to screen space, using flight->MVPMatrix
+ *
+ * @param out Three int16_ts per point: X and Y on screen, then 1 if the point can be drawn or 2 if it can't
+ * @param pin Three int16_ts per point in model space
+ * @param nrv The number of int16_ts in pin, three times the number of points
+ */
+void tdTransformVertices(int16_t* restrict out, const int16_t* restrict pin, int nrv)
+{
+    // A local copy, so the matrix stays in registers rather than being reloaded through flight every point
+    int32_t mvp[16];
+    memcpy(mvp, flight->MVPMatrix, sizeof(mvp));
+
+    for (int i = 0; i < nrv; i += 3)
+    {
+        out[i + 2] = tdProjectPoint(mvp, &pin[i], &out[i], &out[i + 1]) ? 2 : 1;
+    }
+
+#ifdef PROFILING
+    flight->profVertices += nrv / 3;
+#endif
+}
+
 // Note: Function unused.  For illustration purposes.
 // void Draw3DSegment( display_t * disp, const int16_t * c1, const int16_t * c2 )
 // {
@@ -1173,16 +1326,14 @@ int LocalToScreenspace(const int16_t* coords_3v, int16_t* o1, int16_t* o2)
 // Only needs center and radius.
 int tdModelVisibilitycheck(const tdModel* m)
 {
-    // For computing visibility check
-    int16_t tmppt[4];
-    tdPtTransform(tmppt, flight->ModelviewMatrix, m->center);
-    td4Transform(tmppt, flight->ProjectionMatrix, tmppt);
-    if (tmppt[3] < -2)
-    {
-        int scx = ((256 * tmppt[0] / tmppt[3]) / VIEWPORT_DIV + (TFT_WIDTH / 2));
-        int scy = ((256 * tmppt[1] / tmppt[3]) / VIEWPORT_DIV + (TFT_HEIGHT / 2));
-        // int scz = ((65536 * tmppt[2] / tmppt[3]));
-        int scd = ((-256 * 2 * m->radius / tmppt[3]) / VIEWPORT_DIV);
+    // For computing visibility check, X, Y and W
+    int32_t tmppt[3];
+    tdClipTransform(tmppt, flight->MVPMatrix, m->center);
+    if (tmppt[2] < -2)
+    {
+        int scx = ((256 * tmppt[0] / tmppt[2]) / VIEWPORT_DIV + (TFT_WIDTH / 2));
+        int scy = ((256 * tmppt[1] / tmppt[2]) / VIEWPORT_DIV + (TFT_HEIGHT / 2));
+        int scd = ((-256 * 2 * m->radius / tmppt[2]) / VIEWPORT_DIV);
         scd += 3; // Slack
         if (scx < -scd || scy < -scd || scx >= TFT_WIDTH + scd || scy >= TFT_HEIGHT + scd)
         {
@@ -1190,7 +1341,7 @@ int tdModelVisibilitycheck(const tdModel* m)
         }
         else
         {
-            return -tmppt[3];
+            return -tmppt[2];
         }
     }
     else
@@ -1199,6 +1350,191 @@ int tdModelVisibilitycheck(const tdModel* m)
     }
 }
 
+/**
+ * @brief Sort the environment so the labelled models come first, then build a tree of bounding spheres around the
+ * rest, so flightCullEnvironment() can cull them a cluster at a time
+ */
+static void flightBuildEnvCull(void)
+{
+    const tdModel** env = flight->environment;
+
+    int labelled = 0;
+    for (int i = 0; i < flight->enviromodels; i++)
+    {
+        if (env[i]->label)
+        {
+            const tdModel* tmp = env[labelled];
+            env[labelled++]    = env[i];
+            env[i]             = tmp;
+        }
+    }
+    flight->enviroLabelled = labelled;
+
+    // A binary tree with at least one model per leaf has fewer than twice as many nodes as models
+    int scenery          = flight->enviromodels - labelled;
+    flight->envCull      = malloc(sizeof(envCullNode_t) * MAX(1, 2 * scenery));
+    flight->envCullNodes = 0;
+    if (scenery > 0)
+    {
+        flightBuildEnvCullNode(labelled, scenery);
+    }
+}
+
+/**
+ * @brief Build the node of the environment's bounding sphere tree for some models, then split them along their
+ * longest axis and build the nodes under it
+ *
+ * @param first The first model, an index into flight->environment
+ * @param count The number of models
+ * @return The index of the node
+ */
+static uint16_t flightBuildEnvCullNode(uint16_t first, uint16_t count)
+{
+    const tdModel** env = &flight->environment[first];
+    uint16_t idx        = flight->envCullNodes++;
+
+    int32_t lo[3] = {INT16_MAX, INT16_MAX, INT16_MAX};
+    int32_t hi[3] = {INT16_MIN, INT16_MIN, INT16_MIN};
+    for (int i = 0; i < count; i++)
+    {
+        for (int a = 0; a < 3; a++)
+        {
+            lo[a] = MIN(lo[a], env[i]->center[a] - env[i]->radius);
+            hi[a] = MAX(hi[a], env[i]->center[a] + env[i]->radius);
+        }
+    }
+
+    envCullNode_t* node = &flight->envCull[idx];
+    int axis            = 0;
+    for (int a = 0; a < 3; a++)
+    {
+        node->center[a] = (lo[a] + hi[a]) / 2;
+        if (hi[a] - lo[a] > hi[axis] - lo[axis])
+        {
+            axis = a;
+        }
+    }
+
+    // Round up, so every model is entirely inside
+    int32_t radius = 0;
+    for (int i = 0; i < count; i++)
+    {
+        radius = MAX(radius, tdDist(node->center, env[i]->center) + env[i]->radius + 1);
+    }
+    node->radius = MIN(radius, INT16_MAX);
+    node->first  = first;
+
+    if (count <= ENV_CULL_LEAF_SIZE)
+    {
+        node->count = count;
+    }
+    else
+    {
+        // Insertion sort along the longest axis. This only happens once, on a few hundred models
+        for (int i = 1; i < count; i++)
+        {
+            const tdModel* m = env[i];
+            int j            = i;
+            for (; j > 0 && env[j - 1]->center[axis] > m->center[axis]; j--)
+            {
+                env[j] = env[j - 1];
+            }
+            env[j] = m;
+        }
+
+        node->count = 0;
+        flightBuildEnvCullNode(first, count / 2);
+        flightBuildEnvCullNode(first + count / 2, count - count / 2);
+    }
+
+    flight->envCull[idx].skip = flight->envCullNodes;
+    return idx;
+}
+
+/**
+ * @brief Add the unlabelled environment models which may be on screen to the list of models to draw. Whole clusters
+ * are culled when their bounding spheres are outside the view frustum, and tdModelVisibilitycheck() checks the models
+ * in the rest.
+ *
+ * The frustum test is conservative with respect to tdModelVisibilitycheck(), which allows models up to twice their
+ * radius (in clip space) plus 3 pixels off screen. Each plane is one dot product with the cluster's center in clip
+ * space, padded by the cluster's radius times the plane's gradient in world space.
+ *
+ */
+static void flightCullEnvironment(void)
+{
+    const int32_t* mvp = flight->MVPMatrix;
+
+    // Screen positions are (256 / VIEWPORT_DIV) * clip / -W, so a point is within half the screen plus the slack of
+    // tdModelVisibilitycheck() when (half + slack) * -W - (256 / VIEWPORT_DIV) * |clip| is positive. Find the length of
+    // the gradient of each of those planes in world space, in the same units, taking the larger of each +/- pair
+    const int32_t scale = 256 / VIEWPORT_DIV;
+    const int32_t halfX = TFT_WIDTH / 2 + 4;
+    const int32_t halfY = TFT_HEIGHT / 2 + 4;
+    uint32_t gradX[2] = {0}, gradY[2] = {0}, gradW = 0;
+    for (int a = 0; a < 3; a++)
+    {
+        int32_t w = -mvp[m30 + a];
+        int32_t x = mvp[m00 + a];
+        int32_t y = mvp[m10 + a];
+        for (int s = 0; s < 2; s++)
+        {
+            int32_t gx = (halfX * w + (s ? scale : -scale) * x) / 256;
+            int32_t gy = (halfY * w + (s ? scale : -scale) * y) / 256;
+            gradX[s] += gx * gx;
+            gradY[s] += gy * gy;
+        }
+        gradW += w * w;
+    }
+    // Pad the radius term for models (twice the radius) and for rounding
+    int32_t padX = tdSQRT(MAX(gradX[0], gradX[1])) + 2 + 2 * scale;
+    int32_t padY = tdSQRT(MAX(gradY[0], gradY[1])) + 2 + 2 * scale;
+    int32_t padW = tdSQRT(gradW) + 2;
+
+    int n = 0;
+    while (n < flight->envCullNodes)
+    {
+        const envCullNode_t* node = &flight->envCull[n];
+
+        int32_t clip[3];
+        tdClipTransform(clip, mvp, node->center);
+        int32_t w = -clip[2];
+
+        // Entirely behind the camera, or entirely off one side of the screen
+        if ((256 * w + padW * node->radius <= 2 * 256)
+            || (halfX * w - scale * ABS(clip[0]) + padX * node->radius + 4 * scale < 0)
+            || (halfY * w - scale * ABS(clip[1]) + padY * node->radius + 4 * scale < 0))
+        {
+            n = node->skip;
+            continue;
+        }
+
+        for (int i = 0; i < node->count; i++)
+        {
+            const tdModel* m = flight->environment[node->first + i];
+
+            int r = tdModelVisibilitycheck(m);
+            if (r < 0)
+                continue;
+            flightQueueModel(node->first + i, r, m);
+        }
+        n++;
+    }
+}
+
+/**
+ * @brief Add a model to the list of models to draw this frame, farthest first
+ *
+ * @param id The model's depth sort ID, which must be the same every frame. Environment models use their index in
+ * flight->environment, and everything else is offset past them by one of the FLIGHT_SORT_* values
+ * @param range The model's distance, from tdModelVisibilitycheck()
+ * @param m The model, or one of the special values below 0x3000 for things drawn another way
+ */
+static void flightQueueModel(uint16_t id, int range, const tdModel* m)
+{
+    depthSortAdd(&flight->depthSort, id, MIN(range, UINT16_MAX), m);
+}
+
 void tdDrawModel(const tdModel* m)
 {
     int i;
@@ -1219,15 +1555,7 @@ void tdDrawModel(const tdModel* m)
     // so we don't have to re-compute every time round.
     // f( "%d    n", nrv );
     int16_t cached_verts[nrv];
-
-    for (i = 0; i < nrv; i += 3)
-    {
-        int16_t* cv1 = &cached_verts[i];
-        if (LocalToScreenspace(&verticesmark[i], cv1, cv1 + 1))
-            cv1[2] = 2;
-        else
-            cv1[2] = 1;
-    }
+    tdTransformVertices(cached_verts, verticesmark, nrv);
 
     if (m->indices_per_face == 2)
     {
@@ -1271,14 +1599,6 @@ void tdDrawModel(const tdModel* m)
     }
 }
 
-int mdlctcmp(const void* va, const void* vb);
-int mdlctcmp(const void* va, const void* vb)
-{
-    const modelRangePair_t* a = (const modelRangePair_t*)va;
-    const modelRangePair_t* b = (const modelRangePair_t*)vb;
-    return b->mrange - a->mrange;
-}
-
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1356,14 +1676,15 @@ static void flightRender(int64_t elapsedUs)
     }
     tdTranslate(flight->ModelviewMatrix, -tflight->planeloc[0], -tflight->planeloc[1], -tflight->planeloc[2]);
 
-    modelRangePair_t* mrp   = tflight->mrp;
-    modelRangePair_t* mrptr = mrp;
+    // The matrices are fixed for the rest of the frame, so every point can go through them both at once
+    tdConcatenate(flight->MVPMatrix, flight->ProjectionMatrix, flight->ModelviewMatrix);
 
     /////////////////////////////////////////////////////////////////////////////////////////
     ////GAME LOGIC GOES HERE (FOR COLLISIONS/////////////////////////////////////////////////
 
+    // Labelled models have game logic which runs even when they're off screen, so they're each checked
     int i;
-    for (i = 0; i < tflight->enviromodels; i++)
+    for (i = 0; i < tflight->enviroLabelled; i++)
     {
         const tdModel* m = tflight->environment[i];
 
@@ -1420,13 +1741,14 @@ static void flightRender(int64_t elapsedUs)
         int r = tdModelVisibilitycheck(m);
         if (r < 0)
             continue;
-        mrptr->model  = m;
-        mrptr->mrange = r;
-        mrptr++;
+        flightQueueModel(i, r, m);
     }
 
+    // The rest is scenery, which can be culled a cluster at a time
+    flightCullEnvironment();
+
     if (tflight->nNetworkMode)
-        FlightNetworkFrameCall(tflight, now, &mrptr);
+        FlightNetworkFrameCall(tflight, now);
 
     // #ifndef EMULATOR
     //     if( flight->mode == FLIGHT_FREEFLIGHT ) uart_tx_one_char('2');
@@ -1435,12 +1757,12 @@ static void flightRender(int64_t elapsedUs)
     //     uint32_t mid1 = cndrawPerfcounter;
     // #endif
 
-    int mdlct = mrptr - mrp;
 #ifdef PROFILING
     uint32_t t1 = getCycleCount();
 #endif
-    // Painter's algorithm
-    qsort(mrp, mdlct, sizeof(modelRangePair_t), mdlctcmp);
+    // Painter's algorithm. Models keep their IDs from frame to frame, so last frame's order is nearly sorted already
+    uint16_t mdlct         = 0;
+    const uint16_t* sorted = depthSortFinish(&tflight->depthSort, &mdlct);
 
 #ifdef PROFILING
     uint32_t t2 = getCycleCount();
@@ -1455,7 +1777,7 @@ static void flightRender(int64_t elapsedUs)
 
     for (i = 0; i < mdlct; i++)
     {
-        const tdModel* m = mrp[i].model;
+        const tdModel* m = tflight->depthSort.items[sorted[i]];
         if ((intptr_t)m < 0x3000)
         {
             // It's a special thing.  Don't draw the normal way.
@@ -1656,6 +1978,11 @@ static void flightRender(int64_t elapsedUs)
     sprintf(cts, "%d", (int)(t3 - tlast) / 240);
     drawText(&flight->ibm, CNDRAW_WHITE, cts, 185, 210);
 
+    // Vertices per second, at the rate this frame was rendered
+    sprintf(cts, "%dv/s", (int)((uint64_t)flight->profVertices * 240000000 / (t3 - tlast)));
+    drawText(&flight->ibm, CNDRAW_WHITE, cts, 15, 225);
+    flight->profVertices = 0;
+
     /*
         float plusy[3] = {0, 0, 1};
         mathRotateVectorByInverseOfQuaternion(plusy, LSM6DSL.fqQuat, plusy);
@@ -2088,8 +2415,9 @@ void flightButtonCallback(buttonEvt_t* evt)
                 if (timeSinceShot > 300000) // Limit fire rate.
                 {
                     // Fire a boolet.
-                    boolet_t* tb         = &flight->myBoolets[flight->myBooletHead];
-                    flight->myBooletHead = (flight->myBooletHead + 1) % BOOLETSPERPLAYER;
+                    boolet_t* tb                                = &flight->myBoolets[flight->myBooletHead];
+                    flight->myBooletSends[flight->myBooletHead] = FSNET_BOOLET_SENDS;
+                    flight->myBooletHead                        = (flight->myBooletHead + 1) % BOOLETSPERPLAYER;
                     tb->flags            = (rand() % 65535) + 1;
                     tb->timeOfLaunch
                         = now + 50000; // Post-date shots to reduce prevelancy of close-range shots being missed.
@@ -2424,7 +2752,7 @@ static void TModOrDrawCustomNetModel(flight_t* tflight, tdModel* tmod, int16_t*
     croot[0] = pa[0] + ((va[0] * delta) >> 16);
     croot[1] = pa[1] + ((va[1] * delta) >> 16);
     croot[2] = pa[2] + ((va[2] * delta) >> 16);
-    int16_t rootcx, rootcy;
+    int16_t rootcx = 0, rootcy = 0;
     int rootisvalid = !LocalToScreenspace(croot, &rootcx, &rootcy);
     int oldisvalid  = rootisvalid;
 
@@ -2452,7 +2780,7 @@ static void TModOrDrawCustomNetModel(flight_t* tflight, tdModel* tmod, int16_t*
             draw   = ReadUQ(&binencprop, 1);
         }
 
-        int16_t newcx, newcy;
+        int16_t newcx = 0, newcy = 0;
         int16_t new[3];
         new[0] = last[0] + bpos[0];
         new[1] = last[1] + bpos[1];
@@ -2470,10 +2798,204 @@ static void TModOrDrawCustomNetModel(flight_t* tflight, tdModel* tmod, int16_t*
     }
 }
 
-static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePair_t** mrp)
+/**
+ * @brief Find where a ship would be if it kept flying at a keyframe's velocity. This is the same dead reckoning
+ * TModOrDrawPlayer() does, so positions can be sent as how far off the prediction they are
+ *
+ * @param key The keyframe
+ * @param time When to predict the position for, in the sender's timestamp
+ * @param[out] pos The predicted position
+ */
+static void flightNetPredict(const flightNetShip_t* key, uint32_t time, int16_t* pos)
 {
-    modelRangePair_t* mrptr = *mrp;
+    int32_t dt = time - key->time;
+    for (int k = 0; k < 3; k++)
+    {
+        pos[k] = key->pos[k] + ((key->vel[k] * dt) >> 16);
+    }
+}
 
+/**
+ * @brief Write our ship to a packet. Every FSNET_KEY_INTERVAL updates this is a keyframe. In between, only the fields
+ * which differ from the last keyframe are sent, and the position is sent as how far off the dead reckoned prediction
+ * from the last keyframe it is, usually in a byte per axis. Deltas are never chained, so a lost packet only loses one
+ * update, and a lost keyframe is made up for by the next one.
+ *
+ * @param tflight The flight state
+ * @param pp Where to write the ship
+ * @param now The time the packet is sent, which is in its header
+ * @return Where to write the next thing in the packet
+ */
+static uint8_t* flightNetWriteShip(flight_t* tflight, uint8_t* pp, uint32_t now)
+{
+    flightNetShip_t cur = {
+        .time  = now,
+        .aux   = tflight->killedByBooletID,
+        .flags = 1 | ((tflight->myHealth > 0) ? 0 : 2),
+        .color = tflight->was_hit_by_boolet ? 92 : 5, // Purple:Blue
+        .seq   = tflight->netKey.seq,
+    };
+    memcpy(cur.pos, tflight->planeloc, sizeof(cur.pos));
+    memcpy(cur.vel, tflight->lastSpeed, sizeof(cur.vel)); // mirrors velAt real speed = ( this * microsecond >> 16 )
+    for (int k = 0; k < 3; k++)
+    {
+        cur.rot[k] = tflight->hpr[k] >> 4;
+    }
+
+    // Keyframes are deltas from all zeros
+    flightNetShip_t zero        = {.time = now};
+    const flightNetShip_t* base = &tflight->netKey;
+    uint8_t mask                = 0;
+    if (tflight->netUpdatesToKey == 0)
+    {
+        base                     = &zero;
+        mask                     = FSNET_SHIP_KEY;
+        cur.seq                  = tflight->netKey.seq + 1;
+        tflight->netUpdatesToKey = FSNET_KEY_INTERVAL;
+    }
+    tflight->netUpdatesToKey--;
+
+    int16_t res[3];
+    flightNetPredict(base, now, res);
+    bool fitsInByte = true;
+    for (int k = 0; k < 3; k++)
+    {
+        res[k] = cur.pos[k] - res[k];
+        fitsInByte &= (res[k] >= INT8_MIN && res[k] <= INT8_MAX);
+    }
+    if (res[0] || res[1] || res[2])
+        mask |= fitsInByte ? FSNET_SHIP_POS8 : FSNET_SHIP_POS16;
+    if (memcmp(cur.vel, base->vel, sizeof(cur.vel)))
+        mask |= FSNET_SHIP_VEL;
+    if (memcmp(cur.rot, base->rot, sizeof(cur.rot)))
+        mask |= FSNET_SHIP_ROT;
+    if (cur.flags != base->flags || cur.aux != base->aux || cur.color != base->color)
+        mask |= FSNET_SHIP_STATUS;
+
+    *(pp++) = mask;
+    *(pp++) = cur.seq;
+    if (mask & FSNET_SHIP_POS8)
+    {
+        for (int k = 0; k < 3; k++)
+            *(pp++) = (int8_t)res[k];
+    }
+    if (mask & FSNET_SHIP_POS16)
+    {
+        memcpy(pp, res, sizeof(res));
+        pp += sizeof(res);
+    }
+    if (mask & FSNET_SHIP_VEL)
+    {
+        memcpy(pp, cur.vel, sizeof(cur.vel));
+        pp += sizeof(cur.vel);
+    }
+    if (mask & FSNET_SHIP_ROT)
+    {
+        memcpy(pp, cur.rot, sizeof(cur.rot));
+        pp += sizeof(cur.rot);
+    }
+    if (mask & FSNET_SHIP_STATUS)
+    {
+        *(pp++) = cur.flags;
+        memcpy(pp, &cur.aux, sizeof(cur.aux));
+        pp += sizeof(cur.aux);
+        *(pp++) = cur.color;
+    }
+
+    if (mask & FSNET_SHIP_KEY)
+    {
+        tflight->netKey = cur;
+    }
+    return pp;
+}
+
+/**
+ * @brief Read a ship written by flightNetWriteShip() into a peer. Deltas are ignored unless the peer has the keyframe
+ * they were made from
+ *
+ * @param tp The peer to read the ship into
+ * @param data The ship, after its shipNo
+ * @param dataend The end of the packet
+ * @param timeOnPeer The time the packet was sent, in the sender's timestamp
+ * @param[out] applied Set to true if the peer was updated
+ * @return Where the next thing in the packet is, or NULL if the packet is too short
+ */
+static const uint8_t* flightNetReadShip(multiplayerpeer_t* tp, const uint8_t* data, const uint8_t* dataend,
+                                       uint32_t timeOnPeer, bool* applied)
+{
+    *applied = false;
+    if (data + 2 > dataend)
+        return NULL;
+    uint8_t mask = *(data++);
+    uint8_t seq  = *(data++);
+
+    int len = ((mask & FSNET_SHIP_POS8) ? 3 : 0) + ((mask & FSNET_SHIP_POS16) ? 6 : 0)
+              + ((mask & FSNET_SHIP_VEL) ? 3 : 0) + ((mask & FSNET_SHIP_ROT) ? 3 : 0)
+              + ((mask & FSNET_SHIP_STATUS) ? 4 : 0);
+    if (data + len > dataend)
+        return NULL;
+
+    flightNetShip_t zero        = {.time = timeOnPeer, .seq = seq};
+    const flightNetShip_t* base = &zero;
+    if (!(mask & FSNET_SHIP_KEY))
+    {
+        base = &tp->netKey;
+        if (base->flags == 0 || base->seq != seq || (int32_t)(timeOnPeer - base->time) > FSNET_KEY_MAX_AGE_US)
+            return data + len;
+    }
+
+    flightNetShip_t cur = *base;
+    cur.time            = timeOnPeer;
+    flightNetPredict(base, timeOnPeer, cur.pos);
+    if (mask & FSNET_SHIP_POS8)
+    {
+        for (int k = 0; k < 3; k++)
+            cur.pos[k] += (int8_t)*(data++);
+    }
+    if (mask & FSNET_SHIP_POS16)
+    {
+        int16_t res[3];
+        memcpy(res, data, sizeof(res));
+        data += sizeof(res);
+        for (int k = 0; k < 3; k++)
+            cur.pos[k] += res[k];
+    }
+    if (mask & FSNET_SHIP_VEL)
+    {
+        memcpy(cur.vel, data, sizeof(cur.vel));
+        data += sizeof(cur.vel);
+    }
+    if (mask & FSNET_SHIP_ROT)
+    {
+        memcpy(cur.rot, data, sizeof(cur.rot));
+        data += sizeof(cur.rot);
+    }
+    if (mask & FSNET_SHIP_STATUS)
+    {
+        cur.flags = *(data++);
+        memcpy(&cur.aux, data, sizeof(cur.aux));
+        data += sizeof(cur.aux);
+        cur.color = *(data++);
+    }
+    cur.flags |= 1;
+
+    if (mask & FSNET_SHIP_KEY)
+    {
+        tp->netKey = cur;
+    }
+
+    memcpy(tp->posAt, cur.pos, sizeof(tp->posAt));
+    memcpy(tp->velAt, cur.vel, sizeof(tp->velAt));
+    memcpy(tp->rotAt, cur.rot, sizeof(tp->rotAt));
+    tp->basePeerFlags = cur.flags;
+    tp->auxPeerFlags  = cur.aux;
+    tp->reqColor      = cur.color;
+    *applied          = true;
+    return data;
+}
+
+static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now)
+{
     if (tflight->nNetworkServerExclusiveMode > 0)
         tflight->nNetworkServerExclusiveMode--;
 
@@ -2499,9 +3021,8 @@ static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePa
                 int r = tdModelVisibilitycheck(&tmod);
                 if (r >= 0)
                 {
-                    mrptr->model  = (const tdModel*)(intptr_t)(0x1000 + (p - ap));
-                    mrptr->mrange = r;
-                    mrptr++;
+                    flightQueueModel(tflight->enviromodels + FLIGHT_SORT_PEERS + (p - ap), r,
+                                     (const tdModel*)(intptr_t)(0x1000 + (p - ap)));
                 }
             }
         }
@@ -2532,9 +3053,8 @@ static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePa
                 int r = tdModelVisibilitycheck(&tmod);
                 if (r >= 0)
                 {
-                    mrptr->model  = (const tdModel*)(intptr_t)(0x2000 + (nm - nmbegin));
-                    mrptr->mrange = r;
-                    mrptr++;
+                    flightQueueModel(tflight->enviromodels + FLIGHT_SORT_NET_MODELS + (nm - nmbegin), r,
+                                     (const tdModel*)(intptr_t)(0x2000 + (nm - nmbegin)));
                 }
             }
         }
@@ -2546,6 +3066,7 @@ static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePa
         boolet_t* b         = allb;
         boolet_t* booletEnd = b + MAX_BOOLETS;
         int gen_ofs         = 0;
+        int sort_ofs        = FLIGHT_SORT_BOOLETS;
         do
         {
             for (; b != booletEnd; b++)
@@ -2567,9 +3088,8 @@ static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePa
                 int r = tdModelVisibilitycheck(&tmod);
                 if (r >= 0)
                 {
-                    mrptr->model  = (const tdModel*)(intptr_t)(0x0000 + (b - allb + gen_ofs));
-                    mrptr->mrange = r;
-                    mrptr++;
+                    flightQueueModel(tflight->enviromodels + sort_ofs + (b - allb), r,
+                                     (const tdModel*)(intptr_t)(0x0000 + (b - allb + gen_ofs)));
                 }
 
                 // Handle collision logic.
@@ -2626,6 +3146,7 @@ static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePa
                 b         = allb;
                 booletEnd = b + BOOLETSPERPLAYER;
                 gen_ofs   = 0x800;
+                sort_ofs  = FLIGHT_SORT_MY_BOOLETS;
                 continue;
             }
             else
@@ -2637,14 +3158,14 @@ static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePa
 
 #ifndef PROFILING
     // Only update our position to the network at 10Hz.
-    if (now > tflight->lastNetUpdate + 100000)
+    if (now > tflight->lastNetUpdate + FSNET_UPDATE_US)
     {
         tflight->lastNetUpdate = now;
         int NumActiveBoolets   = 0;
         int i;
         for (i = 0; i < BOOLETSPERPLAYER; i++)
         {
-            if (tflight->myBoolets[i].flags != 0)
+            if (tflight->myBoolets[i].flags != 0 && tflight->myBooletSends[i])
                 NumActiveBoolets++;
         }
 
@@ -2657,7 +3178,7 @@ static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePa
 
         uint32_t contents = 0;
         int bitct         = 0;
-        bitct += WriteUEQ(&contents, 1);
+        bitct += WriteUEQ(&contents, FSNET_PROTOCOL_DELTA);
         bitct += WriteUEQ(&contents, 0);
         bitct += WriteUEQ(&contents, 1);
         bitct += WriteUEQ(&contents, NumActiveBoolets);
@@ -2667,38 +3188,21 @@ static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePa
         FinalizeUEQ(&contents, bitct);
         *((uint32_t*)pp) = contents;
         pp += 4;
-        // XXX TODO: Here, we need to update peers with our position + boolets + status (alive/dead)
 
         // There are no models.
 
         // There is a ship - us.
-
-        *(pp++) = 0; // "shipNo"
-        memcpy(pp, tflight->planeloc, sizeof(tflight->planeloc));
-        pp += sizeof(tflight->planeloc);
-        memcpy(pp, tflight->lastSpeed, sizeof(tflight->lastSpeed));
-        pp += sizeof(tflight->lastSpeed); // mirrors velAt real speed = ( this * microsecond >> 16 )
-
-        int8_t orot[3];
-        orot[0] = tflight->hpr[0] >> 4;
-        orot[1] = tflight->hpr[1] >> 4;
-        orot[2] = tflight->hpr[2] >> 4;
-        memcpy(pp, orot, sizeof(orot));
-        pp += sizeof(orot);
-        uint8_t flags = 1 | ((tflight->myHealth > 0) ? 0 : 2);
-        memcpy(pp, &flags, sizeof(flags));
-        pp += sizeof(flags);
-        memcpy(pp, &tflight->killedByBooletID, sizeof(tflight->killedByBooletID));
-        pp += sizeof(tflight->killedByBooletID);
-        *(pp++)                    = tflight->was_hit_by_boolet ? 92 : 5; // Purple:Blue
+        *(pp++)                    = 0; // "shipNo"
+        pp                         = flightNetWriteShip(tflight, pp, now);
         tflight->was_hit_by_boolet = 0;
 
-        // Now, need to send boolets.
+        // Boolets fly on their own once fired, so they're only sent a few times
         for (i = 0; i < BOOLETSPERPLAYER; i++)
         {
             boolet_t* b = &tflight->myBoolets[i];
-            if (b->flags == 0)
+            if (b->flags == 0 || tflight->myBooletSends[i] == 0)
                 continue;
+            tflight->myBooletSends[i]--;
             *(pp++) = i; // Local "bulletID"
             memcpy(pp, &b->timeOfLaunch, sizeof(b->timeOfLaunch));
             pp += sizeof(b->timeOfLaunch);
@@ -2719,7 +3223,6 @@ static void FlightNetworkFrameCall(flight_t* tflight, uint32_t now, modelRangePa
         //XTOS_SET_INTLEVEL(XCHAL_EXCM_LEVEL);   // Disable Interrupts
         //XTOS_SET_INTLEVEL(0);  //re-enable interrupts.
     */
-    *mrp = mrptr;
 }
 
 typedef struct
@@ -2793,6 +3296,7 @@ static void FlightfnEspNowRecvCb(const esp_now_recv_info_t* esp_now_info, const
             thisPeer = allPeers + foundfree;
 
             thisPeer->timeOffsetOfPeerFromNow = np->timeOnPeer - now;
+            memset(&thisPeer->netKey, 0, sizeof(thisPeer->netKey));
             memcpy(thisPeer->mac, mac_addr, 6);
             thisPeer->basePeerFlags |= 1;
             peerId = hash;
@@ -2822,7 +3326,7 @@ static void FlightfnEspNowRecvCb(const esp_now_recv_info_t* esp_now_info, const
     uint32_t assetCounts = np->assetCounts;
 
     int protVer = ReadUEQ(&assetCounts);
-    if (protVer != 1)
+    if (protVer != 1 && protVer != FSNET_PROTOCOL_DELTA)
         return; // Try not to rev version.
     int modelCount  = ReadUEQ(&assetCounts);
     int shipCount   = ReadUEQ(&assetCounts);
@@ -2895,9 +3399,7 @@ static void FlightfnEspNowRecvCb(const esp_now_recv_info_t* esp_now_info, const
     {
         for (i = 0; i < shipCount; i++)
         {
-            if (data + 1 + sizeof(allPeers[0].velAt) + sizeof(allPeers[0].posAt) + sizeof(allPeers[0].rotAt)
-                    + sizeof(allPeers[0].basePeerFlags) + sizeof(allPeers[0].auxPeerFlags) + 1
-                > dataend)
+            if (data + 1 > dataend)
                 return;
 
             int readID = *(data++);
@@ -2907,21 +3409,40 @@ static void FlightfnEspNowRecvCb(const esp_now_recv_info_t* esp_now_info, const
                 shipNo = 0;
 
             multiplayerpeer_t* tp = allPeers + shipNo;
-            tp->timeOfUpdate      = peerSendInOurTime;
-
-            // Pos, Vel, Rot, RotVel + flags.
-            memcpy(tp->posAt, data, sizeof(tp->posAt));
-            data += sizeof(tp->posAt);
-            memcpy(tp->velAt, data, sizeof(tp->velAt));
-            data += sizeof(tp->velAt);
-            memcpy(tp->rotAt, data, sizeof(tp->rotAt));
-            data += sizeof(tp->rotAt);
-            memcpy(&tp->basePeerFlags, data, sizeof(tp->basePeerFlags));
-            data += sizeof(tp->basePeerFlags);
-            tp->basePeerFlags |= 1;
-            memcpy(&tp->auxPeerFlags, data, sizeof(tp->auxPeerFlags));
-            data += sizeof(tp->auxPeerFlags);
-            tp->reqColor = *(data++);
+
+            if (protVer == FSNET_PROTOCOL_DELTA)
+            {
+                bool applied;
+                data = flightNetReadShip(tp, data, dataend, np->timeOnPeer, &applied);
+                if (!data)
+                    return;
+                if (!applied)
+                    continue;
+                tp->timeOfUpdate = peerSendInOurTime;
+            }
+            else
+            {
+                if (data + sizeof(tp->velAt) + sizeof(tp->posAt) + sizeof(tp->rotAt) + sizeof(tp->basePeerFlags)
+                        + sizeof(tp->auxPeerFlags) + 1
+                    > dataend)
+                    return;
+
+                tp->timeOfUpdate = peerSendInOurTime;
+
+                // Pos, Vel, Rot, RotVel + flags.
+                memcpy(tp->posAt, data, sizeof(tp->posAt));
+                data += sizeof(tp->posAt);
+                memcpy(tp->velAt, data, sizeof(tp->velAt));
+                data += sizeof(tp->velAt);
+                memcpy(tp->rotAt, data, sizeof(tp->rotAt));
+                data += sizeof(tp->rotAt);
+                memcpy(&tp->basePeerFlags, data, sizeof(tp->basePeerFlags));
+                data += sizeof(tp->basePeerFlags);
+                tp->basePeerFlags |= 1;
+                memcpy(&tp->auxPeerFlags, data, sizeof(tp->auxPeerFlags));
+                data += sizeof(tp->auxPeerFlags);
+                tp->reqColor = *(data++);
+            }
 
             // uprintf( "%d %d %d - %d %d %d - %d %d %d %08x %08x    n",
             // tp->posAt[0],tp->posAt[1],tp->posAt[2],tp->velAt[0], tp->velAt[1], tp->velAt[2],
@@ -17,11 +17,11 @@
  * Host -> Client: CHARACTER_MSG
  * Client -> Host: CHARACTER_MSG
  * Host -> Client: READY_MSG
- * group Sent once a second
- * Host -> Client: SCORE_MSG
- * Client -> Host: SCORE_MSG
+ * group Sent once a second without other traffic
+ * Host -> Client: STATE_MSG (ping)
+ * Client -> Host: STATE_MSG
  * end
- * note over Host, Client: DEATH_MSG, BUMP_MSG, etc. sent intermittently
+ * note over Host, Client: STATE_MSG sent when score, lives, bumps or attacks change,\none at a time
  * @enduml
  */
 
@@ -43,7 +43,7 @@
 #include "lumberjackGame.h"
 
 #define LUMBERJACK_VLEN    7
-#define LUMBERJACK_VERSION "231121b"
+#define LUMBERJACK_VERSION "261018a"
 
 #define DEFAULT_HIGHSCORE 5000
 
@@ -66,6 +66,9 @@ static void lumberjackEspNowSendCb(const uint8_t* mac_addr, esp_now_send_status_
 static void lumberjackConCb(p2pInfo* p2p, connectionEvt_t evt);
 static void lumberjackMsgRxCb(p2pInfo* p2p, const uint8_t* payload, uint8_t len);
 static void lumberjackMsgTxCbFn(p2pInfo* p2p, messageStatus_t status, const uint8_t* data, uint8_t len);
+static void lumberjackSendMsg(const uint8_t* payload, uint8_t len);
+static void lumberjackResetNetState(void);
+static void lumberjackOnReceiveState(const uint8_t* payload, uint8_t len);
 
 static void lumberjackMenuCb(const char*, bool selected, uint32_t settingVal);
 
@@ -110,21 +113,8 @@ swadgeMode_t lumberjackMode = {
     .fnAdvancedUSB            = NULL,
 };
 
-typedef enum
-{
-    VERSION_MSG,
-    READY_MSG,
-    ATTACK_MSG,
-    DEATH_MSG,
-    SCORE_MSG,
-    CHARACTER_MSG,
-    BUMP_MSG,
-    HIGHSCORE_MSG
-} lumberjackMessageType_t;
-
 /// @brief Names of lumberjackMessageType_t, in order
-static const char* msg_names[] = {"VERSION_MSG", "READY_MSG",     "ATTACK_MSG", "DEATH_MSG",
-                                  "SCORE_MSG",   "CHARACTER_MSG", "BUMP_MSG",   "HIGHSCORE_MSG"};
+static const char* msg_names[] = {"VERSION_MSG", "READY_MSG", "CHARACTER_MSG", "HIGHSCORE_MSG", "STATE_MSG"};
 
 lumberjack_t* lumberjack = NULL;
 
@@ -573,84 +563,70 @@ static void lumberjackConCb(p2pInfo* p2p, connectionEvt_t evt)
 
 static void lumberjackMsgRxCb(p2pInfo* p2p, const uint8_t* payload, uint8_t len)
 {
-    // Do anything
+    if (len == 0 || payload[0] >= ARRAY_SIZE(msg_names))
+    {
+        return;
+    }
+
     ESP_LOGI(LUM_TAG, "p2p Receive (%s): %s", lumberjack->host ? "host" : "client", msg_names[payload[0]]);
 
     lumberjackQualityCheck();
 
-    if (len > 0)
+    if (payload[0] == VERSION_MSG)
     {
-        if (payload[0] == VERSION_MSG)
+        ESP_LOGD(LUM_TAG, "Version received!");
+        if (memcmp(&payload[1], LUMBERJACK_VERSION, LUMBERJACK_VLEN))
         {
-            ESP_LOGD(LUM_TAG, "Version received!");
-            if (memcmp(&payload[1], LUMBERJACK_VERSION, LUMBERJACK_VLEN))
-            {
-                ESP_LOGD("LUM_TAG", "We're in!");
-            }
-
-            if (false == lumberjack->host)
-            {
-                // If we are not the host, reply to the version with our own version
-                lumberjackSendVersion();
-            }
-            else
-            {
-                // If we are the host, follow the version transaction with a high score transaction
-                lumberjackSendHighScore();
-            }
+            ESP_LOGD("LUM_TAG", "We're in!");
         }
 
-        if (payload[0] == READY_MSG)
+        if (false == lumberjack->host)
         {
-            lumberjackPlayGame();
+            // If we are not the host, reply to the version with our own version
+            lumberjackSendVersion();
         }
-
-        if (payload[0] == ATTACK_MSG)
-        {
-            lumberjackOnReceiveAttack(payload, len);
-        }
-
-        if (payload[0] == SCORE_MSG)
+        else
         {
-            lumberjackOnReceiveScore(payload);
+            // If we are the host, follow the version transaction with a high score transaction
+            lumberjackSendHighScore();
         }
+    }
 
-        if (payload[0] == HIGHSCORE_MSG)
-        {
-            lumberjackOnReceiveHighScore(payload);
+    if (payload[0] == READY_MSG)
+    {
+        lumberjackPlayGame();
+    }
 
-            if (false == lumberjack->host)
-            {
-                // If we are not the host, reply to the high score with our own high score
-                lumberjackSendHighScore();
-            }
-        }
+    if (payload[0] == HIGHSCORE_MSG)
+    {
+        lumberjackOnReceiveHighScore(payload);
 
-        if (payload[0] == CHARACTER_MSG)
+        if (false == lumberjack->host)
         {
-            lumberjackOnReceiveCharacter(payload[1]);
+            // If we are not the host, reply to the high score with our own high score
+            lumberjackSendHighScore();
         }
+    }
 
-        if (payload[0] == BUMP_MSG)
-        {
-            lumberjackOnReceiveBump();
-        }
+    if (payload[0] == CHARACTER_MSG)
+    {
+        lumberjackOnReceiveCharacter(payload[1]);
+    }
 
-        if (payload[0] == DEATH_MSG)
-        {
-            lumberjackOnReceiveDeath(payload[1]);
-        }
+    if (payload[0] == STATE_MSG)
+    {
+        lumberjackOnReceiveState(payload, len);
+    }
 
-        /*
-        if (payload[0] == 0x19)
-        {
-            //int locX      = (int)payload[1] << 0 | (uint32_t)payload[2] << 8;
-            //int locY      = (int)payload[3] << 0 | (uint32_t)payload[4] << 8;
-            //uint8_t frame = (uint8_t)payload[5];
-            //ESP_LOGD(LUM_TAG,"Got %d,%d %d|", locX, locY, frame);
+    /*
+    if (payload[0] == 0x19)
+    {
+        //int locX      = (int)payload[1] << 0 | (uint32_t)payload[2] << 8;
+        //int locY      = (int)payload[3] << 0 | (uint32_t)payload[4] << 8;
+        //uint8_t frame = (uint8_t)payload[5];
+        //ESP_LOGD(LUM_TAG,"Got %d,%d %d|", locX, locY, frame);
 
-        }*/
-    }
+    }*/
 
     ESP_LOGD(LUM_TAG, "Received %d %d!\n", *payload, len);
 }
@@ -661,9 +637,7 @@ void lumberjackSendVersion(void)
     {
         uint8_t payload[1 + LUMBERJACK_VLEN] = {VERSION_MSG};
         memcpy(&payload[1], LUMBERJACK_VERSION, LUMBERJACK_VLEN);
-
-        ESP_LOGI(LUM_TAG, "p2p Send (%s) %s", lumberjack->host ? "host" : "client", msg_names[payload[0]]);
-        p2pSendMsg(&lumberjack->p2p, payload, sizeof(payload), lumberjackMsgTxCbFn);
+        lumberjackSendMsg(payload, sizeof(payload));
     }
 }
 
@@ -679,9 +653,7 @@ void lumberjackSendHighScore(void)
         payload[3] = score >> 16 & 0xFF;
         payload[2] = score >> 8 & 0xFF;
         payload[1] = score & 0xFF;
-
-        ESP_LOGI(LUM_TAG, "p2p Send (%s) %s", lumberjack->host ? "host" : "client", msg_names[payload[0]]);
-        p2pSendMsg(&lumberjack->p2p, payload, sizeof(payload), lumberjackMsgTxCbFn);
+        lumberjackSendMsg(payload, sizeof(payload));
     }
 }
 
@@ -690,20 +662,29 @@ void lumberjackSendGo(void)
     if (lumberjack->networked)
     {
         const uint8_t payload[] = {READY_MSG};
-        ESP_LOGI(LUM_TAG, "p2p Send (%s) %s", lumberjack->host ? "host" : "client", msg_names[payload[0]]);
-        p2pSendMsg(&lumberjack->p2p, payload, ARRAY_SIZE(payload), lumberjackMsgTxCbFn);
+        lumberjackSendMsg(payload, ARRAY_SIZE(payload));
     }
 }
 
-void lumberjackSendAttack(uint8_t* number)
+void lumberjackSendCharacter(uint8_t character)
 {
     if (lumberjack->networked)
     {
-        uint8_t payload[9] = {ATTACK_MSG};
-        memcpy(&payload[1], number, 8);
+        uint8_t payload[2] = {CHARACTER_MSG, character};
+        lumberjackSendMsg(payload, ARRAY_SIZE(payload));
+    }
+}
 
-        ESP_LOGI(LUM_TAG, "p2p Send (%s) %s", lumberjack->host ? "host" : "client", msg_names[payload[0]]);
-        p2pSendMsg(&lumberjack->p2p, payload, ARRAY_SIZE(payload), lumberjackMsgTxCbFn);
+void lumberjackSendAttack(uint8_t* number)
+{
+    if (lumberjack->networked)
+    {
+        lumberjack->netLocal.attacks++;
+        for (int i = 0; i < LUMBERJACK_NET_ENEMY_TYPES; i++)
+        {
+            lumberjack->netLocal.enemies[i] += number[i];
+        }
+        lumberjackSyncState();
     }
 }
 
@@ -711,9 +692,8 @@ void lumberjackSendBump(void)
 {
     if (lumberjack->networked)
     {
-        uint8_t payload[1] = {BUMP_MSG};
-        ESP_LOGI(LUM_TAG, "p2p Send (%s) %s", lumberjack->host ? "host" : "client", msg_names[payload[0]]);
-        p2pSendMsg(&lumberjack->p2p, payload, ARRAY_SIZE(payload), lumberjackMsgTxCbFn);
+        lumberjack->netLocal.bumps++;
+        lumberjackSyncState();
     }
 }
 
@@ -721,36 +701,116 @@ void lumberjackSendScore(int score)
 {
     if (lumberjack->networked)
     {
-        uint8_t payload[4] = {SCORE_MSG};
-
-        payload[3] = score >> 16 & 0xFF;
-        payload[2] = score >> 8 & 0xFF;
-        payload[1] = score & 0xFF;
-        ESP_LOGI(LUM_TAG, "p2p Send (%s) %s", lumberjack->host ? "host" : "client", msg_names[payload[0]]);
-        p2pSendMsg(&lumberjack->p2p, payload, ARRAY_SIZE(payload), lumberjackMsgTxCbFn);
+        lumberjack->netLocal.score = score;
+        lumberjackSyncState();
     }
 }
 
-void lumberjackSendCharacter(uint8_t character)
+void lumberjackSendDeath(uint8_t lives)
 {
     if (lumberjack->networked)
     {
-        uint8_t payload[2] = {CHARACTER_MSG, character};
-        ESP_LOGI(LUM_TAG, "p2p Send (%s) %s", lumberjack->host ? "host" : "client", msg_names[payload[0]]);
-        p2pSendMsg(&lumberjack->p2p, payload, ARRAY_SIZE(payload), lumberjackMsgTxCbFn);
+        lumberjack->netLocal.lives = lives;
+        lumberjackSyncState();
     }
 }
 
-void lumberjackSendDeath(uint8_t lives)
+/**
+ * @brief Ask the other Swadge to reply with a snapshot, so both know the connection is still alive
+ */
+void lumberjackSendPing(void)
 {
     if (lumberjack->networked)
     {
-        const uint8_t payload[2] = {DEATH_MSG, lives};
-        ESP_LOGI(LUM_TAG, "p2p Send (%s) %s", lumberjack->host ? "host" : "client", msg_names[payload[0]]);
-        p2pSendMsg(&lumberjack->p2p, payload, ARRAY_SIZE(payload), lumberjackMsgTxCbFn);
+        lumberjack->netPing = true;
+        lumberjackSyncState();
+    }
+}
+
+/**
+ * @brief Send a snapshot of everything in this Swadge's state which changed since the other Swadge last acknowledged
+ * one. Only one message is in flight at a time, so if one already is, nothing is sent now. Changes made in the meantime
+ * are merged into the next snapshot, which this should be called every frame to send
+ */
+void lumberjackSyncState(void)
+{
+    if (!lumberjack->networked || lumberjack->netTxBusy || CON_ESTABLISHED != lumberjack->conStatus)
+    {
+        return;
+    }
+
+    uint8_t payload[LUMBERJACK_NET_MAX_LEN];
+    uint8_t len = lumberjackEncodeState(&lumberjack->netLocal, &lumberjack->netAcked, lumberjack->netUnacked,
+                                        lumberjack->netPing, payload);
+    if (0 == payload[2] && !lumberjack->netReply)
+    {
+        return;
+    }
+
+    payload[1] = ++lumberjack->netSeq;
+
+    lumberjack->netUnacked |= payload[2] & ~LUMBERJACK_NET_PING;
+    lumberjack->netTxFrame = lumberjack->netLocal;
+    lumberjack->netTxState = true;
+    lumberjack->netPing    = false;
+    lumberjack->netReply   = false;
+    lumberjackSendMsg(payload, len);
+}
+
+/**
+ * @brief Apply a snapshot of the other Swadge's state. Fields which aren't in the snapshot haven't changed
+ *
+ * @param payload The STATE_MSG
+ * @param len The length of the STATE_MSG
+ */
+static void lumberjackOnReceiveState(const uint8_t* payload, uint8_t len)
+{
+    lumberjackNetEvents_t events;
+    if (!lumberjackApplyState(&lumberjack->netRemote, &lumberjack->netRemoteSeq, payload, len, &events))
+    {
+        return;
+    }
+
+    if (events.score)
+    {
+        lumberjackOnReceiveScore(lumberjack->netRemote.score);
+    }
+
+    if (events.lives)
+    {
+        lumberjackOnReceiveDeath(lumberjack->netRemote.lives);
+    }
+
+    if (events.bump)
+    {
+        lumberjackOnReceiveBump();
+    }
+
+    if (events.attacks > 0)
+    {
+        lumberjackOnReceiveAttack(events.attacks, events.enemies);
+    }
+
+    if (events.ping)
+    {
+        lumberjack->netReply = true;
+        lumberjackSyncState();
     }
 }
 
+/**
+ * @brief Send a message to the other Swadge
+ *
+ * @param payload The message
+ * @param len The length of the message
+ */
+static void lumberjackSendMsg(const uint8_t* payload, uint8_t len)
+{
+    ESP_LOGI(LUM_TAG, "p2p Send (%s) %s", lumberjack->host ? "host" : "client", msg_names[payload[0]]);
+    lumberjack->netTxBusy = true;
+    p2pSendMsg(&lumberjack->p2p, payload, len, lumberjackMsgTxCbFn);
+}
+
 /**
  * @brief This is called after transmitting a p2p packet and receiving (or not receiving) an ack
  *
@@ -765,27 +825,57 @@ static void lumberjackMsgTxCbFn(p2pInfo* p2p, messageStatus_t status, const uint
     {
         case MSG_ACKED:
         {
-            // All good
+            // The other Swadge has everything in the snapshot, so the next one only needs what changed since
+            if (lumberjack->netTxState)
+            {
+                lumberjack->netAcked   = lumberjack->netTxFrame;
+                lumberjack->netUnacked = 0;
+            }
             break;
         }
         case MSG_FAILED:
         {
-            // TODO figure out what to do if a message fails to transmit (i.e. no ack). Retry?
+            // A failed snapshot is covered by the next one, which is still relative to the last acknowledged one
             ESP_LOGI(LUM_TAG, "Failed?");
             break;
         }
     }
+
+    lumberjack->netTxBusy  = false;
+    lumberjack->netTxState = false;
+}
+
+/**
+ * @brief Reset the versus state sync for a new connection
+ */
+static void lumberjackResetNetState(void)
+{
+    memset(&lumberjack->netLocal, 0, sizeof(lumberjack->netLocal));
+    lumberjack->netLocal.lives = LUMBERJACK_NET_NO_LIVES;
+
+    lumberjack->netAcked     = lumberjack->netLocal;
+    lumberjack->netTxFrame   = lumberjack->netLocal;
+    lumberjack->netRemote    = lumberjack->netLocal;
+    lumberjack->netSeq       = 0;
+    lumberjack->netRemoteSeq = 0;
+    lumberjack->netUnacked   = 0;
+    lumberjack->netTxBusy    = false;
+    lumberjack->netTxState   = false;
+    lumberjack->netPing      = false;
+    lumberjack->netReply     = false;
 }
 
 void lumberjackInitp2p()
 {
     p2pDeinit(&lumberjack->p2p);
+    lumberjackResetNetState();
     lumberjack->conStatus = CON_LOST;
     p2pInitialize(&lumberjack->p2p, (lumberjack->gameMode == LUMBERJACK_MODE_PANIC ? 0x13 : 0x15), lumberjackConCb,
                   lumberjackMsgRxCb, -70);
     p2pStartConnection(&lumberjack->p2p);
 }
 
+
 static void lumberjackMenuCb(const char* label, bool selected, uint32_t settingVal)
 {
     if (selected)
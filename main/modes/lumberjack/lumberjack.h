@@ -5,6 +5,7 @@
 
 #include "lumberjackEntity.h"
 #include "lumberjackPlayer.h"
+#include "lumberjackNet.h"
 
 extern const char lumberjackName[];
 extern const char* LUM_TAG;
@@ -63,6 +64,19 @@ typedef struct
     lumberjackGameType_t gameMode;
     lumberjackUnlock_t save;
 
+    // Versus state sync
+    lumberjackNetState_t netLocal;   ///< This Swadge's state
+    lumberjackNetState_t netAcked;   ///< This Swadge's state as last acknowledged by the other Swadge
+    lumberjackNetState_t netTxFrame; ///< This Swadge's state as of the snapshot in flight
+    lumberjackNetState_t netRemote;  ///< The other Swadge's state
+    uint8_t netSeq;                  ///< The sequence number of the last snapshot sent
+    uint8_t netRemoteSeq;            ///< The sequence number of the last snapshot received
+    uint8_t netUnacked;              ///< The flags of the fields sent since the last acknowledged snapshot
+    bool netTxBusy;                  ///< true while any message is waiting to be acknowledged
+    bool netTxState;                 ///< true while a snapshot is waiting to be acknowledged
+    bool netPing;                    ///< true to send a snapshot asking for a reply, even if nothing changed
+    bool netReply;                   ///< true to send a snapshot, even if nothing changed
+
     led_t playerColor;
 
     const char** charactersArray;
@@ -164,12 +178,13 @@ typedef struct
     int comboTime;
     int comboAmount;
 
-    uint8_t attackQueue[8];
+    uint8_t attackQueue[LUMBERJACK_NET_ENEMY_TYPES];
 
     int wakeupSignal;
     int lastResponseSignal;
 
     wsg_t floorTiles[20];
+    bool floorTileOpaque[20];
     wsg_t animationTiles[20];
     wsg_t minicharacters[4];
     wsg_t itemIcons[18];
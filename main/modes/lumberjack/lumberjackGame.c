@@ -66,6 +66,8 @@
 static lumberjackTile_t* lumberjackGetTile(int x, int y);
 static void lumberjackUpdateEntity(lumberjackEntity_t* entity, int64_t elapsedUs);
 static bool lumberjackIsCollisionTile(int index);
+static bool lumberjackIsWsgOpaque(const wsg_t* wsg);
+static void lumberjackDrawTileRun(const wsg_t* tile, int16_t x, int16_t y, int count, bool opaque);
 
 bool lumberjackLoadLevel(void);
 void lumberjackOnLocalPlayerDeath(void);
@@ -157,6 +159,12 @@ void lumberjackStartGameMode(lumberjack_t* main, uint8_t characterIndex)
     loadWsg("lumbers_itemused_block.wsg", &lumv->floorTiles[10], true);
     loadWsg("lumbers_rtile_1.wsg", &lumv->floorTiles[11], true);
 
+    // Runs of floor tiles without transparent pixels can be copied across the screen instead of drawn one by one
+    for (int i = 0; i < ARRAY_SIZE(lumv->floorTiles); i++)
+    {
+        lumv->floorTileOpaque[i] = lumberjackIsWsgOpaque(&lumv->floorTiles[i]);
+    }
+
     // Loading Animation Tiles
     loadWsg("lumbers_water_floor1.wsg", &lumv->animationTiles[0], true);
     loadWsg("lumbers_water_floor2.wsg", &lumv->animationTiles[1], true);
@@ -865,15 +873,18 @@ void lumberjackGameLoop(int64_t elapsedUs)
         // If we are the host
         if (lumv->lumberjackMain->host)
         {
-            // Send our score every second to ping.
-            // The client will respond with their score
+            // Ping if nothing was heard for a second.
+            // The client will respond with a snapshot
             if (lumv->wakeupSignal < 0)
             {
                 lumv->wakeupSignal = 100;
-                lumberjackSendScore(lumv->score);
+                lumberjackSendPing();
             }
         }
 
+        // Send whatever changed since the last snapshot, if one isn't still in flight
+        lumberjackSyncState();
+
         if (lumv->lastResponseSignal <= 0)
         {
             bzrStop(true);
@@ -1998,12 +2009,12 @@ void lumberjackQualityCheck()
     lumv->lastResponseSignal = 2000;
 }
 
-void lumberjackOnReceiveAttack(const uint8_t* attack, int len)
+void lumberjackOnReceiveAttack(uint8_t attacks, const uint8_t* enemies)
 {
     if (lumv->gameType == LUMBERJACK_MODE_PANIC)
     {
         lumv->waterDirection = -1; // Even if it is draining
-        lumv->waterSpeed -= 5;
+        lumv->waterSpeed -= 5 * attacks;
         if (lumv->waterSpeed < 0)
         {
             lumv->waterSpeed = 0;
@@ -2012,9 +2023,9 @@ void lumberjackOnReceiveAttack(const uint8_t* attack, int len)
 
     if (lumv->gameType == LUMBERJACK_MODE_ATTACK)
     {
-        for (int i = 1; i < len; i++)
+        for (int i = 0; i < LUMBERJACK_NET_ENEMY_TYPES; i++)
         {
-            int rem = attack[i];
+            int rem = enemies[i];
             for (int n = 0; n < ARRAY_SIZE(lumv->enemy); n++)
             {
                 if (rem <= 0)
@@ -2023,7 +2034,7 @@ void lumberjackOnReceiveAttack(const uint8_t* attack, int len)
                 if (lumv->enemy[n] == NULL || lumv->enemy[n]->queueable)
                     continue;
 
-                if (lumv->enemy[n]->type == i - 1)
+                if (lumv->enemy[n]->type == i)
                 {
                     lumv->enemy[n]->queueable = true;
                     rem--;
@@ -2045,16 +2056,9 @@ void lumberjackOnReceiveAttack(const uint8_t* attack, int len)
     }
 }
 
-void lumberjackOnReceiveScore(const uint8_t* score)
+void lumberjackOnReceiveScore(int score)
 {
-    int locX        = (int)score[1] << 0 | (uint32_t)score[2] << 8 | (uint32_t)score[3] << 16;
-    lumv->highscore = locX;
-
-    // If we are not the host, reply with our score
-    if (false == lumv->lumberjackMain->host)
-    {
-        lumberjackSendScore(lumv->score);
-    }
+    lumv->highscore = score;
 }
 
 void lumberjackOnReceiveHighScore(const uint8_t* score)
@@ -2470,54 +2474,129 @@ void lumberjackUpdate(int64_t elapseUs)
 
 void lumberjackTileMap(void)
 {
-    for (int y = 0; y < lumv->currentMapHeight; y++)
+    // Only draw the rows which can be on screen. Bumped tiles are drawn a little above their row, so draw one more row
+    // below the screen too
+    int firstRow = MAX(0, lumv->yOffset / LUMBERJACK_TILE_SIZE);
+    int lastRow  = MIN(lumv->currentMapHeight, (lumv->yOffset + TFT_HEIGHT) / LUMBERJACK_TILE_SIZE + 2);
+    int lastCol  = MIN(LUMBERJACK_MAP_WIDTH, (TFT_WIDTH + LUMBERJACK_TILE_SIZE - 1) / LUMBERJACK_TILE_SIZE);
+
+    for (int y = firstRow; y < lastRow; y++)
     {
-        for (int x = 0; x < LUMBERJACK_MAP_WIDTH; x++)
-        {
-            int index = (y * LUMBERJACK_MAP_WIDTH) + x;
+        const lumberjackTile_t* row = &lumv->tile[y * LUMBERJACK_MAP_WIDTH];
+        int16_t rowY                = (y * LUMBERJACK_TILE_SIZE) - lumv->yOffset;
 
-            int tileIndex = lumv->tile[index].type;
-            int offset    = lumv->tile[index].offset;
+        for (int x = 0; x < lastCol; x++)
+        {
+            int tileIndex = row[x].type;
+            int offset    = row[x].offset;
 
-            if ((y * LUMBERJACK_TILE_SIZE) - lumv->yOffset >= -16)
+            if ((tileIndex > 0 && tileIndex < 11) || (tileIndex == 11 && !lumv->itemBlockReady))
             {
-                if (tileIndex > 0 && tileIndex < 15)
+                // Draw runs of the same floor tile together, as long as none of them are bumped
+                int runLength = 1;
+                if (0 == offset)
                 {
-                    if (tileIndex < 11)
-                    {
-                        drawWsgSimple(&lumv->floorTiles[tileIndex - 1], x * LUMBERJACK_TILE_SIZE,
-                                      (y * LUMBERJACK_TILE_SIZE) - lumv->yOffset - offset);
-                    }
-                    else if (tileIndex == 11)
-                    {
-                        if (lumv->itemBlockReady)
-                        {
-                            drawWsgSimple(
-                                &lumv->unusedBlockSprite[lumv->stageAnimationFrame % LUMBERJACK_BLOCK_ANIMATION_MAX],
-                                x * LUMBERJACK_TILE_SIZE, (y * LUMBERJACK_TILE_SIZE) - lumv->yOffset - offset);
-                        }
-                        else
-                        {
-                            drawWsgSimple(&lumv->floorTiles[tileIndex - 1], x * LUMBERJACK_TILE_SIZE,
-                                          (y * LUMBERJACK_TILE_SIZE) - lumv->yOffset - offset);
-                        }
-                    }
-                    else if (tileIndex == 12)
-                    {
-                        drawWsgSimple(&lumv->animationTiles[12], x * LUMBERJACK_TILE_SIZE,
-                                      (y * LUMBERJACK_TILE_SIZE) - lumv->yOffset);
-                    }
-                    else if (tileIndex == 13)
+                    while (x + runLength < lastCol && row[x + runLength].type == tileIndex
+                           && row[x + runLength].offset == 0)
                     {
-                        drawWsgSimple(&lumv->animationTiles[12 + (offset % LUMBERJACK_ROTATE_ANIMATION_MAX)],
-                                      x * LUMBERJACK_TILE_SIZE, (y * LUMBERJACK_TILE_SIZE) - lumv->yOffset);
+                        runLength++;
                     }
                 }
+
+                lumberjackDrawTileRun(&lumv->floorTiles[tileIndex - 1], x * LUMBERJACK_TILE_SIZE, rowY - offset,
+                                      runLength, lumv->floorTileOpaque[tileIndex - 1]);
+                x += runLength - 1;
+            }
+            else if (tileIndex == 11)
+            {
+                drawWsgSimple(&lumv->unusedBlockSprite[lumv->stageAnimationFrame % LUMBERJACK_BLOCK_ANIMATION_MAX],
+                              x * LUMBERJACK_TILE_SIZE, rowY - offset);
             }
+            else if (tileIndex == 12)
+            {
+                drawWsgSimple(&lumv->animationTiles[12], x * LUMBERJACK_TILE_SIZE, rowY);
+            }
+            else if (tileIndex == 13)
+            {
+                drawWsgSimple(&lumv->animationTiles[12 + (offset % LUMBERJACK_ROTATE_ANIMATION_MAX)],
+                              x * LUMBERJACK_TILE_SIZE, rowY);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Draw a horizontal run of the same tile
+ *
+ * If the tile has no transparent pixels, it's drawn once and then copied across the rest of the run a row at a time,
+ * doubling the copied width each time
+ *
+ * @param tile The tile to draw
+ * @param x The x offset of the first tile
+ * @param y The y offset of the tiles
+ * @param count The number of tiles in the run
+ * @param opaque true if the tile has no transparent pixels
+ */
+static void lumberjackDrawTileRun(const wsg_t* tile, int16_t x, int16_t y, int count, bool opaque)
+{
+    drawWsgSimple(tile, x, y);
+
+    if (count == 1)
+    {
+        return;
+    }
+
+    // The first tile has to be entirely on screen horizontally to be copied
+    if (!opaque || x < 0 || x + tile->w > TFT_WIDTH)
+    {
+        for (int i = 1; i < count; i++)
+        {
+            drawWsgSimple(tile, x + i * tile->w, y);
+        }
+        return;
+    }
+
+    int16_t xEnd = MIN(x + count * tile->w, TFT_WIDTH);
+    int16_t yMin = MAX(y, 0);
+    int16_t yMax = MIN(y + tile->h, TFT_HEIGHT);
+
+    paletteColor_t* fb = getPxTftFramebuffer();
+    for (int16_t py = yMin; py < yMax; py++)
+    {
+        paletteColor_t* px = &fb[py * TFT_WIDTH];
+        int16_t filled     = tile->w;
+        while (x + filled < xEnd)
+        {
+            int16_t len = MIN(filled, xEnd - (x + filled));
+            memcpy(&px[x + filled], &px[x], len);
+            filled += len;
         }
     }
 }
 
+/**
+ * @brief Check if a WSG has no transparent pixels
+ *
+ * @param wsg The WSG to check
+ * @return true if every pixel is opaque, false if any are transparent or the WSG isn't loaded
+ */
+static bool lumberjackIsWsgOpaque(const wsg_t* wsg)
+{
+    if (NULL == wsg->px)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < wsg->w * wsg->h; i++)
+    {
+        if (cTransparent == wsg->px[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void lumberjackDrawWaterLevel(void)
 {
     // If GameMode is Panic... draw the water
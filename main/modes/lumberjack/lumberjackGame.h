@@ -35,9 +35,11 @@ void lumberjackSendScore(int score);
 void lumberjackSendCharacter(uint8_t character);
 void lumberjackSendDeath(uint8_t lives);
 void lumberjackSendBump(void);
+void lumberjackSendPing(void);
+void lumberjackSyncState(void);
 
-void lumberjackOnReceiveAttack(const uint8_t* attack, int len);
-void lumberjackOnReceiveScore(const uint8_t* score);
+void lumberjackOnReceiveAttack(uint8_t attacks, const uint8_t* enemies);
+void lumberjackOnReceiveScore(int score);
 void lumberjackOnReceiveCharacter(uint8_t character);
 void lumberjackOnReceiveDeath(uint8_t lives);
 void lumberjackOnReceiveBump(void);
@@ -0,0 +1,148 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <string.h>
+
+#include "lumberjackNet.h"
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Write a snapshot of everything in a state which changed since the acknowledged state. The sequence number
+ * is left for the caller to fill in
+ *
+ * Fields sent in a snapshot which wasn't acknowledged may have arrived anyway, so they're sent again until one is. If
+ * they weren't, a field which changed back to its acknowledged value would never be sent, and the other Swadge would
+ * keep the value from the unacknowledged snapshot.
+ *
+ * @param local The state to send
+ * @param acked The state the other Swadge last acknowledged
+ * @param unacked The flags of the fields sent since the last acknowledged snapshot
+ * @param ping true to ask the other Swadge for a snapshot in reply
+ * @param[out] payload Written with the STATE_MSG, at most ::LUMBERJACK_NET_MAX_LEN bytes. The flags are 0 if there is
+ * nothing to send
+ * @return The length of the STATE_MSG
+ */
+uint8_t lumberjackEncodeState(const lumberjackNetState_t* local, const lumberjackNetState_t* acked, uint8_t unacked,
+                              bool ping, uint8_t* payload)
+{
+    uint8_t len   = LUMBERJACK_NET_HDR_LEN;
+    uint8_t flags = 0;
+
+    if (ping)
+    {
+        flags |= LUMBERJACK_NET_PING;
+    }
+
+    if (local->score != acked->score || (unacked & LUMBERJACK_NET_SCORE))
+    {
+        flags |= LUMBERJACK_NET_SCORE;
+        payload[len++] = local->score & 0xFF;
+        payload[len++] = local->score >> 8 & 0xFF;
+        payload[len++] = local->score >> 16 & 0xFF;
+    }
+
+    if (local->lives != acked->lives || (unacked & LUMBERJACK_NET_LIVES))
+    {
+        flags |= LUMBERJACK_NET_LIVES;
+        payload[len++] = local->lives;
+    }
+
+    if (local->bumps != acked->bumps || (unacked & LUMBERJACK_NET_BUMPS))
+    {
+        flags |= LUMBERJACK_NET_BUMPS;
+        payload[len++] = local->bumps;
+    }
+
+    if (local->attacks != acked->attacks || memcmp(local->enemies, acked->enemies, sizeof(local->enemies))
+        || (unacked & LUMBERJACK_NET_ATTACKS))
+    {
+        flags |= LUMBERJACK_NET_ATTACKS;
+        payload[len++] = local->attacks;
+        memcpy(&payload[len], local->enemies, sizeof(local->enemies));
+        len += sizeof(local->enemies);
+    }
+
+    payload[0] = STATE_MSG;
+    payload[1] = 0;
+    payload[2] = flags;
+    return len;
+}
+
+/**
+ * @brief Apply a snapshot to the copy of the other Swadge's state, and find what happened since the last one applied
+ *
+ * @param remote The other Swadge's state, updated with the snapshot
+ * @param remoteSeq The sequence number of the last snapshot applied, updated with the snapshot's
+ * @param payload The STATE_MSG
+ * @param len The length of the STATE_MSG
+ * @param[out] events Written with what happened since the last snapshot applied
+ * @return true if the snapshot was applied, false if it was malformed or older than one already applied
+ */
+bool lumberjackApplyState(lumberjackNetState_t* remote, uint8_t* remoteSeq, const uint8_t* payload, uint8_t len,
+                          lumberjackNetEvents_t* events)
+{
+    memset(events, 0, sizeof(lumberjackNetEvents_t));
+
+    if (len < LUMBERJACK_NET_HDR_LEN)
+    {
+        return false;
+    }
+
+    uint8_t flags     = payload[2];
+    uint8_t expectLen = LUMBERJACK_NET_HDR_LEN + ((flags & LUMBERJACK_NET_SCORE) ? 3 : 0)
+                        + ((flags & LUMBERJACK_NET_LIVES) ? 1 : 0) + ((flags & LUMBERJACK_NET_BUMPS) ? 1 : 0)
+                        + ((flags & LUMBERJACK_NET_ATTACKS) ? 1 + LUMBERJACK_NET_ENEMY_TYPES : 0);
+
+    // Drop malformed snapshots, and ones older than a snapshot already applied
+    if (len < expectLen || (int8_t)(payload[1] - *remoteSeq) <= 0)
+    {
+        return false;
+    }
+    *remoteSeq = payload[1];
+
+    const uint8_t* field = &payload[LUMBERJACK_NET_HDR_LEN];
+
+    if (flags & LUMBERJACK_NET_SCORE)
+    {
+        remote->score = (int32_t)field[0] | (int32_t)field[1] << 8 | (int32_t)field[2] << 16;
+        field += 3;
+        events->score = true;
+    }
+
+    if (flags & LUMBERJACK_NET_LIVES)
+    {
+        remote->lives = *field++;
+        events->lives = true;
+    }
+
+    if (flags & LUMBERJACK_NET_BUMPS)
+    {
+        // Bumps which arrive together only bump once
+        if (remote->bumps != *field)
+        {
+            remote->bumps = *field;
+            events->bump  = true;
+        }
+        field++;
+    }
+
+    if (flags & LUMBERJACK_NET_ATTACKS)
+    {
+        // The counters are totals, so the difference is what was sent since the last snapshot
+        events->attacks = field[0] - remote->attacks;
+        for (int i = 0; i < LUMBERJACK_NET_ENEMY_TYPES; i++)
+        {
+            events->enemies[i] = field[1 + i] - remote->enemies[i];
+        }
+
+        remote->attacks = field[0];
+        memcpy(remote->enemies, &field[1], sizeof(remote->enemies));
+    }
+
+    events->ping = (flags & LUMBERJACK_NET_PING);
+    return true;
+}
@@ -0,0 +1,69 @@
+#ifndef _LUMBERJACK_NET_H_
+#define _LUMBERJACK_NET_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/// The types of lumberjack's p2p messages, which are each message's first byte
+typedef enum
+{
+    VERSION_MSG,
+    READY_MSG,
+    CHARACTER_MSG,
+    HIGHSCORE_MSG,
+    STATE_MSG
+} lumberjackMessageType_t;
+
+/// The number of enemy types which can be sent as an attack
+#define LUMBERJACK_NET_ENEMY_TYPES 8
+
+/// The lives in a lumberjackNetState_t before the player has died
+#define LUMBERJACK_NET_NO_LIVES 0xFF
+
+/**
+ * @brief The game state one Swadge shares with the other during a versus game
+ *
+ * Counters are totals since the game started and wrap around, so the other Swadge can tell how many new events a
+ * snapshot holds no matter how many snapshots were merged or lost along the way
+ */
+typedef struct
+{
+    int32_t score;                               ///< The player's score
+    uint8_t lives;                               ///< The player's lives, or LUMBERJACK_NET_NO_LIVES
+    uint8_t bumps;                               ///< How many times the player has bumped the other player
+    uint8_t attacks;                             ///< How many attacks the player has sent
+    uint8_t enemies[LUMBERJACK_NET_ENEMY_TYPES]; ///< How many enemies of each type the player has sent
+} lumberjackNetState_t;
+
+// Flags for which fields follow the header of a STATE_MSG, in this order
+#define LUMBERJACK_NET_PING    0x01 ///< The sender wants a snapshot in reply, to know the connection is alive
+#define LUMBERJACK_NET_SCORE   0x02 ///< The 24 bit score follows
+#define LUMBERJACK_NET_LIVES   0x04 ///< The lives follow
+#define LUMBERJACK_NET_BUMPS   0x08 ///< The bump count follows
+#define LUMBERJACK_NET_ATTACKS 0x10 ///< The attack count and the count of each enemy type sent follow
+
+/// The length of a STATE_MSG header: the message type, sequence number and flags
+#define LUMBERJACK_NET_HDR_LEN 3
+
+/// The length of a STATE_MSG with every field
+#define LUMBERJACK_NET_MAX_LEN (LUMBERJACK_NET_HDR_LEN + 3 + 1 + 1 + 1 + LUMBERJACK_NET_ENEMY_TYPES)
+
+/**
+ * @brief What happened to the other Swadge between two snapshots
+ */
+typedef struct
+{
+    bool score;                                  ///< true if the score changed
+    bool lives;                                  ///< true if the lives changed
+    bool bump;                                   ///< true if the other player bumped this one at least once
+    bool ping;                                   ///< true if the other Swadge wants a snapshot in reply
+    uint8_t attacks;                             ///< How many attacks were sent
+    uint8_t enemies[LUMBERJACK_NET_ENEMY_TYPES]; ///< How many enemies of each type were sent
+} lumberjackNetEvents_t;
+
+uint8_t lumberjackEncodeState(const lumberjackNetState_t* local, const lumberjackNetState_t* acked, uint8_t unacked,
+                              bool ping, uint8_t* payload);
+bool lumberjackApplyState(lumberjackNetState_t* remote, uint8_t* remoteSeq, const uint8_t* payload, uint8_t len,
+                          lumberjackNetEvents_t* events);
+
+#endif
@@ -191,6 +191,23 @@ void paintDrawSquareWave(paintCanvas_t* canvas, point_t* points, uint8_t numPoin
 
 void paintDrawPaintBucket(paintCanvas_t* canvas, point_t* points, uint8_t numPoints, uint16_t size, paletteColor_t col)
 {
-    floodFill(canvas->x + canvas->xScale * points[0].x, canvas->y + canvas->yScale * points[0].y, col, canvas->x,
-              canvas->y, canvas->x + canvas->xScale * canvas->w, canvas->y + canvas->yScale * canvas->h);
+    // Fill the image itself, which has xScale * yScale times fewer pixels than its copy on the screen
+    uint32_t numPx      = canvas->w * canvas->h;
+    paletteColor_t* img = canvas->buffer ? malloc(numPx * sizeof(paletteColor_t)) : NULL;
+
+    if (NULL == img)
+    {
+        // Fall back to filling the screen, which gets synced back to the canvas afterward
+        floodFill(canvas->x + canvas->xScale * points[0].x, canvas->y + canvas->yScale * points[0].y, col, canvas->x,
+                  canvas->y, canvas->x + canvas->xScale * canvas->w, canvas->y + canvas->yScale * canvas->h);
+        return;
+    }
+
+    paintUnpackPixels(canvas, 0, numPx, img);
+    floodFillArea(img, canvas->w, points[0].x, points[0].y, col, 0, 0, canvas->w, canvas->h);
+    paintPackPixelsInto(canvas, 0, numPx, img);
+    free(img);
+
+    // The screen is synced back to the canvas after drawing, so it has to show the fill too
+    paintBlitCanvas(canvas);
 }
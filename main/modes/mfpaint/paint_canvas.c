@@ -1,47 +1,237 @@
 #include "paint_canvas.h"
 
+#include <string.h>
+
 #include "hdw-tft.h"
 #include "paint_common.h"
 #include "paint_util.h"
 
-static size_t _paintSerialize(uint8_t* dest, const paintCanvas_t* canvas, const wsg_t* wsg, size_t offset, size_t count,
-                              const paletteColor_t palette[16]);
+static void paintBuildPaletteIndex(const paletteColor_t palette[16], uint8_t paletteIndex[cTransparent + 1]);
+static void paintPackPixels(uint8_t* dest, uint32_t first, uint32_t count, const paletteColor_t* in,
+                            const uint8_t paletteIndex[cTransparent + 1]);
 
 /**
- * @brief Draw a buffered canvas to the screen, overwriting whatever was drawn previously
- *
- * Does nothing on a canvas with \c{buffered == false}
+ * @brief Draw a canvas to the screen, overwriting whatever was drawn previously
  *
- * @param canvas The buffered canvas to draw to the screen
+ * @param canvas The canvas to draw to the screen
  */
 void paintBlitCanvas(const paintCanvas_t* canvas)
 {
-    if (!canvas->buffered || !canvas->buffer)
+    paintBlitCanvasRect(canvas, 0, 0, canvas->w, canvas->h);
+}
+
+/**
+ * @brief Draw part of a canvas to the screen, overwriting whatever was drawn previously
+ *
+ * Each canvas row is unpacked once and drawn as runs of scaled pixels, and the rest of its scaled rows are copied from
+ * the first.
+ *
+ * @param canvas The canvas to draw to the screen
+ * @param x0 The first canvas column to draw
+ * @param y0 The first canvas row to draw
+ * @param x1 The canvas column after the last one to draw
+ * @param y1 The canvas row after the last one to draw
+ */
+void paintBlitCanvasRect(const paintCanvas_t* canvas, int x0, int y0, int x1, int y1)
+{
+    if (!canvas->buffer)
+    {
+        PAINT_LOGE("Attempting to blit a canvas with no buffer! Doing nothing!");
+        return;
+    }
+
+    x0 = MAX(x0, 0);
+    y0 = MAX(y0, 0);
+    x1 = MIN(x1, canvas->w);
+    y1 = MIN(y1, canvas->h);
+    if (x0 >= x1 || y0 >= y1)
+    {
+        return;
+    }
+
+    // The part of the screen the columns cover
+    int sx0 = MAX(canvas->x + x0 * canvas->xScale, 0);
+    int sx1 = MIN(canvas->x + x1 * canvas->xScale, TFT_WIDTH);
+    if (sx0 >= sx1)
     {
-        PAINT_LOGE("Attempting to blit from a non-buffered canvas! Doing nothing!");
         return;
     }
 
-    // Super simple
-    paintDeserialize(canvas, canvas->buffer, 0, paintGetStoredSize(canvas));
+    paletteColor_t* fb = getPxTftFramebuffer();
+    paletteColor_t line[x1 - x0];
+
+    for (int r = y0; r < y1; r++)
+    {
+        int sy0 = MAX(canvas->y + r * canvas->yScale, 0);
+        int sy1 = MIN(canvas->y + (r + 1) * canvas->yScale, TFT_HEIGHT);
+        if (sy0 >= sy1)
+        {
+            continue;
+        }
+
+        paintUnpackPixels(canvas, r * canvas->w + x0, x1 - x0, line);
+
+        paletteColor_t* row = &fb[sy0 * TFT_WIDTH];
+        if (canvas->xScale == 1)
+        {
+            memcpy(&row[sx0], &line[sx0 - (canvas->x + x0)], sx1 - sx0);
+        }
+        else
+        {
+            for (int c = 0; c < x1 - x0; c++)
+            {
+                int px0 = MAX(canvas->x + (x0 + c) * canvas->xScale, sx0);
+                int px1 = MIN(canvas->x + (x0 + c + 1) * canvas->xScale, sx1);
+                if (px0 < px1)
+                {
+                    memset(&row[px0], line[c], px1 - px0);
+                }
+            }
+        }
+
+        for (int sy = sy0 + 1; sy < sy1; sy++)
+        {
+            memcpy(&fb[sy * TFT_WIDTH + sx0], &row[sx0], sx1 - sx0);
+        }
+    }
 }
 
 /**
- * @brief Copy a canvas from the screen into the buffer, overwriting whatever was stored previously
+ * @brief Copy a canvas from the screen into the buffer, overwriting whatever was stored previously. Use this after
+ * drawing on the canvas with screen drawing functions
  *
- * Does nothing on a canvas with \c{buffered == false}
- *
- * @param canvas The buffered canvas to copy from the screen
+ * @param canvas The canvas to copy from the screen
  */
 void paintSyncCanvas(paintCanvas_t* canvas)
 {
-    if (!canvas->buffered || !canvas->buffer)
+    paintSyncCanvasRect(canvas, 0, 0, canvas->w, canvas->h);
+}
+
+/**
+ * @brief Copy part of a canvas from the screen into the buffer. Use this instead of paintSyncCanvas() when only a known
+ * part of the canvas was drawn on. Canvas pixels which are off screen are left alone
+ *
+ * @param canvas The canvas to copy from the screen
+ * @param x0 The first canvas column to copy
+ * @param y0 The first canvas row to copy
+ * @param x1 The canvas column after the last one to copy
+ * @param y1 The canvas row after the last one to copy
+ */
+void paintSyncCanvasRect(paintCanvas_t* canvas, int x0, int y0, int x1, int y1)
+{
+    if (!canvas->buffer)
     {
-        PAINT_LOGE("Attempting to sync to a non-buffered canvas! Doing nothing!");
+        PAINT_LOGE("Attempting to sync a canvas with no buffer! Doing nothing!");
         return;
     }
-    // Also super simple, come to think of it
-    paintSerialize(canvas->buffer, canvas, 0, paintGetStoredSize(canvas));
+
+    // Only the top-left screen pixel of each canvas pixel is read, so that one has to be on screen
+    x0 = MAX(x0, 0);
+    y0 = MAX(y0, 0);
+    x1 = MIN(x1, MIN(canvas->w, (TFT_WIDTH - canvas->x + canvas->xScale - 1) / canvas->xScale));
+    y1 = MIN(y1, MIN(canvas->h, (TFT_HEIGHT - canvas->y + canvas->yScale - 1) / canvas->yScale));
+    if (x0 >= x1 || y0 >= y1)
+    {
+        return;
+    }
+
+    uint8_t paletteIndex[cTransparent + 1];
+    paintBuildPaletteIndex(canvas->palette, paletteIndex);
+
+    const paletteColor_t* fb = getPxTftFramebuffer();
+    paletteColor_t line[x1 - x0];
+
+    for (int r = y0; r < y1; r++)
+    {
+        const paletteColor_t* row = &fb[(canvas->y + r * canvas->yScale) * TFT_WIDTH + canvas->x];
+        const paletteColor_t* src = &row[x0];
+
+        if (canvas->xScale != 1)
+        {
+            // Gather one screen pixel per canvas pixel
+            for (int c = x0; c < x1; c++)
+            {
+                line[c - x0] = row[c * canvas->xScale];
+            }
+            src = line;
+        }
+
+        paintPackPixels(canvas->buffer, r * canvas->w + x0, x1 - x0, src, paletteIndex);
+    }
+}
+
+/**
+ * @brief Convert some of a canvas's pixels to colors
+ *
+ * Whole words of the buffer are unpacked at a time, eight pixels each. This assumes a little-endian CPU
+ *
+ * @param canvas The canvas to read from
+ * @param first The index of the first pixel to read, row-major
+ * @param count The number of pixels to read
+ * @param[out] out Written with the color of each pixel
+ */
+void paintUnpackPixels(const paintCanvas_t* canvas, uint32_t first, uint32_t count, paletteColor_t* out)
+{
+    const paletteColor_t* pal = canvas->palette;
+    const uint8_t* src        = &canvas->buffer[first / 2];
+
+    // A pixel at an odd index is in the low nibble
+    if ((first & 1) && count)
+    {
+        *out++ = pal[*src++ & 0x0F];
+        count--;
+    }
+
+    // Unpack a byte at a time until the buffer is aligned to a word
+    while (count >= 2 && ((uintptr_t)src & 3))
+    {
+        *out++ = pal[*src >> 4];
+        *out++ = pal[*src++ & 0x0F];
+        count -= 2;
+    }
+
+    for (; count >= 8; count -= 8, src += 4, out += 8)
+    {
+        uint32_t word;
+        memcpy(&word, src, sizeof(word));
+
+        out[0] = pal[(word >> 4) & 0x0F];
+        out[1] = pal[(word >> 0) & 0x0F];
+        out[2] = pal[(word >> 12) & 0x0F];
+        out[3] = pal[(word >> 8) & 0x0F];
+        out[4] = pal[(word >> 20) & 0x0F];
+        out[5] = pal[(word >> 16) & 0x0F];
+        out[6] = pal[(word >> 28) & 0x0F];
+        out[7] = pal[(word >> 24) & 0x0F];
+    }
+
+    for (; count >= 2; count -= 2)
+    {
+        *out++ = pal[*src >> 4];
+        *out++ = pal[*src++ & 0x0F];
+    }
+
+    if (count)
+    {
+        *out = pal[*src >> 4];
+    }
+}
+
+/**
+ * @brief Convert some colors to pixels and store them in a canvas
+ *
+ * Colors that aren't in the canvas's palette are stored as its first color
+ *
+ * @param canvas The canvas to write to
+ * @param first The index of the first pixel to write, row-major
+ * @param count The number of pixels to write
+ * @param in The color of each pixel
+ */
+void paintPackPixelsInto(paintCanvas_t* canvas, uint32_t first, uint32_t count, const paletteColor_t* in)
+{
+    uint8_t paletteIndex[cTransparent + 1];
+    paintBuildPaletteIndex(canvas->palette, paletteIndex);
+    paintPackPixels(canvas->buffer, first, count, in, paletteIndex);
 }
 
 /**
@@ -131,102 +321,96 @@ void paintRebuildPalette(paletteColor_t palette[16], const paletteColor_t* img,
     }
 }
 
-/**
- * @brief Draw a segment of a serialized paint image onto the screen
- *
- * @param dest The canvas defining the draw destination
- * @param data The buffer to be drawn
- * @param offset The offset of this data segment within the image
- * @param count The length of the segment
- * @return true If there is more image to be drawn
- * @return false If the image was completely drawn
- */
-bool paintDeserialize(const paintCanvas_t* dest, const uint8_t* data, size_t offset, size_t count)
-{
-    uint16_t x0, y0, x1, y1;
-    for (uint16_t n = 0; n < count; n++)
-    {
-        if (offset * 2 + (n * 2) >= dest->w * dest->h)
-        {
-            // If we've just read the last pixel, exit early
-            return false;
-        }
-
-        // no need for logic to exit the final chunk early, since each chunk's size is given to us
-        // calculate the canvas coordinates given the pixel indices
-        x0 = (offset * 2 + (n * 2)) % dest->w;
-        y0 = (offset * 2 + (n * 2)) / dest->w;
-        x1 = (offset * 2 + (n * 2 + 1)) % dest->w;
-        y1 = (offset * 2 + (n * 2 + 1)) / dest->w;
-
-        setPxScaled(x0, y0, dest->palette[data[n] >> 4], dest->x, dest->y, dest->xScale, dest->yScale);
-        setPxScaled(x1, y1, dest->palette[data[n] & 0xF], dest->x, dest->y, dest->xScale, dest->yScale);
-    }
-
-    return offset * 2 + (count * 2) < dest->w * dest->h;
-}
-
 size_t paintSerializeWsg(uint8_t* dest, const wsg_t* wsg)
 {
     // WSG has no palette, build it
     paletteColor_t palette[16];
     paintRebuildPalette(palette, wsg->px, wsg->w, wsg->h);
 
-    return _paintSerialize(dest, NULL, wsg, 0, (wsg->w * wsg->h + 1) / 2, palette);
-}
-
-size_t paintSerialize(uint8_t* dest, const paintCanvas_t* canvas, size_t offset, size_t count)
-{
-    return _paintSerialize(dest, canvas, NULL, offset, count, canvas->palette);
+    return paintSerializeWsgPalette(dest, wsg, palette);
 }
 
 size_t paintSerializeWsgPalette(uint8_t* dest, const wsg_t* wsg, const paletteColor_t palette[16])
 {
-    return _paintSerialize(dest, NULL, wsg, 0, paintGetStoredSizeDim(wsg->w, wsg->h), palette);
+    uint8_t paletteIndex[cTransparent + 1];
+    paintBuildPaletteIndex(palette, paletteIndex);
+
+    paintPackPixels(dest, 0, wsg->w * wsg->h, wsg->px, paletteIndex);
+
+    // Don't leave the unused half of the last byte uninitialized
+    if ((wsg->w * wsg->h) & 1)
+    {
+        dest[(wsg->w * wsg->h) / 2] &= 0xF0;
+    }
+
+    return paintGetStoredSizeDim(wsg->w, wsg->h);
 }
 
-static size_t _paintSerialize(uint8_t* dest, const paintCanvas_t* canvas, const wsg_t* wsg, size_t offset, size_t count,
-                              const paletteColor_t palette[16])
+/**
+ * @brief Build a map from each color to its index in a palette. Colors not in the palette map to 0
+ *
+ * @param palette The palette
+ * @param[out] paletteIndex Written with the palette index of each color
+ */
+static void paintBuildPaletteIndex(const paletteColor_t palette[16], uint8_t paletteIndex[cTransparent + 1])
 {
-    uint8_t paletteIndex[cTransparent + 1] = {};
+    memset(paletteIndex, 0, cTransparent + 1);
 
-    // Build the reverse-palette map
     for (uint16_t i = 0; i < PAINT_MAX_COLORS; i++)
     {
         paletteIndex[((uint8_t)palette[i])] = i;
     }
+}
+
+/**
+ * @brief Convert colors to palette indices and store them in a packed buffer
+ *
+ * Whole words of the buffer are packed at a time, eight pixels each. This assumes a little-endian CPU
+ *
+ * @param dest The packed buffer
+ * @param first The index of the first pixel to write, row-major
+ * @param count The number of pixels to write
+ * @param in The color of each pixel
+ * @param paletteIndex A map from each color to its palette index, from paintBuildPaletteIndex()
+ */
+static void paintPackPixels(uint8_t* dest, uint32_t first, uint32_t count, const paletteColor_t* in,
+                            const uint8_t paletteIndex[cTransparent + 1])
+{
+    const uint8_t* idx = paletteIndex;
+    uint8_t* dst       = &dest[first / 2];
+
+    // A pixel at an odd index is in the low nibble
+    if ((first & 1) && count)
+    {
+        *dst = (*dst & 0xF0) | idx[(uint8_t)*in++];
+        dst++;
+        count--;
+    }
 
-    uint16_t x0, y0, x1, y1;
-    // build the chunk
-    for (uint16_t n = 0; n < count; n++)
+    // Pack a byte at a time until the buffer is aligned to a word
+    while (count >= 2 && ((uintptr_t)dst & 3))
     {
-        if (canvas)
-        {
-            if (offset * 2 + (n * 2) >= (wsg ? (wsg->w * wsg->h) : (canvas->w * canvas->h)))
-            {
-                // If we've just stored the last pixel, return false to indicate that we're done
-                return n;
-            }
+        *dst++ = (idx[(uint8_t)in[0]] << 4) | idx[(uint8_t)in[1]];
+        in += 2;
+        count -= 2;
+    }
 
-            // calculate the real coordinates given the pixel indices
-            // (we store 2 pixels in each byte)
-            // that's 100% more pixel, per pixel!
-            x0 = canvas->x + (offset * 2 + (n * 2)) % canvas->w * canvas->xScale;
-            y0 = canvas->y + (offset * 2 + (n * 2)) / canvas->w * canvas->yScale;
-            x1 = canvas->x + (offset * 2 + (n * 2 + 1)) % canvas->w * canvas->xScale;
-            y1 = canvas->y + (offset * 2 + (n * 2 + 1)) / canvas->w * canvas->yScale;
-
-            // we only need to save the top-left pixel of each scaled pixel, since they're the same unless something is
-            // very broken
-            dest[n] = paletteIndex[(uint8_t)getPxTft(x0, y0)] << 4 | paletteIndex[(uint8_t)getPxTft(x1, y1)];
-        }
+    for (; count >= 8; count -= 8, dst += 4, in += 8)
+    {
+        uint32_t word = ((uint32_t)idx[(uint8_t)in[0]] << 4) | ((uint32_t)idx[(uint8_t)in[1]] << 0)
+                        | ((uint32_t)idx[(uint8_t)in[2]] << 12) | ((uint32_t)idx[(uint8_t)in[3]] << 8)
+                        | ((uint32_t)idx[(uint8_t)in[4]] << 20) | ((uint32_t)idx[(uint8_t)in[5]] << 16)
+                        | ((uint32_t)idx[(uint8_t)in[6]] << 28) | ((uint32_t)idx[(uint8_t)in[7]] << 24);
+        memcpy(dst, &word, sizeof(word));
+    }
 
-        if (wsg)
-        {
-            dest[n] = paletteIndex[(uint8_t)wsg->px[offset * 2 + n * 2]] << 4
-                      | paletteIndex[(uint8_t)wsg->px[offset * 2 + n * 2 + 1]];
-        }
+    for (; count >= 2; count -= 2, in += 2)
+    {
+        *dst++ = (idx[(uint8_t)in[0]] << 4) | idx[(uint8_t)in[1]];
     }
 
-    return count;
+    if (count)
+    {
+        *dst = (*dst & 0x0F) | (idx[(uint8_t)*in] << 4);
+    }
 }
@@ -25,24 +25,25 @@ typedef struct
 
     paletteColor_t palette[PAINT_MAX_COLORS];
 
-    // Whether this canvas is backed off-screen in a buffer
-    bool buffered;
-    // The buffer, if this canvas has one
+    // The canvas's pixels, two palette indices per byte with the first pixel in the high nibble. This is always the
+    // real image, the screen only ever shows a copy of it
     uint8_t* buffer;
 
 } paintCanvas_t;
 
 void paintBlitCanvas(const paintCanvas_t* canvas);
+void paintBlitCanvasRect(const paintCanvas_t* canvas, int x0, int y0, int x1, int y1);
 void paintSyncCanvas(paintCanvas_t* canvas);
+void paintSyncCanvasRect(paintCanvas_t* canvas, int x0, int y0, int x1, int y1);
+void paintUnpackPixels(const paintCanvas_t* canvas, uint32_t first, uint32_t count, paletteColor_t* out);
+void paintPackPixelsInto(paintCanvas_t* canvas, uint32_t first, uint32_t count, const paletteColor_t* in);
 
 size_t paintGetStoredSize(const paintCanvas_t* canvas);
 size_t paintGetStoredSizeDim(uint16_t w, uint16_t h);
 int8_t paintGetPaletteIndex(const paletteColor_t palette[16], paletteColor_t color);
 void paintRebuildPalette(paletteColor_t palette[16], const paletteColor_t* img, uint16_t w, uint16_t h);
 
-bool paintDeserialize(const paintCanvas_t* dest, const uint8_t* data, size_t offset, size_t count);
 size_t paintSerializeWsg(uint8_t* dest, const wsg_t* wsg);
 size_t paintSerializeWsgPalette(uint8_t* dest, const wsg_t* wsg, const paletteColor_t palette[16]);
-size_t paintSerialize(uint8_t* dest, const paintCanvas_t* canvas, size_t offset, size_t count);
 
 #endif
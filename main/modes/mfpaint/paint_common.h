@@ -18,6 +18,7 @@
 #include "px_stack.h"
 #include "paint_type.h"
 #include "paint_brush.h"
+#include "paint_undo.h"
 
 #define PAINT_LOGV(...) ESP_LOGV("Paint", __VA_ARGS__)
 #define PAINT_LOGD(...) ESP_LOGD("Paint", __VA_ARGS__)
@@ -269,12 +270,9 @@ typedef struct
 
     //////// Undo Data
 
-    // The linked list of undo data
-    list_t undoList;
-
-    // After an undo is performed, this points to the action that was undone.
-    // This allows redo to work. If the image is edited, this and all following items are removed.
-    node_t* undoHead;
+    // The history of changes to the canvas. After an undo is performed, the undone changes can be redone until the
+    // image is edited again.
+    paintUndoJournal_t undoJournal;
 
     // The menu for the tool wheel
     menu_t* toolWheel;
@@ -381,6 +379,7 @@ typedef struct
     // The version of the protocol to use
     // 0 is the original
     // 1 is the next one, only difference is packet length and
+    // 2 compresses the whole canvas once and sends it as a single bulk message
     uint8_t version;
     bool versionSent;
 
@@ -392,6 +391,13 @@ typedef struct
 
     uint8_t sharePaletteMap[256];
 
+    // For the sender, the compressed canvas for protocol version 2, built once per image
+    uint8_t* shareBlob;
+    uint16_t shareBlobLen;
+
+    // For the receiver, set to true when the whole canvas has been received in a single bulk message
+    bool shareBlobReceived;
+
     // Set to true when a new packet has been written to sharePacket, either to be sent or to be handled
     bool shareNewPacket;
 
@@ -384,8 +384,7 @@ void paintDrawScreenSetup(void)
         getArtist()->fgColor = paintState->canvas.palette[0];
         getArtist()->bgColor = paintState->canvas.palette[1];
 
-        paintState->canvas.buffered = true;
-        paintState->canvas.buffer   = malloc(paintGetStoredSize(&paintState->canvas));
+        paintState->canvas.buffer = malloc(paintGetStoredSize(&paintState->canvas));
         memset(paintState->canvas.buffer, 0x11, paintGetStoredSize(&paintState->canvas));
     }
 
@@ -598,7 +597,7 @@ void paintDrawScreenCleanup(void)
 
     resetImageBrowser(&paintState->browser);
 
-    if (paintState->canvas.buffered && paintState->canvas.buffer)
+    if (paintState->canvas.buffer)
     {
         free(paintState->canvas.buffer);
         paintState->canvas.buffer = NULL;
@@ -775,8 +774,18 @@ void paintDrawScreenMainLoop(int64_t elapsedUs)
             {
                 // Draw the tool
                 paintDoTool(getCursor()->x, getCursor()->y, getArtist()->fgColor, false);
-                // Immediately save the canvas back to the buffer
-                paintSyncCanvas(&paintState->canvas);
+
+                // Immediately save the canvas back to the buffer. Pens only touch the area around the cursor
+                if (getArtist()->brushDef->mode == HOLD_DRAW)
+                {
+                    int16_t margin = getArtist()->brushWidth + 1;
+                    paintSyncCanvasRect(&paintState->canvas, getCursor()->x - margin, getCursor()->y - margin,
+                                        getCursor()->x + margin + 1, getCursor()->y + margin + 1);
+                }
+                else
+                {
+                    paintSyncCanvas(&paintState->canvas);
+                }
 
                 if (getArtist()->brushDef->mode != HOLD_DRAW)
                 {
@@ -837,7 +846,6 @@ void paintDrawScreenMainLoop(int64_t elapsedUs)
             paintResetButtons();
             paintRenderToolbar(getArtist(), &paintState->canvas, paintState, firstBrush, lastBrush);
             paintRenderColorPicker(getArtist(), &paintState->canvas, paintState);
-            paintBlitCanvas(&paintState->canvas);
             paintEditPaletteUpdateCanvas();
             break;
         }
@@ -960,26 +968,12 @@ void paintEditPaletteNextColor(void)
 
 void paintEditPaletteUpdateCanvas(void)
 {
-    // Save the old color, and update the palette with the new color
-    paletteColor_t old = paintState->canvas.palette[paintState->paletteSelect];
-    paletteColor_t new = paintState->newColor;
-
-    // Only replace the color on the canvas if the old color is no longer in the palette
-    int count = 0;
-    for (uint8_t i = 0; i < PAINT_MAX_COLORS; i++)
-    {
-        if (paintState->canvas.palette[i] == old)
-        {
-            count++;
-        }
-    }
-
-    // This color is no longer in the palette, so replace it with the new one
-    if (count < 2)
-    {
-        // And replace it within the canvas
-        paintColorReplaceScreen(&paintState->canvas, old, new);
-    }
+    // Preview the new color by drawing the canvas with it swapped into the palette. The canvas's pixels are palette
+    // indices, so every pixel of the old color is drawn with the new one without changing the buffer
+    paletteColor_t old                                    = paintState->canvas.palette[paintState->paletteSelect];
+    paintState->canvas.palette[paintState->paletteSelect] = paintState->newColor;
+    paintBlitCanvas(&paintState->canvas);
+    paintState->canvas.palette[paintState->paletteSelect] = old;
 }
 
 void paintEditPaletteConfirm(void)
@@ -1018,8 +1012,7 @@ void paintEditPaletteConfirm(void)
             getArtist()->bgColor = new;
         }
 
-        // And replace it within the canvas
-        paintColorReplace(&paintState->canvas, old, new);
+        // The canvas stores palette indices, so changing the palette entry already recolored its pixels
         paintState->unsaved = true;
     }
 }
@@ -1366,113 +1359,27 @@ void paintHandleDpad(uint16_t state)
 
 void paintFreeUndos(void)
 {
-    paintState->undoHead = NULL;
-    for (node_t* undo = paintState->undoList.first; undo != NULL; undo = undo->next)
-    {
-        paintUndo_t* val = undo->val;
-        free(val);
-    }
-    clear(&paintState->undoList);
+    paintUndoJournalFree(&paintState->undoJournal);
 }
 
 void paintStoreUndo(paintCanvas_t* canvas, paletteColor_t fg, paletteColor_t bg)
 {
-    // If paintState->undoHead is set, we need to clear all the previous undos to delete the alternate timeline
-    uint8_t deleted = 0;
-    while (paintState->undoHead != NULL)
-    {
-        // Save the next pointer before the node gets freed
-        node_t* next = paintState->undoHead->next;
-
-        paintUndo_t* delUndo = removeEntry(&paintState->undoList, paintState->undoHead);
-
-        // Free the undo data pixels and then the struct itself
-        free(delUndo);
-
-        paintState->undoHead = next;
-        deleted++;
-    }
-    if (deleted > 0)
-    {
-        PAINT_LOGD("Deleted %" PRIu8 " dangling undos after changing history", deleted);
-    }
-    // paintState->undoHead should now be NULL
-
-    // Allocate a new paintUndo_t to store the canvas
-    paintUndo_t* undoData;
-    // Calculate the amount of space we wolud need to store the canvas pixels
-    size_t pxSize = paintGetStoredSize(canvas);
-
-    // Allocate memory for the undo data struct and its pixel data in one go
-    void* undoMem = heap_caps_malloc(sizeof(paintUndo_t) + pxSize, MALLOC_CAP_SPIRAM);
-    if (undoMem != NULL)
-    {
-        // Alloc succeeded, use the data
-        undoData     = undoMem;
-        undoData->px = (uint8_t*)undoMem + sizeof(paintUndo_t);
-    }
-    else
-    {
-        // Alloc failed, reuse the first undo data
-        undoData = shift(&paintState->undoList);
-    }
-
-    if (!undoData)
-    {
-        PAINT_LOGD("Failed to allocate or reuse undo data! Canceling undo");
-        // There's no undo data at all! We're completely out of space!
-        return;
-    }
-
-    // Save the palette
-    memcpy(undoData->palette, canvas->palette, sizeof(paletteColor_t) * PAINT_MAX_COLORS);
-
-    // Just in case we don't find the colors somehow
-    undoData->fgIdx = 0;
-    undoData->bgIdx = 1;
-
-    // Search through the
-    for (int i = 0; i < PAINT_MAX_COLORS; i++)
-    {
-        if (undoData->palette[i] == fg)
-        {
-            undoData->fgIdx = i;
-        }
-        if (undoData->palette[i] == bg)
-        {
-            undoData->bgIdx = i;
-        }
-    }
-
-    if (canvas->buffered)
-    {
-        memcpy(undoData->px, canvas->buffer, pxSize);
-    }
-    else
-    {
-        // Save the pixel data
-        paintSerialize(undoData->px, canvas, 0, pxSize);
-    }
+    paintUndoJournalStore(&paintState->undoJournal, canvas, fg, bg, false);
+}
 
-    push(&paintState->undoList, undoData);
+// Like paintStoreUndo(), but for a brush dab, which is undone along with any dabs made just before it
+void paintStoreUndoDab(paintCanvas_t* canvas, paletteColor_t fg, paletteColor_t bg)
+{
+    paintUndoJournalStore(&paintState->undoJournal, canvas, fg, bg, true);
 }
 
-// Delete the oldest undo entry, if one exists. Returns true if some space was made available, false otherwise.
+// Free the undo history, since its buffers can't be partially freed. Returns true if some space was made available,
+// false otherwise.
 bool paintMaybeSacrificeUndoForHeap(void)
 {
-    if (paintState->undoList.first != NULL)
+    if (paintState->undoJournal.ring != NULL)
     {
-        // Don't leave a bad pointer in undoHead
-        // This has to be done *before* calling shift()
-        if (paintState->undoHead != NULL && paintState->undoHead == paintState->undoList.first)
-        {
-            paintState->undoHead = paintState->undoHead->next;
-        }
-
-        paintUndo_t* delUndo = shift(&paintState->undoList);
-
-        free(delUndo);
-
+        paintUndoJournalFree(&paintState->undoJournal);
         return true;
     }
 
@@ -1481,85 +1388,34 @@ bool paintMaybeSacrificeUndoForHeap(void)
 
 bool paintCanUndo(void)
 {
-    // We can undo as long as one of these is true:
-    //  - The undoHead is NULL and undoList.last is NOT NULL
-    //  - The undoHead is NOT NULL and undoHead->prev is NOT NULL
-    return (paintState->undoHead == NULL && paintState->undoList.last != NULL)
-           || (paintState->undoHead != NULL && paintState->undoHead->prev != NULL);
+    return paintUndoJournalCanUndo(&paintState->undoJournal);
 }
 
 bool paintCanRedo(void)
 {
-    // We can redo as long as all of these are true:
-    //  - The undoHead is NOT NULL
-    //  - There is another undo after undoHead (that's what contains the state we want to return to)
-    return paintState->undoHead != NULL && paintState->undoHead->next != NULL;
+    return paintUndoJournalCanRedo(&paintState->undoJournal);
 }
 
-void paintApplyUndo(paintCanvas_t* canvas)
+void paintUndo(paintCanvas_t* canvas)
 {
-    if (paintState->undoHead == NULL)
+    if (!paintUndoJournalUndo(&paintState->undoJournal, canvas, &getArtist()->fgColor, &getArtist()->bgColor))
     {
         // If we've undone everything, or there's nothing to undo, exit early
-        PAINT_LOGD("Not undoing because undoHead is NULL");
-        return;
-    }
-
-    paintUndo_t* undo = paintState->undoHead->val;
-
-    memcpy(canvas->palette, undo->palette, sizeof(paletteColor_t) * PAINT_MAX_COLORS);
-    getArtist()->fgColor = canvas->palette[undo->fgIdx];
-    getArtist()->bgColor = canvas->palette[undo->bgIdx];
-
-    if (canvas->buffered && canvas->buffer)
-    {
-        // Copy the undo data into the canvas buffer
-        memcpy(canvas->buffer, undo->px, paintGetStoredSize(canvas));
-    }
-    else
-    {
-        size_t pxSize = paintGetStoredSize(canvas);
-        paintDeserialize(canvas, undo->px, 0, pxSize);
-        PAINT_LOGD("Undid %" PRIu32 " bytes!", (uint32_t)pxSize);
+        PAINT_LOGD("Nothing to undo");
     }
 
     paintRefreshUndoRedo();
 }
 
-void paintUndo(paintCanvas_t* canvas)
-{
-    if (paintState->undoHead == NULL)
-    {
-        // We have not undone anything else yet -- use the last element in the undo list
-        node_t* head = paintState->undoList.last;
-
-        // Also, since this is the first undo, save the current state so that we can return to it with redo
-        paintStoreUndo(canvas, getArtist()->fgColor, getArtist()->bgColor);
-
-        paintState->undoHead = head;
-    }
-    else
-    {
-        // We have already undone something! Undo the previous action.
-        paintState->undoHead = paintState->undoHead->prev;
-    }
-
-    paintApplyUndo(canvas);
-}
-
 void paintRedo(paintCanvas_t* canvas)
 {
-    if (paintState->undoHead == NULL)
+    if (!paintUndoJournalRedo(&paintState->undoJournal, canvas, &getArtist()->fgColor, &getArtist()->bgColor))
     {
         // We have not undone anything else -- so there's nothing to redo?
-    }
-    else
-    {
-        // We have already undone something, so there's something to redo
-        paintState->undoHead = paintState->undoHead->next;
+        PAINT_LOGD("Nothing to redo");
     }
 
-    paintApplyUndo(canvas);
+    paintRefreshUndoRedo();
 }
 
 void paintDoTool(uint16_t x, uint16_t y, paletteColor_t col, bool partial)
@@ -1668,11 +1524,17 @@ void paintDoTool(uint16_t x, uint16_t y, paletteColor_t col, bool partial)
                 ;
 
             // Save the current state before we draw, but only do it on the first press if we're using a HOLD_DRAW pen
-            if (getArtist()->brushDef->mode != HOLD_DRAW || paintState->aPress)
+            if (getArtist()->brushDef->mode != HOLD_DRAW)
             {
                 paintStoreUndo(&paintState->canvas, getArtist()->fgColor, getArtist()->bgColor);
                 paintRefreshUndoRedo();
             }
+            else if (paintState->aPress)
+            {
+                // Quick taps with a HOLD_DRAW pen are undone together, like a single stroke
+                paintStoreUndoDab(&paintState->canvas, getArtist()->fgColor, getArtist()->bgColor);
+                paintRefreshUndoRedo();
+            }
             paintState->unsaved = true;
             getArtist()->brushDef->fnDraw(&paintState->canvas, canvasPickPoints, pickCount, getArtist()->brushWidth,
                                           col);
@@ -2256,11 +2118,7 @@ static void doLoad(const char* key)
 {
     if (paintSlotExists(key))
     {
-        // Load from the selected slot if it's been used
-        paintClearCanvas(&paintState->canvas, getArtist()->bgColor);
-
-        // Load the image into the buffer so we can orient it properly
-        paintState->canvas.buffered = true;
+        // Load from the selected slot if it's been used. This replaces the buffer with the image's
         if (paintLoadNamed(key, &paintState->canvas))
         {
             paintPositionDrawCanvas();
@@ -2293,11 +2151,9 @@ static void doLoad(const char* key)
         paintState->canvas.w = PAINT_DEFAULT_CANVAS_WIDTH;
         paintState->canvas.h = PAINT_DEFAULT_CANVAS_HEIGHT;
 
-        paintState->canvas.buffered = true;
-        if (!paintState->canvas.buffer)
-        {
-            paintState->canvas.buffer = malloc(paintGetStoredSize(&paintState->canvas));
-        }
+        // The buffer may be sized for whatever was loaded before
+        free(paintState->canvas.buffer);
+        paintState->canvas.buffer = malloc(paintGetStoredSize(&paintState->canvas));
 
         paintResetCanvas(&paintState->canvas);
         paintState->buttonMode = BTN_MODE_DRAW;
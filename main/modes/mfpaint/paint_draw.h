@@ -57,10 +57,10 @@ void paintPositionDrawCanvas(void);
 void paintHandleDpad(uint16_t state);
 void paintFreeUndos(void);
 void paintStoreUndo(paintCanvas_t* canvas, paletteColor_t fg, paletteColor_t bg);
+void paintStoreUndoDab(paintCanvas_t* canvas, paletteColor_t fg, paletteColor_t bg);
 bool paintMaybeSacrificeUndoForHeap(void);
 bool paintCanUndo(void);
 bool paintCanRedo(void);
-void paintApplyUndo(paintCanvas_t* canvas);
 void paintUndo(paintCanvas_t* canvas);
 void paintRedo(paintCanvas_t* canvas);
 void paintDoTool(uint16_t x, uint16_t y, paletteColor_t col, bool partial);
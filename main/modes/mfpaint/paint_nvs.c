@@ -79,31 +79,8 @@ bool paintSaveNamed(const char* name, const paintCanvas_t* canvas)
         return false;
     }
 
-    // Read pixels from the screen into the temp WSG
-    for (uint16_t r = 0; r < canvas->h; ++r)
-    {
-        for (uint16_t c = 0; c < canvas->w; ++c)
-        {
-            paletteColor_t col;
-            if (canvas->buffered && canvas->buffer)
-            {
-                if (((r * canvas->w + c) % 2) == 0)
-                {
-                    col = canvas->palette[(canvas->buffer[(r * canvas->w + c) / 2] >> 4) & 0x0F];
-                }
-                else
-                {
-                    col = canvas->palette[(canvas->buffer[(r * canvas->w + c) / 2] >> 0) & 0x0F];
-                }
-            }
-            else
-            {
-                col = getPxTft(canvas->x + c * canvas->xScale, canvas->y + r * canvas->yScale);
-            }
-
-            tmpWsg.px[r * canvas->w + c] = col;
-        }
-    }
+    // Unpack the canvas's pixels into the temp WSG
+    paintUnpackPixels(canvas, 0, canvas->w * canvas->h, tmpWsg.px);
 
     bool result = saveWsgNvs(PAINT_NS_DATA, name, &tmpWsg);
     free(tmpWsg.px);
@@ -129,27 +106,10 @@ bool paintLoadNamed(const char* name, paintCanvas_t* canvas)
             PAINT_LOGW("No palette found for image %s, that's weird right?", name);
         }
 
-        if (canvas->buffered)
-        {
-            if (canvas->buffer)
-            {
-                free(canvas->buffer);
-            }
-            canvas->buffer = malloc(paintGetStoredSize(canvas));
-            paintSerializeWsgPalette(canvas->buffer, &tmpWsg, canvas->palette);
-        }
-        else
-        {
-            for (uint16_t y = 0; y < canvas->h; ++y)
-            {
-                for (uint16_t x = 0; x < canvas->w; ++x)
-                {
-                    setPxScaled(x, y,
-                                cTransparent == tmpWsg.px[y * canvas->w + x] ? c555 : tmpWsg.px[y * canvas->w + x],
-                                canvas->x, canvas->y, canvas->xScale, canvas->yScale);
-                }
-            }
-        }
+        free(canvas->buffer);
+        canvas->buffer = malloc(paintGetStoredSize(canvas));
+        paintSerializeWsgPalette(canvas->buffer, &tmpWsg, canvas->palette);
+
         freeWsg(&tmpWsg);
     }
 
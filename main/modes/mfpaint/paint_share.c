@@ -3,9 +3,12 @@
 #include <stddef.h>
 #include <string.h>
 
+#include <esp_heap_caps.h>
+
 #include "p2pConnection.h"
 #include "shapes.h"
 #include "hdw-btn.h"
+#include "heatshrink_helper.h"
 
 #include "mode_paint.h"
 #include "paint_common.h"
@@ -30,6 +33,12 @@
  * - Each packet contains an absolute sequence number and as many bytes of pixel data as will fit (palette-indexed and
  * packed into 2 pixels per byte)
  * - Once the last packet has been acked, we're done! Return to share mode
+ *
+ * Version 2 of the protocol replaces the pixel packets with one bulk message:
+ * - The receiver asks for version 2 in its pixel request if the sender's canvas data said it supports it
+ * - The sender heatshrink-compresses the packed canvas once and sends it with p2pSendBulk(), which takes care of
+ *   fragmenting, windowing and retrying
+ * - The receiver decompresses it straight into its canvas buffer, then sends the receive complete packet as usual
  */
 
 #define SHARE_LEFT_MARGIN   10
@@ -62,6 +71,15 @@ const uint8_t SHARE_PACKET_ABORT            = 4;
 // yes there is a version in the canvas data, but we also need it on the other side
 const uint8_t SHARE_PACKET_VERSION = 5;
 
+// The newest version of the share protocol this swadge speaks
+const uint8_t SHARE_VERSION_CURRENT = 2;
+// The first version which sends the canvas as a single compressed bulk message
+const uint8_t SHARE_VERSION_BLOB = 2;
+
+// The first byte of a bulk canvas message says how the rest of it is encoded
+const uint8_t SHARE_BLOB_RAW        = 0;
+const uint8_t SHARE_BLOB_HEATSHRINK = 1;
+
 // The canvas data packet has PAINT_MAX_COLORS bytes of palette, plus 2 uint16_ts of width/height. Also 1 for size
 const uint8_t PACKET_LEN_CANVAS_DATA_V0 = sizeof(uint8_t) * PAINT_MAX_COLORS + sizeof(uint16_t) * 2;
 // v1 adds another byte at the end for version
@@ -87,6 +105,8 @@ void paintShareSendCb(const uint8_t* mac_addr, esp_now_send_status_t status);
 void paintShareP2pConnCb(p2pInfo* p2p, connectionEvt_t evt);
 void paintShareP2pSendCb(p2pInfo* p2p, messageStatus_t status, const uint8_t* data, uint8_t len);
 void paintShareP2pMsgRecvCb(p2pInfo* p2p, const uint8_t* payload, uint8_t len);
+void paintShareP2pBulkSendCb(p2pInfo* p2p, messageStatus_t status, uint16_t len);
+void paintShareP2pBulkRecvCb(p2pInfo* p2p, const uint8_t* payload, uint16_t len);
 static void paintShareBrowserCb(const char* key, imageBrowserAction_t action);
 
 void paintShareRenderProgressBar(int64_t elapsedUs, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
@@ -112,6 +132,11 @@ void paintShareHandleCanvas(void);
 void paintShareSendPixels(void);
 void paintShareHandlePixels(void);
 
+static bool paintShareBuildBlob(void);
+static void paintShareFreeBlob(void);
+void paintShareSendBlob(void);
+void paintShareHandleBlob(void);
+
 void paintShareCheckForTimeout(void);
 void paintShareRetry(void);
 
@@ -231,6 +256,7 @@ void paintShareInitP2p(void)
     paintShare->connectionStarted = true;
     paintShare->shareSeqNum       = 0;
     paintShare->shareNewPacket    = false;
+    paintShare->shareBlobReceived = false;
 
     p2pDeinit(&paintShare->p2pInfo);
 
@@ -246,6 +272,7 @@ void paintShareInitP2p(void)
 
     p2pInitialize(&paintShare->p2pInfo, isSender() ? 'P' : 'Q', paintShareP2pConnCb, paintShareP2pMsgRecvCb, -35);
     p2pSetAsymmetric(&paintShare->p2pInfo, isSender() ? 'Q' : 'P');
+    p2pSetBulkRxCb(&paintShare->p2pInfo, paintShareP2pBulkRecvCb);
     p2pStartConnection(&paintShare->p2pInfo);
 }
 
@@ -405,9 +432,13 @@ void paintShareRenderProgressBar(int64_t elapsedUs, uint16_t x, uint16_t y, uint
         paintShare->shareTime = 0;
         // if we have the canvas dimensinos, we can calculate the max progress
         // (WIDTH / ((totalPacketNum + 1) * 4)) * (currentPacketNum) * 4 + (sent: 2, acked: 3, req'd: 4)
+        // The compressed canvas is sent as a single message
         uint16_t maxProgress
-            = ((paintShare->canvas.h * paintShare->canvas.w + PAINT_SHARE_PX_PER_PACKET - 1) / PAINT_SHARE_PX_PER_PACKET
-               + 1);
+            = (paintShare->version >= SHARE_VERSION_BLOB)
+                  ? 2
+                  : ((paintShare->canvas.h * paintShare->canvas.w + PAINT_SHARE_PX_PER_PACKET - 1)
+                         / PAINT_SHARE_PX_PER_PACKET
+                     + 1);
 
         // Now, we just draw a box at (progress * (width) / maxProgress)
         uint16_t size = (progress > maxProgress ? maxProgress : progress) * w / maxProgress;
@@ -612,8 +643,8 @@ void paintShareSendCanvas(void)
     // Height LSB
     paintShare->sharePacket[PAINT_MAX_COLORS + 4] = ((uint8_t)((paintShare->canvas.w >> 0) & 0xFF));
 
-    // Version (v1)
-    paintShare->sharePacket[PAINT_MAX_COLORS + 5] = 1;
+    // Version
+    paintShare->sharePacket[PAINT_MAX_COLORS + 5] = SHARE_VERSION_CURRENT;
 
     paintShare->shareState     = SHARE_SEND_WAIT_CANVAS_DATA_ACK;
     paintShare->shareNewPacket = false;
@@ -665,8 +696,8 @@ void paintShareHandleCanvas(void)
           + (TFT_HEIGHT - SHARE_TOP_MARGIN - SHARE_BOTTOM_MARGIN - paintShare->canvas.h * paintShare->canvas.yScale)
                 / 2;
 
-    paintShare->canvas.buffered = true;
-    paintShare->canvas.buffer   = malloc(paintGetStoredSize(&paintShare->canvas));
+    free(paintShare->canvas.buffer);
+    paintShare->canvas.buffer = malloc(paintGetStoredSize(&paintShare->canvas));
     // make a sorta stripey background while we load the image
     memset(paintShare->canvas.buffer, (uint8_t)(0x10), (paintShare->canvas.w * paintShare->canvas.h + 1) / 2);
     paintShare->dataOffset = 0;
@@ -681,6 +712,12 @@ void paintShareHandleCanvas(void)
 
 void paintShareSendPixels(void)
 {
+    if (paintShare->version >= SHARE_VERSION_BLOB)
+    {
+        paintShareSendBlob();
+        return;
+    }
+
     // Packet type header
     paintShare->sharePacket[0] = SHARE_PACKET_PIXEL_DATA;
 
@@ -704,35 +741,8 @@ void paintShareSendPixels(void)
                    paintShare->canvas.w * paintShare->canvas.h);
     }
 
-    if (paintShare->canvas.buffered && paintShare->canvas.buffer)
-    {
-        PAINT_LOGI("Using the memcpy path with length %" PRIu8, paintShare->sharePacketLen);
-        memcpy(&paintShare->sharePacket[3], &paintShare->canvas.buffer[paintShare->dataOffset + compatOffset],
-               paintShare->sharePacketLen - 3);
-    }
-    else
-    {
-        for (uint8_t i = 0; i < paintShare->sharePacketLen - 3; i++)
-        {
-            // TODO dedupe this and the nvs functions into a paintSerialize() or something
-            uint16_t x0 = paintShare->canvas.x
-                          + ((paintShare->dataOffset * 2) + (i * 2)) % paintShare->canvas.w * paintShare->canvas.xScale;
-            uint16_t y0 = paintShare->canvas.y
-                          + ((paintShare->dataOffset * 2) + (i * 2)) / paintShare->canvas.w * paintShare->canvas.yScale;
-            uint16_t x1
-                = paintShare->canvas.x
-                  + ((paintShare->dataOffset * 2) + (i * 2 + 1)) % paintShare->canvas.w * paintShare->canvas.xScale;
-            uint16_t y1
-                = paintShare->canvas.y
-                  + ((paintShare->dataOffset * 2) + (i * 2 + 1)) / paintShare->canvas.w * paintShare->canvas.yScale;
-
-            PAINT_LOGD("Mapping px(%d, %d) (%d) --> %x", x0, y0, getPxTft(x0, y0),
-                       paintShare->sharePaletteMap[(uint8_t)(getPxTft(x0, y0))]);
-
-            paintShare->sharePacket[i + 3] = paintShare->sharePaletteMap[(uint8_t)getPxTft(x0, y0)] << 4
-                                             | paintShare->sharePaletteMap[(uint8_t)getPxTft(x1, y1)];
-        }
-    }
+    memcpy(&paintShare->sharePacket[3], &paintShare->canvas.buffer[paintShare->dataOffset + compatOffset],
+           paintShare->sharePacketLen - 3);
 
     paintShare->dataOffset += (paintShare->sharePacketLen - 3);
 
@@ -773,24 +783,9 @@ void paintShareHandlePixels(void)
     PAINT_LOGI("Packet seqnum is %d (%x << 8 | %x)", paintShare->shareSeqNum, paintShare->sharePacket[1],
                paintShare->sharePacket[2]);
 
-    if (paintShare->canvas.buffered)
-    {
-        memcpy(&paintShare->canvas.buffer[paintShare->dataOffset], &paintShare->sharePacket[3],
-               paintShare->sharePacketLen - 3);
-    }
-
-    for (uint8_t i = 0; i < paintShare->sharePacketLen - 3; i++)
-    {
-        uint16_t x0 = ((PAINT_SHARE_PX_PER_PACKET * paintShare->shareSeqNum) + (i * 2)) % paintShare->canvas.w;
-        uint16_t y0 = ((PAINT_SHARE_PX_PER_PACKET * paintShare->shareSeqNum) + (i * 2)) / paintShare->canvas.w;
-        uint16_t x1 = ((PAINT_SHARE_PX_PER_PACKET * paintShare->shareSeqNum) + (i * 2 + 1)) % paintShare->canvas.w;
-        uint16_t y1 = ((PAINT_SHARE_PX_PER_PACKET * paintShare->shareSeqNum) + (i * 2 + 1)) / paintShare->canvas.w;
-
-        setPxScaled(x0, y0, paintShare->canvas.palette[paintShare->sharePacket[i + 3] >> 4], paintShare->canvas.x,
-                    paintShare->canvas.y, paintShare->canvas.xScale, paintShare->canvas.yScale);
-        setPxScaled(x1, y1, paintShare->canvas.palette[paintShare->sharePacket[i + 3] & 0xF], paintShare->canvas.x,
-                    paintShare->canvas.y, paintShare->canvas.xScale, paintShare->canvas.yScale);
-    }
+    // The canvas is drawn from the buffer every frame, so this is all it takes to show the new pixels
+    memcpy(&paintShare->canvas.buffer[paintShare->dataOffset], &paintShare->sharePacket[3],
+           paintShare->sharePacketLen - 3);
 
     PAINT_LOGI("We've received %d / %d pixels", (int)paintShare->dataOffset * 2 + (paintShare->sharePacketLen - 3) * 2,
                paintShare->canvas.h * paintShare->canvas.w);
@@ -812,17 +807,101 @@ void paintShareHandlePixels(void)
     }
 }
 
+/**
+ * @brief Build the bulk canvas message for protocol version 2: the packed canvas, heatshrink-compressed once. The
+ * first byte says whether the rest is compressed, since heatshrinkCompress() refuses to expand noisy images
+ *
+ * @return true if the message was built, false if memory ran out
+ */
+static bool paintShareBuildBlob(void)
+{
+    size_t rawLen = paintGetStoredSize(&paintShare->canvas);
+
+    const uint8_t* src = paintShare->canvas.buffer;
+
+    uint8_t* blob = heap_caps_malloc(1 + rawLen, MALLOC_CAP_SPIRAM);
+    if (NULL == blob)
+    {
+        return false;
+    }
+
+    uint32_t compressedLen = (rawLen > 4) ? heatshrinkCompress(&blob[1], src, rawLen) : 0;
+    if (0 != compressedLen)
+    {
+        blob[0]                  = SHARE_BLOB_HEATSHRINK;
+        paintShare->shareBlobLen = 1 + compressedLen;
+    }
+    else
+    {
+        blob[0] = SHARE_BLOB_RAW;
+        memcpy(&blob[1], src, rawLen);
+        paintShare->shareBlobLen = 1 + rawLen;
+    }
+
+    if (paintShare->shareBlobLen > P2P_BULK_MAX_LEN)
+    {
+        free(blob);
+        return false;
+    }
+
+    PAINT_LOGI("Compressed %" PRIu32 " bytes of pixels to %" PRIu16, (uint32_t)rawLen, paintShare->shareBlobLen);
+    paintShare->shareBlob = blob;
+    return true;
+}
+
+static void paintShareFreeBlob(void)
+{
+    if (paintShare->shareBlob)
+    {
+        free(paintShare->shareBlob);
+        paintShare->shareBlob = NULL;
+    }
+    paintShare->shareBlobLen = 0;
+}
+
+void paintShareSendBlob(void)
+{
+    if (NULL == paintShare->shareBlob && !paintShareBuildBlob())
+    {
+        // The receiver handles the old pixel packets too, so fall back to those
+        PAINT_LOGE("Unable to build compressed canvas, sending packets instead");
+        paintShare->version = 1;
+        paintShareSendPixels();
+        return;
+    }
+
+    paintShare->dataOffset = paintGetStoredSize(&paintShare->canvas);
+    paintShare->shareState = SHARE_SEND_WAIT_PIXEL_DATA_ACK;
+
+    if (!p2pSendBulk(&paintShare->p2pInfo, paintShare->shareBlob, paintShare->shareBlobLen, paintShareP2pBulkSendCb))
+    {
+        paintShareMsgSendFail();
+    }
+}
+
+void paintShareHandleBlob(void)
+{
+    PAINT_LOGI("Received the whole canvas");
+    paintShare->shareBlobReceived = false;
+    paintShare->dataOffset        = paintGetStoredSize(&paintShare->canvas);
+
+    paintShare->shareState = SHARE_RECV_SELECT_SLOT;
+    paintShareSendReceiveComplete();
+}
+
 void paintShareSendVersion(void)
 {
     paintShare->sharePacket[0] = SHARE_PACKET_VERSION;
-    paintShare->sharePacket[1] = 1;
+    paintShare->sharePacket[1] = SHARE_VERSION_CURRENT;
+    paintShare->sharePacketLen = 2;
     p2pSendMsg(&paintShare->p2pInfo, paintShare->sharePacket, paintShare->sharePacketLen, paintShareP2pSendCb);
 }
 
 void paintShareSendPixelRequest(void)
 {
+    // Ask for the newest version both sides understand. Version 0 senders ignore this
     paintShare->sharePacket[0] = SHARE_PACKET_PIXEL_REQUEST;
-    paintShare->sharePacket[1] = 1;
+    paintShare->sharePacket[1] = MAX(1, MIN(paintShare->version, SHARE_VERSION_CURRENT));
     paintShare->sharePacketLen = 2;
     p2pSendMsg(&paintShare->p2pInfo, paintShare->sharePacket, paintShare->sharePacketLen, paintShareP2pSendCb);
     paintShare->shareUpdateScreen = true;
@@ -931,13 +1010,11 @@ void paintBeginShare(void)
 void paintShareExitMode(void)
 {
     p2pDeinit(&paintShare->p2pInfo);
+    paintShareFreeBlob();
     freeFont(&paintShare->toolbarFont);
     freeWsg(&paintShare->arrowWsg);
 
-    if (paintShare->canvas.buffered && paintShare->canvas.buffer)
-    {
-        free(paintShare->canvas.buffer);
-    }
+    free(paintShare->canvas.buffer);
     resetImageBrowser(&paintShare->browser);
     deinitDialogBox(paintShare->dialog);
 
@@ -1136,7 +1213,11 @@ void paintShareMainLoop(int64_t elapsedUs)
 
         case SHARE_RECV_PIXEL_DATA:
         {
-            if (paintShare->shareNewPacket)
+            if (paintShare->shareBlobReceived)
+            {
+                paintShareHandleBlob();
+            }
+            else if (paintShare->shareNewPacket)
             {
                 paintShareHandlePixels();
             }
@@ -1372,6 +1453,40 @@ void paintShareP2pMsgRecvCb(p2pInfo* p2p, const uint8_t* payload, uint8_t len)
     paintShare->shareNewPacket = true;
 }
 
+void paintShareP2pBulkSendCb(p2pInfo* p2p, messageStatus_t status, uint16_t len)
+{
+    paintShareP2pSendCb(p2p, status, NULL, 0);
+}
+
+void paintShareP2pBulkRecvCb(p2pInfo* p2p, const uint8_t* payload, uint16_t len)
+{
+    if (paintShare->shareState != SHARE_RECV_PIXEL_DATA || !paintShare->canvas.buffer || len < 1)
+    {
+        return;
+    }
+
+    // Unpack straight into the canvas buffer, the screen gets drawn from it
+    size_t rawLen   = paintGetStoredSize(&paintShare->canvas);
+    uint32_t outLen = 0;
+    if (payload[0] == SHARE_BLOB_HEATSHRINK)
+    {
+        outLen = heatshrinkDecompress(paintShare->canvas.buffer, rawLen, &payload[1], len - 1);
+    }
+    else if (payload[0] == SHARE_BLOB_RAW)
+    {
+        outLen = MIN(rawLen, len - 1);
+        memcpy(paintShare->canvas.buffer, &payload[1], outLen);
+    }
+
+    if (outLen != rawLen)
+    {
+        PAINT_LOGE("Compressed canvas was %" PRIu32 " bytes, expected %" PRIu32, outLen, (uint32_t)rawLen);
+        return;
+    }
+
+    paintShare->shareBlobReceived = true;
+}
+
 static void paintShareBrowserCb(const char* key, imageBrowserAction_t action)
 {
     switch (action)
@@ -1412,7 +1527,9 @@ void paintShareDoLoad(void)
 {
     clearPxTft();
 
-    paintShare->canvas.buffered = true;
+    // A different image needs compressing again
+    paintShareFreeBlob();
+
     if (!paintLoadNamed(paintShare->shareSaveSlotKey, &paintShare->canvas))
     {
         PAINT_LOGE("Failed to load dimensions, stopping load");
@@ -108,11 +108,4 @@ typedef enum
     SHARE_RECV_SELECT_SLOT,
 } paintShareState_t;
 
-typedef struct
-{
-    paletteColor_t palette[PAINT_MAX_COLORS];
-    uint8_t fgIdx, bgIdx;
-    uint8_t* px;
-} paintUndo_t;
-
 #endif
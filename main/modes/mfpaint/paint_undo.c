@@ -0,0 +1,449 @@
+#include "paint_undo.h"
+
+#include <string.h>
+
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include "paint_common.h"
+
+// A run of at least this many unchanged bytes ends a run of changed bytes in a delta
+#define PAINT_UNDO_MIN_SKIP 3
+
+static bool paintUndoJournalInit(paintUndoJournal_t* journal, const paintCanvas_t* canvas, paletteColor_t fg,
+                                 paletteColor_t bg);
+static void paintUndoCaptureState(paintUndoState_t* state, const paintCanvas_t* canvas, paletteColor_t fg,
+                                  paletteColor_t bg);
+static uint32_t paintUndoPutVarint(uint8_t* out, uint32_t val);
+static uint32_t paintUndoGetVarint(const uint8_t** data);
+static uint32_t paintUndoEncode(const uint8_t* before, const uint8_t* after, size_t len, uint8_t* out);
+static void paintUndoApply(paintUndoJournal_t* journal, paintCanvas_t* canvas, const paintUndoEntry_t* entry,
+                           const paintUndoState_t* state);
+static paintUndoEntry_t* paintUndoEntryAt(paintUndoJournal_t* journal, uint8_t i);
+static void paintUndoDropOldest(paintUndoJournal_t* journal);
+static bool paintUndoReserve(paintUndoJournal_t* journal, uint32_t size, uint32_t* offset);
+static void paintUndoCommit(paintUndoJournal_t* journal, const paintCanvas_t* canvas, paletteColor_t fg,
+                            paletteColor_t bg);
+
+/**
+ * @brief Free all memory used by an undo journal and forget its history
+ *
+ * @param journal The journal to free
+ */
+void paintUndoJournalFree(paintUndoJournal_t* journal)
+{
+    free(journal->ring);
+    free(journal->ref);
+    memset(journal, 0, sizeof(paintUndoJournal_t));
+}
+
+/**
+ * @brief Mark the current state of the canvas as a point in history that can be returned to. Call this before
+ * changing the canvas.
+ *
+ * Any change since the last call is added to the journal, and any undone changes are forgotten.
+ *
+ * @param journal The journal to store the change in
+ * @param canvas The canvas, before it is changed
+ * @param fg The current foreground color
+ * @param bg The current background color
+ * @param dab true if the change about to be made is a brush dab, which will be coalesced with recent dabs
+ */
+void paintUndoJournalStore(paintUndoJournal_t* journal, paintCanvas_t* canvas, paletteColor_t fg, paletteColor_t bg,
+                           bool dab)
+{
+    if (!paintUndoJournalInit(journal, canvas, fg, bg))
+    {
+        return;
+    }
+
+    if (journal->undone > 0)
+    {
+        // Delete the undone changes, this is a different timeline now
+        PAINT_LOGD("Deleted %" PRIu8 " dangling undos after changing history", journal->undone);
+        journal->count -= journal->undone;
+        journal->undone = 0;
+    }
+
+    paintUndoCommit(journal, canvas, fg, bg);
+
+    journal->pending     = true;
+    journal->pendingDab  = dab;
+    journal->pendingTime = esp_timer_get_time();
+}
+
+bool paintUndoJournalCanUndo(const paintUndoJournal_t* journal)
+{
+    return journal->count > journal->undone || (journal->undone == 0 && journal->pending);
+}
+
+bool paintUndoJournalCanRedo(const paintUndoJournal_t* journal)
+{
+    return journal->undone > 0;
+}
+
+/**
+ * @brief Undo the most recent change to the canvas which hasn't been undone
+ *
+ * @param journal The journal to undo from
+ * @param canvas The canvas to undo the change on
+ * @param[in,out] fg The current foreground color, written with the foreground color before the change
+ * @param[in,out] bg The current background color, written with the background color before the change
+ * @return true if a change was undone, false if there was nothing to undo
+ */
+bool paintUndoJournalUndo(paintUndoJournal_t* journal, paintCanvas_t* canvas, paletteColor_t* fg, paletteColor_t* bg)
+{
+    if (journal->undone == 0)
+    {
+        // Since this is the first undo, save the current change so that we can return to it with redo
+        paintUndoCommit(journal, canvas, *fg, *bg);
+    }
+
+    if (journal->undone >= journal->count)
+    {
+        return false;
+    }
+
+    paintUndoEntry_t* entry = paintUndoEntryAt(journal, journal->count - 1 - journal->undone);
+    paintUndoApply(journal, canvas, entry, &entry->before);
+    journal->undone++;
+
+    *fg = canvas->palette[entry->before.fgIdx];
+    *bg = canvas->palette[entry->before.bgIdx];
+    return true;
+}
+
+/**
+ * @brief Redo the most recently undone change to the canvas
+ *
+ * @param journal The journal to redo from
+ * @param canvas The canvas to redo the change on
+ * @param[out] fg Written with the foreground color after the change
+ * @param[out] bg Written with the background color after the change
+ * @return true if a change was redone, false if there was nothing to redo
+ */
+bool paintUndoJournalRedo(paintUndoJournal_t* journal, paintCanvas_t* canvas, paletteColor_t* fg, paletteColor_t* bg)
+{
+    if (journal->undone == 0)
+    {
+        return false;
+    }
+
+    paintUndoEntry_t* entry = paintUndoEntryAt(journal, journal->count - journal->undone);
+    paintUndoApply(journal, canvas, entry, &entry->after);
+    journal->undone--;
+
+    *fg = canvas->palette[entry->after.fgIdx];
+    *bg = canvas->palette[entry->after.bgIdx];
+    return true;
+}
+
+/**
+ * @brief Allocate the journal's buffers if needed, and take the current canvas as the start of history
+ *
+ * @return true if the journal is ready to use, false if memory couldn't be allocated
+ */
+static bool paintUndoJournalInit(paintUndoJournal_t* journal, const paintCanvas_t* canvas, paletteColor_t fg,
+                                 paletteColor_t bg)
+{
+    size_t canvasSize = paintGetStoredSize(canvas);
+    if (journal->ref != NULL && journal->canvasSize == canvasSize)
+    {
+        return true;
+    }
+
+    paintUndoJournalFree(journal);
+
+    journal->ring = heap_caps_malloc(PAINT_UNDO_JOURNAL_SIZE, MALLOC_CAP_SPIRAM);
+    journal->ref  = heap_caps_malloc(canvasSize, MALLOC_CAP_SPIRAM);
+
+    if (journal->ring == NULL || journal->ref == NULL)
+    {
+        PAINT_LOGE("Failed to allocate undo journal! Canceling undo");
+        paintUndoJournalFree(journal);
+        return false;
+    }
+
+    journal->canvasSize = canvasSize;
+    memcpy(journal->ref, canvas->buffer, canvasSize);
+    paintUndoCaptureState(&journal->refState, canvas, fg, bg);
+    return true;
+}
+
+static void paintUndoCaptureState(paintUndoState_t* state, const paintCanvas_t* canvas, paletteColor_t fg,
+                                  paletteColor_t bg)
+{
+    // Save the palette
+    memcpy(state->palette, canvas->palette, sizeof(paletteColor_t) * PAINT_MAX_COLORS);
+
+    // Just in case we don't find the colors somehow
+    state->fgIdx = 0;
+    state->bgIdx = 1;
+
+    for (int i = 0; i < PAINT_MAX_COLORS; i++)
+    {
+        if (state->palette[i] == fg)
+        {
+            state->fgIdx = i;
+        }
+        if (state->palette[i] == bg)
+        {
+            state->bgIdx = i;
+        }
+    }
+}
+
+/**
+ * @brief Write a number as a variable-length sequence of 7-bit groups, least significant first
+ *
+ * @param out The buffer to write to, or NULL to only count the bytes needed
+ * @param val The number to write
+ * @return The number of bytes written
+ */
+static uint32_t paintUndoPutVarint(uint8_t* out, uint32_t val)
+{
+    uint32_t len = 0;
+    do
+    {
+        uint8_t byte = val & 0x7F;
+        val >>= 7;
+        if (out)
+        {
+            out[len] = byte | (val ? 0x80 : 0);
+        }
+        len++;
+    } while (val);
+    return len;
+}
+
+static uint32_t paintUndoGetVarint(const uint8_t** data)
+{
+    uint32_t val  = 0;
+    uint8_t shift = 0;
+    uint8_t byte;
+    do
+    {
+        byte = *((*data)++);
+        val |= (uint32_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return val;
+}
+
+/**
+ * @brief Encode the difference between two packed canvases as a list of (skip, length, XOR bytes) runs
+ *
+ * @param before The canvas before the change
+ * @param after The canvas after the change
+ * @param len The size of each canvas
+ * @param out The buffer to write the delta to, or NULL to only measure it
+ * @return The size of the delta, which is 0 if nothing changed
+ */
+static uint32_t paintUndoEncode(const uint8_t* before, const uint8_t* after, size_t len, uint8_t* out)
+{
+    uint32_t outLen = 0;
+    size_t last     = 0;
+    size_t i        = 0;
+
+    while (i < len)
+    {
+        if (before[i] == after[i])
+        {
+            i++;
+            continue;
+        }
+
+        // Extend the run until enough unchanged bytes are found in a row that it's cheaper to skip them
+        size_t end     = i + 1;
+        uint8_t intact = 0;
+        for (size_t j = i + 1; j < len && intact < PAINT_UNDO_MIN_SKIP; j++)
+        {
+            if (before[j] == after[j])
+            {
+                intact++;
+            }
+            else
+            {
+                intact = 0;
+                end    = j + 1;
+            }
+        }
+
+        outLen += paintUndoPutVarint(out ? &out[outLen] : NULL, i - last);
+        outLen += paintUndoPutVarint(out ? &out[outLen] : NULL, end - i);
+        for (; i < end; i++, outLen++)
+        {
+            if (out)
+            {
+                out[outLen] = before[i] ^ after[i];
+            }
+        }
+        last = end;
+    }
+
+    return outLen;
+}
+
+/**
+ * @brief Apply an entry's delta to the journal's copy of the canvas and to the canvas itself. Since the delta is an
+ * XOR, this both undoes and redoes the entry. Only the changed bytes are touched
+ *
+ * @param journal The journal the entry is in
+ * @param canvas The canvas to apply the delta to, or NULL to only update the journal's copy
+ * @param entry The entry to apply
+ * @param state The palette and colors to restore along with the pixels
+ */
+static void paintUndoApply(paintUndoJournal_t* journal, paintCanvas_t* canvas, const paintUndoEntry_t* entry,
+                           const paintUndoState_t* state)
+{
+    const uint8_t* data = &journal->ring[entry->offset];
+    const uint8_t* end  = data + entry->size;
+    uint32_t offset     = 0;
+
+    while (data < end)
+    {
+        offset += paintUndoGetVarint(&data);
+        uint32_t len = paintUndoGetVarint(&data);
+
+        for (uint32_t i = 0; i < len; i++)
+        {
+            journal->ref[offset + i] ^= data[i];
+        }
+        data += len;
+
+        if (canvas)
+        {
+            memcpy(&canvas->buffer[offset], &journal->ref[offset], len);
+        }
+
+        offset += len;
+    }
+
+    if (canvas)
+    {
+        memcpy(canvas->palette, state->palette, sizeof(paletteColor_t) * PAINT_MAX_COLORS);
+    }
+
+    journal->refState = *state;
+}
+
+static paintUndoEntry_t* paintUndoEntryAt(paintUndoJournal_t* journal, uint8_t i)
+{
+    return &journal->entries[(journal->first + i) % PAINT_UNDO_MAX_ENTRIES];
+}
+
+static void paintUndoDropOldest(paintUndoJournal_t* journal)
+{
+    journal->first = (journal->first + 1) % PAINT_UNDO_MAX_ENTRIES;
+    journal->count--;
+}
+
+/**
+ * @brief Find space in the ring buffer for a new entry's delta, dropping the oldest entries until it fits
+ *
+ * @param journal The journal to find space in
+ * @param size The size of the delta
+ * @param[out] offset Written with the offset of the space in the ring buffer
+ * @return true if space was found, false if the delta is larger than the whole ring buffer
+ */
+static bool paintUndoReserve(paintUndoJournal_t* journal, uint32_t size, uint32_t* offset)
+{
+    if (size > PAINT_UNDO_JOURNAL_SIZE)
+    {
+        return false;
+    }
+
+    if (journal->count == PAINT_UNDO_MAX_ENTRIES)
+    {
+        paintUndoDropOldest(journal);
+    }
+
+    // Deltas are stored one after another, wrapping to the start rather than splitting one across the end
+    uint32_t start = 0;
+    if (journal->count > 0)
+    {
+        const paintUndoEntry_t* newest = paintUndoEntryAt(journal, journal->count - 1);
+        start                          = newest->offset + newest->size;
+        if (start + size > PAINT_UNDO_JOURNAL_SIZE)
+        {
+            start = 0;
+        }
+    }
+
+    // The oldest deltas are the ones in the way, so drop them until nothing overlaps
+    bool overlap;
+    do
+    {
+        overlap = false;
+        for (uint8_t i = 0; i < journal->count && !overlap; i++)
+        {
+            const paintUndoEntry_t* entry = paintUndoEntryAt(journal, i);
+            overlap = (entry->offset < start + size) && (start < entry->offset + entry->size);
+        }
+
+        if (overlap)
+        {
+            paintUndoDropOldest(journal);
+        }
+    } while (overlap);
+
+    *offset = start;
+    return true;
+}
+
+/**
+ * @brief Add the change made to the canvas since the current point in history to the journal, if there was one
+ */
+static void paintUndoCommit(paintUndoJournal_t* journal, const paintCanvas_t* canvas, paletteColor_t fg,
+                            paletteColor_t bg)
+{
+    if (!journal->pending)
+    {
+        return;
+    }
+    journal->pending = false;
+
+    paintUndoState_t state;
+    paintUndoCaptureState(&state, canvas, fg, bg);
+
+    if (journal->pendingDab && journal->count > 0)
+    {
+        paintUndoEntry_t* newest = paintUndoEntryAt(journal, journal->count - 1);
+        if (newest->dab && journal->pendingTime - newest->time < PAINT_UNDO_COALESCE_US)
+        {
+            // Step back to before the previous dab, so this delta covers both dabs
+            paintUndoApply(journal, NULL, newest, &newest->before);
+            journal->count--;
+        }
+    }
+
+    uint32_t size = paintUndoEncode(journal->ref, canvas->buffer, journal->canvasSize, NULL);
+    if (size == 0 && memcmp(&state, &journal->refState, sizeof(paintUndoState_t)) == 0)
+    {
+        // Nothing changed
+        return;
+    }
+
+    uint32_t offset;
+    if (paintUndoReserve(journal, size, &offset))
+    {
+        paintUndoEncode(journal->ref, canvas->buffer, journal->canvasSize, &journal->ring[offset]);
+
+        paintUndoEntry_t* entry = paintUndoEntryAt(journal, journal->count++);
+        entry->offset           = offset;
+        entry->size             = size;
+        entry->before           = journal->refState;
+        entry->after            = state;
+        entry->time             = journal->pendingTime;
+        entry->dab              = journal->pendingDab;
+    }
+    else
+    {
+        // The change is too big to store, so nothing before it can be undone
+        PAINT_LOGD("Undo delta of %" PRIu32 " bytes doesn't fit, dropping history", size);
+        journal->count = 0;
+    }
+
+    memcpy(journal->ref, canvas->buffer, journal->canvasSize);
+    journal->refState = state;
+}
@@ -0,0 +1,89 @@
+#ifndef _PAINT_UNDO_H_
+#define _PAINT_UNDO_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "palette.h"
+#include "paint_canvas.h"
+
+// The number of bytes of pixel changes the journal can hold before it starts forgetting the oldest changes
+#define PAINT_UNDO_JOURNAL_SIZE (16 * 1024)
+
+// The most undo steps the journal can hold, no matter how small they are
+#define PAINT_UNDO_MAX_ENTRIES 64
+
+// Brush dabs started within this long of the previous dab are undone together
+#define PAINT_UNDO_COALESCE_US 400000
+
+/// @brief The palette and selected colors of the canvas at some point in history
+typedef struct
+{
+    paletteColor_t palette[PAINT_MAX_COLORS];
+    uint8_t fgIdx, bgIdx;
+} paintUndoState_t;
+
+/// @brief One undoable change to the canvas
+typedef struct
+{
+    // The offset of this change's pixel delta within the journal's ring buffer
+    uint32_t offset;
+
+    // The size of this change's pixel delta, in bytes
+    uint32_t size;
+
+    // The palette and colors before and after the change
+    paintUndoState_t before, after;
+
+    // When the change was started, for coalescing brush dabs
+    int64_t time;
+
+    // Whether the change was a brush dab, which may be coalesced with the next one
+    bool dab;
+} paintUndoEntry_t;
+
+/// @brief A bounded history of changes to a canvas, stored as run-length encoded pixel deltas
+///
+/// Each change is stored as the XOR of the packed canvas before and after it, so applying an entry's delta both undoes
+/// and redoes it. The deltas are kept in a fixed-size ring buffer, and the oldest are dropped to make room for new
+/// ones. A copy of the canvas as of the current point in history is kept so that the next change can be found.
+typedef struct
+{
+    // The ring buffer holding each entry's pixel delta
+    uint8_t* ring;
+
+    // The packed canvas as of the current point in history
+    uint8_t* ref;
+
+    // The size of the packed canvas
+    size_t canvasSize;
+
+    // The palette and colors as of the current point in history
+    paintUndoState_t refState;
+
+    // The entries, oldest first, starting at index `first` and wrapping around
+    paintUndoEntry_t entries[PAINT_UNDO_MAX_ENTRIES];
+    uint8_t first;
+    uint8_t count;
+
+    // How many of the newest entries have been undone, and can be redone
+    uint8_t undone;
+
+    // Whether the canvas may have changed since the current point in history
+    bool pending;
+
+    // Whether the pending change is a brush dab, and when it was started
+    bool pendingDab;
+    int64_t pendingTime;
+} paintUndoJournal_t;
+
+void paintUndoJournalFree(paintUndoJournal_t* journal);
+void paintUndoJournalStore(paintUndoJournal_t* journal, paintCanvas_t* canvas, paletteColor_t fg, paletteColor_t bg,
+                           bool dab);
+bool paintUndoJournalCanUndo(const paintUndoJournal_t* journal);
+bool paintUndoJournalCanRedo(const paintUndoJournal_t* journal);
+bool paintUndoJournalUndo(paintUndoJournal_t* journal, paintCanvas_t* canvas, paletteColor_t* fg, paletteColor_t* bg);
+bool paintUndoJournalRedo(paintUndoJournal_t* journal, paintCanvas_t* canvas, paletteColor_t* fg, paletteColor_t* bg);
+
+#endif
@@ -1,5 +1,7 @@
 #include "paint_util.h"
 
+#include <string.h>
+
 #include "paint_common.h"
 #include "paint_nvs.h"
 
@@ -126,57 +128,54 @@ void drawRectFilledScaled(int x0, int y0, int x1, int y1, paletteColor_t col, in
     fillDisplayArea(xTr + x0 * xScale, yTr + y0 * yScale, xTr + (x1)*xScale, yTr + (y1)*yScale, col);
 }
 
+/**
+ * @brief Replace every pixel of one color on a canvas with another color, then redraw the canvas
+ *
+ * The buffer is scanned a word at a time, eight pixels per word, by finding the nibbles which match the search index
+ *
+ * @param canvas The canvas to replace the color in
+ * @param search The color to replace. Nothing is done if this isn't in the canvas's palette
+ * @param replace The color to replace it with
+ */
 void paintColorReplace(paintCanvas_t* canvas, paletteColor_t search, paletteColor_t replace)
 {
-    // super inefficient dumb color replace, maybe do iterated color fill later?
-    if (canvas->buffered)
+    int8_t searchIdx  = paintGetPaletteIndex(canvas->palette, search);
+    int8_t replaceIdx = paintGetPaletteIndex(canvas->palette, replace);
+
+    if (searchIdx < 0 || searchIdx == replaceIdx)
     {
-        uint8_t searchHigh = 0xF0;
-        uint8_t searchLow  = 0x0F;
-        uint8_t replHigh   = 0xF0;
-        uint8_t replLow    = 0x0F;
-        for (uint8_t i = 0; i < PAINT_MAX_COLORS; i++)
-        {
-            if (canvas->palette[i] == search)
-            {
-                searchHigh = (i & 0x0F) << 4;
-                searchLow  = (i & 0x0F);
-            }
-            else if (canvas->palette[i] == replace)
-            {
-                replHigh = (i & 0x0F) << 4;
-                replLow  = (i & 0x0F);
-            }
-        }
+        return;
+    }
 
-        for (int n = 0; n < (canvas->w * canvas->h + 1) / 2; n++)
-        {
-            uint8_t val = canvas->buffer[n];
-            if ((val & 0xF0) == searchHigh)
-            {
-                canvas->buffer[n] = (canvas->buffer[n] & 0x0F) | replHigh;
-            }
-            if ((val & 0x0F) == searchLow)
-            {
-                canvas->buffer[n] = (canvas->buffer[n] & 0xF0) | replLow;
-            }
-        }
+    if (replaceIdx < 0)
+    {
+        // The new color isn't in the palette, so just recolor every pixel using the old one
+        canvas->palette[searchIdx] = replace;
         paintBlitCanvas(canvas);
+        return;
     }
-}
 
-void paintColorReplaceScreen(paintCanvas_t* canvas, paletteColor_t search, paletteColor_t replace)
-{
-    for (uint8_t x = 0; x < canvas->w; x++)
+    const uint32_t searchWord  = 0x11111111u * (uint32_t)searchIdx;
+    const uint32_t replaceWord = 0x11111111u * (uint32_t)replaceIdx;
+
+    size_t size = paintGetStoredSize(canvas);
+    for (size_t n = 0; n < size; n += sizeof(uint32_t))
     {
-        for (uint8_t y = 0; y < canvas->h; y++)
-        {
-            if (getPxTft(canvas->x + x * canvas->xScale, canvas->y + y * canvas->yScale) == search)
-            {
-                setPxScaled(x, y, replace, canvas->x, canvas->y, canvas->xScale, canvas->yScale);
-            }
-        }
+        uint32_t word = 0;
+        size_t len    = MIN(sizeof(uint32_t), size - n);
+        memcpy(&word, &canvas->buffer[n], len);
+
+        // Fold each nibble onto its low bit, which is then only clear where the nibble matched
+        uint32_t diff = word ^ searchWord;
+        diff |= diff >> 1;
+        diff |= diff >> 2;
+        uint32_t mask = (~diff & 0x11111111u) * 0x0F;
+
+        word = (word & ~mask) | (replaceWord & mask);
+        memcpy(&canvas->buffer[n], &word, len);
     }
+
+    paintBlitCanvas(canvas);
 }
 
 void setPxScaled(int x, int y, paletteColor_t col, int xTr, int yTr, int xScale, int yScale)
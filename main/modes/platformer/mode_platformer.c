@@ -220,6 +220,9 @@ void platformerEnterMode(void)
 
     loadFont("radiostars.font", &platformer->radiostars, false);
 
+    // The HUD is drawn in this font every frame
+    cacheFontGlyphs(&platformer->radiostars);
+
     pl_initializeTileMap(&(platformer->tilemap));
     pl_loadMapFromFile(&(platformer->tilemap), leveldef[0].filename);
 
@@ -284,12 +287,10 @@ void platformerMainLoop(int64_t elapsedUs)
 
 void updateGame(platformer_t* self)
 {
-    // Clear the display
-    fillDisplayArea(0, 0, TFT_WIDTH, TFT_HEIGHT, self->gameData.bgColor);
-
     pl_updateEntities(&(self->entityManager));
 
-    pl_drawTileMap(&(self->tilemap));
+    // The tilemap covers the whole display, so it doesn't need to be cleared
+    pl_drawTileMap(&(self->tilemap), self->gameData.bgColor);
     pl_drawEntities(&(self->entityManager));
     detectGameStateChange(self);
     detectBgmChange(self);
@@ -626,7 +627,7 @@ void updateTitleScreen(platformer_t* self)
 
 void drawPlatformerTitleScreen(font_t* font, plGameData_t* gameData)
 {
-    pl_drawTileMap(&(platformer->tilemap));
+    pl_drawTileMap(&(platformer->tilemap), gameData->bgColor);
 
     drawText(font, c555, "Super Swadge Land", 40, 32);
 
@@ -902,7 +903,7 @@ void updateDead(platformer_t* self)
     }
 
     pl_updateEntities(&(self->entityManager));
-    pl_drawTileMap(&(self->tilemap));
+    pl_drawTileMap(&(self->tilemap), self->gameData.bgColor);
     pl_drawEntities(&(self->entityManager));
     drawPlatformerHud(&(self->radiostars), &(self->gameData));
 
@@ -1070,7 +1071,7 @@ void updateLevelClear(platformer_t* self)
     }
 
     pl_updateEntities(&(self->entityManager));
-    pl_drawTileMap(&(self->tilemap));
+    pl_drawTileMap(&(self->tilemap), self->gameData.bgColor);
     pl_drawEntities(&(self->entityManager));
     drawPlatformerHud(&(self->radiostars), &(self->gameData));
     drawLevelClear(&(self->radiostars), &(self->gameData));
@@ -1438,7 +1439,7 @@ void updatePause(platformer_t* self)
         self->update              = &updateGame;
     }
 
-    pl_drawTileMap(&(self->tilemap));
+    pl_drawTileMap(&(self->tilemap), self->gameData.bgColor);
     pl_drawEntities(&(self->entityManager));
     drawPlatformerHud(&(self->radiostars), &(self->gameData));
     drawPause(&(self->radiostars));
@@ -23,6 +23,9 @@
 #define PL_HALF_TILESIZE           8
 #define DESPAWN_THRESHOLD          64
 
+// Entities closer than this taxicab distance, in subpixels, collide
+#define PL_COLLISION_DIST 200
+
 #define SIGNOF(x)           ((x > 0) - (x < 0))
 #define PL_TO_TILECOORDS(x) ((x) >> PL_TILESIZE_IN_POWERS_OF_2)
 // #define TO_PIXEL_COORDS(x) ((x) >> SUBPIXEL_RESOLUTION)
@@ -329,7 +332,7 @@ void updateHitBlock(plEntity_t* self)
             bzrPlaySfx(&(self->soundManager->sndBreak), BZR_LEFT);
         }
 
-        self->tilemap->map[self->homeTileY * self->tilemap->mapWidth + self->homeTileX] = self->jumpPower;
+        pl_setTile(self->tilemap, self->homeTileX, self->homeTileY, self->jumpPower);
 
         pl_destroyEntity(self, false);
     }
@@ -544,7 +547,7 @@ void pl_destroyEntity(plEntity_t* self, bool respawn)
         self->tilemap->map[self->homeTileY * self->tilemap->mapWidth + self->homeTileX] = self->type + 128;
     }
 
-    // self->entityManager->activeEntities--;
+    entityPoolFree(&self->entityManager->pool, self - self->entityManager->entities);
     self->active = false;
 }
 
@@ -604,14 +607,21 @@ void animatePlayer(plEntity_t* self)
 
 void pl_detectEntityCollisions(plEntity_t* self)
 {
-    for (uint8_t i = 0; i < MAX_ENTITIES; i++)
+    // The broadphase was built from positions at the start of the tick, so pad the query by how far any other entity
+    // may have moved since then
+    int32_t reach = PL_COLLISION_DIST + self->entityManager->broadphaseMargin;
+    uint16_t nearby[MAX_ENTITIES];
+    uint16_t numNearby = spatialHashQuery(&self->entityManager->broadphase, self->x - reach, self->y - reach,
+                                          self->x + reach, self->y + reach, nearby, MAX_ENTITIES);
+
+    for (uint16_t n = 0; n < numNearby; n++)
     {
-        plEntity_t* checkEntity = &(self->entityManager->entities[i]);
+        plEntity_t* checkEntity = &(self->entityManager->entities[nearby[n]]);
         if (checkEntity->active && checkEntity != self)
         {
             uint32_t dist = abs(self->x - checkEntity->x) + abs(self->y - checkEntity->y);
 
-            if (dist < 200)
+            if (dist < PL_COLLISION_DIST)
             {
                 self->collisionHandler(self, checkEntity);
             }
@@ -18,6 +18,255 @@
 //==============================================================================
 #define SUBPIXEL_RESOLUTION 4
 
+// Half the width of the display, in pixels. Entities spawned left of this walk right, and vice versa
+#define PL_HALF_SCREEN_WIDTH 120
+
+// Archetype spawn flags
+#define PL_SPAWN_WALK_TO_CENTER   0x01 ///< Set xspeed to walkSpeed, towards the center of the screen
+#define PL_SPAWN_WALK_FROM_PLAYER 0x02 ///< Set xspeed to walkSpeed, away from the player
+#define PL_SPAWN_FLIP_LEFT_HALF   0x04 ///< Flip horizontally when spawned on the left half of the screen
+#define PL_SPAWN_FLIP_RIGHT_HALF  0x08 ///< Flip horizontally when spawned on the right half of the screen
+#define PL_SPAWN_RANDOM_JUMP      0x10 ///< Set a random jumpPower
+#define PL_SPAWN_POWERUP_SPRITE   0x20 ///< Pick the powerup sprite by the player's HP
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * @brief The initial state of a type of entity. Every field not listed here starts at zero
+ */
+typedef struct
+{
+    bool visible;
+    uint8_t spriteIndex;
+    bool spriteFlipVertical;
+    int16_t walkSpeed; ///< The magnitude of xspeed for the PL_SPAWN_WALK_* flags
+    int16_t xMaxSpeed;
+    int16_t yMaxSpeed;
+    int16_t xDamping; ///< Many entities repurpose this as state
+    int16_t yDamping; ///< Many entities repurpose this as a timer
+    bool gravityEnabled;
+    int16_t gravity;
+    bool falling;
+    uint8_t hp;
+    uint16_t scoreValue;
+    uint8_t spawnFlags; ///< A bitmask of PL_SPAWN_*
+    pl_updateFunction_t updateFunction;
+    pl_collisionHandler_t collisionHandler;
+    pl_tileCollisionHandler_t tileCollisionHandler;
+    pl_fallOffTileHandler_t fallOffTileHandler; ///< NULL for defaultFallOffTileHandler
+    pl_overlapTileHandler_t overlapTileHandler;
+} plArchetype_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void pl_broadphaseInsert(plEntityManager_t* entityManager, int32_t slot);
+static void pl_broadphaseTrackSpeed(plEntityManager_t* entityManager, const plEntity_t* entity);
+
+//==============================================================================
+// Macros
+//==============================================================================
+
+/// An invisible trigger entity that does nothing but run its update function
+#define PL_TRIGGER(update, state)                                                                                     \
+    {                                                                                                                 \
+        .xDamping = (state), .updateFunction = (update), .collisionHandler = &pl_dummyCollisionHandler,               \
+        .tileCollisionHandler = &pl_dummyTileCollisionHandler, .overlapTileHandler = &pl_defaultOverlapTileHandler,   \
+    }
+
+//==============================================================================
+// Look Up Tables
+//==============================================================================
+
+// clang-format off
+/**
+ * @brief The initial state of every entity type, indexed by ::plEntityIndex_t. Types with no update function can't
+ * be spawned.
+ */
+static const plArchetype_t plArchetypes[] = {
+    [ENTITY_PLAYER] = {
+        .visible = true, .spriteIndex = SP_PLAYER_IDLE,
+        .xMaxSpeed = 40, .yMaxSpeed = 64, .xDamping = 1, .yDamping = 4,
+        .gravityEnabled = true, .gravity = 4, .falling = true, .hp = 1,
+        .updateFunction       = &pl_updatePlayer,
+        .collisionHandler     = &pl_playerCollisionHandler,
+        .tileCollisionHandler = &pl_playerTileCollisionHandler,
+        .overlapTileHandler   = &pl_playerOverlapTileHandler,
+    },
+    [plEntity_tEST] = {
+        .visible = true, .spriteIndex = SP_ENEMY_BASIC,
+        .walkSpeed = 8, .xMaxSpeed = 132, .yMaxSpeed = 132,
+        .gravityEnabled = true, .gravity = 4, .scoreValue = 100,
+        .spawnFlags = PL_SPAWN_WALK_TO_CENTER,
+        .updateFunction       = &updateTestObject,
+        .collisionHandler     = &pl_enemyCollisionHandler,
+        .tileCollisionHandler = &pl_enemyTileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_SCROLL_LOCK_LEFT]  = PL_TRIGGER(&updateScrollLockLeft, 0),
+    [ENTITY_SCROLL_LOCK_RIGHT] = PL_TRIGGER(&updateScrollLockRight, 0),
+    [ENTITY_SCROLL_LOCK_UP]    = PL_TRIGGER(&updateScrollLockUp, 0),
+    [ENTITY_SCROLL_LOCK_DOWN]  = PL_TRIGGER(&updateScrollLockDown, 0),
+    [ENTITY_SCROLL_UNLOCK]     = PL_TRIGGER(&updateScrollUnlock, 0),
+    [ENTITY_HIT_BLOCK] = {
+        .visible = true, .spriteIndex = SP_HITBLOCK_CONTAINER,
+        .xMaxSpeed = 132, .yMaxSpeed = 132,
+        .gravityEnabled = true, .gravity = 4,
+        .updateFunction       = &updateHitBlock,
+        .collisionHandler     = &pl_dummyCollisionHandler,
+        .tileCollisionHandler = &pl_dummyTileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_POWERUP] = {
+        .visible = true,
+        .walkSpeed = 16, .xMaxSpeed = 132, .yMaxSpeed = 132,
+        .gravityEnabled = true, .gravity = 4,
+        .spawnFlags = PL_SPAWN_WALK_FROM_PLAYER | PL_SPAWN_POWERUP_SPRITE,
+        .updateFunction       = &updatePowerUp,
+        .collisionHandler     = &powerUpCollisionHandler,
+        .tileCollisionHandler = &pl_enemyTileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_WARP] = {
+        .visible = true, .spriteIndex = SP_WARP_1,
+        .xMaxSpeed = 132, .yMaxSpeed = 132,
+        .gravityEnabled = true, .gravity = 4,
+        .updateFunction       = &updateWarp,
+        .collisionHandler     = &pl_dummyCollisionHandler,
+        .tileCollisionHandler = &pl_dummyTileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_DUST_BUNNY] = {
+        .visible = true, .spriteIndex = SP_DUSTBUNNY_IDLE,
+        .xMaxSpeed = 132, .yMaxSpeed = 132,
+        .gravityEnabled = true, .gravity = 4, .scoreValue = 150,
+        .spawnFlags = PL_SPAWN_FLIP_LEFT_HALF,
+        .updateFunction       = &updateDustBunny,
+        .collisionHandler     = &pl_enemyCollisionHandler,
+        .tileCollisionHandler = &dustBunnyTileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_WASP] = {
+        .visible = true, .spriteIndex = SP_WASP_1,
+        .walkSpeed = 16, .xMaxSpeed = 132, .yMaxSpeed = 128,
+        .gravity = 8, .scoreValue = 200,
+        .spawnFlags = PL_SPAWN_WALK_TO_CENTER | PL_SPAWN_FLIP_RIGHT_HALF,
+        .updateFunction       = &updateWasp,
+        .collisionHandler     = &pl_enemyCollisionHandler,
+        .tileCollisionHandler = &waspTileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_BUSH_2] = {
+        .visible = true, .spriteIndex = SP_ENEMY_BUSH_L2,
+        .walkSpeed = 12, .xMaxSpeed = 132, .yMaxSpeed = 132,
+        .gravityEnabled = true, .gravity = 4, .scoreValue = 150,
+        .spawnFlags = PL_SPAWN_WALK_TO_CENTER,
+        .updateFunction       = &updateTestObject,
+        .collisionHandler     = &pl_enemyCollisionHandler,
+        .tileCollisionHandler = &pl_enemyTileCollisionHandler,
+        .fallOffTileHandler   = &turnAroundAtEdgeOfTileHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_BUSH_3] = {
+        .visible = true, .spriteIndex = SP_ENEMY_BUSH_L3,
+        .walkSpeed = 11, .xMaxSpeed = 132, .yMaxSpeed = 132, .yDamping = 20,
+        .gravityEnabled = true, .gravity = 4, .scoreValue = 250,
+        .spawnFlags = PL_SPAWN_WALK_TO_CENTER,
+        .updateFunction       = &updateEnemyBushL3,
+        .collisionHandler     = &pl_enemyCollisionHandler,
+        .tileCollisionHandler = &pl_enemyTileCollisionHandler,
+        .fallOffTileHandler   = &turnAroundAtEdgeOfTileHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_DUST_BUNNY_2] = {
+        .visible = true, .spriteIndex = SP_DUSTBUNNY_L2_IDLE,
+        .xMaxSpeed = 132, .yMaxSpeed = 132,
+        .gravityEnabled = true, .gravity = 4, .scoreValue = 200,
+        .spawnFlags = PL_SPAWN_FLIP_RIGHT_HALF,
+        .updateFunction       = &updateDustBunnyL2,
+        .collisionHandler     = &pl_enemyCollisionHandler,
+        .tileCollisionHandler = &dustBunnyL2TileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_DUST_BUNNY_3] = {
+        .visible = true, .spriteIndex = SP_DUSTBUNNY_L3_IDLE,
+        .xMaxSpeed = 132, .yMaxSpeed = 132,
+        .gravityEnabled = true, .gravity = 4, .scoreValue = 300,
+        .spawnFlags = PL_SPAWN_FLIP_LEFT_HALF,
+        .updateFunction       = &updateDustBunnyL3,
+        .collisionHandler     = &pl_enemyCollisionHandler,
+        .tileCollisionHandler = &dustBunnyL3TileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_WASP_2] = {
+        .visible = true, .spriteIndex = SP_WASP_L2_1,
+        .walkSpeed = 24, .xMaxSpeed = 132, .yMaxSpeed = 192,
+        .gravity = 8, .scoreValue = 300,
+        .spawnFlags = PL_SPAWN_WALK_TO_CENTER | PL_SPAWN_FLIP_RIGHT_HALF | PL_SPAWN_RANDOM_JUMP,
+        .updateFunction       = &updateWaspL2,
+        .collisionHandler     = &pl_enemyCollisionHandler,
+        .tileCollisionHandler = &waspTileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_WASP_3] = {
+        .visible = true, .spriteIndex = SP_WASP_L3_1,
+        .walkSpeed = 24, .xMaxSpeed = 132, .yMaxSpeed = 256,
+        .gravity = 8, .scoreValue = 400,
+        .spawnFlags = PL_SPAWN_WALK_TO_CENTER | PL_SPAWN_FLIP_RIGHT_HALF | PL_SPAWN_RANDOM_JUMP,
+        .updateFunction       = &updateWaspL3,
+        .collisionHandler     = &pl_enemyCollisionHandler,
+        .tileCollisionHandler = &waspTileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_BGCOL_BLUE]          = PL_TRIGGER(&updateBgCol, c335),
+    [ENTITY_BGCOL_YELLOW]        = PL_TRIGGER(&updateBgCol, c542),
+    [ENTITY_BGCOL_ORANGE]        = PL_TRIGGER(&updateBgCol, c532),
+    [ENTITY_BGCOL_PURPLE]        = PL_TRIGGER(&updateBgCol, c214),
+    [ENTITY_BGCOL_DARK_PURPLE]   = PL_TRIGGER(&updateBgCol, c103),
+    [ENTITY_BGCOL_BLACK]         = PL_TRIGGER(&updateBgCol, c000),
+    [ENTITY_BGCOL_NEUTRAL_GREEN] = PL_TRIGGER(&updateBgCol, c133),
+    [ENTITY_BGCOL_DARK_RED]      = PL_TRIGGER(&updateBgCol, c200),
+    [ENTITY_BGCOL_DARK_GREEN]    = PL_TRIGGER(&updateBgCol, c010),
+    [ENTITY_1UP] = {
+        .visible = true, .spriteIndex = SP_1UP_1,
+        .walkSpeed = 16, .xMaxSpeed = 132, .yMaxSpeed = 132,
+        .gravityEnabled = true, .gravity = 4,
+        .spawnFlags = PL_SPAWN_WALK_FROM_PLAYER,
+        .updateFunction       = &update1up,
+        .collisionHandler     = &powerUpCollisionHandler,
+        .tileCollisionHandler = &pl_enemyTileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_WAVE_BALL] = {
+        .visible = true, .spriteIndex = SP_WAVEBALL_1,
+        .xMaxSpeed = 132, .yMaxSpeed = 132, .yDamping = 3,
+        .gravity = 4,
+        .updateFunction       = &updateWaveBall,
+        .collisionHandler     = &pl_dummyCollisionHandler,
+        .tileCollisionHandler = &pl_dummyTileCollisionHandler,
+        .overlapTileHandler   = &waveBallOverlapTileHandler,
+    },
+    [ENTITY_CHECKPOINT] = {
+        .visible = true, .spriteIndex = SP_CHECKPOINT_INACTIVE,
+        .xMaxSpeed = 132, .yMaxSpeed = 132,
+        .gravityEnabled = true, .gravity = 4,
+        .updateFunction       = &updateCheckpoint,
+        .collisionHandler     = &pl_dummyCollisionHandler,
+        .tileCollisionHandler = &pl_dummyTileCollisionHandler,
+        .overlapTileHandler   = &pl_defaultOverlapTileHandler,
+    },
+    [ENTITY_BGM_STOP]     = PL_TRIGGER(&updateBgmChange, PL_BGM_NULL),
+    [ENTITY_BGM_CHANGE_1] = PL_TRIGGER(&updateBgmChange, PL_BGM_MAIN),
+    [ENTITY_BGM_CHANGE_2] = PL_TRIGGER(&updateBgmChange, PL_BGM_ATHLETIC),
+    [ENTITY_BGM_CHANGE_3] = PL_TRIGGER(&updateBgmChange, PL_BGM_UNDERGROUND),
+    [ENTITY_BGM_CHANGE_4] = PL_TRIGGER(&updateBgmChange, PL_BGM_FORTRESS),
+    [ENTITY_BGM_CHANGE_5] = PL_TRIGGER(&updateBgmChange, PL_BGM_NULL),
+};
+// clang-format on
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -32,8 +281,10 @@ void pl_initializeEntityManager(plEntityManager_t* entityManager, plTilemap_t* t
         pl_initializeEntity(&(entityManager->entities[i]), entityManager, tilemap, gameData, soundManager);
     }
 
-    entityManager->activeEntities = 0;
-    entityManager->tilemap        = tilemap;
+    entityPoolInit(&entityManager->pool, MAX_ENTITIES);
+    spatialHashInit(&entityManager->broadphase, MAX_ENTITIES, PL_BROADPHASE_CELL_SHIFT, PL_BROADPHASE_BUCKETS);
+
+    entityManager->tilemap = tilemap;
 
     // entityManager->viewEntity = pl_createPlayer(entityManager, entityManager->tilemap->warps[0].x * 16,
     // entityManager->tilemap->warps[0].y * 16);
@@ -97,22 +348,33 @@ void pl_loadSprites(plEntityManager_t* entityManager)
 
 void pl_updateEntities(plEntityManager_t* entityManager)
 {
-    for (uint8_t i = 0; i < MAX_ENTITIES; i++)
+    // Rebuild the collision broadphase from this tick's starting positions
+    spatialHashClear(&entityManager->broadphase);
+    entityManager->broadphaseMargin = 0;
+    for (int32_t i = entityPoolNext(&entityManager->pool, -1); i >= 0; i = entityPoolNext(&entityManager->pool, i))
     {
-        if (entityManager->entities[i].active)
-        {
-            entityManager->entities[i].updateFunction(&(entityManager->entities[i]));
+        pl_broadphaseInsert(entityManager, i);
+    }
 
-            if (&(entityManager->entities[i]) == entityManager->viewEntity)
-            {
-                pl_viewFollowEntity(entityManager->tilemap, &(entityManager->entities[i]));
-            }
+    // Entities spawned during this loop at higher slots are updated this tick too, same as before
+    for (int32_t i = entityPoolNext(&entityManager->pool, -1); i >= 0; i = entityPoolNext(&entityManager->pool, i))
+    {
+        entityManager->entities[i].updateFunction(&(entityManager->entities[i]));
+
+        // Speed may have changed, and later entities' queries must reach wherever this one moved to
+        pl_broadphaseTrackSpeed(entityManager, &(entityManager->entities[i]));
+
+        if (&(entityManager->entities[i]) == entityManager->viewEntity)
+        {
+            pl_viewFollowEntity(entityManager->tilemap, &(entityManager->entities[i]));
         }
     }
 }
 
 void pl_deactivateAllEntities(plEntityManager_t* entityManager, bool excludePlayer)
 {
+    entityPoolClear(&entityManager->pool);
+
     for (uint8_t i = 0; i < MAX_ENTITIES; i++)
     {
         plEntity_t* currentEntity = &(entityManager->entities[i]);
@@ -130,47 +392,25 @@ void pl_deactivateAllEntities(plEntityManager_t* entityManager, bool excludePlay
         if (excludePlayer && currentEntity == entityManager->playerEntity)
         {
             currentEntity->active = true;
+            entityPoolAllocAt(&entityManager->pool, i);
         }
     }
 }
 
 void pl_drawEntities(plEntityManager_t* entityManager)
 {
-    for (uint8_t i = 0; i < MAX_ENTITIES; i++)
-    {
-        plEntity_t currentEntity = entityManager->entities[i];
-
-        if (currentEntity.active && currentEntity.visible)
-        {
-            drawWsg(&entityManager->sprites[currentEntity.spriteIndex],
-                    (currentEntity.x >> SUBPIXEL_RESOLUTION) - 8 - entityManager->tilemap->mapOffsetX,
-                    (currentEntity.y >> SUBPIXEL_RESOLUTION) - entityManager->tilemap->mapOffsetY - 8,
-                    currentEntity.spriteFlipHorizontal, currentEntity.spriteFlipVertical, 0);
-        }
-    }
-}
-
-plEntity_t* pl_findInactiveEntity(plEntityManager_t* entityManager)
-{
-    if (entityManager->activeEntities == MAX_ENTITIES)
-    {
-        return NULL;
-    };
-
-    uint8_t entityIndex = 0;
-
-    while (entityManager->entities[entityIndex].active)
+    for (int32_t i = entityPoolNext(&entityManager->pool, -1); i >= 0; i = entityPoolNext(&entityManager->pool, i))
     {
-        entityIndex++;
+        const plEntity_t* currentEntity = &entityManager->entities[i];
 
-        // Extra safeguard to make sure we don't get stuck here
-        if (entityIndex > MAX_ENTITIES)
+        if (currentEntity->visible)
         {
-            return NULL;
+            drawWsg(&entityManager->sprites[currentEntity->spriteIndex],
+                    (currentEntity->x >> SUBPIXEL_RESOLUTION) - 8 - entityManager->tilemap->mapOffsetX,
+                    (currentEntity->y >> SUBPIXEL_RESOLUTION) - entityManager->tilemap->mapOffsetY - 8,
+                    currentEntity->spriteFlipHorizontal, currentEntity->spriteFlipVertical, 0);
         }
     }
-
-    return &(entityManager->entities[entityIndex]);
 }
 
 void pl_viewFollowEntity(plTilemap_t* tilemap, plEntity_t* entity)
@@ -194,1203 +434,136 @@ void pl_viewFollowEntity(plTilemap_t* tilemap, plEntity_t* entity)
     //}
 }
 
+/**
+ * @brief Spawn an entity from its archetype in ::plArchetypes
+ *
+ * @param entityManager The entity manager to spawn in
+ * @param objectIndex The type of entity to spawn, a ::plEntityIndex_t
+ * @param x The X position to spawn at, in pixels
+ * @param y The Y position to spawn at, in pixels
+ * @return The spawned entity, or NULL if the type can't be spawned or there are no free slots
+ */
 plEntity_t* pl_createEntity(plEntityManager_t* entityManager, uint8_t objectIndex, uint16_t x, uint16_t y)
 {
-    // if(entityManager->activeEntities == MAX_ENTITIES){
-    //     return NULL;
-    // }
-
-    plEntity_t* createdEntity;
-
-    switch (objectIndex)
-    {
-        case ENTITY_PLAYER:
-            createdEntity = pl_createPlayer(entityManager, x, y);
-            break;
-        case plEntity_tEST:
-            createdEntity = createTestObject(entityManager, x, y);
-            break;
-        case ENTITY_SCROLL_LOCK_LEFT:
-            createdEntity = createScrollLockLeft(entityManager, x, y);
-            break;
-        case ENTITY_SCROLL_LOCK_RIGHT:
-            createdEntity = createScrollLockRight(entityManager, x, y);
-            break;
-        case ENTITY_SCROLL_LOCK_UP:
-            createdEntity = createScrollLockUp(entityManager, x, y);
-            break;
-        case ENTITY_SCROLL_LOCK_DOWN:
-            createdEntity = createScrollLockDown(entityManager, x, y);
-            break;
-        case ENTITY_SCROLL_UNLOCK:
-            createdEntity = createScrollUnlock(entityManager, x, y);
-            break;
-        case ENTITY_HIT_BLOCK:
-            createdEntity = createHitBlock(entityManager, x, y);
-            break;
-        case ENTITY_POWERUP:
-            createdEntity = createPowerUp(entityManager, x, y);
-            break;
-        case ENTITY_WARP:
-            createdEntity = createWarp(entityManager, x, y);
-            break;
-        case ENTITY_DUST_BUNNY:
-            createdEntity = createDustBunny(entityManager, x, y);
-            break;
-        case ENTITY_WASP:
-            createdEntity = createWasp(entityManager, x, y);
-            break;
-        case ENTITY_BUSH_2:
-            createdEntity = createEnemyBushL2(entityManager, x, y);
-            break;
-        case ENTITY_BUSH_3:
-            createdEntity = createEnemyBushL3(entityManager, x, y);
-            break;
-        case ENTITY_DUST_BUNNY_2:
-            createdEntity = createDustBunnyL2(entityManager, x, y);
-            break;
-        case ENTITY_DUST_BUNNY_3:
-            createdEntity = createDustBunnyL3(entityManager, x, y);
-            break;
-        case ENTITY_WASP_2:
-            createdEntity = createWaspL2(entityManager, x, y);
-            break;
-        case ENTITY_WASP_3:
-            createdEntity = createWaspL3(entityManager, x, y);
-            break;
-        case ENTITY_BGCOL_BLUE:
-            createdEntity = createBgColBlue(entityManager, x, y);
-            break;
-        case ENTITY_BGCOL_YELLOW:
-            createdEntity = createBgColYellow(entityManager, x, y);
-            break;
-        case ENTITY_BGCOL_ORANGE:
-            createdEntity = createBgColOrange(entityManager, x, y);
-            break;
-        case ENTITY_BGCOL_PURPLE:
-            createdEntity = createBgColPurple(entityManager, x, y);
-            break;
-        case ENTITY_BGCOL_DARK_PURPLE:
-            createdEntity = createBgColDarkPurple(entityManager, x, y);
-            break;
-        case ENTITY_BGCOL_BLACK:
-            createdEntity = createBgColBlack(entityManager, x, y);
-            break;
-        case ENTITY_BGCOL_NEUTRAL_GREEN:
-            createdEntity = createBgColNeutralGreen(entityManager, x, y);
-            break;
-        case ENTITY_BGCOL_DARK_RED:
-            createdEntity = createBgColNeutralDarkRed(entityManager, x, y);
-            break;
-        case ENTITY_BGCOL_DARK_GREEN:
-            createdEntity = createBgColNeutralDarkGreen(entityManager, x, y);
-            break;
-        case ENTITY_1UP:
-            createdEntity = create1up(entityManager, x, y);
-            break;
-        case ENTITY_WAVE_BALL:
-            createdEntity = createWaveBall(entityManager, x, y);
-            break;
-        case ENTITY_CHECKPOINT:
-            createdEntity = createCheckpoint(entityManager, x, y);
-            break;
-        case ENTITY_BGM_STOP:
-            createdEntity = createBgmStop(entityManager, x, y);
-            break;
-        case ENTITY_BGM_CHANGE_1:
-            createdEntity = createBgmChange1(entityManager, x, y);
-            break;
-        case ENTITY_BGM_CHANGE_2:
-            createdEntity = createBgmChange2(entityManager, x, y);
-            break;
-        case ENTITY_BGM_CHANGE_3:
-            createdEntity = createBgmChange3(entityManager, x, y);
-            break;
-        case ENTITY_BGM_CHANGE_4:
-            createdEntity = createBgmChange4(entityManager, x, y);
-            break;
-        case ENTITY_BGM_CHANGE_5:
-            createdEntity = createBgmChange5(entityManager, x, y);
-            break;
-
-        default:
-            createdEntity = NULL;
-    }
-
-    // if(createdEntity != NULL) {
-    //     entityManager->activeEntities++;
-    // }
-
-    return createdEntity;
-}
-
-plEntity_t* pl_createPlayer(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
+    if (objectIndex >= ARRAY_SIZE(plArchetypes) || NULL == plArchetypes[objectIndex].updateFunction)
     {
         return NULL;
     }
 
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed             = 0;
-    entity->yspeed             = 0;
-    entity->xMaxSpeed          = 40; // 72; Walking
-    entity->yMaxSpeed          = 64; // 72;
-    entity->xDamping           = 1;
-    entity->yDamping           = 4;
-    entity->gravityEnabled     = true;
-    entity->gravity            = 4;
-    entity->falling            = true;
-    entity->jumpPower          = 0;
-    entity->spriteFlipVertical = false;
-    entity->hp                 = 1;
-    entity->animationTimer     = 0; // Used as a cooldown for shooting square wave balls
-
-    entity->type                 = ENTITY_PLAYER;
-    entity->spriteIndex          = SP_PLAYER_IDLE;
-    entity->updateFunction       = &pl_updatePlayer;
-    entity->collisionHandler     = &pl_playerCollisionHandler;
-    entity->tileCollisionHandler = &pl_playerTileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &pl_playerOverlapTileHandler;
-    return entity;
-}
-
-plEntity_t* createTestObject(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
+    int32_t slot = entityPoolAlloc(&entityManager->pool);
+    if (slot < 0)
     {
         return NULL;
     }
 
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = (x < (entityManager->tilemap->mapOffsetX + 120)) ? 8 : -8;
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 132;
-    entity->gravityEnabled       = true;
-    entity->gravity              = 4;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->scoreValue           = 100;
-
-    entity->type                 = plEntity_tEST;
-    entity->spriteIndex          = SP_ENEMY_BASIC;
-    entity->updateFunction       = &updateTestObject;
-    entity->collisionHandler     = &pl_enemyCollisionHandler;
-    entity->tileCollisionHandler = &pl_enemyTileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createScrollLockLeft(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = false;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->type                 = ENTITY_SCROLL_LOCK_LEFT;
-    entity->updateFunction       = &updateScrollLockLeft;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createScrollLockRight(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = false;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->type                 = ENTITY_SCROLL_LOCK_RIGHT;
-    entity->updateFunction       = &updateScrollLockRight;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createScrollLockUp(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = false;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->type                 = ENTITY_SCROLL_LOCK_UP;
-    entity->updateFunction       = &updateScrollLockUp;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createScrollLockDown(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = false;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->type                 = ENTITY_SCROLL_LOCK_DOWN;
-    entity->updateFunction       = &updateScrollLockDown;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createScrollUnlock(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
+    const plArchetype_t* arch = &plArchetypes[objectIndex];
+    plEntity_t* entity        = &(entityManager->entities[slot]);
 
-    if (entity == NULL)
-    {
-        return NULL;
-    }
+    // Start from a clean slot so nothing leaks from whatever used it last
+    pl_initializeEntity(entity, entityManager, entity->tilemap, entity->gameData, entity->soundManager);
 
     entity->active  = true;
-    entity->visible = false;
+    entity->visible = arch->visible;
     entity->x       = x << SUBPIXEL_RESOLUTION;
     entity->y       = y << SUBPIXEL_RESOLUTION;
 
-    entity->type                 = ENTITY_SCROLL_UNLOCK;
-    entity->updateFunction       = &updateScrollUnlock;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
+    entity->xspeed              = 0;
+    entity->yspeed              = 0;
+    entity->xMaxSpeed           = arch->xMaxSpeed;
+    entity->yMaxSpeed           = arch->yMaxSpeed;
+    entity->xDamping            = arch->xDamping;
+    entity->yDamping            = arch->yDamping;
+    entity->gravityEnabled      = arch->gravityEnabled;
+    entity->gravity             = arch->gravity;
+    entity->falling             = arch->falling;
+    entity->jumpPower           = 0;
+    entity->spriteFlipVertical  = arch->spriteFlipVertical;
+    entity->hp                  = arch->hp;
+    entity->invincibilityFrames = 0;
+    entity->scoreValue          = arch->scoreValue;
+    entity->animationTimer      = 0;
 
-plEntity_t* createHitBlock(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
+    entity->type                 = objectIndex;
+    entity->spriteIndex          = arch->spriteIndex;
+    entity->updateFunction       = arch->updateFunction;
+    entity->collisionHandler     = arch->collisionHandler;
+    entity->tileCollisionHandler = arch->tileCollisionHandler;
+    entity->fallOffTileHandler   = arch->fallOffTileHandler ? arch->fallOffTileHandler : &defaultFallOffTileHandler;
+    entity->overlapTileHandler   = arch->overlapTileHandler;
 
-    if (entity == NULL)
+    // Apply the per-instance parts of the archetype
+    bool leftHalf = x < (entityManager->tilemap->mapOffsetX + PL_HALF_SCREEN_WIDTH);
+    if (arch->spawnFlags & PL_SPAWN_WALK_TO_CENTER)
     {
-        return NULL;
+        entity->xspeed = leftHalf ? arch->walkSpeed : -arch->walkSpeed;
     }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed         = 0;
-    entity->yspeed         = 0;
-    entity->yDamping       = 0;
-    entity->xMaxSpeed      = 132;
-    entity->yMaxSpeed      = 132;
-    entity->gravityEnabled = true;
-    entity->gravity        = 4;
-
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-
-    entity->type                 = ENTITY_HIT_BLOCK;
-    entity->spriteIndex          = SP_HITBLOCK_CONTAINER;
-    entity->animationTimer       = 0;
-    entity->updateFunction       = &updateHitBlock;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createPowerUp(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
+    if (arch->spawnFlags & PL_SPAWN_WALK_FROM_PLAYER)
     {
-        return NULL;
+        entity->xspeed = (entityManager->playerEntity->x > entity->x) ? -arch->walkSpeed : arch->walkSpeed;
     }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = (entityManager->playerEntity->x > entity->x) ? -16 : 16;
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 132;
-    entity->gravityEnabled       = true;
-    entity->gravity              = 4;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-
-    entity->type                 = ENTITY_POWERUP;
-    entity->spriteIndex          = (entityManager->playerEntity->hp < 2) ? SP_GAMING_1 : SP_MUSIC_1;
-    entity->animationTimer       = 0;
-    entity->updateFunction       = &updatePowerUp;
-    entity->collisionHandler     = &powerUpCollisionHandler;
-    entity->tileCollisionHandler = &pl_enemyTileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createWarp(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
+    if (arch->spawnFlags & PL_SPAWN_FLIP_LEFT_HALF)
     {
-        return NULL;
+        entity->spriteFlipHorizontal = leftHalf;
     }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed         = 0;
-    entity->yspeed         = 0;
-    entity->xMaxSpeed      = 132;
-    entity->yMaxSpeed      = 132;
-    entity->gravityEnabled = true;
-    entity->gravity        = 4;
-
-    entity->spriteFlipVertical = false;
-
-    entity->type                 = ENTITY_WARP;
-    entity->spriteIndex          = SP_WARP_1;
-    entity->animationTimer       = 0;
-    entity->updateFunction       = &updateWarp;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createDustBunny(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
+    if (arch->spawnFlags & PL_SPAWN_FLIP_RIGHT_HALF)
     {
-        return NULL;
+        entity->spriteFlipHorizontal = !leftHalf;
     }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 132;
-    entity->xDamping             = 0; // This will be repurposed to track state
-    entity->yDamping             = 0; // This will be repurposed as a state timer
-    entity->gravityEnabled       = true;
-    entity->gravity              = 4;
-    entity->spriteFlipHorizontal = (x < (entityManager->tilemap->mapOffsetX + 120)) ? true : false;
-    entity->spriteFlipVertical   = false;
-
-    entity->scoreValue = 150;
-
-    entity->type                 = ENTITY_DUST_BUNNY;
-    entity->spriteIndex          = SP_DUSTBUNNY_IDLE;
-    entity->updateFunction       = &updateDustBunny;
-    entity->collisionHandler     = &pl_enemyCollisionHandler;
-    entity->tileCollisionHandler = &dustBunnyTileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createWasp(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
+    if (arch->spawnFlags & PL_SPAWN_RANDOM_JUMP)
     {
-        return NULL;
+        entity->jumpPower = (1 + esp_random() % 4) * 256;
     }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 128;
-    entity->xDamping             = 0; // This will be repurposed to track state
-    entity->yDamping             = 0; // This will be repurposed as a state timer
-    entity->gravityEnabled       = false;
-    entity->gravity              = 8;
-    entity->spriteFlipHorizontal = (x < (entityManager->tilemap->mapOffsetX + 120)) ? false : true;
-    entity->spriteFlipVertical   = false;
-    entity->scoreValue           = 200;
-
-    entity->xspeed = (entity->spriteFlipHorizontal) ? -16 : 16;
-
-    entity->type                 = ENTITY_WASP;
-    entity->spriteIndex          = SP_WASP_1;
-    entity->updateFunction       = &updateWasp;
-    entity->collisionHandler     = &pl_enemyCollisionHandler;
-    entity->tileCollisionHandler = &waspTileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createEnemyBushL2(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
+    if (arch->spawnFlags & PL_SPAWN_POWERUP_SPRITE)
     {
-        return NULL;
+        entity->spriteIndex = (entityManager->playerEntity->hp < 2) ? SP_GAMING_1 : SP_MUSIC_1;
     }
 
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = (x < (entityManager->tilemap->mapOffsetX + 120)) ? 12 : -12;
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 132;
-    entity->gravityEnabled       = true;
-    entity->gravity              = 4;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->scoreValue           = 150;
-
-    entity->type                 = ENTITY_BUSH_2;
-    entity->spriteIndex          = SP_ENEMY_BUSH_L2;
-    entity->updateFunction       = &updateTestObject;
-    entity->collisionHandler     = &pl_enemyCollisionHandler;
-    entity->tileCollisionHandler = &pl_enemyTileCollisionHandler;
-    entity->fallOffTileHandler   = &turnAroundAtEdgeOfTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
+    // Make it collidable right away rather than on the next tick
+    pl_broadphaseInsert(entityManager, slot);
 
     return entity;
 }
 
-plEntity_t* createEnemyBushL3(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
+/**
+ * @brief Put an entity's position in the collision broadphase
+ *
+ * @param entityManager The entity manager
+ * @param slot The entity's slot
+ */
+static void pl_broadphaseInsert(plEntityManager_t* entityManager, int32_t slot)
 {
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = (x < (entityManager->tilemap->mapOffsetX + 120)) ? 11 : -11;
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 132;
-    entity->gravityEnabled       = true;
-    entity->gravity              = 4;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->scoreValue           = 250;
-
-    entity->yDamping = 20; // This will be repurposed as a state timer
-
-    entity->type                 = ENTITY_BUSH_3;
-    entity->spriteIndex          = SP_ENEMY_BUSH_L3;
-    entity->updateFunction       = &updateEnemyBushL3;
-    entity->collisionHandler     = &pl_enemyCollisionHandler;
-    entity->tileCollisionHandler = &pl_enemyTileCollisionHandler;
-    entity->fallOffTileHandler   = &turnAroundAtEdgeOfTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
+    plEntity_t* entity = &(entityManager->entities[slot]);
+    spatialHashInsert(&entityManager->broadphase, slot, entity->x, entity->y, entity->x, entity->y);
+    pl_broadphaseTrackSpeed(entityManager, entity);
 }
 
-plEntity_t* createDustBunnyL2(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
+/**
+ * @brief Grow the broadphase query margin to cover how far an entity can move in one tick
+ *
+ * @param entityManager The entity manager
+ * @param entity The entity
+ */
+static void pl_broadphaseTrackSpeed(plEntityManager_t* entityManager, const plEntity_t* entity)
 {
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
+    int32_t margin = MAX(MAX(abs(entity->xspeed), entity->xMaxSpeed), MAX(abs(entity->yspeed), entity->yMaxSpeed));
+    if (margin > entityManager->broadphaseMargin)
     {
-        return NULL;
+        entityManager->broadphaseMargin = margin;
     }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 132;
-    entity->xDamping             = 0; // This will be repurposed to track state
-    entity->yDamping             = 0; // This will be repurposed as a state timer
-    entity->gravityEnabled       = true;
-    entity->gravity              = 4;
-    entity->spriteFlipHorizontal = (x < (entityManager->tilemap->mapOffsetX + 120)) ? false : true;
-    entity->spriteFlipVertical   = false;
-    entity->scoreValue           = 200;
-
-    entity->type                 = ENTITY_DUST_BUNNY_2;
-    entity->spriteIndex          = SP_DUSTBUNNY_L2_IDLE;
-    entity->updateFunction       = &updateDustBunnyL2;
-    entity->collisionHandler     = &pl_enemyCollisionHandler;
-    entity->tileCollisionHandler = &dustBunnyL2TileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
 }
 
-plEntity_t* createDustBunnyL3(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 132;
-    entity->xDamping             = 0; // This will be repurposed to track state
-    entity->yDamping             = 0; // This will be repurposed as a state timer
-    entity->gravityEnabled       = true;
-    entity->gravity              = 4;
-    entity->spriteFlipHorizontal = (x < (entityManager->tilemap->mapOffsetX + 120)) ? true : false;
-    entity->spriteFlipVertical   = false;
-    entity->scoreValue           = 300;
-
-    entity->type                 = ENTITY_DUST_BUNNY_3;
-    entity->spriteIndex          = SP_DUSTBUNNY_L3_IDLE;
-    entity->updateFunction       = &updateDustBunnyL3;
-    entity->collisionHandler     = &pl_enemyCollisionHandler;
-    entity->tileCollisionHandler = &dustBunnyL3TileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createWaspL2(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 192;
-    entity->xDamping             = 0; // This will be repurposed to track state
-    entity->yDamping             = 0; // This will be repurposed as a state timer
-    entity->jumpPower            = (1 + esp_random() % 4) * 256;
-    entity->gravityEnabled       = false;
-    entity->gravity              = 8;
-    entity->spriteFlipHorizontal = (x < (entityManager->tilemap->mapOffsetX + 120)) ? false : true;
-    entity->spriteFlipVertical   = false;
-    entity->falling              = false;
-    entity->scoreValue           = 300;
-
-    entity->xspeed = (entity->spriteFlipHorizontal) ? -24 : 24;
-
-    entity->type                 = ENTITY_WASP_2;
-    entity->spriteIndex          = SP_WASP_L2_1;
-    entity->updateFunction       = &updateWaspL2;
-    entity->collisionHandler     = &pl_enemyCollisionHandler;
-    entity->tileCollisionHandler = &waspTileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createWaspL3(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 256;
-    entity->xDamping             = 0; // This will be repurposed to track state
-    entity->yDamping             = 0; // This will be repurposed as a state timer
-    entity->jumpPower            = (1 + esp_random() % 4) * 256;
-    entity->gravityEnabled       = false;
-    entity->gravity              = 8;
-    entity->spriteFlipHorizontal = (x < (entityManager->tilemap->mapOffsetX + 120)) ? false : true;
-    entity->spriteFlipVertical   = false;
-    entity->scoreValue           = 400;
-
-    entity->xspeed = (entity->spriteFlipHorizontal) ? -24 : 24;
-
-    entity->type                 = ENTITY_WASP_3;
-    entity->spriteIndex          = SP_WASP_L3_1;
-    entity->updateFunction       = &updateWaspL3;
-    entity->collisionHandler     = &pl_enemyCollisionHandler;
-    entity->tileCollisionHandler = &waspTileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgColBlue(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = c335;
-
-    entity->type                 = ENTITY_BGCOL_BLUE;
-    entity->updateFunction       = &updateBgCol;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgColYellow(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = c542;
-
-    entity->type                 = ENTITY_BGCOL_YELLOW;
-    entity->updateFunction       = &updateBgCol;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgColOrange(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = c532;
-
-    entity->type                 = ENTITY_BGCOL_ORANGE;
-    entity->updateFunction       = &updateBgCol;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgColPurple(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = c214;
-
-    entity->type                 = ENTITY_BGCOL_PURPLE;
-    entity->updateFunction       = &updateBgCol;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgColDarkPurple(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = c103;
-
-    entity->type                 = ENTITY_BGCOL_DARK_PURPLE;
-    entity->updateFunction       = &updateBgCol;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgColBlack(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = c000;
-
-    entity->type                 = ENTITY_BGCOL_BLACK;
-    entity->updateFunction       = &updateBgCol;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgColNeutralGreen(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = c133;
-
-    entity->type                 = ENTITY_BGCOL_NEUTRAL_GREEN;
-    entity->updateFunction       = &updateBgCol;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgColNeutralDarkRed(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = c200;
-
-    entity->type                 = ENTITY_BGCOL_DARK_RED;
-    entity->updateFunction       = &updateBgCol;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgColNeutralDarkGreen(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = c010;
-
-    entity->type                 = ENTITY_BGCOL_DARK_GREEN;
-    entity->updateFunction       = &updateBgCol;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* create1up(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = (entityManager->playerEntity->x > entity->x) ? -16 : 16;
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 132;
-    entity->gravityEnabled       = true;
-    entity->gravity              = 4;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-
-    entity->type                 = ENTITY_1UP;
-    entity->spriteIndex          = SP_1UP_1;
-    entity->animationTimer       = 0;
-    entity->updateFunction       = &update1up;
-    entity->collisionHandler     = &powerUpCollisionHandler;
-    entity->tileCollisionHandler = &pl_enemyTileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createWaveBall(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 132;
-    entity->gravityEnabled       = false;
-    entity->gravity              = 4;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-    entity->yDamping             = 3; // This will be repurposed as a state timer
-    entity->xDamping             = 0; // This will be repurposed as a state tracker
-
-    entity->type                 = ENTITY_WAVE_BALL;
-    entity->spriteIndex          = SP_WAVEBALL_1;
-    entity->animationTimer       = 0;
-    entity->updateFunction       = &updateWaveBall;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->fallOffTileHandler   = &defaultFallOffTileHandler;
-    entity->overlapTileHandler   = &waveBallOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createCheckpoint(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
+plEntity_t* pl_createPlayer(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
 {
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active  = true;
-    entity->visible = true;
-    entity->x       = x << SUBPIXEL_RESOLUTION;
-    entity->y       = y << SUBPIXEL_RESOLUTION;
-
-    entity->xspeed               = 0;
-    entity->yspeed               = 0;
-    entity->xMaxSpeed            = 132;
-    entity->yMaxSpeed            = 132;
-    entity->gravityEnabled       = true;
-    entity->gravity              = 4;
-    entity->spriteFlipHorizontal = false;
-    entity->spriteFlipVertical   = false;
-
-    entity->xDamping = 0; // State of the checkpoint. 0 = inactive, 1 = active
-
-    entity->type                 = ENTITY_CHECKPOINT;
-    entity->spriteIndex          = SP_CHECKPOINT_INACTIVE;
-    entity->animationTimer       = 0;
-    entity->updateFunction       = &updateCheckpoint;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
+    return pl_createEntity(entityManager, ENTITY_PLAYER, x, y);
 }
 
 void pl_freeEntityManager(plEntityManager_t* self)
 {
     free(self->entities);
+    entityPoolDeinit(&self->pool);
+    spatialHashDeinit(&self->broadphase);
     for (uint8_t i = 0; i < SPRITESET_SIZE; i++)
     {
         freeWsg(&self->sprites[i]);
     }
 }
-
-plEntity_t* createBgmChange1(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = PL_BGM_MAIN;
-
-    entity->type                 = ENTITY_BGM_CHANGE_1;
-    entity->updateFunction       = &updateBgmChange;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgmChange2(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = PL_BGM_ATHLETIC;
-
-    entity->type                 = ENTITY_BGM_CHANGE_2;
-    entity->updateFunction       = &updateBgmChange;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgmChange3(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = PL_BGM_UNDERGROUND;
-
-    entity->type                 = ENTITY_BGM_CHANGE_3;
-    entity->updateFunction       = &updateBgmChange;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgmChange4(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = PL_BGM_FORTRESS;
-
-    entity->type                 = ENTITY_BGM_CHANGE_4;
-    entity->updateFunction       = &updateBgmChange;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgmChange5(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = PL_BGM_NULL;
-
-    entity->type                 = ENTITY_BGM_CHANGE_5;
-    entity->updateFunction       = &updateBgmChange;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
-
-plEntity_t* createBgmStop(plEntityManager_t* entityManager, uint16_t x, uint16_t y)
-{
-    plEntity_t* entity = pl_findInactiveEntity(entityManager);
-
-    if (entity == NULL)
-    {
-        return NULL;
-    }
-
-    entity->active   = true;
-    entity->visible  = false;
-    entity->x        = x << SUBPIXEL_RESOLUTION;
-    entity->y        = y << SUBPIXEL_RESOLUTION;
-    entity->xDamping = PL_BGM_NULL;
-
-    entity->type                 = ENTITY_BGM_STOP;
-    entity->updateFunction       = &updateBgmChange;
-    entity->collisionHandler     = &pl_dummyCollisionHandler;
-    entity->tileCollisionHandler = &pl_dummyTileCollisionHandler;
-    entity->overlapTileHandler   = &pl_defaultOverlapTileHandler;
-
-    return entity;
-}
\ No newline at end of file
@@ -19,6 +19,8 @@
 //==============================================================================
 
 // bool isInteractive(uint8_t tileId);
+static const wsg_t* pl_lookupTile(void* ctx, int32_t tx, int32_t ty, uint8_t* tag);
+static void pl_spawnVisibleTiles(plTilemap_t* tilemap);
 
 //==============================================================================
 // Functions
@@ -37,65 +39,105 @@ void pl_initializeTileMap(plTilemap_t* tilemap)
     tilemap->animationTimer = 23;
 
     pl_loadTiles(tilemap);
+
+    tileLayerInit(&tilemap->layer, PL_TILEMAP_DISPLAY_WIDTH_PIXELS, PL_TILEMAP_DISPLAY_HEIGHT_PIXELS,
+                  PL_TILESIZE_IN_POWERS_OF_2, pl_lookupTile, tilemap);
 }
 
-void pl_drawTileMap(plTilemap_t* tilemap)
+/**
+ * @brief Draw the visible part of the map over a solid background, and spawn entities from tiles which scrolled into
+ * view. This covers the whole display, so the display doesn't need to be cleared first
+ *
+ * @param tilemap The tilemap to draw
+ * @param bgColor The background color
+ */
+void pl_drawTileMap(plTilemap_t* tilemap, paletteColor_t bgColor)
 {
     tilemap->animationTimer--;
     if (tilemap->animationTimer < 0)
     {
         tilemap->animationFrame = ((tilemap->animationFrame + 1) % 3);
         tilemap->animationTimer = 23;
+        tileLayerRefresh(&tilemap->layer);
     }
 
-    for (uint16_t y = (tilemap->mapOffsetY >> PL_TILESIZE_IN_POWERS_OF_2);
-         y < (tilemap->mapOffsetY >> PL_TILESIZE_IN_POWERS_OF_2) + PL_TILEMAP_DISPLAY_HEIGHT_TILES; y++)
+    tileLayerSetBackground(&tilemap->layer, bgColor);
+    tileLayerDraw(&tilemap->layer, tilemap->mapOffsetX, tilemap->mapOffsetY);
+
+    pl_spawnVisibleTiles(tilemap);
+}
+
+/**
+ * @brief Look up how a tile looks, for the tile layer
+ *
+ * @param ctx The tilemap
+ * @param tx The tile's X coordinate
+ * @param ty The tile's Y coordinate
+ * @param tag Written with the tile ID, including animation frame, or 0 for tiles which aren't drawn
+ * @return The tile's image, or NULL if it isn't drawn
+ */
+static const wsg_t* pl_lookupTile(void* ctx, int32_t tx, int32_t ty, uint8_t* tag)
+{
+    plTilemap_t* tilemap = (plTilemap_t*)ctx;
+    *tag                 = 0;
+
+    if (tx < 0 || ty < 0 || tx >= tilemap->mapWidth || ty >= tilemap->mapHeight)
     {
-        if (y >= tilemap->mapHeight)
-        {
-            break;
-        }
+        return NULL;
+    }
 
-        for (uint16_t x = (tilemap->mapOffsetX >> PL_TILESIZE_IN_POWERS_OF_2);
-             x < (tilemap->mapOffsetX >> PL_TILESIZE_IN_POWERS_OF_2) + PL_TILEMAP_DISPLAY_WIDTH_TILES; x++)
-        {
-            if (x >= tilemap->mapWidth)
-            {
-                break;
-            }
+    uint8_t tile = tilemap->map[(ty * tilemap->mapWidth) + tx];
 
-            uint8_t tile = tilemap->map[(y * tilemap->mapWidth) + x];
+    // Test animated tiles
+    if (tile == 64 || tile == 67)
+    {
+        tile += tilemap->animationFrame;
+    }
 
-            if (tile < PL_TILEGRASS)
-            {
-                continue;
-            }
+    // Draw only non-garbage tiles
+    if (tile < PL_TILEGRASS || tile >= 104)
+    {
+        return NULL;
+    }
 
-            // Test animated tiles
-            if (tile == 64 || tile == 67)
-            {
-                tile += tilemap->animationFrame;
-            }
+    *tag = tile;
+    return &tilemap->tiles[tile - 32];
+}
 
-            // Draw only non-garbage tiles
-            if (tile > 31 && tile < 104)
-            {
-                if (pl_needsTransparency(tile))
-                {
-                    // drawWsgSimpleFast(&tilemap->tiles[tile - 32], x * PL_TILESIZE - tilemap->mapOffsetX, y *
-                    // PL_TILESIZE - tilemap->mapOffsetY);
-                    drawWsgSimple(&tilemap->tiles[tile - 32], x * PL_TILESIZE - tilemap->mapOffsetX,
-                                  y * PL_TILESIZE - tilemap->mapOffsetY);
-                }
-                else
-                {
-                    drawWsgTile(&tilemap->tiles[tile - 32], x * PL_TILESIZE - tilemap->mapOffsetX,
-                                y * PL_TILESIZE - tilemap->mapOffsetY);
-                }
-            }
-            else if (tile > 127 && tilemap->tileSpawnEnabled
-                     && (tilemap->executeTileSpawnColumn == x || tilemap->executeTileSpawnRow == y
-                         || tilemap->executeTileSpawnAll))
+/**
+ * @brief Spawn entities from spawn tiles in the row or column which just scrolled into view, or from all visible tiles
+ * if requested
+ *
+ * @param tilemap The tilemap to spawn from
+ */
+static void pl_spawnVisibleTiles(plTilemap_t* tilemap)
+{
+    if (!tilemap->tileSpawnEnabled)
+    {
+        tilemap->executeTileSpawnAll = 0;
+        return;
+    }
+
+    uint16_t tx0 = tilemap->mapOffsetX >> PL_TILESIZE_IN_POWERS_OF_2;
+    uint16_t ty0 = tilemap->mapOffsetY >> PL_TILESIZE_IN_POWERS_OF_2;
+    uint16_t tx1 = MIN(tx0 + PL_TILEMAP_DISPLAY_WIDTH_TILES, tilemap->mapWidth);
+    uint16_t ty1 = MIN(ty0 + PL_TILEMAP_DISPLAY_HEIGHT_TILES, tilemap->mapHeight);
+
+    for (uint16_t y = ty0; y < ty1; y++)
+    {
+        // Check the whole row if it is being spawned, otherwise only where it crosses the spawn column
+        bool wholeRow = tilemap->executeTileSpawnAll || tilemap->executeTileSpawnRow == y;
+        uint16_t xs   = wholeRow ? tx0 : tilemap->executeTileSpawnColumn;
+        uint16_t xe   = wholeRow ? tx1 : tilemap->executeTileSpawnColumn + 1;
+        if (!wholeRow && (tilemap->executeTileSpawnColumn < tx0 || tilemap->executeTileSpawnColumn >= tx1))
+        {
+            continue;
+        }
+
+        for (uint16_t x = xs; x < xe; x++)
+        {
+            uint8_t tile = tilemap->map[(y * tilemap->mapWidth) + x];
+            if (tile > 127)
             {
                 pl_tileSpawnEntity(tilemap, tile - 128, x, y);
             }
@@ -172,6 +214,7 @@ bool pl_loadMapFromFile(plTilemap_t* tilemap, const char* name)
 
     tilemap->mapWidth  = width;
     tilemap->mapHeight = height;
+    tileLayerInvalidate(&tilemap->layer);
 
     tilemap->minMapOffsetX = 0;
     tilemap->maxMapOffsetX = width * PL_TILESIZE - PL_TILEMAP_DISPLAY_WIDTH_PIXELS;
@@ -316,6 +359,7 @@ void pl_setTile(plTilemap_t* tilemap, uint8_t tx, uint8_t ty, uint8_t newTileId)
     }
 
     tilemap->map[ty * tilemap->mapWidth + tx] = newTileId;
+    tileLayerUpdateTile(&tilemap->layer, tx, ty);
 }
 
 bool pl_isSolid(uint8_t tileId)
@@ -382,6 +426,7 @@ bool pl_needsTransparency(uint8_t tileId)
 void pl_freeTilemap(plTilemap_t* tilemap)
 {
     free(tilemap->map);
+    tileLayerDeinit(&tilemap->layer);
     for (uint8_t i = 0; i < PL_TILESET_SIZE; i++)
     {
         switch (i)
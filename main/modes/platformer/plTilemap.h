@@ -8,6 +8,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "wsg.h"
+#include "tileLayer.h"
 #include "macros.h"
 #include "platformer_typedef.h"
 #include "plEntityManager.h"
@@ -171,13 +172,16 @@ struct plTilemap_t
 
     uint8_t animationFrame;
     int16_t animationTimer;
+
+    /// The pre-rendered visible part of the map
+    tileLayer_t layer;
 };
 
 //==============================================================================
 // Prototypes
 //==============================================================================
 void pl_initializeTileMap(plTilemap_t* tilemap);
-void pl_drawTileMap(plTilemap_t* tilemap);
+void pl_drawTileMap(plTilemap_t* tilemap, paletteColor_t bgColor);
 void pl_scrollTileMap(plTilemap_t* tilemap, int16_t x, int16_t y);
 void pl_drawTile(plTilemap_t* tilemap, uint8_t tileId, int16_t x, int16_t y);
 bool pl_loadMapFromFile(plTilemap_t* tilemap, const char* name);
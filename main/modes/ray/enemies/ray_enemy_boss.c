@@ -98,8 +98,8 @@ void rayEnemyBossMove(ray_t* ray, rayEnemy_t* enemy, uint32_t elapsedUs)
     q24_8 marginY = (delY > 0 ? 1 : -1) * TO_FX_FRAC(1, 2);
 
     // Move if in bounds
-    if (isPassableCell(
-            &ray->map.tiles[FROM_FX(enemy->c.posX + delX + marginX)][FROM_FX(enemy->c.posY + delY + marginY)]))
+    if (isPassableCell(RAY_MAP_CELL(&ray->map, FROM_FX(enemy->c.posX + delX + marginX),
+                                    FROM_FX(enemy->c.posY + delY + marginY))))
     {
         enemy->c.posX += delX;
         enemy->c.posY += delY;
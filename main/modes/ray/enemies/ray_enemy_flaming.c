@@ -58,14 +58,15 @@ void rayEnemyFlamingMove(ray_t* ray, rayEnemy_t* enemy, uint32_t elapsedUs)
     q24_8 marginY = (delY > 0 ? 1 : -1) * TO_FX_FRAC(1, 2);
 
     // If the cell can be moved into
-    if (isPassableCell(
-            &ray->map.tiles[FROM_FX(enemy->c.posX + delX + marginX)][FROM_FX(enemy->c.posY + delY + marginY)]))
+    if (isPassableCell(RAY_MAP_CELL(&ray->map, FROM_FX(enemy->c.posX + delX + marginX),
+                                    FROM_FX(enemy->c.posY + delY + marginY))))
     {
         // Move into it
         enemy->c.posX += delX;
         enemy->c.posY += delY;
     }
-    else if (!isPassableCell(&ray->map.tiles[FROM_FX(enemy->c.posX + delX + marginX)][FROM_FX(enemy->c.posY)]))
+    else if (!isPassableCell(
+                 RAY_MAP_CELL(&ray->map, FROM_FX(enemy->c.posX + delX + marginX), FROM_FX(enemy->c.posY))))
     {
         // Collision on X axis, invert that
         switch (enemy->behavior)
@@ -70,6 +70,20 @@
  */
 #define CELL_IS_TYPE(cell, type) (((cell) & (0xE0)) == (type))
 
+/**
+ * @brief Helper macro to get a pointer to a map cell. Cells are stored row-major
+ *
+ * @param map The ::rayMap_t to get a cell from
+ * @param x The X coordinate of the cell
+ * @param y The Y coordinate of the cell
+ */
+#define RAY_MAP_CELL(map, x, y) (&(map)->tiles[((y) * (map)->w) + (x)])
+
+// Flags for each map cell, derived from the cell's type when the map is loaded
+#define RAY_CELL_WALL   0x01 ///< The cell is a wall
+#define RAY_CELL_DOOR   0x02 ///< The cell is a door
+#define RAY_CELL_EFFECT 0x04 ///< The cell is a floor with an effect, like lava, water, or healing
+
 // Bits used for tile type construction, topmost bit
 #define BG  0x00
 #define OBJ 0x80
@@ -379,6 +393,7 @@ typedef struct
 typedef struct
 {
     bool isActive;         ///< true if the script is active, false if it is not
+    uint16_t loadIdx;      ///< The order this script was loaded in, which is the order scripts are checked in
     int32_t resetTimerSec; ///< Timer to not re-trigger the script immediately
     ifOp_t ifOp;           ///< The type of condition that triggers the script
     /// A union of arguments for the condition that triggers the script
@@ -453,6 +468,8 @@ typedef struct
     q8_8 doorOpen;           ///< A timer for this cell, if it happens to be a door
     rayMapCellType_t type;   ///< The type of this cell
     int8_t openingDirection; ///< If the door is opening or closing
+    uint8_t flags;           ///< RAY_CELL_* flags for this cell
+    uint16_t scriptIdx;      ///< Where this cell's scripts start in ray_t.scriptIndex, or 0 if it has none
 } rayMapCell_t;
 
 /**
@@ -462,7 +479,7 @@ typedef struct
 {
     uint32_t w;                   ///< The width of the map
     uint32_t h;                   ///< The height of the map
-    rayMapCell_t** tiles;         ///< A 2D array of tiles in the map
+    rayMapCell_t* tiles;          ///< A 1D array of all the tiles in the map, row-order
     rayTileState_t* visitedTiles; ///< A 1D array of all the visited tiles in the map, row-order
 } rayMap_t;
 
@@ -647,9 +664,12 @@ typedef struct
     int32_t blinkTimer;   ///< A timer to blink things on the pause menu
     bool blink;           ///< Boolean for two draw states on the pause menu
 
-    list_t scripts[NUM_IF_OP_TYPES]; ///< An array of lists of scripts
-    uint32_t scriptTimer;            ///< A microsecond timer to check for time based scripts
-    uint32_t secondsSinceStart;      ///< The number of seconds since this map was loaded
+    list_t scripts[NUM_IF_OP_TYPES];        ///< An array of lists of scripts
+    rayScript_t** scriptIndex;              ///< NULL-terminated runs of scripts to check for each cell, ID, and trigger
+    uint16_t idScriptIdx[256];              ///< Where each ID's scripts start in scriptIndex, or 0 if it has none
+    uint16_t anyScriptIdx[NUM_IF_OP_TYPES]; ///< Where scripts checked for every event of a trigger start
+    uint32_t scriptTimer;                   ///< A microsecond timer to check for time based scripts
+    uint32_t secondsSinceStart;             ///< The number of seconds since this map was loaded
 
     starfield_t starfield; ///< Starfield used for warp animation
 
@@ -17,6 +17,12 @@
 #include "ray_script.h"
 #include "ray_enemy.h"
 
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static uint8_t rayCellFlags(rayMapCellType_t type);
+
 //==============================================================================
 // Functions
 //==============================================================================
@@ -56,12 +62,8 @@ void loadRayMap(int32_t mapId, ray_t* ray, q24_8* pStartX, q24_8* pStartY, bool
     map->w = fileData[fileIdx++];
     map->h = fileData[fileIdx++];
 
-    // Allocate the tiles, 2D array
-    map->tiles = (rayMapCell_t**)heap_caps_calloc(map->w, sizeof(rayMapCell_t*), caps);
-    for (uint32_t x = 0; x < map->w; x++)
-    {
-        map->tiles[x] = (rayMapCell_t*)heap_caps_calloc(map->h, sizeof(rayMapCell_t), caps);
-    }
+    // Allocate the tiles, one contiguous row-order array
+    map->tiles = (rayMapCell_t*)heap_caps_calloc(map->w * map->h, sizeof(rayMapCell_t), caps);
 
     // Allocate space to track what tiles have been visited
     map->visitedTiles = (rayTileState_t*)heap_caps_calloc(map->w * map->h, sizeof(rayTileState_t), caps);
@@ -76,10 +78,12 @@ void loadRayMap(int32_t mapId, ray_t* ray, q24_8* pStartX, q24_8* pStartY, bool
         for (uint32_t x = 0; x < map->w; x++)
         {
             // Each tile has a type and object
-            map->tiles[x][y].type     = fileData[fileIdx++];
-            map->tiles[x][y].doorOpen = 0;
-            rayMapCellType_t oType    = fileData[fileIdx++];
-            rayMapCellType_t cType    = map->tiles[x][y].type;
+            rayMapCell_t* cell     = RAY_MAP_CELL(map, x, y);
+            cell->type             = fileData[fileIdx++];
+            cell->flags            = rayCellFlags(cell->type);
+            cell->doorOpen         = 0;
+            rayMapCellType_t oType = fileData[fileIdx++];
+            rayMapCellType_t cType = cell->type;
 
             // Open doors which were already unlocked
             if ((cType == BG_DOOR_KEY_A && OPEN_KEY == ray->p.i.keys[mapId][0]) || //
@@ -88,7 +92,7 @@ void loadRayMap(int32_t mapId, ray_t* ray, q24_8* pStartX, q24_8* pStartY, bool
                 (SCRIPT_DOOR_OPEN == map->visitedTiles[(y * ray->map.w) + x]))
             {
                 // If the key was already used, open the door
-                map->tiles[x][y].doorOpen = TO_FX(1);
+                cell->doorOpen = TO_FX(1);
             }
 
             // If the oType isn't empty
@@ -241,6 +245,30 @@ void loadRayMap(int32_t mapId, ray_t* ray, q24_8* pStartX, q24_8* pStartY, bool
     bzrPlayBgm(&ray->songs[ray->p.mapId], BZR_STEREO);
 }
 
+/**
+ * @brief Get the RAY_CELL_* flags for a type of cell. Cell types don't change after the map is loaded, so neither do
+ * the flags
+ *
+ * @param type The type of the cell
+ * @return The cell's flags
+ */
+static uint8_t rayCellFlags(rayMapCellType_t type)
+{
+    if (CELL_IS_TYPE(type, BG | WALL))
+    {
+        return RAY_CELL_WALL;
+    }
+    else if (CELL_IS_TYPE(type, BG | DOOR))
+    {
+        return RAY_CELL_DOOR;
+    }
+    else if ((BG_FLOOR_LAVA == type) || (BG_FLOOR_WATER == type) || (BG_FLOOR_HEAL == type))
+    {
+        return RAY_CELL_EFFECT;
+    }
+    return 0;
+}
+
 /**
  * @brief Create an enemy
  *
@@ -336,12 +364,7 @@ void rayCreateCommonObj(ray_t* ray, rayMapCellType_t type, int32_t id, q24_8 x,
  */
 void freeRayMap(rayMap_t* map)
 {
-    // Free each column
-    for (uint32_t x = 0; x < map->w; x++)
-    {
-        free(map->tiles[x]);
-    }
-    // Free the pointers
+    // Free the tiles
     free(map->tiles);
     // Free visited tiles too
     free(map->visitedTiles);
@@ -355,12 +378,12 @@ void freeRayMap(rayMap_t* map)
  */
 bool isPassableCell(rayMapCell_t* cell)
 {
-    if (CELL_IS_TYPE(cell->type, BG | WALL))
+    if (cell->flags & RAY_CELL_WALL)
     {
         // Never pass through walls
         return false;
     }
-    else if (CELL_IS_TYPE(cell->type, BG | DOOR))
+    else if (cell->flags & RAY_CELL_DOOR)
     {
         // Only pass through at least half open doors
         return (TO_FX_FRAC(1, 2) < cell->doorOpen);
@@ -105,7 +105,7 @@ static void moveRayBullets(ray_t* ray, uint32_t elapsedUs)
             obj->c.posY += (obj->velY * (int32_t)elapsedUs) / 100000;
 
             // Get the cell the bullet is in now
-            rayMapCell_t* cell = &ray->map.tiles[FROM_FX(obj->c.posX)][FROM_FX(obj->c.posY)];
+            rayMapCell_t* cell = RAY_MAP_CELL(&ray->map, FROM_FX(obj->c.posX), FROM_FX(obj->c.posY));
 
             // If the bullet hit something
             if (!isPassableCell(cell))
@@ -237,7 +237,7 @@ static void rayPauseRenderLocalMap(ray_t* ray, uint32_t elapsedUs)
             if (ray->map.visitedTiles[(y * ray->map.w) + x] > NOT_VISITED)
             {
                 // Get the cell type and pick a color depending on the type
-                rayMapCellType_t type = ray->map.tiles[x][y].type;
+                rayMapCellType_t type = RAY_MAP_CELL(&ray->map, x, y)->type;
                 paletteColor_t color  = c000;
                 if (CELL_IS_TYPE(type, BG | WALL))
                 {
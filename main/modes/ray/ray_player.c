@@ -320,7 +320,8 @@ void rayPlayerCheckButtons(ray_t* ray, rayObjCommon_t* centeredEnemy, uint32_t e
     }
 
     // If the player is in water without the water suit
-    bool isInWater = (!ray->p.i.waterSuit) && (BG_FLOOR_WATER == ray->map.tiles[FROM_FX(pPosX)][FROM_FX(pPosY)].type);
+    bool isInWater
+        = (!ray->p.i.waterSuit) && (BG_FLOOR_WATER == RAY_MAP_CELL(&ray->map, FROM_FX(pPosX), FROM_FX(pPosY))->type);
 
     // Find move distances
     q24_8 deltaX = 0;
@@ -441,14 +442,14 @@ void rayPlayerCheckButtons(ray_t* ray, rayObjCommon_t* centeredEnemy, uint32_t e
         int16_t oldCellY = FROM_FX(pPosY);
 
         // Move forwards if no wall in front of you
-        if (isPassableCell(&ray->map.tiles[FROM_FX(pPosX + boundaryCheckX)][FROM_FX(pPosY)]))
+        if (isPassableCell(RAY_MAP_CELL(&ray->map, FROM_FX(pPosX + boundaryCheckX), FROM_FX(pPosY))))
         {
             ray->p.posX += deltaX;
             // Update local copy
             pPosX = ray->p.posX;
         }
 
-        if (isPassableCell(&ray->map.tiles[FROM_FX(pPosX)][FROM_FX(pPosY + boundaryCheckY)]))
+        if (isPassableCell(RAY_MAP_CELL(&ray->map, FROM_FX(pPosX), FROM_FX(pPosY + boundaryCheckY))))
         {
             ray->p.posY += deltaY;
             // Update local copy
@@ -801,8 +802,11 @@ void rayPlayerTouchItem(ray_t* ray, rayObjCommon_t* item, int32_t mapId)
  */
 void rayPlayerCheckFloorEffect(ray_t* ray, uint32_t elapsedUs)
 {
+    // Get the cell the player is standing in
+    rayMapCell_t* cell = RAY_MAP_CELL(&ray->map, FROM_FX(ray->p.posX), FROM_FX(ray->p.posY));
+
     // If the player is in lava without the lava suit
-    if ((!ray->p.i.lavaSuit) && (BG_FLOOR_LAVA == ray->map.tiles[FROM_FX(ray->p.posX)][FROM_FX(ray->p.posY)].type))
+    if ((!ray->p.i.lavaSuit) && (BG_FLOOR_LAVA == cell->type))
     {
         // Run a timer to take lava damage
         ray->floorEffectTimer += elapsedUs;
@@ -821,7 +825,7 @@ void rayPlayerCheckFloorEffect(ray_t* ray, uint32_t elapsedUs)
             // bzrPlaySfx(&ray->sfx_lava_dmg, BZR_RIGHT);
         }
     }
-    else if (BG_FLOOR_HEAL == ray->map.tiles[FROM_FX(ray->p.posX)][FROM_FX(ray->p.posY)].type)
+    else if (BG_FLOOR_HEAL == cell->type)
     {
         // Run a timer to heal
         ray->floorEffectTimer += elapsedUs;
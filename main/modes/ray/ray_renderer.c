@@ -196,12 +196,12 @@ void castFloorCeiling(ray_t* ray, int32_t firstRow, int32_t lastRow)
                     if (isFloor)
                     {
                         // Get the next cell texture
-                        rayMapCellType_t type = ray->map.tiles[cellX][cellY].type;
+                        const rayMapCell_t* cell = RAY_MAP_CELL(&ray->map, cellX, cellY);
 
                         // Water, lava, and heal are special
-                        if ((BG_FLOOR_LAVA == type) || (BG_FLOOR_WATER == type) || (BG_FLOOR_HEAL == type))
+                        if (cell->flags & RAY_CELL_EFFECT)
                         {
-                            texture = getTexByType(ray, type)->px;
+                            texture = getTexByType(ray, cell->type)->px;
                         }
                         else
                         {
@@ -347,7 +347,8 @@ void castWalls(ray_t* ray)
             }
 
             // Check if ray has hit a wall or door
-            rayMapCellType_t tileType = ray->map.tiles[mapX][mapY].type;
+            const rayMapCell_t* cell  = RAY_MAP_CELL(&ray->map, mapX, mapY);
+            rayMapCellType_t tileType = cell->type;
 
             // Mark this tile as seen
             rayTileState_t* vTile = &ray->map.visitedTiles[(mapY * ray->map.w) + mapX];
@@ -356,14 +357,14 @@ void castWalls(ray_t* ray)
                 *vTile = VISITED;
             }
 
-            if (CELL_IS_TYPE(tileType, BG | WALL) || CELL_IS_TYPE(tileType, BG | DOOR))
+            if (cell->flags & (RAY_CELL_WALL | RAY_CELL_DOOR))
             {
                 // Check if the door should be drawn recessed or not
                 bool drawRecessedDoor = false;
                 if (tileType == BG_DOOR_XRAY)
                 {
                     // X-Ray door, only draw recessed if the X-Ray loadout is active or the door is open
-                    if ((LO_XRAY == ray->p.loadout) || (TO_FX(1) == ray->map.tiles[mapX][mapY].doorOpen))
+                    if ((LO_XRAY == ray->p.loadout) || (TO_FX(1) == cell->doorOpen))
                     {
                         // Draw recessed door
                         drawRecessedDoor = true;
@@ -374,7 +375,7 @@ void castWalls(ray_t* ray)
                         xrayOverride = true;
                     }
                 }
-                else if (CELL_IS_TYPE(tileType, BG | DOOR))
+                else if (cell->flags & RAY_CELL_DOOR)
                 {
                     // Not an X-Ray door, always draw recessed
                     drawRecessedDoor = true;
@@ -385,7 +386,7 @@ void castWalls(ray_t* ray)
                 {
                     // Check if the ray actually intersects the recessed door
                     if (rayIntersectsDoor(side, mapX, mapY, pPosX, pPosY, rayDirX, rayDirY, deltaDistX, deltaDistY,
-                                          ray->map.tiles[mapX][mapY].doorOpen))
+                                          cell->doorOpen))
                     {
                         // Add a half step to these values to recess the door
                         sideDistX = ADD_FX(sideDistX, deltaDistX / 2);
@@ -463,7 +464,7 @@ void castWalls(ray_t* ray)
                 if (drawRecessedDoor)
                 {
                     // Adjust wallX to start drawing the texture at the door's edge rather than the map cell's edge
-                    wallX -= ray->map.tiles[mapX][mapY].doorOpen;
+                    wallX -= cell->doorOpen;
 
                     // If this is negative, it would draw an out-of-bounds pixel.
                     // Negative numbers are a rounding error, so make it zero
@@ -508,7 +509,7 @@ void castWalls(ray_t* ray)
 
         // Pick the texture based on the map tile
         paletteColor_t* tex;
-        rayMapCellType_t type = ray->map.tiles[mapX][mapY].type;
+        rayMapCellType_t type = RAY_MAP_CELL(&ray->map, mapX, mapY)->type;
         if (xrayOverride)
         {
             tex = ray->envTex[ray->p.mapId % NUM_ENVS][TX_WALL_1].px;
@@ -1271,7 +1272,7 @@ void runEnvTimers(ray_t* ray, uint32_t elapsedUs)
             for (int32_t x = 0; x < ray->map.w; x++)
             {
                 // Get a reference to this cell
-                rayMapCell_t* cell = &(ray->map.tiles[x][y]);
+                rayMapCell_t* cell = RAY_MAP_CELL(&ray->map, x, y);
 
                 // If the timer to start closing the door is running
                 if (0 < cell->closeTimer)
@@ -1,4 +1,6 @@
+#include <inttypes.h>
 #include <esp_heap_caps.h>
+#include <esp_log.h>
 #include "ray_script.h"
 #include "ray_dialog.h"
 #include "ray_player.h"
@@ -10,8 +12,16 @@
 #include "ray_tex_manager.h"
 
 static void executeScriptEvent(ray_t* ray, rayScript_t* script, wsg_t* portrait);
-static void checkScriptId(ray_t* ray, list_t* scriptList, int32_t id, wsg_t* portrait);
-static void checkScriptCell(ray_t* ray, list_t* scriptList, int32_t x, int32_t y);
+static void checkScriptIds(ray_t* ray, ifOp_t ifOp, int32_t id, wsg_t* portrait);
+static void checkScriptId(ray_t* ray, rayScript_t* script, int32_t id, wsg_t* portrait);
+static void checkScriptCells(ray_t* ray, ifOp_t ifOp, int32_t x, int32_t y);
+static void checkScriptCell(ray_t* ray, rayScript_t* script, int32_t x, int32_t y);
+static rayScript_t* nextScriptInRuns(rayScript_t*** runA, rayScript_t*** runB, ifOp_t ifOp);
+static void indexScripts(ray_t* ray, uint32_t caps);
+static void indexScript(ray_t* ray, rayScript_t* script, bool fill);
+static void addScriptToRun(ray_t* ray, uint16_t* runIdx, rayScript_t* script, bool fill);
+static uint32_t startScriptRun(uint16_t* runIdx, uint32_t nextIdx);
+static bool isScriptCheckedForEveryEvent(const rayScript_t* script);
 static void freeScript(rayScript_t* script);
 
 /**
@@ -38,8 +48,9 @@ void loadScripts(ray_t* ray, const uint8_t* fileData, uint32_t fileSize, uint32_
         // Allocate a script
         rayScript_t* newScript = heap_caps_calloc(1, sizeof(rayScript_t), caps);
 
-        // Scripts start as active
+        // Scripts start as active, and are checked in the order they're loaded
         newScript->isActive = true;
+        newScript->loadIdx  = sIdx;
 
         // Read the if operation
         newScript->ifOp = fileData[fileIdx++];
@@ -183,6 +194,219 @@ void loadScripts(ray_t* ray, const uint8_t* fileData, uint32_t fileSize, uint32_
         // Add script to the list
         push(&ray->scripts[newScript->ifOp], newScript);
     }
+
+    // Index the scripts by what triggers them
+    indexScripts(ray, caps);
+}
+
+/**
+ * @brief Build the index of scripts by what triggers them, so that entering a cell or shooting an object only checks
+ * the scripts which could care about it.
+ *
+ * Each map cell and object ID has a NULL-terminated run of scripts in ray_t.scriptIndex, in the order the scripts were
+ * loaded. Index 0 is an empty run, for cells and IDs without scripts. Scripts which must see every event to work,
+ * like ones which reset when things happen out of order, get their own run per trigger instead.
+ *
+ * If there are too many entries to index with 16 bits, an error is logged and ray_t.scriptIndex is left NULL, which
+ * disables the scripts.
+ *
+ * @param ray The entire game state, with scripts and the map loaded
+ * @param caps Memory allocation strategy
+ */
+static void indexScripts(ray_t* ray, uint32_t caps)
+{
+    // First count the scripts in each run. The start of each run is used as its counter for now
+    for (uint16_t sIdx = 0; sIdx < NUM_IF_OP_TYPES; sIdx++)
+    {
+        node_t* currentNode = ray->scripts[sIdx].first;
+        while (currentNode != NULL)
+        {
+            indexScript(ray, currentNode->val, false);
+            currentNode = currentNode->next;
+        }
+    }
+
+    // Then turn the counts into starting indices, leaving room for each run's terminator
+    uint32_t numEntries = 1;
+    for (uint32_t cIdx = 0; cIdx < ray->map.w * ray->map.h; cIdx++)
+    {
+        numEntries = startScriptRun(&ray->map.tiles[cIdx].scriptIdx, numEntries);
+    }
+    for (uint16_t id = 0; id < ARRAY_SIZE(ray->idScriptIdx); id++)
+    {
+        numEntries = startScriptRun(&ray->idScriptIdx[id], numEntries);
+    }
+    for (uint16_t op = 0; op < ARRAY_SIZE(ray->anyScriptIdx); op++)
+    {
+        numEntries = startScriptRun(&ray->anyScriptIdx[op], numEntries);
+    }
+
+    // Runs start at 16-bit indices. A map with this many scripts is broken, so leave its scripts unindexed
+    if (numEntries > UINT16_MAX)
+    {
+        ESP_LOGE("RAY", "Too many script triggers to index (%" PRIu32 "), scripts are disabled", numEntries);
+        return;
+    }
+
+    // Finally fill in the runs, which are already terminated by the calloc
+    ray->scriptIndex = heap_caps_calloc(numEntries, sizeof(rayScript_t*), caps);
+    for (uint16_t sIdx = 0; sIdx < NUM_IF_OP_TYPES; sIdx++)
+    {
+        node_t* currentNode = ray->scripts[sIdx].first;
+        while (currentNode != NULL)
+        {
+            indexScript(ray, currentNode->val, true);
+            currentNode = currentNode->next;
+        }
+    }
+}
+
+/**
+ * @brief Add a script to the runs of every cell or ID which can trigger it
+ *
+ * @param ray The entire game state
+ * @param script The script to index
+ * @param fill false to count the script in each run, true to add it to each run
+ */
+static void indexScript(ray_t* ray, rayScript_t* script, bool fill)
+{
+    switch (script->ifOp)
+    {
+        case SHOOT_OBJS:
+        case KILL:
+        case GET:
+        case TOUCH:
+        {
+            if (isScriptCheckedForEveryEvent(script))
+            {
+                addScriptToRun(ray, &ray->anyScriptIdx[script->ifOp], script, fill);
+                break;
+            }
+
+            for (uint8_t i = 0; i < script->ifArgs.idList.numIds; i++)
+            {
+                // Only add the script once per ID, even if the ID is listed twice
+                uint8_t id = script->ifArgs.idList.ids[i];
+                if (NULL == memchr(script->ifArgs.idList.ids, id, i))
+                {
+                    addScriptToRun(ray, &ray->idScriptIdx[id], script, fill);
+                }
+            }
+            break;
+        }
+        case SHOOT_WALLS:
+        case ENTER:
+        {
+            if (isScriptCheckedForEveryEvent(script))
+            {
+                addScriptToRun(ray, &ray->anyScriptIdx[script->ifOp], script, fill);
+                break;
+            }
+
+            for (uint8_t i = 0; i < script->ifArgs.cellList.numCells; i++)
+            {
+                rayMapCoordinates_t* cell = &script->ifArgs.cellList.cells[i];
+
+                // Cells outside the map can never be entered or shot
+                if (cell->x >= ray->map.w || cell->y >= ray->map.h)
+                {
+                    continue;
+                }
+
+                // Only add the script once per cell, even if the cell is listed twice
+                bool isFirst = true;
+                for (uint8_t j = 0; j < i; j++)
+                {
+                    if (cell->x == script->ifArgs.cellList.cells[j].x && cell->y == script->ifArgs.cellList.cells[j].y)
+                    {
+                        isFirst = false;
+                        break;
+                    }
+                }
+
+                if (isFirst)
+                {
+                    addScriptToRun(ray, &RAY_MAP_CELL(&ray->map, cell->x, cell->y)->scriptIdx, script, fill);
+                }
+            }
+            break;
+        }
+        default:
+        case TIME_ELAPSED:
+        case NUM_IF_OP_TYPES:
+        {
+            // Checked by time, not indexed
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Count a script in a run, or add it to the end of the run
+ *
+ * @param ray The entire game state
+ * @param runIdx The run's start index in ray_t.scriptIndex, or its count while counting
+ * @param script The script to add
+ * @param fill false to count the script, true to add it
+ */
+static void addScriptToRun(ray_t* ray, uint16_t* runIdx, rayScript_t* script, bool fill)
+{
+    if (!fill)
+    {
+        // Saturate rather than wrap, so an oversized run still makes the total too big to index
+        if (*runIdx < UINT16_MAX)
+        {
+            (*runIdx)++;
+        }
+        return;
+    }
+
+    rayScript_t** slot = &ray->scriptIndex[*runIdx];
+    while (NULL != *slot)
+    {
+        slot++;
+    }
+    *slot = script;
+}
+
+/**
+ * @brief Turn a run's count into its start index in ray_t.scriptIndex
+ *
+ * @param runIdx The run's count, which is replaced with its start index, or 0 for an empty run
+ * @param nextIdx The next free index in ray_t.scriptIndex
+ * @return The next free index after this run
+ */
+static uint32_t startScriptRun(uint16_t* runIdx, uint32_t nextIdx)
+{
+    uint16_t count = *runIdx;
+    if (0 == count)
+    {
+        return nextIdx;
+    }
+
+    *runIdx = nextIdx;
+    return nextIdx + count + 1;
+}
+
+/**
+ * @brief Check if a script must be checked for every event of its trigger, rather than just the events for its own
+ * cells or IDs. In-order AND scripts reset when anything else happens first, and empty AND scripts trigger on anything
+ *
+ * @param script The script to check
+ * @return true if the script must be checked for every event
+ */
+static bool isScriptCheckedForEveryEvent(const rayScript_t* script)
+{
+    if (SHOOT_WALLS == script->ifOp || ENTER == script->ifOp)
+    {
+        return (AND == script->ifArgs.cellList.andOr)
+               && (IN_ORDER == script->ifArgs.cellList.order || 0 == script->ifArgs.cellList.numCells);
+    }
+    else
+    {
+        return (AND == script->ifArgs.idList.andOr)
+               && (IN_ORDER == script->ifArgs.idList.order || 0 == script->ifArgs.idList.numIds);
+    }
 }
 
 /**
@@ -201,6 +425,12 @@ void freeScripts(ray_t* ray)
             freeScript(script);
         }
     }
+
+    // Free the index too
+    free(ray->scriptIndex);
+    ray->scriptIndex = NULL;
+    memset(ray->idScriptIdx, 0, sizeof(ray->idScriptIdx));
+    memset(ray->anyScriptIdx, 0, sizeof(ray->anyScriptIdx));
 }
 
 /**
@@ -286,120 +516,136 @@ static void freeScript(rayScript_t* script)
  * @brief Check a script which is triggered by an ID
  *
  * @param ray The entire game state
- * @param scriptList The list of scripts to check
+ * @param script The script to check
  * @param id The ID to check
  * @param portrait A portrait to draw on dialogs
  */
-static void checkScriptId(ray_t* ray, list_t* scriptList, int32_t id, wsg_t* portrait)
+static void checkScriptId(ray_t* ray, rayScript_t* script, int32_t id, wsg_t* portrait)
 {
-    // Iterate over all nodes
-    node_t* currentNode = scriptList->first;
-    while (currentNode != NULL)
+    // Only check if the script is active
+    if (script->isActive)
     {
-        // Get the script
-        rayScript_t* script = currentNode->val;
+        // Don't execute it by default
+        bool shouldExecute = false;
 
-        // Only check if the script is active
-        if (script->isActive)
+        // Check if this is an AND or OR script
+        if (OR == script->ifArgs.idList.andOr)
         {
-            // Don't execute it by default
-            bool shouldExecute = false;
-
-            // Check if this is an AND or OR script
-            if (OR == script->ifArgs.idList.andOr)
+            // OR - check if any of the IDs are triggered
+            for (int32_t idx = 0; idx < script->ifArgs.idList.numIds; idx++)
             {
-                // OR - check if any of the IDs are triggered
-                for (int32_t idx = 0; idx < script->ifArgs.idList.numIds; idx++)
+                // Check if any ID matches
+                if (id == script->ifArgs.idList.ids[idx])
                 {
-                    // Check if any ID matches
-                    if (id == script->ifArgs.idList.ids[idx])
-                    {
-                        // Do the then
-                        shouldExecute = true;
-                        break;
-                    }
+                    // Do the then
+                    shouldExecute = true;
+                    break;
                 }
             }
-            else
+        }
+        else
+        {
+            // For each id in the script list
+            for (int32_t idx = 0; idx < script->ifArgs.idList.numIds; idx++)
             {
-                // For each id in the script list
-                for (int32_t idx = 0; idx < script->ifArgs.idList.numIds; idx++)
+                // If this hasn't been triggered yet
+                if (false == script->ifArgs.idList.idsTriggered[idx])
                 {
-                    // If this hasn't been triggered yet
-                    if (false == script->ifArgs.idList.idsTriggered[idx])
+                    // Check if the id matches
+                    if (id == script->ifArgs.idList.ids[idx])
                     {
-                        // Check if the id matches
-                        if (id == script->ifArgs.idList.ids[idx])
-                        {
-                            // Mark it as triggered
-                            script->ifArgs.idList.idsTriggered[idx] = true;
-                            break;
-                        }
-                        else if (IN_ORDER == script->ifArgs.idList.order)
-                        {
-                            // Not triggered in order, clear them all
-                            memset(script->ifArgs.idList.idsTriggered, false,
-                                   sizeof(bool) * script->ifArgs.idList.numIds);
-                            break;
-                        }
+                        // Mark it as triggered
+                        script->ifArgs.idList.idsTriggered[idx] = true;
+                        break;
                     }
-                }
-
-                // Check if all were triggered
-                bool allTriggered = true;
-                for (int32_t idx = 0; idx < script->ifArgs.idList.numIds; idx++)
-                {
-                    // Check if the ID matches
-                    if (false == script->ifArgs.idList.idsTriggered[idx])
+                    else if (IN_ORDER == script->ifArgs.idList.order)
                     {
-                        allTriggered = false;
+                        // Not triggered in order, clear them all
+                        memset(script->ifArgs.idList.idsTriggered, false,
+                               sizeof(bool) * script->ifArgs.idList.numIds);
                         break;
                     }
                 }
+            }
 
-                // If all IDs were triggered
-                if (allTriggered)
+            // Check if all were triggered
+            bool allTriggered = true;
+            for (int32_t idx = 0; idx < script->ifArgs.idList.numIds; idx++)
+            {
+                // Check if the ID matches
+                if (false == script->ifArgs.idList.idsTriggered[idx])
                 {
-                    // Execute the script
-                    shouldExecute = true;
+                    allTriggered = false;
+                    break;
                 }
             }
 
-            // If the script should execute
-            if (shouldExecute)
+            // If all IDs were triggered
+            if (allTriggered)
             {
-                // Do it
-                executeScriptEvent(ray, script, portrait);
+                // Execute the script
+                shouldExecute = true;
+            }
+        }
+
+        // If the script should execute
+        if (shouldExecute)
+        {
+            // Do it
+            executeScriptEvent(ray, script, portrait);
 
-                // If this script is an always script, not a one-time script
-                if (ALWAYS == script->ifArgs.cellList.oneTime)
+            // If this script is an always script, not a one-time script
+            if (ALWAYS == script->ifArgs.cellList.oneTime)
+            {
+                // If the reset timer is not running after execution
+                if (0 == script->resetTimerSec)
                 {
-                    // If the reset timer is not running after execution
-                    if (0 == script->resetTimerSec)
-                    {
-                        // Immediately activate the script
-                        script->isActive = true;
-                    }
-                    else
-                    {
-                        // Otherwise mark it inactive, and let the reset timer reactivate it
-                        script->isActive = false;
-                    }
+                    // Immediately activate the script
+                    script->isActive = true;
                 }
                 else
                 {
-                    // This is a one-time script, so stop it, period
-                    script->isActive      = false;
-                    script->resetTimerSec = 0;
+                    // Otherwise mark it inactive, and let the reset timer reactivate it
+                    script->isActive = false;
                 }
-
-                // Reset the triggered IDs
-                memset(script->ifArgs.idList.idsTriggered, false, sizeof(bool) * script->ifArgs.idList.numIds);
             }
+            else
+            {
+                // This is a one-time script, so stop it, period
+                script->isActive      = false;
+                script->resetTimerSec = 0;
+            }
+
+            // Reset the triggered IDs
+            memset(script->ifArgs.idList.idsTriggered, false, sizeof(bool) * script->ifArgs.idList.numIds);
         }
+    }
+}
 
-        // Move to the next script
-        currentNode = currentNode->next;
+/**
+ * @brief Check the scripts which an ID could trigger, in the order they were loaded
+ *
+ * @param ray The entire game state
+ * @param ifOp The type of event which happened to the ID
+ * @param id The ID to check
+ * @param portrait A portrait to draw on dialogs
+ */
+static void checkScriptIds(ray_t* ray, ifOp_t ifOp, int32_t id, wsg_t* portrait)
+{
+    if (NULL == ray->scriptIndex)
+    {
+        return;
+    }
+
+    // IDs are a byte in the map file, so others can't trigger anything but the scripts which check every event
+    uint16_t idIdx = ((uint32_t)id < ARRAY_SIZE(ray->idScriptIdx)) ? ray->idScriptIdx[id] : 0;
+
+    rayScript_t** idRun  = &ray->scriptIndex[idIdx];
+    rayScript_t** anyRun = &ray->scriptIndex[ray->anyScriptIdx[ifOp]];
+    rayScript_t* script;
+    while (NULL != (script = nextScriptInRuns(&idRun, &anyRun, ifOp)))
+    {
+        checkScriptId(ray, script, id, portrait);
     }
 }
 
@@ -412,7 +658,7 @@ static void checkScriptId(ray_t* ray, list_t* scriptList, int32_t id, wsg_t* por
  */
 void checkScriptShootObjs(ray_t* ray, int32_t id, wsg_t* portrait)
 {
-    checkScriptId(ray, &ray->scripts[SHOOT_OBJS], id, portrait);
+    checkScriptIds(ray, SHOOT_OBJS, id, portrait);
 }
 
 /**
@@ -424,7 +670,7 @@ void checkScriptShootObjs(ray_t* ray, int32_t id, wsg_t* portrait)
  */
 void checkScriptKill(ray_t* ray, int32_t id, wsg_t* portrait)
 {
-    checkScriptId(ray, &ray->scripts[KILL], id, portrait);
+    checkScriptIds(ray, KILL, id, portrait);
 }
 
 /**
@@ -436,7 +682,7 @@ void checkScriptKill(ray_t* ray, int32_t id, wsg_t* portrait)
  */
 void checkScriptGet(ray_t* ray, int32_t id, wsg_t* portrait)
 {
-    checkScriptId(ray, &ray->scripts[GET], id, portrait);
+    checkScriptIds(ray, GET, id, portrait);
 }
 
 /**
@@ -448,128 +694,183 @@ void checkScriptGet(ray_t* ray, int32_t id, wsg_t* portrait)
  */
 void checkScriptTouch(ray_t* ray, int32_t id, wsg_t* portrait)
 {
-    checkScriptId(ray, &ray->scripts[TOUCH], id, portrait);
+    checkScriptIds(ray, TOUCH, id, portrait);
 }
 
 /**
  * @brief Check a script which is triggered by a map cell
  *
  * @param ray The entire game state
- * @param scriptList The list of scripts to check
+ * @param script The script to check
  * @param x The X coordinate of the cell
  * @param y The Y coordinate of the cell
  */
-static void checkScriptCell(ray_t* ray, list_t* scriptList, int32_t x, int32_t y)
+static void checkScriptCell(ray_t* ray, rayScript_t* script, int32_t x, int32_t y)
 {
-    // Iterate over all nodes
-    node_t* currentNode = scriptList->first;
-    while (currentNode != NULL)
+    // Only check if the script is active
+    if (script->isActive)
     {
-        // Get the script
-        rayScript_t* script = currentNode->val;
+        // Don't execute it by default
+        bool shouldExecute = false;
 
-        // Only check if the script is active
-        if (script->isActive)
+        // Check if this is an AND or OR script
+        if (OR == script->ifArgs.cellList.andOr)
         {
-            // Don't execute it by default
-            bool shouldExecute = false;
-
-            // Check if this is an AND or OR script
-            if (OR == script->ifArgs.cellList.andOr)
+            // OR - check if any of the cells are triggered
+            for (int32_t idx = 0; idx < script->ifArgs.cellList.numCells; idx++)
             {
-                // OR - check if any of the cells are triggered
-                for (int32_t idx = 0; idx < script->ifArgs.cellList.numCells; idx++)
+                // Check if any cell matches
+                if ((x == script->ifArgs.cellList.cells[idx].x) && (y == script->ifArgs.cellList.cells[idx].y))
                 {
-                    // Check if any cell matches
-                    if ((x == script->ifArgs.cellList.cells[idx].x) && (y == script->ifArgs.cellList.cells[idx].y))
-                    {
-                        // Do the then
-                        shouldExecute = true;
-                        break;
-                    }
+                    // Do the then
+                    shouldExecute = true;
+                    break;
                 }
             }
-            else
+        }
+        else
+        {
+            // For each cell in the script list
+            for (int32_t idx = 0; idx < script->ifArgs.cellList.numCells; idx++)
             {
-                // For each cell in the script list
-                for (int32_t idx = 0; idx < script->ifArgs.cellList.numCells; idx++)
+                // If this hasn't been triggered yet
+                if (false == script->ifArgs.cellList.cellsTriggered[idx])
                 {
-                    // If this hasn't been triggered yet
-                    if (false == script->ifArgs.cellList.cellsTriggered[idx])
+                    // Check if the cell matches
+                    if ((x == script->ifArgs.cellList.cells[idx].x) && (y == script->ifArgs.cellList.cells[idx].y))
                     {
-                        // Check if the cell matches
-                        if ((x == script->ifArgs.cellList.cells[idx].x) && (y == script->ifArgs.cellList.cells[idx].y))
-                        {
-                            // Mark it as triggered
-                            script->ifArgs.cellList.cellsTriggered[idx] = true;
-                            break;
-                        }
-                        else if (IN_ORDER == script->ifArgs.cellList.order)
-                        {
-                            // Not triggered in order, clear them all
-                            memset(script->ifArgs.cellList.cellsTriggered, false,
-                                   sizeof(bool) * script->ifArgs.cellList.numCells);
-                            break;
-                        }
+                        // Mark it as triggered
+                        script->ifArgs.cellList.cellsTriggered[idx] = true;
+                        break;
                     }
-                }
-
-                // Check if all were triggered
-                bool allTriggered = true;
-                for (int32_t idx = 0; idx < script->ifArgs.cellList.numCells; idx++)
-                {
-                    // Check if the cell matches
-                    if (false == script->ifArgs.cellList.cellsTriggered[idx])
+                    else if (IN_ORDER == script->ifArgs.cellList.order)
                     {
-                        allTriggered = false;
+                        // Not triggered in order, clear them all
+                        memset(script->ifArgs.cellList.cellsTriggered, false,
+                               sizeof(bool) * script->ifArgs.cellList.numCells);
                         break;
                     }
                 }
+            }
 
-                // If all cells were triggered
-                if (allTriggered)
+            // Check if all were triggered
+            bool allTriggered = true;
+            for (int32_t idx = 0; idx < script->ifArgs.cellList.numCells; idx++)
+            {
+                // Check if the cell matches
+                if (false == script->ifArgs.cellList.cellsTriggered[idx])
                 {
-                    // Execute the script
-                    shouldExecute = true;
+                    allTriggered = false;
+                    break;
                 }
             }
 
-            // If the script should execute
-            if (shouldExecute)
+            // If all cells were triggered
+            if (allTriggered)
             {
-                // Do it
-                executeScriptEvent(ray, script, &ray->cho_portrait);
+                // Execute the script
+                shouldExecute = true;
+            }
+        }
 
-                // If this script is an always script, not a one-time script
-                if (ALWAYS == script->ifArgs.cellList.oneTime)
+        // If the script should execute
+        if (shouldExecute)
+        {
+            // Do it
+            executeScriptEvent(ray, script, &ray->cho_portrait);
+
+            // If this script is an always script, not a one-time script
+            if (ALWAYS == script->ifArgs.cellList.oneTime)
+            {
+                // If the reset timer is not running after execution
+                if (0 == script->resetTimerSec)
                 {
-                    // If the reset timer is not running after execution
-                    if (0 == script->resetTimerSec)
-                    {
-                        // Immediately activate the script
-                        script->isActive = true;
-                    }
-                    else
-                    {
-                        // Otherwise mark it inactive, and let the reset timer reactivate it
-                        script->isActive = false;
-                    }
+                    // Immediately activate the script
+                    script->isActive = true;
                 }
                 else
                 {
-                    // This is a one-time script, so stop it, period
-                    script->isActive      = false;
-                    script->resetTimerSec = 0;
+                    // Otherwise mark it inactive, and let the reset timer reactivate it
+                    script->isActive = false;
                 }
-
-                // Reset the triggered cells
-                memset(script->ifArgs.cellList.cellsTriggered, false, sizeof(bool) * script->ifArgs.cellList.numCells);
             }
+            else
+            {
+                // This is a one-time script, so stop it, period
+                script->isActive      = false;
+                script->resetTimerSec = 0;
+            }
+
+            // Reset the triggered cells
+            memset(script->ifArgs.cellList.cellsTriggered, false, sizeof(bool) * script->ifArgs.cellList.numCells);
         }
+    }
+}
+
+/**
+ * @brief Check the scripts which a map cell could trigger, in the order they were loaded
+ *
+ * @param ray The entire game state
+ * @param ifOp The type of event which happened in the cell
+ * @param x The X coordinate of the cell
+ * @param y The Y coordinate of the cell
+ */
+static void checkScriptCells(ray_t* ray, ifOp_t ifOp, int32_t x, int32_t y)
+{
+    if (NULL == ray->scriptIndex)
+    {
+        return;
+    }
 
-        // Move to the next script
-        currentNode = currentNode->next;
+    // Negative coordinates wrap around to be out of bounds too
+    uint16_t cellIdx = 0;
+    if ((uint32_t)x < ray->map.w && (uint32_t)y < ray->map.h)
+    {
+        cellIdx = RAY_MAP_CELL(&ray->map, x, y)->scriptIdx;
+    }
+
+    rayScript_t** cellRun = &ray->scriptIndex[cellIdx];
+    rayScript_t** anyRun  = &ray->scriptIndex[ray->anyScriptIdx[ifOp]];
+    rayScript_t* script;
+    while (NULL != (script = nextScriptInRuns(&cellRun, &anyRun, ifOp)))
+    {
+        checkScriptCell(ray, script, x, y);
+    }
+}
+
+/**
+ * @brief Get the next script from two runs in ray_t.scriptIndex, in the order the scripts were loaded. This is the
+ * same order the lists of scripts are in
+ *
+ * @param runA The first run, which is advanced past the returned script
+ * @param runB The second run, which is advanced past the returned script
+ * @param ifOp Only return scripts with this trigger. A cell's run has scripts for both shooting and entering it
+ * @return The next script, or NULL if both runs are done
+ */
+static rayScript_t* nextScriptInRuns(rayScript_t*** runA, rayScript_t*** runB, ifOp_t ifOp)
+{
+    while (NULL != **runA && ifOp != (**runA)->ifOp)
+    {
+        (*runA)++;
+    }
+    while (NULL != **runB && ifOp != (**runB)->ifOp)
+    {
+        (*runB)++;
+    }
+
+    rayScript_t* a = **runA;
+    rayScript_t* b = **runB;
+    if (NULL != a && (NULL == b || a->loadIdx < b->loadIdx))
+    {
+        (*runA)++;
+        return a;
+    }
+    else if (NULL != b)
+    {
+        (*runB)++;
+        return b;
     }
+    return NULL;
 }
 
 /**
@@ -581,7 +882,7 @@ static void checkScriptCell(ray_t* ray, list_t* scriptList, int32_t x, int32_t y
  */
 void checkScriptShootWall(ray_t* ray, int32_t x, int32_t y)
 {
-    checkScriptCell(ray, &ray->scripts[SHOOT_WALLS], x, y);
+    checkScriptCells(ray, SHOOT_WALLS, x, y);
 }
 
 /**
@@ -593,7 +894,7 @@ void checkScriptShootWall(ray_t* ray, int32_t x, int32_t y)
  */
 void checkScriptEnter(ray_t* ray, int32_t x, int32_t y)
 {
-    checkScriptCell(ray, &ray->scripts[ENTER], x, y);
+    checkScriptCells(ray, ENTER, x, y);
 }
 
 /**
@@ -687,7 +988,7 @@ static void executeScriptEvent(ray_t* ray, rayScript_t* script, wsg_t* portrait)
                 int32_t x = script->thenArgs.cellList.cells[cIdx].x;
                 int32_t y = script->thenArgs.cellList.cells[cIdx].y;
                 // Start opening the door
-                ray->map.tiles[x][y].openingDirection = 1;
+                RAY_MAP_CELL(&ray->map, x, y)->openingDirection = 1;
                 // Mark it as permanently open
                 ray->map.visitedTiles[(y * ray->map.w) + x] = SCRIPT_DOOR_OPEN;
                 // Play SFX
@@ -702,7 +1003,7 @@ static void executeScriptEvent(ray_t* ray, rayScript_t* script, wsg_t* portrait)
                 int32_t x = script->thenArgs.cellList.cells[cIdx].x;
                 int32_t y = script->thenArgs.cellList.cells[cIdx].y;
                 // Start closing the door
-                ray->map.tiles[x][y].openingDirection = -1;
+                RAY_MAP_CELL(&ray->map, x, y)->openingDirection = -1;
             }
             break;
         }
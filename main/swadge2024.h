@@ -194,6 +194,7 @@
 #include "spiffs_txt.h"
 #include "spiffs_json.h"
 #include "spiffs_song.h"
+#include "spiffs_model.h"
 
 // Connection interface
 #include "p2pConnection.h"
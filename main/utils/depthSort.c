@@ -0,0 +1,224 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "depthSort.h"
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static void depthSortInsertion(depthSort_t* ds);
+static void depthSortRadix(depthSort_t* ds);
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Initialize a depth sorter and allocate its memory
+ *
+ * @param ds The depth sorter to initialize
+ * @param maxIds The maximum number of things to draw. IDs must be less than this
+ */
+void depthSortInit(depthSort_t* ds, uint16_t maxIds)
+{
+    ds->maxIds    = maxIds;
+    ds->depths    = malloc(maxIds * sizeof(uint16_t));
+    ds->items     = malloc(maxIds * sizeof(const void*));
+    ds->addedBits = calloc((maxIds + 31) / 32, sizeof(uint32_t));
+    ds->addedIds  = malloc(maxIds * sizeof(uint16_t));
+    ds->order     = malloc(maxIds * sizeof(uint16_t));
+    ds->scratch   = malloc(maxIds * sizeof(uint16_t));
+    ds->numAdded  = 0;
+    ds->numOrder  = 0;
+}
+
+/**
+ * @brief Free a depth sorter's memory
+ *
+ * @param ds The depth sorter to deinitialize
+ */
+void depthSortDeinit(depthSort_t* ds)
+{
+    free(ds->depths);
+    free(ds->items);
+    free(ds->addedBits);
+    free(ds->addedIds);
+    free(ds->order);
+    free(ds->scratch);
+    memset(ds, 0, sizeof(depthSort_t));
+}
+
+/**
+ * @brief Add something to draw this frame. If the ID was already added this frame, its depth and item are replaced
+ *
+ * @param ds The depth sorter
+ * @param id The thing's ID, which should be the same every frame
+ * @param depth How far away the thing is. Farther things are drawn first
+ * @param item Anything the caller wants back with the ID, available from ds->items[id]
+ */
+void depthSortAdd(depthSort_t* ds, uint16_t id, uint16_t depth, const void* item)
+{
+    if (id >= ds->maxIds)
+    {
+        return;
+    }
+
+    ds->depths[id] = depth;
+    ds->items[id]  = item;
+
+    uint32_t bit = 1u << (id & 31);
+    if (!(ds->addedBits[id >> 5] & bit))
+    {
+        ds->addedBits[id >> 5] |= bit;
+        ds->addedIds[ds->numAdded++] = id;
+    }
+}
+
+/**
+ * @brief Put everything added this frame in drawing order, and start a new frame
+ *
+ * @param ds The depth sorter
+ * @param[out] numIds Written with the number of IDs in drawing order
+ * @return The IDs of everything added this frame, farthest first. This is valid until the next call
+ */
+const uint16_t* depthSortFinish(depthSort_t* ds, uint16_t* numIds)
+{
+    uint16_t* next = ds->scratch;
+    uint16_t n     = 0;
+
+    // Start from last frame's order, keeping what was added again, then append what's new. Clearing each bit as its ID
+    // is placed leaves the bitmap ready for the next frame
+    for (uint16_t i = 0; i < ds->numOrder; i++)
+    {
+        uint16_t id  = ds->order[i];
+        uint32_t bit = 1u << (id & 31);
+        if (ds->addedBits[id >> 5] & bit)
+        {
+            ds->addedBits[id >> 5] &= ~bit;
+            next[n++] = id;
+        }
+    }
+    for (uint16_t i = 0; i < ds->numAdded; i++)
+    {
+        uint16_t id  = ds->addedIds[i];
+        uint32_t bit = 1u << (id & 31);
+        if (ds->addedBits[id >> 5] & bit)
+        {
+            ds->addedBits[id >> 5] &= ~bit;
+            next[n++] = id;
+        }
+    }
+
+    ds->scratch  = ds->order;
+    ds->order    = next;
+    ds->numOrder = n;
+    ds->numAdded = 0;
+
+    // Count the neighbors which are out of order. A few means last frame's order is a good hint
+    uint16_t descents = 0;
+    for (uint16_t i = 1; i < n; i++)
+    {
+        if (ds->depths[next[i - 1]] < ds->depths[next[i]])
+        {
+            descents++;
+        }
+    }
+
+    if (descents == 0)
+    {
+        // Already sorted
+    }
+    else if (descents * 8 <= n)
+    {
+        depthSortInsertion(ds);
+    }
+    else
+    {
+        depthSortRadix(ds);
+    }
+
+    *numIds = n;
+    return ds->order;
+}
+
+/**
+ * @brief Sort the order by descending depth with an insertion sort, which is fast when it's nearly sorted already
+ *
+ * @param ds The depth sorter
+ */
+static void depthSortInsertion(depthSort_t* ds)
+{
+    uint16_t* order        = ds->order;
+    const uint16_t* depths = ds->depths;
+
+    for (uint16_t i = 1; i < ds->numOrder; i++)
+    {
+        uint16_t id    = order[i];
+        uint16_t depth = depths[id];
+        uint16_t j     = i;
+        while (j > 0 && depths[order[j - 1]] < depth)
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = id;
+    }
+}
+
+/**
+ * @brief Sort the order by descending depth with a stable least significant byte first radix sort
+ *
+ * @param ds The depth sorter
+ */
+static void depthSortRadix(depthSort_t* ds)
+{
+    uint16_t n             = ds->numOrder;
+    const uint16_t* depths = ds->depths;
+
+    // Count both bytes in one pass. Inverting the depths makes an ascending sort put the farthest first
+    uint16_t counts[2][256] = {0};
+    for (uint16_t i = 0; i < n; i++)
+    {
+        uint16_t key = ~depths[ds->order[i]];
+        counts[0][key & 0xFF]++;
+        counts[1][key >> 8]++;
+    }
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        uint16_t* count = counts[pass];
+        int shift       = pass * 8;
+
+        // If every key has the same byte, this pass wouldn't move anything
+        uint16_t key = ~depths[ds->order[0]];
+        if (count[(key >> shift) & 0xFF] == n)
+        {
+            continue;
+        }
+
+        // Turn the counts into the position of the first ID with each byte
+        uint16_t pos = 0;
+        for (int b = 0; b < 256; b++)
+        {
+            uint16_t c = count[b];
+            count[b]   = pos;
+            pos += c;
+        }
+
+        for (uint16_t i = 0; i < n; i++)
+        {
+            uint16_t id   = ds->order[i];
+            uint16_t byte = ((uint16_t)~depths[id] >> shift) & 0xFF;
+            ds->scratch[count[byte]++] = id;
+        }
+
+        uint16_t* tmp = ds->order;
+        ds->order     = ds->scratch;
+        ds->scratch   = tmp;
+    }
+}
@@ -0,0 +1,84 @@
+/*! \file depthSort.h
+ *
+ * \section depthSort_design Design Philosophy
+ *
+ * This puts things in drawing order for a painter's algorithm renderer, farthest first, in linear time and without
+ * the comparator call per comparison that qsort() makes.
+ *
+ * Things are identified by IDs which stay the same from frame to frame, such as array indices. Each frame starts from
+ * the previous frame's order, with anything no longer added dropped and anything newly added appended. Depths don't
+ * change much between frames, so that is usually sorted already or nearly so, and an insertion sort finishes it.
+ * Otherwise, such as after the camera turns quickly, a radix sort on the 16 bit depths is used. Both sorts are stable,
+ * so things at the same depth keep their order from frame to frame and don't flicker.
+ *
+ * \section depthSort_usage Usage
+ *
+ * Call depthSortInit() once to allocate memory, and depthSortDeinit() when done.
+ *
+ * Each frame, call depthSortAdd() for each thing to draw, then depthSortFinish() to get their IDs in drawing order.
+ *
+ * \section depthSort_example Example
+ *
+ * \code{.c}
+ * depthSort_t sorter;
+ * depthSortInit(&sorter, MAX_THINGS);
+ *
+ * // Once per frame
+ * for (uint16_t i = 0; i < MAX_THINGS; i++)
+ * {
+ *     if (isVisible(&things[i]))
+ *     {
+ *         depthSortAdd(&sorter, i, distanceTo(&things[i]), &things[i]);
+ *     }
+ * }
+ *
+ * uint16_t numIds;
+ * const uint16_t* ids = depthSortFinish(&sorter, &numIds);
+ * for (uint16_t i = 0; i < numIds; i++)
+ * {
+ *     drawThing(sorter.items[ids[i]]);
+ * }
+ *
+ * depthSortDeinit(&sorter);
+ * \endcode
+ */
+
+#ifndef _DEPTH_SORT_H_
+#define _DEPTH_SORT_H_
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * @brief Things to draw this frame and the order they were drawn in last frame
+ */
+typedef struct
+{
+    uint16_t maxIds;     ///< IDs must be less than this
+    uint16_t* depths;    ///< The depth of each ID added this frame
+    const void** items;  ///< The item given with each ID added this frame
+    uint32_t* addedBits; ///< A bitmap of IDs added this frame
+    uint16_t* addedIds;  ///< IDs added this frame, in the order they were added
+    uint16_t numAdded;   ///< The number of IDs in addedIds
+    uint16_t* order;     ///< IDs in drawing order, farthest first
+    uint16_t numOrder;   ///< The number of IDs in order
+    uint16_t* scratch;   ///< Space for building the next order
+} depthSort_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+void depthSortInit(depthSort_t* ds, uint16_t maxIds);
+void depthSortDeinit(depthSort_t* ds);
+void depthSortAdd(depthSort_t* ds, uint16_t id, uint16_t depth, const void* item);
+const uint16_t* depthSortFinish(depthSort_t* ds, uint16_t* numIds);
+
+#endif
@@ -0,0 +1,163 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "entityPool.h"
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Initialize an entity pool and allocate its memory. All slots start free
+ *
+ * @param pool The pool to initialize
+ * @param capacity The number of slots, which should be the size of the entity array
+ */
+void entityPoolInit(entityPool_t* pool, uint16_t capacity)
+{
+    pool->capacity    = capacity;
+    pool->numActive   = 0;
+    pool->bitmapWords = (capacity + 31) / 32;
+    pool->activeBits  = calloc(pool->bitmapWords, sizeof(uint32_t));
+}
+
+/**
+ * @brief Free memory allocated by an entity pool
+ *
+ * @param pool The pool to deinitialize
+ */
+void entityPoolDeinit(entityPool_t* pool)
+{
+    free(pool->activeBits);
+    pool->activeBits = NULL;
+    pool->numActive  = 0;
+}
+
+/**
+ * @brief Free every slot in an entity pool
+ *
+ * @param pool The pool to clear
+ */
+void entityPoolClear(entityPool_t* pool)
+{
+    memset(pool->activeBits, 0, pool->bitmapWords * sizeof(uint32_t));
+    pool->numActive = 0;
+}
+
+/**
+ * @brief Claim the lowest free slot in an entity pool
+ *
+ * @param pool The pool to allocate from
+ * @return The claimed slot, or -1 if the pool is full
+ */
+int32_t entityPoolAlloc(entityPool_t* pool)
+{
+    if (pool->numActive >= pool->capacity)
+    {
+        return -1;
+    }
+
+    for (uint16_t word = 0; word < pool->bitmapWords; word++)
+    {
+        uint32_t freeBits = ~pool->activeBits[word];
+        if (freeBits)
+        {
+            int32_t slot = word * 32 + __builtin_ctz(freeBits);
+            if (slot >= pool->capacity)
+            {
+                break;
+            }
+
+            pool->activeBits[word] |= (1u << (slot % 32));
+            pool->numActive++;
+            return slot;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Claim a specific slot in an entity pool
+ *
+ * @param pool The pool to allocate from
+ * @param slot The slot to claim
+ * @return true if the slot was free and is now claimed, false if it was already in use or out of range
+ */
+bool entityPoolAllocAt(entityPool_t* pool, uint16_t slot)
+{
+    if (slot >= pool->capacity || entityPoolIsActive(pool, slot))
+    {
+        return false;
+    }
+
+    pool->activeBits[slot / 32] |= (1u << (slot % 32));
+    pool->numActive++;
+    return true;
+}
+
+/**
+ * @brief Release a slot in an entity pool. Releasing a slot which is already free does nothing
+ *
+ * @param pool The pool to release the slot to
+ * @param slot The slot to release
+ */
+void entityPoolFree(entityPool_t* pool, uint16_t slot)
+{
+    if (slot < pool->capacity && entityPoolIsActive(pool, slot))
+    {
+        pool->activeBits[slot / 32] &= ~(1u << (slot % 32));
+        pool->numActive--;
+    }
+}
+
+/**
+ * @brief Check if a slot in an entity pool is in use
+ *
+ * @param pool The pool to check
+ * @param slot The slot to check
+ * @return true if the slot is in use, false if it is free
+ */
+bool entityPoolIsActive(const entityPool_t* pool, uint16_t slot)
+{
+    return 0 != (pool->activeBits[slot / 32] & (1u << (slot % 32)));
+}
+
+/**
+ * @brief Find the next slot in use after a given slot
+ *
+ * @param pool The pool to search
+ * @param prev The slot to search after, or -1 to start from the beginning
+ * @return The next slot in use, or -1 if there are no more
+ */
+int32_t entityPoolNext(const entityPool_t* pool, int32_t prev)
+{
+    int32_t start = prev + 1;
+    if (start >= pool->capacity)
+    {
+        return -1;
+    }
+
+    uint16_t word = start / 32;
+
+    // Mask off the bits at or before prev in the first word
+    uint32_t bits = pool->activeBits[word] & (~0u << (start % 32));
+    while (true)
+    {
+        if (bits)
+        {
+            int32_t slot = word * 32 + __builtin_ctz(bits);
+            return (slot < pool->capacity) ? slot : -1;
+        }
+
+        if (++word >= pool->bitmapWords)
+        {
+            return -1;
+        }
+        bits = pool->activeBits[word];
+    }
+}
@@ -0,0 +1,91 @@
+/*! \file entityPool.h
+ *
+ * \section entityPool_design Design Philosophy
+ *
+ * This is a fixed-capacity slot allocator for game entities. It does not own the entities themselves, just which
+ * slots of the game's entity array are in use, so any entity struct can be used with it.
+ *
+ * Slot occupancy is kept in a packed bitmap instead of in each entity struct. Finding a free slot or the next live
+ * entity reads a few words of bitmap rather than striding across every (large) entity struct, so spawning is
+ * effectively O(1) and update loops skip dead slots without touching them. The lowest free slot is always handed out
+ * first, and iteration is always in ascending slot order, so draw and update order is the same as scanning the array.
+ *
+ * Together with a per-game archetype table, this replaces the linear free-slot scans and per-type constructors the
+ * games used to have.
+ *
+ * \section entityPool_usage Usage
+ *
+ * Call entityPoolInit() once with the size of the entity array, and entityPoolDeinit() when done.
+ *
+ * Call entityPoolAlloc() to claim a slot and entityPoolFree() to release it. entityPoolAllocAt() claims a specific
+ * slot.
+ *
+ * Iterate over live slots with entityPoolNext(). Entities spawned during iteration at higher slots are visited in the
+ * same pass.
+ *
+ * \section entityPool_example Example
+ *
+ * \code{.c}
+ * entityPool_t pool;
+ * entity_t entities[MAX_ENTITIES];
+ * entityPoolInit(&pool, MAX_ENTITIES);
+ *
+ * // Spawn
+ * int32_t slot = entityPoolAlloc(&pool);
+ * if (slot >= 0)
+ * {
+ *     initEntity(&entities[slot]);
+ * }
+ *
+ * // Update all live entities
+ * for (int32_t i = entityPoolNext(&pool, -1); i >= 0; i = entityPoolNext(&pool, i))
+ * {
+ *     updateEntity(&entities[i]);
+ * }
+ *
+ * // Despawn
+ * entityPoolFree(&pool, slot);
+ *
+ * entityPoolDeinit(&pool);
+ * \endcode
+ */
+
+#ifndef _ENTITY_POOL_H_
+#define _ENTITY_POOL_H_
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * @brief A fixed-capacity entity slot allocator
+ */
+typedef struct
+{
+    uint16_t capacity;    ///< The number of slots
+    uint16_t numActive;   ///< The number of slots in use
+    uint16_t bitmapWords; ///< The number of words in activeBits
+    uint32_t* activeBits; ///< A bitmap of slots in use
+} entityPool_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+void entityPoolInit(entityPool_t* pool, uint16_t capacity);
+void entityPoolDeinit(entityPool_t* pool);
+void entityPoolClear(entityPool_t* pool);
+int32_t entityPoolAlloc(entityPool_t* pool);
+bool entityPoolAllocAt(entityPool_t* pool, uint16_t slot);
+void entityPoolFree(entityPool_t* pool, uint16_t slot);
+bool entityPoolIsActive(const entityPool_t* pool, uint16_t slot);
+int32_t entityPoolNext(const entityPool_t* pool, int32_t prev);
+
+#endif
@@ -3,6 +3,7 @@
 //==============================================================================
 
 #include <stdint.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdlib.h>
 
@@ -11,7 +12,14 @@
 #include <esp_now.h>
 #include <esp_wifi.h>
 
+#ifndef EMULATOR
+    #include <freertos/FreeRTOS.h>
+    #include <freertos/semphr.h>
+#endif
+
 #include "hdw-esp-now.h"
+#include "linked_list.h"
+#include "macros.h"
 #include "p2pConnection.h"
 
 //==============================================================================
@@ -26,6 +34,18 @@
 // (240 steps of rotation + (252/4) steps of decay) * 12ms
 #define FAILURE_RESTART_US 8000000
 
+// Retransmit bulk fragments which haven't been acknowledged after this long
+#define WIN_RTO_US 15000
+
+// Retransmit a bulk fragment early if a later fragment was acknowledged and this one was sent at least this long ago
+#define WIN_FAST_RTX_US 3000
+
+// Wait this long for outgoing bulk data to piggyback an acknowledgement on before sending a standalone one
+#define WIN_ACK_DELAY_US 2000
+
+// Send a standalone acknowledgement at least every this many in-order bulk fragments
+#define WIN_ACK_EVERY 2
+
 // #define P2P_DEBUG
 #ifdef P2P_DEBUG
 static const char* P2P_TAG = "P2P";
@@ -34,6 +54,86 @@ static const char* P2P_TAG = "P2P";
     #define P2P_LOG(...)
 #endif
 
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * @brief A queued bulk message waiting to be transmitted and acknowledged
+ */
+typedef struct
+{
+    uint8_t* data;            ///< A copy of the message
+    uint16_t len;             ///< The length of the message
+    uint8_t numFrags;         ///< The number of fragments the message is split into
+    uint8_t fragsAcked;       ///< The number of fragments which have been acknowledged
+    p2pBulkTxCbFn bulkTxCbFn; ///< Called when the message is acknowledged or fails
+} p2pWinTxMsg_t;
+
+/**
+ * @brief A bulk fragment which has been assigned a sequence number and is in flight
+ */
+typedef struct
+{
+    p2pWinTxMsg_t* msg; ///< The message this fragment belongs to, NULL if the slot is empty
+    uint8_t fragIdx;    ///< The index of this fragment within its message
+    bool acked;         ///< true if this fragment has been acknowledged
+    int64_t sentUs;     ///< The time this fragment was last transmitted, 0 if it should be transmitted again
+} p2pWinTxSlot_t;
+
+/**
+ * @brief A bulk fragment which was received out of order and is waiting for the fragments before it
+ */
+typedef struct
+{
+    bool received;                  ///< true if this slot holds a fragment
+    uint8_t fragIdx;                ///< The index of this fragment within its message
+    uint8_t numFrags;               ///< The number of fragments in this fragment's message
+    uint8_t len;                    ///< The length of this fragment
+    uint8_t data[P2P_WIN_FRAG_LEN]; ///< The fragment's data bytes
+} p2pWinRxSlot_t;
+
+/**
+ * @brief The windowed transport state. Both slot arrays are indexed by sequence number modulo ::P2P_WIN_SIZE
+ */
+struct p2pWindow
+{
+    // Transmit state
+    list_t txQueue;                  ///< Queued ::p2pWinTxMsg_t, oldest first
+    node_t* txNextNode;              ///< The oldest queued message with fragments which haven't been sent yet
+    uint8_t txNextFrag;              ///< The next fragment of txNextNode to send
+    uint16_t txBase;                 ///< The oldest unacknowledged sequence number
+    uint16_t txNextSeq;              ///< The sequence number to assign to the next new fragment
+    uint8_t txEpoch;                 ///< Incremented every time a transfer fails so the receiver can start over
+    p2pWinTxSlot_t tx[P2P_WIN_SIZE]; ///< Fragments in flight
+    int64_t lastProgressUs;          ///< The last time an acknowledgement moved the transfer forward
+    int64_t radioBusyUs;             ///< The time the last frame was handed to ESP-NOW
+    bool retryArmed;                 ///< true while tmr.WinRetry is running
+
+    // Receive state
+    uint16_t rxNextSeq;              ///< The next in-order sequence number expected
+    uint8_t rxEpoch;                 ///< The epoch of the fragments being received
+    uint8_t rxAckPending;            ///< The number of in-order fragments received since the last acknowledgement
+    bool rxAckNow;                   ///< true if an acknowledgement should be sent without waiting
+    p2pWinRxSlot_t rx[P2P_WIN_SIZE]; ///< Fragments received out of order
+    uint8_t* rxMsg;                  ///< The message being reassembled
+    uint16_t rxMsgLen;               ///< The number of bytes reassembled so far
+    uint8_t rxNextFrag;              ///< The next fragment index expected for rxMsg
+    uint8_t rxNumFrags;              ///< The number of fragments in rxMsg, from its first fragment
+};
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+#ifndef EMULATOR
+/// Held while any windowed transport state is used, including p2pInfo.win itself. The main loop, the timer task, and
+/// the receive path may each use it. It's recursive so bulk callbacks may queue more messages. It's never deleted, so a
+/// timer callback waiting for it while the window is freed wakes up and finds p2pInfo.win is NULL. The emulator runs
+/// all of those on its main thread
+static SemaphoreHandle_t p2pWinMutex = NULL;
+#endif
+
 //==============================================================================
 // Function Prototypes
 //==============================================================================
@@ -46,11 +146,28 @@ static void p2pRestartTmrCb(void* arg);
 static void p2pStartRestartTimer(void* arg);
 static void p2pProcConnectionEvt(p2pInfo* p2p, connectionEvt_t event);
 static void p2pGameStartAckRecv(p2pInfo* p2p, const uint8_t* data, uint8_t dataLen);
-static void p2pSendAckToMac(p2pInfo* p2p, const uint8_t* mac_addr);
+static void p2pSendAckToMac(p2pInfo* p2p, const uint8_t* mac_addr, uint8_t seqNum);
 static void p2pSendMsgEx(p2pInfo* p2p, uint8_t* msg, uint16_t len, bool shouldAck, p2pAckSuccessFn success,
                          p2pAckFailureFn failure);
 static void p2pModeMsgSuccess(p2pInfo* p2p, const uint8_t* data, uint8_t dataLen);
 static void p2pModeMsgFailure(p2pInfo* p2p);
+static p2pWindow_t* p2pWinAlloc(void);
+static void p2pWinFree(p2pInfo* p2p);
+static void p2pWinLock(void);
+static void p2pWinUnlock(void);
+static void p2pWinBuildHdr(p2pInfo* p2p, p2pWinMsg_t* msg, p2pMsgType_t type);
+static void p2pWinSendAck(p2pInfo* p2p);
+static void p2pWinSendFrag(p2pInfo* p2p, uint16_t seq, p2pWinTxSlot_t* slot);
+static void p2pWinPump(p2pInfo* p2p);
+static bool p2pWinAckSlot(p2pWindow_t* win, uint16_t seq);
+static void p2pWinProcAck(p2pInfo* p2p, uint16_t ackSeq, uint8_t sackBits, uint8_t ackEpoch);
+static void p2pWinFailAll(p2pInfo* p2p);
+static void p2pWinRecv(p2pInfo* p2p, const uint8_t* data, uint8_t len);
+static void p2pWinRecvFrag(p2pInfo* p2p, const p2pWinMsg_t* msg, uint8_t fragLen);
+static void p2pWinReassemble(p2pInfo* p2p, uint8_t fragIdx, uint8_t numFrags, const uint8_t* data, uint8_t len);
+static void p2pWinRetryTimeout(void* arg);
+static void p2pWinRetry(p2pInfo* p2p);
+static void p2pWinAckTimeout(void* arg);
 
 //==============================================================================
 // Functions
@@ -154,6 +271,29 @@ void p2pInitialize(p2pInfo* p2p, uint8_t modeId, p2pConCbFn conCbFn, p2pMsgRxCbF
         .skip_unhandled_events = false,
     };
     esp_timer_create(&p2pConnectionTimeoutArgs, &p2p->tmr.Connection);
+
+    // Set up a timer to retransmit unacknowledged bulk fragments
+    esp_timer_create_args_t p2pWinRetryTimeoutArgs = {
+        .callback              = p2pWinRetryTimeout,
+        .arg                   = p2p,
+        .dispatch_method       = ESP_TIMER_TASK,
+        .name                  = "p2pt_wr",
+        .skip_unhandled_events = false,
+    };
+    esp_timer_create(&p2pWinRetryTimeoutArgs, &p2p->tmr.WinRetry);
+
+    // Set up a timer to send delayed bulk acknowledgements
+    esp_timer_create_args_t p2pWinAckTimeoutArgs = {
+        .callback              = p2pWinAckTimeout,
+        .arg                   = p2p,
+        .dispatch_method       = ESP_TIMER_TASK,
+        .name                  = "p2pt_wa",
+        .skip_unhandled_events = false,
+    };
+    esp_timer_create(&p2pWinAckTimeoutArgs, &p2p->tmr.WinAck);
+
+    // Set up the windowed transport now rather than when it's first used, so its lock exists before any task uses it
+    p2p->win = p2pWinAlloc();
 }
 
 /**
@@ -200,7 +340,11 @@ void p2pDeinit(p2pInfo* p2p)
         esp_timer_stop(p2p->tmr.TxRetry);
         esp_timer_stop(p2p->tmr.Reinit);
         esp_timer_stop(p2p->tmr.TxAllRetries);
+        esp_timer_stop(p2p->tmr.WinRetry);
+        esp_timer_stop(p2p->tmr.WinAck);
     }
+
+    p2pWinFree(p2p);
 }
 
 /**
@@ -376,8 +520,11 @@ static void p2pSendMsgEx(p2pInfo* p2p, uint8_t* msg, uint16_t len, bool shouldAc
     P2P_LOG("%s", dbgStr);
 #endif
 
-    // If this is a first time message and longer than a connection message
-    if (((void*)&(p2p->ack.msgToAck) != (void*)msg) && sizeof(p2pConMsg_t) < len)
+    // If this is a first time message and longer than a connection message. Acknowledgements already have the
+    // sequence number of the message they acknowledge
+    p2pMsgType_t msgType = ((const p2pConMsg_t*)msg)->messageType;
+    if (((void*)&(p2p->ack.msgToAck) != (void*)msg) && sizeof(p2pConMsg_t) < len && P2P_MSG_ACK != msgType
+        && P2P_MSG_DATA_ACK != msgType)
     {
         // Insert a sequence number
         ((p2pCommonHeader_t*)msg)->seqNum = p2p->cnc.mySeqNum;
@@ -484,17 +631,31 @@ void p2pRecvCb(p2pInfo* p2p, const uint8_t* mac_addr, const uint8_t* data, uint8
         return;
     }
 
+    // Windowed packets have their own sequence numbers and acknowledgements
+    if (len >= sizeof(p2pCommonHeader_t)
+        && (P2P_MSG_WIN_DATA == p2pHdr->messageType || P2P_MSG_WIN_ACK == p2pHdr->messageType))
+    {
+        if (p2p->cnc.isConnected)
+        {
+            p2pWinRecv(p2p, data, len);
+        }
+        return;
+    }
+
+    // Check if this is an ACK
+    bool isAck = (P2P_MSG_ACK == p2pHdr->messageType) || (P2P_MSG_DATA_ACK == p2pHdr->messageType);
+
     // By here, we know the received message matches our message ID, either a
     // broadcast or for us. If this isn't an ack message, ack it
-    if (len >= sizeof(p2pCommonHeader_t) && p2pHdr->messageType != P2P_MSG_ACK
-        && p2pHdr->messageType != P2P_MSG_DATA_ACK)
+    if (len >= sizeof(p2pCommonHeader_t) && !isAck)
     {
-        p2pSendAckToMac(p2p, mac_addr);
+        p2pSendAckToMac(p2p, mac_addr, p2pHdr->seqNum);
     }
 
     // After ACKing the message, check the sequence number to see if we should
-    // process it or ignore it (we already did!)
-    if (len >= sizeof(p2pCommonHeader_t))
+    // process it or ignore it (we already did!). ACKs have the sequence number of the message they acknowledge, which
+    // is from this Swadge's sequence, so they're checked against that instead
+    if (len >= sizeof(p2pCommonHeader_t) && !isAck)
     {
         // Check it against the last known sequence number
         if (p2pHdr->seqNum == p2p->cnc.lastSeqNum)
@@ -509,11 +670,9 @@ void p2pRecvCb(p2pInfo* p2p, const uint8_t* mac_addr, const uint8_t* data, uint8
         }
     }
 
-    // Check if this is an ACK
-    bool isAck = (P2P_MSG_ACK == p2pHdr->messageType) || (P2P_MSG_DATA_ACK == p2pHdr->messageType);
-
-    // ACKs can be received in any state
-    if (p2p->ack.isWaitingForAck && isAck)
+    // ACKs can be received in any state. A late ACK for an earlier transmission, or for a retry of one, doesn't
+    // acknowledge the message being waited on
+    if (p2p->ack.isWaitingForAck && isAck && p2pHdr->seqNum == p2p->ack.msgToAck.hdr.seqNum)
     {
         P2P_LOG("ACK Received when waiting for one");
 
@@ -545,9 +704,10 @@ void p2pRecvCb(p2pInfo* p2p, const uint8_t* mac_addr, const uint8_t* data, uint8
         // Ack handled
         return;
     }
-    else if (p2p->ack.isWaitingForAck || isAck)
+    else if (isAck || (p2p->ack.isWaitingForAck && !p2p->cnc.isConnected))
     {
-        // Don't process anything else when waiting for or receiving an ack
+        // Don't process anything else when receiving an ack, or when waiting for one during the handshake. Once
+        // connected, a message was already acknowledged above, so it must be processed or it's lost
         return;
     }
 
@@ -649,14 +809,16 @@ void p2pClearDataInAck(p2pInfo* p2p)
  *
  * @param p2p      The p2pInfo struct with all the state information
  * @param mac_addr The MAC to address this ACK to
+ * @param seqNum   The sequence number of the message to acknowledge
  */
-static void p2pSendAckToMac(p2pInfo* p2p, const uint8_t* mac_addr)
+static void p2pSendAckToMac(p2pInfo* p2p, const uint8_t* mac_addr, uint8_t seqNum)
 {
     P2P_LOG("%s", __func__);
 
-    // Write the destination MAC address
+    // Write the destination MAC address and the sequence number being acknowledged
     // Everything else should already be written
     memcpy(p2p->ackMsg.hdr.macAddr, mac_addr, sizeof(p2p->ackMsg.hdr.macAddr));
+    p2p->ackMsg.hdr.seqNum = seqNum;
     // Send the ACK
     p2pSendMsgEx(p2p, (uint8_t*)&p2p->ackMsg, sizeof(p2pCommonHeader_t) + p2p->dataInAckLen, false, NULL, NULL);
 }
@@ -793,10 +955,12 @@ static void p2pRestart(p2pInfo* p2p)
         p2p->conCbFn(p2p, CON_LOST);
     }
 
-    uint8_t modeId         = p2p->modeId;
-    uint8_t incomingModeId = p2p->incomingModeId;
+    uint8_t modeId           = p2p->modeId;
+    uint8_t incomingModeId   = p2p->incomingModeId;
+    p2pBulkRxCbFn bulkRxCbFn = p2p->bulkRxCbFn;
     p2pDeinit(p2p);
     p2pInitialize(p2p, modeId, p2p->conCbFn, p2p->msgRxCbFn, p2p->connectionRssi);
+    p2p->bulkRxCbFn = bulkRxCbFn;
 
     if (incomingModeId != modeId)
     {
@@ -862,6 +1026,16 @@ void p2pSendCb(p2pInfo* p2p, const uint8_t* mac_addr __attribute__((unused)), es
             break;
         }
     }
+
+    // The radio is free, so send the next bulk fragment if there is one. This runs in the WiFi task on a Swadge, which
+    // shouldn't wait on the window or send from here, so the retry timer sends it instead. A failed fragment is
+    // retransmitted when it times out. The emulator treats a 0 timeout as stopped, so it's 1us
+    if (p2p->winRadioBusy)
+    {
+        p2p->winRadioBusy = false;
+        esp_timer_stop(p2p->tmr.WinRetry);
+        esp_timer_start_once(p2p->tmr.WinRetry, 1);
+    }
 }
 
 /**
@@ -894,3 +1068,715 @@ void p2pSetPlayOrder(p2pInfo* p2p, playOrder_t order)
 {
     p2p->cnc.playOrder = order;
 }
+
+//==============================================================================
+// Windowed Transport
+//==============================================================================
+
+/**
+ * @brief Queue a message to be sent to the other Swadge through the windowed transport. This must not be called before
+ * the CON_ESTABLISHED event occurs. The message is copied, split into fragments, and sent with up to ::P2P_WIN_SIZE
+ * fragments in flight. Lost fragments are retransmitted until the whole message is acknowledged or no progress has been
+ * made for three seconds. Messages are delivered to the other Swadge's ::p2pBulkRxCbFn in the order they were queued
+ *
+ * @param p2p        The p2pInfo struct with all the state information
+ * @param payload    A byte array to be copied and sent
+ * @param len        The length of the byte array, at most ::P2P_BULK_MAX_LEN
+ * @param bulkTxCbFn A callback function when this message is acknowledged or dropped. May be NULL
+ * @return true if the message was queued, false if not connected, the message is too long, or memory ran out
+ */
+bool p2pSendBulk(p2pInfo* p2p, const uint8_t* payload, uint16_t len, p2pBulkTxCbFn bulkTxCbFn)
+{
+    P2P_LOG("%s", __func__);
+
+    if (!p2p->cnc.isConnected || len > P2P_BULK_MAX_LEN || (NULL == payload && 0 != len))
+    {
+        return false;
+    }
+
+    // Copy the message so the caller doesn't have to keep it around
+    p2pWinTxMsg_t* msg = calloc(1, sizeof(p2pWinTxMsg_t));
+    if (NULL == msg)
+    {
+        return false;
+    }
+    if (0 != len)
+    {
+        msg->data = malloc(len);
+        if (NULL == msg->data)
+        {
+            free(msg);
+            return false;
+        }
+        memcpy(msg->data, payload, len);
+    }
+    msg->len        = len;
+    msg->numFrags   = MAX(1, (len + P2P_WIN_FRAG_LEN - 1) / P2P_WIN_FRAG_LEN);
+    msg->bulkTxCbFn = bulkTxCbFn;
+
+    p2pWinLock();
+    p2pWindow_t* win = p2p->win;
+    if (NULL == win)
+    {
+        p2pWinUnlock();
+        free(msg->data);
+        free(msg);
+        return false;
+    }
+
+    // The retry deadline counts from when the transport has something to do
+    if (0 == win->txQueue.length)
+    {
+        win->lastProgressUs = esp_timer_get_time();
+    }
+
+    push(&win->txQueue, msg);
+    if (NULL == win->txNextNode)
+    {
+        win->txNextNode = win->txQueue.last;
+        win->txNextFrag = 0;
+    }
+
+    p2pWinPump(p2p);
+    p2pWinUnlock();
+    return true;
+}
+
+/**
+ * @brief Set the callback function which receives reassembled bulk messages sent with p2pSendBulk()
+ *
+ * @param p2p        The p2pInfo struct with all the state information
+ * @param bulkRxCbFn A function pointer which will be called when a bulk message is received
+ */
+void p2pSetBulkRxCb(p2pInfo* p2p, p2pBulkRxCbFn bulkRxCbFn)
+{
+    p2p->bulkRxCbFn = bulkRxCbFn;
+}
+
+/**
+ * @brief Allocate the windowed transport state
+ *
+ * @return The windowed transport state, or NULL if it couldn't be allocated
+ */
+static p2pWindow_t* p2pWinAlloc(void)
+{
+#ifndef EMULATOR
+    // The first p2pInitialize() is on the main loop, before any timer which could race it exists
+    if (NULL == p2pWinMutex && NULL == (p2pWinMutex = xSemaphoreCreateRecursiveMutex()))
+    {
+        return NULL;
+    }
+#endif
+    return calloc(1, sizeof(p2pWindow_t));
+}
+
+/**
+ * @brief Free the windowed transport state and any queued messages without calling their callbacks. The timers must
+ * already be stopped
+ *
+ * A timer callback which was already running may be waiting for the lock. The window is detached from p2p with the lock
+ * held, so when that callback gets the lock it finds NULL and returns
+ *
+ * @param p2p The p2pInfo struct with all the state information
+ */
+static void p2pWinFree(p2pInfo* p2p)
+{
+    p2pWinLock();
+
+    p2pWindow_t* win  = p2p->win;
+    p2p->win          = NULL;
+    p2p->winRadioBusy = false;
+    if (NULL != win)
+    {
+        p2pWinTxMsg_t* msg;
+        while (NULL != (msg = shift(&win->txQueue)))
+        {
+            free(msg->data);
+            free(msg);
+        }
+        free(win->rxMsg);
+        free(win);
+    }
+
+    p2pWinUnlock();
+}
+
+/**
+ * @brief Take the windowed transport's lock. It must be held while p2pInfo.win or the window state is used
+ */
+static void p2pWinLock(void)
+{
+#ifndef EMULATOR
+    if (NULL != p2pWinMutex)
+    {
+        xSemaphoreTakeRecursive(p2pWinMutex, portMAX_DELAY);
+    }
+#endif
+}
+
+/**
+ * @brief Give back the windowed transport's lock
+ */
+static void p2pWinUnlock(void)
+{
+#ifndef EMULATOR
+    if (NULL != p2pWinMutex)
+    {
+        xSemaphoreGiveRecursive(p2pWinMutex);
+    }
+#endif
+}
+
+/**
+ * @brief Build the header for a windowed packet, including the acknowledgement for received fragments. Because every
+ * windowed packet carries an acknowledgement, any pending delayed acknowledgement is cancelled
+ *
+ * @param p2p  The p2pInfo struct with all the state information
+ * @param msg  The packet to write the header into
+ * @param type Either ::P2P_MSG_WIN_DATA or ::P2P_MSG_WIN_ACK
+ */
+static void p2pWinBuildHdr(p2pInfo* p2p, p2pWinMsg_t* msg, p2pMsgType_t type)
+{
+    p2pWindow_t* win = p2p->win;
+
+    msg->hdr.startByte   = P2P_START_BYTE;
+    msg->hdr.modeId      = p2p->modeId;
+    msg->hdr.messageType = type;
+    msg->hdr.seqNum      = 0;
+    memcpy(msg->hdr.macAddr, p2p->cnc.otherMac, sizeof(msg->hdr.macAddr));
+
+    msg->seq      = 0;
+    msg->epoch    = win->txEpoch;
+    msg->fragIdx  = 0;
+    msg->numFrags = 0;
+
+    // Cumulatively acknowledge everything in order, then selectively acknowledge what's buffered after the gap
+    msg->ackSeq   = win->rxNextSeq;
+    msg->ackEpoch = win->rxEpoch;
+    msg->sackBits = 0;
+    for (uint8_t i = 0; i < P2P_WIN_SIZE - 1; i++)
+    {
+        if (win->rx[(uint16_t)(win->rxNextSeq + 1 + i) % P2P_WIN_SIZE].received)
+        {
+            msg->sackBits |= (1 << i);
+        }
+    }
+
+    win->rxAckPending = 0;
+    win->rxAckNow     = false;
+    esp_timer_stop(p2p->tmr.WinAck);
+}
+
+/**
+ * @brief Send a standalone acknowledgement for received bulk fragments
+ *
+ * @param p2p The p2pInfo struct with all the state information
+ */
+static void p2pWinSendAck(p2pInfo* p2p)
+{
+    p2pWinMsg_t msg;
+    p2pWinBuildHdr(p2p, &msg, P2P_MSG_WIN_ACK);
+    espNowSend((const char*)&msg, offsetof(p2pWinMsg_t, data));
+}
+
+/**
+ * @brief Transmit a bulk fragment. The fragment is copied straight from the queued message into the packet
+ *
+ * @param p2p  The p2pInfo struct with all the state information
+ * @param seq  The fragment's sequence number
+ * @param slot The fragment to transmit
+ */
+static void p2pWinSendFrag(p2pInfo* p2p, uint16_t seq, p2pWinTxSlot_t* slot)
+{
+    p2pWindow_t* win = p2p->win;
+
+    uint16_t offset  = slot->fragIdx * P2P_WIN_FRAG_LEN;
+    uint16_t fragLen = MIN(P2P_WIN_FRAG_LEN, slot->msg->len - offset);
+
+    p2pWinMsg_t msg;
+    p2pWinBuildHdr(p2p, &msg, P2P_MSG_WIN_DATA);
+    msg.seq      = seq;
+    msg.fragIdx  = slot->fragIdx;
+    msg.numFrags = slot->msg->numFrags;
+    if (0 != fragLen)
+    {
+        memcpy(msg.data, &slot->msg->data[offset], fragLen);
+    }
+
+    slot->sentUs      = esp_timer_get_time();
+    win->radioBusyUs  = slot->sentUs;
+    p2p->winRadioBusy = true;
+    espNowSend((const char*)&msg, offsetof(p2pWinMsg_t, data) + fragLen);
+}
+
+/**
+ * @brief Transmit the next bulk fragment if the radio is free. Retransmissions go first so the window can slide, then
+ * new fragments if the window has room. ESP-NOW's send callback kicks tmr.WinRetry, which calls this again, so
+ * fragments go out back to back without waiting for acknowledgements. The emulator calls the send callback
+ * synchronously, so the loop here sends the next fragment right away. The lock must be held
+ *
+ * @param p2p The p2pInfo struct with all the state information
+ */
+static void p2pWinPump(p2pInfo* p2p)
+{
+    p2pWindow_t* win = p2p->win;
+    if (NULL == win)
+    {
+        return;
+    }
+
+    while (!p2p->winRadioBusy)
+    {
+        p2pWinTxSlot_t* slot = NULL;
+        uint16_t seq;
+
+        // Look for a fragment which needs to be retransmitted
+        for (seq = win->txBase; seq != win->txNextSeq; seq++)
+        {
+            p2pWinTxSlot_t* txSlot = &win->tx[seq % P2P_WIN_SIZE];
+            if (!txSlot->acked && 0 == txSlot->sentUs)
+            {
+                slot = txSlot;
+                break;
+            }
+        }
+
+        // Otherwise assign a sequence number to a new fragment
+        if (NULL == slot && NULL != win->txNextNode && (uint16_t)(win->txNextSeq - win->txBase) < P2P_WIN_SIZE)
+        {
+            seq           = win->txNextSeq++;
+            slot          = &win->tx[seq % P2P_WIN_SIZE];
+            slot->msg     = win->txNextNode->val;
+            slot->fragIdx = win->txNextFrag++;
+            slot->acked   = false;
+
+            // Move to the next message after the last fragment
+            if (win->txNextFrag == slot->msg->numFrags)
+            {
+                win->txNextNode = win->txNextNode->next;
+                win->txNextFrag = 0;
+            }
+        }
+
+        if (NULL == slot)
+        {
+            break;
+        }
+        p2pWinSendFrag(p2p, seq, slot);
+    }
+
+    // Keep checking for timeouts while anything is outstanding
+    if (!win->retryArmed && 0 != win->txQueue.length)
+    {
+        win->retryArmed = true;
+        esp_timer_start_once(p2p->tmr.WinRetry, WIN_RTO_US);
+    }
+}
+
+/**
+ * @brief Mark an in-flight fragment as acknowledged
+ *
+ * @param win The windowed transport state
+ * @param seq The sequence number of the fragment
+ * @return true if the fragment was newly acknowledged, false if it already was or isn't in flight
+ */
+static bool p2pWinAckSlot(p2pWindow_t* win, uint16_t seq)
+{
+    p2pWinTxSlot_t* slot = &win->tx[seq % P2P_WIN_SIZE];
+    if (NULL != slot->msg && !slot->acked)
+    {
+        slot->acked = true;
+        slot->msg->fragsAcked++;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Process an acknowledgement for transmitted bulk fragments, slide the window, and finish any messages which
+ * are completely acknowledged
+ *
+ * @param p2p      The p2pInfo struct with all the state information
+ * @param ackSeq   All fragments before this sequence number were received
+ * @param sackBits Bit n is set if fragment (ackSeq + 1 + n) was received
+ * @param ackEpoch The epoch of the acknowledged fragments
+ */
+static void p2pWinProcAck(p2pInfo* p2p, uint16_t ackSeq, uint8_t sackBits, uint8_t ackEpoch)
+{
+    p2pWindow_t* win = p2p->win;
+
+    // Ignore acknowledgements from before a failure, or for fragments which aren't in flight
+    uint16_t inFlight = win->txNextSeq - win->txBase;
+    if (ackEpoch != win->txEpoch || (uint16_t)(ackSeq - win->txBase) > inFlight)
+    {
+        return;
+    }
+
+    int64_t tNowUs = esp_timer_get_time();
+    bool progress  = false;
+
+    // Cumulative acknowledgement
+    for (uint16_t seq = win->txBase; seq != ackSeq; seq++)
+    {
+        progress |= p2pWinAckSlot(win, seq);
+    }
+
+    // Selective acknowledgement
+    uint16_t highestSacked = ackSeq;
+    for (uint8_t i = 0; i < P2P_WIN_SIZE - 1; i++)
+    {
+        uint16_t seq = ackSeq + 1 + i;
+        if ((sackBits & (1 << i)) && (uint16_t)(seq - win->txBase) < inFlight)
+        {
+            progress |= p2pWinAckSlot(win, seq);
+            highestSacked = seq;
+        }
+    }
+
+    // Anything unacknowledged before a selectively acknowledged fragment was probably lost, so retransmit it now
+    // rather than waiting for it to time out
+    for (uint16_t seq = ackSeq; seq != highestSacked; seq++)
+    {
+        p2pWinTxSlot_t* slot = &win->tx[seq % P2P_WIN_SIZE];
+        if (!slot->acked && 0 != slot->sentUs && tNowUs - slot->sentUs >= WIN_FAST_RTX_US)
+        {
+            slot->sentUs = 0;
+        }
+    }
+
+    // Slide the window past acknowledged fragments
+    while (win->txBase != win->txNextSeq && win->tx[win->txBase % P2P_WIN_SIZE].acked)
+    {
+        memset(&win->tx[win->txBase % P2P_WIN_SIZE], 0, sizeof(p2pWinTxSlot_t));
+        win->txBase++;
+    }
+
+    if (progress)
+    {
+        win->lastProgressUs = tNowUs;
+    }
+
+    // Finish messages in the order they were queued
+    while (NULL != win->txQueue.first)
+    {
+        p2pWinTxMsg_t* msg = win->txQueue.first->val;
+        if (msg->fragsAcked != msg->numFrags)
+        {
+            break;
+        }
+        shift(&win->txQueue);
+
+        if (NULL != msg->bulkTxCbFn)
+        {
+            msg->bulkTxCbFn(p2p, MSG_ACKED, msg->len);
+        }
+        free(msg->data);
+        free(msg);
+    }
+}
+
+/**
+ * @brief Give up on all queued bulk messages after no progress has been made for too long. The epoch is incremented
+ * so the receiver starts over with the next message rather than waiting for the abandoned fragments
+ *
+ * @param p2p The p2pInfo struct with all the state information
+ */
+static void p2pWinFailAll(p2pInfo* p2p)
+{
+    P2P_LOG("%s", __func__);
+
+    p2pWindow_t* win = p2p->win;
+
+    // Detach the queue before calling callbacks so they may queue new messages
+    list_t failed = win->txQueue;
+    memset(&win->txQueue, 0, sizeof(win->txQueue));
+    memset(win->tx, 0, sizeof(win->tx));
+    win->txNextNode = NULL;
+    win->txNextFrag = 0;
+    win->txBase     = 0;
+    win->txNextSeq  = 0;
+    win->txEpoch++;
+
+    p2pWinTxMsg_t* msg;
+    while (NULL != (msg = shift(&failed)))
+    {
+        if (NULL != msg->bulkTxCbFn)
+        {
+            msg->bulkTxCbFn(p2p, MSG_FAILED, msg->len);
+        }
+        free(msg->data);
+        free(msg);
+    }
+}
+
+/**
+ * @brief Process a received windowed packet. Every windowed packet carries an acknowledgement, and data packets also
+ * carry a fragment
+ *
+ * @param p2p  The p2pInfo struct with all the state information
+ * @param data The received packet
+ * @param len  The length of the received packet
+ */
+static void p2pWinRecv(p2pInfo* p2p, const uint8_t* data, uint8_t len)
+{
+    // Copy the packet so the 16 bit fields are aligned
+    p2pWinMsg_t msg;
+    if (len < offsetof(p2pWinMsg_t, data) || len > sizeof(msg))
+    {
+        return;
+    }
+    memcpy(&msg, data, len);
+
+    p2pWinLock();
+    p2pWindow_t* win = p2p->win;
+    if (NULL == win)
+    {
+        p2pWinUnlock();
+        return;
+    }
+
+    p2pWinProcAck(p2p, msg.ackSeq, msg.sackBits, msg.ackEpoch);
+
+    if (P2P_MSG_WIN_DATA == msg.hdr.messageType)
+    {
+        p2pWinRecvFrag(p2p, &msg, len - offsetof(p2pWinMsg_t, data));
+    }
+
+    // The acknowledgement may have opened the window. Any fragment sent now carries the acknowledgement for the
+    // fragment just received
+    p2pWinPump(p2p);
+
+    if (win->rxAckNow)
+    {
+        p2pWinSendAck(p2p);
+    }
+    else if (1 == win->rxAckPending)
+    {
+        esp_timer_start_once(p2p->tmr.WinAck, WIN_ACK_DELAY_US);
+    }
+
+    p2pWinUnlock();
+}
+
+/**
+ * @brief Process a received bulk fragment. In-order fragments are reassembled immediately, out-of-order fragments are
+ * buffered until the gap before them is filled
+ *
+ * @param p2p     The p2pInfo struct with all the state information
+ * @param msg     The received packet
+ * @param fragLen The length of the fragment in the packet
+ */
+static void p2pWinRecvFrag(p2pInfo* p2p, const p2pWinMsg_t* msg, uint8_t fragLen)
+{
+    p2pWindow_t* win = p2p->win;
+
+    if (msg->epoch != win->rxEpoch)
+    {
+        if ((int8_t)(msg->epoch - win->rxEpoch) < 0)
+        {
+            // A stale fragment from before the sender gave up
+            return;
+        }
+
+        // The sender gave up and started over, so start over too
+        win->rxEpoch   = msg->epoch;
+        win->rxNextSeq = 0;
+        memset(win->rx, 0, sizeof(win->rx));
+        free(win->rxMsg);
+        win->rxMsg = NULL;
+    }
+
+    if (0 == msg->numFrags || msg->fragIdx >= msg->numFrags)
+    {
+        return;
+    }
+
+    uint16_t offset = msg->seq - win->rxNextSeq;
+    if (offset >= P2P_WIN_SIZE)
+    {
+        // A duplicate, so the acknowledgement was probably lost
+        win->rxAckNow = true;
+    }
+    else if (0 == offset)
+    {
+        p2pWinReassemble(p2p, msg->fragIdx, msg->numFrags, msg->data, fragLen);
+        win->rxNextSeq++;
+
+        // Reassemble anything buffered after it
+        bool filledGap = false;
+        p2pWinRxSlot_t* slot;
+        while ((slot = &win->rx[win->rxNextSeq % P2P_WIN_SIZE])->received)
+        {
+            p2pWinReassemble(p2p, slot->fragIdx, slot->numFrags, slot->data, slot->len);
+            slot->received = false;
+            win->rxNextSeq++;
+            filledGap = true;
+        }
+
+        // Acknowledge every few fragments, or right away if a gap was filled so the sender can slide its window
+        if (++win->rxAckPending >= WIN_ACK_EVERY || filledGap)
+        {
+            win->rxAckNow = true;
+        }
+    }
+    else
+    {
+        p2pWinRxSlot_t* slot = &win->rx[msg->seq % P2P_WIN_SIZE];
+        if (!slot->received)
+        {
+            slot->received = true;
+            slot->fragIdx  = msg->fragIdx;
+            slot->numFrags = msg->numFrags;
+            slot->len      = fragLen;
+            memcpy(slot->data, msg->data, fragLen);
+        }
+
+        // A gap means something was lost, so tell the sender right away
+        win->rxAckNow = true;
+    }
+}
+
+/**
+ * @brief Append a fragment to the message being reassembled and deliver the message once it's complete
+ *
+ * @param p2p      The p2pInfo struct with all the state information
+ * @param fragIdx  The index of this fragment within its message
+ * @param numFrags The number of fragments in the message
+ * @param data     The fragment's data bytes
+ * @param len      The length of the fragment
+ */
+static void p2pWinReassemble(p2pInfo* p2p, uint8_t fragIdx, uint8_t numFrags, const uint8_t* data, uint8_t len)
+{
+    p2pWindow_t* win = p2p->win;
+
+    if (0 == fragIdx)
+    {
+        // Single fragment messages are delivered straight from the packet
+        free(win->rxMsg);
+        win->rxMsg      = (1 < numFrags) ? malloc(numFrags * P2P_WIN_FRAG_LEN) : NULL;
+        win->rxMsgLen   = 0;
+        win->rxNextFrag = 0;
+        win->rxNumFrags = numFrags;
+
+        if (1 == numFrags)
+        {
+            if (NULL != p2p->bulkRxCbFn)
+            {
+                p2p->bulkRxCbFn(p2p, data, len);
+            }
+            return;
+        }
+    }
+
+    // Fragments arrive in order, so this only happens if memory ran out
+    if (NULL == win->rxMsg || fragIdx != win->rxNextFrag)
+    {
+        return;
+    }
+
+    // The buffer was sized by the first fragment, so give up on a message which doesn't agree with it
+    if (numFrags != win->rxNumFrags || win->rxMsgLen + len > win->rxNumFrags * P2P_WIN_FRAG_LEN)
+    {
+        free(win->rxMsg);
+        win->rxMsg = NULL;
+        return;
+    }
+
+    memcpy(&win->rxMsg[win->rxMsgLen], data, len);
+    win->rxMsgLen += len;
+    win->rxNextFrag++;
+
+    if (win->rxNextFrag == win->rxNumFrags)
+    {
+        // Detach the message before the callback in case it sends or receives more
+        uint8_t* rxMsg = win->rxMsg;
+        win->rxMsg     = NULL;
+        if (NULL != p2p->bulkRxCbFn)
+        {
+            p2p->bulkRxCbFn(p2p, rxMsg, win->rxMsgLen);
+        }
+        free(rxMsg);
+    }
+}
+
+/**
+ * @brief Check for bulk fragments to retransmit with the windowed transport's lock held
+ *
+ * Called from the tmr.WinRetry timer, which runs while any bulk message is queued
+ *
+ * @param arg The p2pInfo struct with all the state information
+ */
+static void p2pWinRetryTimeout(void* arg)
+{
+    p2pInfo* p2p = (p2pInfo*)arg;
+
+    // The window may be freed while this waits for the lock, so only check for it once the lock is held
+    p2pWinLock();
+    if (NULL != p2p->win)
+    {
+        p2pWinRetry(p2p);
+    }
+    p2pWinUnlock();
+}
+
+/**
+ * @brief Retransmit bulk fragments which haven't been acknowledged in time, or give up on all queued bulk messages if
+ * no progress has been made for too long. The lock must be held
+ *
+ * @param p2p The p2pInfo struct with all the state information
+ */
+static void p2pWinRetry(p2pInfo* p2p)
+{
+    p2pWindow_t* win = p2p->win;
+    win->retryArmed  = false;
+
+    if (0 == win->txQueue.length)
+    {
+        return;
+    }
+
+    int64_t tNowUs = esp_timer_get_time();
+    if (tNowUs - win->lastProgressUs > RETRY_TIME_US)
+    {
+        p2pWinFailAll(p2p);
+        return;
+    }
+
+    for (uint16_t seq = win->txBase; seq != win->txNextSeq; seq++)
+    {
+        p2pWinTxSlot_t* slot = &win->tx[seq % P2P_WIN_SIZE];
+        if (!slot->acked && 0 != slot->sentUs && tNowUs - slot->sentUs >= WIN_RTO_US)
+        {
+            slot->sentUs = 0;
+        }
+    }
+
+    // Don't wait forever for a send callback which isn't coming
+    if (p2p->winRadioBusy && tNowUs - win->radioBusyUs >= WIN_RTO_US)
+    {
+        p2p->winRadioBusy = false;
+    }
+
+    // This rearms the timer
+    p2pWinPump(p2p);
+}
+
+/**
+ * @brief Send a delayed acknowledgement for bulk fragments which wasn't piggybacked on outgoing data
+ *
+ * Called from the tmr.WinAck timer
+ *
+ * @param arg The p2pInfo struct with all the state information
+ */
+static void p2pWinAckTimeout(void* arg)
+{
+    p2pInfo* p2p = (p2pInfo*)arg;
+
+    // The window may be freed while this waits for the lock, so only check for it once the lock is held
+    p2pWinLock();
+    if (NULL != p2p->win && 0 != p2p->win->rxAckPending)
+    {
+        p2pWinSendAck(p2p);
+    }
+    p2pWinUnlock();
+}
@@ -89,6 +89,15 @@
  * message will retry until it receives the acknowledge. p2pClearDataInAck() can be called to clear the data to be sent
  * in the acknowledge.
  *
+ * p2pSendBulk() can be called to send a message of up to #P2P_BULK_MAX_LEN bytes through the windowed transport, which
+ * is much faster than p2pSendMsg() for large transfers. Bulk messages are queued, split into fragments of
+ * #P2P_WIN_FRAG_LEN bytes, and up to #P2P_WIN_SIZE fragments are in flight at once instead of waiting for each one to
+ * be acknowledged. Every fragment has its own sequence number. The receiver acknowledges fragments cumulatively and
+ * selectively (with a bitmask of out-of-order fragments it already has), so only lost fragments are retransmitted.
+ * Acknowledgements are delayed briefly and piggybacked on any bulk data going the other way. The receiving Swadge
+ * reassembles fragments in order and delivers whole messages to the callback set with p2pSetBulkRxCb(). Bulk messages
+ * and p2pSendMsg() messages may be used in the same session, but they are not ordered relative to each other.
+ *
  * \section p2p_tips Tips
  *
  * p2pConnection can be finicky to use, so here are a few tips to ensure consistent connections and data transfer.
@@ -123,7 +132,8 @@
  * -# p2pSendMsg() does not queue messages, so if you try to send multiple messages without first receiving the transmit
  * callback (#p2pMsgTxCbFn), then only the last sent message will be sent successfully. Instead, you should either
  * combine data into a single packet (which is preferred, fewer larger packets tend to be faster) or wait for a
- * transmission to completely finish before starting the next.
+ * transmission to completely finish before starting the next. p2pSendBulk() does queue messages, so it's a better fit
+ * for streams of data or anything larger than #P2P_MAX_DATA_LEN.
  *
  * \section p2p_example Example
  *
@@ -197,6 +207,15 @@
 /// The maximum payload of a p2p packet is 245 bytes
 #define P2P_MAX_DATA_LEN 245
 
+/// The number of bulk fragments which may be in flight before the oldest one is acknowledged
+#define P2P_WIN_SIZE 8
+
+/// The payload of each bulk fragment, ESP-NOW's 250 byte limit minus the 19 byte windowed header
+#define P2P_WIN_FRAG_LEN 231
+
+/// The maximum length of a bulk message, limited by the 8 bit fragment count
+#define P2P_BULK_MAX_LEN (P2P_WIN_FRAG_LEN * 255)
+
 /// After connecting, one Swadge will be ::GOING_FIRST and one will be ::GOING_SECOND
 typedef enum
 {
@@ -252,6 +271,25 @@ typedef void (*p2pMsgRxCbFn)(p2pInfo* p2p, const uint8_t* payload, uint8_t len);
  */
 typedef void (*p2pMsgTxCbFn)(p2pInfo* p2p, messageStatus_t status, const uint8_t* data, uint8_t len);
 
+/**
+ * @brief This typedef is for the function callback which delivers reassembled bulk messages to the Swadge mode
+ *
+ * @param p2p The p2pInfo
+ * @param payload The message that was received. It is only valid for the duration of the callback
+ * @param len The length of the message that was received
+ */
+typedef void (*p2pBulkRxCbFn)(p2pInfo* p2p, const uint8_t* payload, uint16_t len);
+
+/**
+ * @brief This typedef is for the function callback which delivers the status of a transmitted bulk message to the
+ * Swadge mode. It's called once every fragment of the message is acknowledged, or when the transfer fails
+ *
+ * @param p2p The p2pInfo
+ * @param status The status of the transmission
+ * @param len The length of the message that was transmitted
+ */
+typedef void (*p2pBulkTxCbFn)(p2pInfo* p2p, messageStatus_t status, uint16_t len);
+
 /**
  * @brief This typedef is for a function callback called when a message is acknowledged.
  * It make also contain a data packet which was appended to the ACK.
@@ -273,7 +311,7 @@ typedef void (*p2pAckFailureFn)(p2pInfo* p2p);
 #define P2P_START_BYTE 'p'
 
 /**
- * @brief The five different types of p2p messages
+ * @brief The seven different types of p2p messages
  */
 typedef enum __attribute__((packed))
 {
@@ -281,7 +319,9 @@ typedef enum __attribute__((packed))
     P2P_MSG_START,    ///< The start message, used during connection
     P2P_MSG_ACK,      ///< An acknowledge message
     P2P_MSG_DATA_ACK, ///< An acknowledge message with extra data
-    P2P_MSG_DATA      ///< A data message
+    P2P_MSG_DATA,     ///< A data message
+    P2P_MSG_WIN_DATA, ///< A bulk message fragment, which also carries an acknowledgement for the other direction
+    P2P_MSG_WIN_ACK   ///< A standalone acknowledgement for bulk message fragments
 } p2pMsgType_t;
 
 /**
@@ -315,6 +355,28 @@ typedef struct
     uint8_t data[P2P_MAX_DATA_LEN]; ///< The data bytes sent or received
 } p2pDataMsg_t;
 
+/**
+ * @brief The byte format for a windowed P2P packet, either a bulk fragment or a standalone acknowledgement.
+ * Acknowledgements are sent without any data bytes
+ */
+typedef struct
+{
+    p2pCommonHeader_t hdr;          ///< The common header bytes for a P2P packet. The sequence number is unused
+    uint16_t seq;                   ///< The sequence number of this fragment
+    uint16_t ackSeq;                ///< Cumulative acknowledgement, all fragments before this one were received
+    uint8_t sackBits;               ///< Selective acknowledgement, bit n means fragment (ackSeq + 1 + n) was received
+    uint8_t epoch;                  ///< Incremented by the sender every time a bulk transfer fails and restarts
+    uint8_t ackEpoch;               ///< The epoch of the fragments being acknowledged
+    uint8_t fragIdx;                ///< The index of this fragment within its message
+    uint8_t numFrags;               ///< The number of fragments in this fragment's message
+    uint8_t data[P2P_WIN_FRAG_LEN]; ///< The fragment's data bytes
+} p2pWinMsg_t;
+
+_Static_assert(sizeof(p2pWinMsg_t) <= 250, "A bulk fragment must fit in one ESP-NOW packet");
+
+/// Windowed transport state, allocated the first time it's used
+typedef struct p2pWindow p2pWindow_t;
+
 /**
  * @brief All the state variables required for a P2P session with another Swadge
  */
@@ -330,9 +392,10 @@ typedef struct _p2pInfo
     uint8_t dataInAckLen;       ///< The length of any extra data which was appended to the ACK, see p2pSetDataInAck()
 
     // Callback function pointers
-    p2pConCbFn conCbFn;     ///< A callback function called during the connection process
-    p2pMsgRxCbFn msgRxCbFn; ///< A callback function called when receiving a message
-    p2pMsgTxCbFn msgTxCbFn; ///< A callback function called when transmitting a message
+    p2pConCbFn conCbFn;       ///< A callback function called during the connection process
+    p2pMsgRxCbFn msgRxCbFn;   ///< A callback function called when receiving a message
+    p2pMsgTxCbFn msgTxCbFn;   ///< A callback function called when transmitting a message
+    p2pBulkRxCbFn bulkRxCbFn; ///< A callback function called when receiving a bulk message, see p2pSetBulkRxCb()
 
     int8_t connectionRssi; ///< The minimum RSSI required to begin a connection
 
@@ -376,7 +439,12 @@ typedef struct _p2pInfo
         esp_timer_handle_t TxAllRetries; ///< A timer used to cancel a transmission if all attempts failed
         esp_timer_handle_t Connection;   ///< A timer used to cancel a connection if the handshake fails
         esp_timer_handle_t Reinit;       ///< A timer used to restart P2P after any complete failures
+        esp_timer_handle_t WinRetry;     ///< A timer used to retransmit unacknowledged bulk fragments
+        esp_timer_handle_t WinAck;       ///< A timer used to send a delayed acknowledgement for bulk fragments
     } tmr;
+
+    p2pWindow_t* win;           ///< The windowed transport state for bulk messages, NULL if it couldn't be allocated
+    volatile bool winRadioBusy; ///< true from handing a bulk fragment to ESP-NOW until its send callback
 } p2pInfo;
 
 /**
@@ -400,6 +468,8 @@ void p2pSendMsg(p2pInfo* p2p, const uint8_t* payload, uint16_t len, p2pMsgTxCbFn
 void p2pSendCb(p2pInfo* p2p, const uint8_t* mac_addr, esp_now_send_status_t status);
 void p2pRecvCb(p2pInfo* p2p, const uint8_t* mac_addr, const uint8_t* data, uint8_t len, int8_t rssi);
 void p2pSetDataInAck(p2pInfo* p2p, const uint8_t* ackData, uint8_t ackDataLen);
+bool p2pSendBulk(p2pInfo* p2p, const uint8_t* payload, uint16_t len, p2pBulkTxCbFn bulkTxCbFn);
+void p2pSetBulkRxCb(p2pInfo* p2p, p2pBulkRxCbFn bulkRxCbFn);
 void p2pClearDataInAck(p2pInfo* p2p);
 
 playOrder_t p2pGetPlayOrder(p2pInfo* p2p);
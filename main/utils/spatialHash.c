@@ -0,0 +1,192 @@
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "spatialHash.h"
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static inline uint16_t spatialHashBucket(const spatialHash_t* hash, int32_t cx, int32_t cy);
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Hash a cell coordinate into a bucket index
+ *
+ * @param hash The spatial hash
+ * @param cx The cell's X coordinate
+ * @param cy The cell's Y coordinate
+ * @return The index of the bucket this cell falls in
+ */
+static inline uint16_t spatialHashBucket(const spatialHash_t* hash, int32_t cx, int32_t cy)
+{
+    return (((uint32_t)cx * 73856093u) ^ ((uint32_t)cy * 19349663u)) & hash->bucketMask;
+}
+
+/**
+ * @brief Initialize a spatial hash and allocate its memory
+ *
+ * @param hash The spatial hash to initialize
+ * @param maxItems The maximum number of items. Item IDs must be less than this
+ * @param cellShift The size of a cell, as a power of two, in the same units as item coordinates
+ * @param numBuckets The number of buckets to hash cells into. This is rounded up to a power of two
+ */
+void spatialHashInit(spatialHash_t* hash, uint16_t maxItems, uint8_t cellShift, uint16_t numBuckets)
+{
+    uint16_t buckets = 1;
+    while (buckets < numBuckets)
+    {
+        buckets <<= 1;
+    }
+
+    hash->cellShift   = cellShift;
+    hash->bucketMask  = buckets - 1;
+    hash->maxItems    = maxItems;
+    hash->bitmapWords = (maxItems + 31) / 32;
+    hash->maxEntries  = maxItems * SPATIAL_HASH_MAX_CELLS;
+
+    hash->bucketHeads = malloc(buckets * sizeof(int16_t));
+    hash->entries     = malloc(hash->maxEntries * sizeof(spatialHashEntry_t));
+    hash->bigItems    = calloc(hash->bitmapWords, sizeof(uint32_t));
+    hash->scratch     = calloc(hash->bitmapWords, sizeof(uint32_t));
+
+    spatialHashClear(hash);
+}
+
+/**
+ * @brief Free memory allocated by a spatial hash
+ *
+ * @param hash The spatial hash to deinitialize
+ */
+void spatialHashDeinit(spatialHash_t* hash)
+{
+    free(hash->bucketHeads);
+    free(hash->entries);
+    free(hash->bigItems);
+    free(hash->scratch);
+    hash->bucketHeads = NULL;
+    hash->entries     = NULL;
+    hash->bigItems    = NULL;
+    hash->scratch     = NULL;
+}
+
+/**
+ * @brief Remove all items from a spatial hash
+ *
+ * @param hash The spatial hash to clear
+ */
+void spatialHashClear(spatialHash_t* hash)
+{
+    // -1 is all ones, so this sets every head to -1
+    memset(hash->bucketHeads, 0xFF, (hash->bucketMask + 1) * sizeof(int16_t));
+    memset(hash->bigItems, 0, hash->bitmapWords * sizeof(uint32_t));
+    hash->numEntries = 0;
+}
+
+/**
+ * @brief Insert an item into a spatial hash. If an item is inserted again before the hash is cleared, for instance when
+ * its ID is reused, its old cells are kept too. That only adds results which fail the caller's precise test
+ *
+ * @param hash The spatial hash to insert into
+ * @param item The item's ID, which is returned by queries. Must be less than the maxItems given at init
+ * @param x0 The left edge of the item's bounding box, inclusive
+ * @param y0 The top edge of the item's bounding box, inclusive
+ * @param x1 The right edge of the item's bounding box, inclusive
+ * @param y1 The bottom edge of the item's bounding box, inclusive
+ */
+void spatialHashInsert(spatialHash_t* hash, uint16_t item, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    if (item >= hash->maxItems)
+    {
+        return;
+    }
+
+    int32_t cx0 = x0 >> hash->cellShift;
+    int32_t cy0 = y0 >> hash->cellShift;
+    int32_t cx1 = x1 >> hash->cellShift;
+    int32_t cy1 = y1 >> hash->cellShift;
+
+    // Items covering too many cells, or which don't fit in the pool, go in the list returned by every query
+    int32_t numCells = (cx1 - cx0 + 1) * (cy1 - cy0 + 1);
+    if (numCells > SPATIAL_HASH_MAX_CELLS || hash->numEntries + numCells > hash->maxEntries)
+    {
+        hash->bigItems[item / 32] |= (1u << (item % 32));
+        return;
+    }
+
+    for (int32_t cy = cy0; cy <= cy1; cy++)
+    {
+        for (int32_t cx = cx0; cx <= cx1; cx++)
+        {
+            uint16_t bucket           = spatialHashBucket(hash, cx, cy);
+            spatialHashEntry_t* ent   = &hash->entries[hash->numEntries];
+            ent->item                 = item;
+            ent->next                 = hash->bucketHeads[bucket];
+            hash->bucketHeads[bucket] = hash->numEntries++;
+        }
+    }
+}
+
+/**
+ * @brief Find all items which may overlap a box
+ *
+ * Results are deduplicated and sorted by ascending item ID. They may include items which don't actually overlap the
+ * box, so the caller should do its own precise collision test.
+ *
+ * @param hash The spatial hash to query
+ * @param x0 The left edge of the query box, inclusive
+ * @param y0 The top edge of the query box, inclusive
+ * @param x1 The right edge of the query box, inclusive
+ * @param y1 The bottom edge of the query box, inclusive
+ * @param out An array to write item IDs to
+ * @param maxOut The size of the \c out array
+ * @return The number of item IDs written to \c out
+ */
+uint16_t spatialHashQuery(spatialHash_t* hash, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t* out,
+                          uint16_t maxOut)
+{
+    int32_t cx0 = x0 >> hash->cellShift;
+    int32_t cy0 = y0 >> hash->cellShift;
+    int32_t cx1 = x1 >> hash->cellShift;
+    int32_t cy1 = y1 >> hash->cellShift;
+
+    // Start with the items which are always returned
+    memcpy(hash->scratch, hash->bigItems, hash->bitmapWords * sizeof(uint32_t));
+
+    // Mark every item in every overlapped cell. Marking a bitmap deduplicates items spanning multiple cells.
+    for (int32_t cy = cy0; cy <= cy1; cy++)
+    {
+        for (int32_t cx = cx0; cx <= cx1; cx++)
+        {
+            int16_t idx = hash->bucketHeads[spatialHashBucket(hash, cx, cy)];
+            while (idx >= 0)
+            {
+                uint16_t item = hash->entries[idx].item;
+                hash->scratch[item / 32] |= (1u << (item % 32));
+                idx = hash->entries[idx].next;
+            }
+        }
+    }
+
+    // Read the bitmap back out in ascending order
+    uint16_t numOut = 0;
+    for (uint16_t word = 0; word < hash->bitmapWords; word++)
+    {
+        uint32_t bits = hash->scratch[word];
+        while (bits && numOut < maxOut)
+        {
+            uint8_t bit   = __builtin_ctz(bits);
+            out[numOut++] = word * 32 + bit;
+            bits &= bits - 1;
+        }
+    }
+
+    return numOut;
+}
@@ -0,0 +1,114 @@
+/*! \file spatialHash.h
+ *
+ * \section spatialHash_design Design Philosophy
+ *
+ * This is a uniform-grid spatial hash used as a collision broadphase. Space is divided into square cells, and each
+ * item is inserted into every cell its bounding box overlaps. Cells are hashed into a fixed number of buckets, so the
+ * size of the world doesn't matter and no memory is spent on empty space.
+ *
+ * A query returns every item sharing a cell with the query box. This is a superset of the items which actually
+ * overlap, so the caller should still do its own precise collision test on the results. Results are deduplicated and
+ * sorted by ascending item ID, so iterating over them visits items in the same order as iterating over the original
+ * array would.
+ *
+ * Items whose bounding box covers more than ::SPATIAL_HASH_MAX_CELLS cells are not hashed at all. Instead, they are
+ * returned from every query.
+ *
+ * The spatial hash does not track movement. It is meant to be cleared and rebuilt once per game tick, which is O(n),
+ * and then queried by each entity, which is O(k) in the number of nearby items rather than O(n).
+ *
+ * \section spatialHash_usage Usage
+ *
+ * Call spatialHashInit() once to allocate memory, and spatialHashDeinit() when done.
+ *
+ * Each tick, call spatialHashClear() and then spatialHashInsert() for every item. Item IDs are usually array indices.
+ *
+ * Call spatialHashQuery() to get nearby items.
+ *
+ * \section spatialHash_example Example
+ *
+ * \code{.c}
+ * spatialHash_t hash;
+ * spatialHashInit(&hash, MAX_ENTITIES, 5, 64);
+ *
+ * // Once per tick
+ * spatialHashClear(&hash);
+ * for (uint16_t i = 0; i < MAX_ENTITIES; i++)
+ * {
+ *     if (entities[i].active)
+ *     {
+ *         spatialHashInsert(&hash, i, entities[i].x0, entities[i].y0, entities[i].x1, entities[i].y1);
+ *     }
+ * }
+ *
+ * // For each entity
+ * uint16_t nearby[MAX_ENTITIES];
+ * uint16_t numNearby = spatialHashQuery(&hash, self->x0, self->y0, self->x1, self->y1, nearby, MAX_ENTITIES);
+ * for (uint16_t i = 0; i < numNearby; i++)
+ * {
+ *     // Precise collision test with entities[nearby[i]]
+ * }
+ *
+ * spatialHashDeinit(&hash);
+ * \endcode
+ */
+
+#ifndef _SPATIAL_HASH_H_
+#define _SPATIAL_HASH_H_
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+/// Items covering more cells than this are returned from every query rather than hashed
+#define SPATIAL_HASH_MAX_CELLS 4
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * @brief One item's membership in one cell
+ */
+typedef struct
+{
+    uint16_t item; ///< The ID of the item in this cell
+    int16_t next;  ///< The index of the next entry in the same bucket, or -1
+} spatialHashEntry_t;
+
+/**
+ * @brief A uniform-grid spatial hash
+ */
+typedef struct
+{
+    uint8_t cellShift;           ///< Cells are (1 << cellShift) units on a side
+    uint16_t bucketMask;         ///< The number of buckets, minus one
+    uint16_t maxItems;           ///< Item IDs must be less than this
+    uint16_t bitmapWords;        ///< The number of words in each item bitmap
+    int16_t* bucketHeads;        ///< The first entry in each bucket, or -1
+    spatialHashEntry_t* entries; ///< The pool of entries
+    uint16_t numEntries;         ///< The number of entries in use
+    uint16_t maxEntries;         ///< The number of entries in the pool
+    uint32_t* bigItems;          ///< A bitmap of items which are too big to hash
+    uint32_t* scratch;           ///< A bitmap used to deduplicate query results
+} spatialHash_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+void spatialHashInit(spatialHash_t* hash, uint16_t maxItems, uint8_t cellShift, uint16_t numBuckets);
+void spatialHashDeinit(spatialHash_t* hash);
+void spatialHashClear(spatialHash_t* hash);
+void spatialHashInsert(spatialHash_t* hash, uint16_t item, int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+uint16_t spatialHashQuery(spatialHash_t* hash, int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t* out,
+                          uint16_t maxOut);
+
+#endif
@@ -29,22 +29,16 @@ typedef struct
     paletteColor_t unselectedBg;
 } wheelItemInfo_t;
 
-typedef struct
-{
-    uint8_t drawOrder;
-    uint16_t x;
-    uint16_t y;
-    bool selected;
-    const wsg_t* wsg;
-    paletteColor_t bgColor;
-} wheelDrawInfo_t;
-
 //==============================================================================
 // Function Prototypes
 //==============================================================================
 
 static wheelItemInfo_t* findInfo(wheelMenuRenderer_t* renderer, const char* label);
 static int cmpDrawInfo(const void* a, const void* b);
+static void makeLayoutKey(const menu_t* menu, const wheelMenuRenderer_t* renderer, wheelLayoutKey_t* key);
+static void layoutWheelMenu(menu_t* menu, wheelMenuRenderer_t* renderer);
+static void drawWheelSettingDial(wheelMenuRenderer_t* renderer, const menuItem_t* curItem);
+static void fitWheelLabel(wheelMenuRenderer_t* renderer, const char* label);
 
 //==============================================================================
 // Functions
@@ -96,6 +90,7 @@ void deinitWheelMenu(wheelMenuRenderer_t* renderer)
         free(info);
     }
 
+    free(renderer->drawInfos);
     free(renderer);
 }
 
@@ -129,6 +124,7 @@ void wheelMenuSetItemInfo(wheelMenuRenderer_t* renderer, const char* label, cons
     info->icon     = icon;
     info->position = position;
     info->scroll   = scrollDir;
+    renderer->infoGen++;
 
     if (label == mnuBackStr)
     {
@@ -160,21 +156,128 @@ void wheelMenuSetItemColor(wheelMenuRenderer_t* renderer, const char* label, pal
 
     info->unselectedBg = unselectedBg;
     info->selectedBg   = selectedBg;
+    renderer->infoGen++;
 }
 
 /**
- * @brief TODO doc
+ * @brief Draw a wheel menu. The wheel is only laid out again when the menu, the selection or the renderer's settings
+ * change, so drawing an unchanged wheel doesn't search, sort or measure anything
  *
- * @param menu
- * @param renderer
- * @param elapsedUs
+ * @param menu The menu to draw
+ * @param renderer The renderer to draw with
+ * @param elapsedUs The time elapsed since this function was last called
  */
 void drawWheelMenu(menu_t* menu, wheelMenuRenderer_t* renderer, int64_t elapsedUs)
 {
-    node_t* node = menu->items->first;
+    wheelLayoutKey_t key;
+    makeLayoutKey(menu, renderer, &key);
+    if (!renderer->layoutValid || 0 != memcmp(&key, &renderer->layoutKey, sizeof(key)))
+    {
+        layoutWheelMenu(menu, renderer);
+
+        // Laying out may change the renderer's state, so key the layout afterwards
+        makeLayoutKey(menu, renderer, &renderer->layoutKey);
+        renderer->layoutValid = true;
+    }
 
-    // Draw background circle for the unselected area
-    // drawCircleFilled(renderer->x, renderer->y, renderer->unselR, renderer->unselBgColor);
+    menuItem_t* curItem = (menu->currentItem) ? menu->currentItem->val : NULL;
+    if (renderer->zoomed && curItem && !menuItemHasOptions(curItem) && menuItemIsSetting(curItem))
+    {
+        drawWheelSettingDial(renderer, curItem);
+    }
+
+    for (int i = 0; i < renderer->numDrawInfos; i++)
+    {
+        wheelDrawInfo_t* info = &renderer->drawInfos[i];
+        uint16_t r            = info->selected ? renderer->drawSelR : renderer->drawUnselR;
+        drawCircleFilled(info->x, info->y, r, info->bgColor);
+        if (info->wsg)
+        {
+            drawWsgSimple(info->wsg, info->x - info->wsg->w / 2, info->y - info->wsg->h / 2);
+        }
+        drawCircle(info->x, info->y, r, renderer->borderColor);
+    }
+
+    if (renderer->textBox)
+    {
+        char buffer[128]  = {0};
+        const char* label = menu->title;
+
+        if (renderer->touched)
+        {
+            label = menu->currentItem ? getMenuItemLabelText(buffer, sizeof(buffer) - 1, menu->currentItem->val)
+                                      : "Close Menu";
+        }
+        else if (renderer->zoomed)
+        {
+            if (renderer->zoomBackSelected)
+            {
+                label = mnuBackStr;
+            }
+            else
+            {
+                label = menu->currentItem ? getMenuItemLabelText(buffer, sizeof(buffer) - 1, menu->currentItem->val)
+                                          : mnuBackStr;
+            }
+        }
+
+        if (label != NULL)
+        {
+            // Only shorten the label again if it changed
+            if (0 != strcmp(label, renderer->label))
+            {
+                fitWheelLabel(renderer, label);
+            }
+
+            drawText(renderer->font, renderer->textColor, renderer->fitLabel,
+                     renderer->textBox->x + (renderer->textBox->width - renderer->fitLabelW) / 2,
+                     renderer->textBox->y + (renderer->textBox->height - renderer->font->height - 1) / 2);
+        }
+    }
+}
+
+/**
+ * @brief Fill in everything a wheel menu's layout depends on
+ *
+ * @param menu The menu being drawn
+ * @param renderer The renderer drawing it
+ * @param key Written with the layout key. Unused bytes are zeroed so keys can be compared with memcmp()
+ */
+static void makeLayoutKey(const menu_t* menu, const wheelMenuRenderer_t* renderer, wheelLayoutKey_t* key)
+{
+    memset(key, 0, sizeof(wheelLayoutKey_t));
+
+    const menuItem_t* curItem = (menu->currentItem) ? menu->currentItem->val : NULL;
+
+    key->menu             = menu;
+    key->currentItem      = menu->currentItem;
+    key->revision         = menu->revision;
+    key->numItems         = menu->items->length;
+    key->currentOpt       = curItem ? curItem->currentOpt : 0;
+    key->infoGen          = renderer->infoGen;
+    key->anchorAngle      = renderer->anchorAngle;
+    key->x                = renderer->x;
+    key->y                = renderer->y;
+    key->spokeR           = renderer->spokeR;
+    key->unselR           = renderer->unselR;
+    key->selR             = renderer->selR;
+    key->unselBgColor     = renderer->unselBgColor;
+    key->selBgColor       = renderer->selBgColor;
+    key->customBack       = renderer->customBack;
+    key->touched          = renderer->touched;
+    key->zoomed           = renderer->zoomed;
+    key->zoomBackSelected = renderer->zoomBackSelected;
+}
+
+/**
+ * @brief Work out where and in what order to draw each item of a wheel menu, and store it in the renderer
+ *
+ * @param menu The menu to lay out
+ * @param renderer The renderer to lay it out for
+ */
+static void layoutWheelMenu(menu_t* menu, wheelMenuRenderer_t* renderer)
+{
+    node_t* node = menu->items->first;
 
     // Add one for the convenience of looping
     uint16_t spokeR = renderer->spokeR;
@@ -202,8 +305,14 @@ void drawWheelMenu(menu_t* menu, wheelMenuRenderer_t* renderer, int64_t elapsedU
     }
 
     // Just figure out what to draw where, then draw them all
-    wheelDrawInfo_t drawInfos[ringItems + 1];
-    uint8_t curDraw = 0;
+    if (renderer->drawInfosCap < ringItems + 1)
+    {
+        free(renderer->drawInfos);
+        renderer->drawInfosCap = ringItems + 1;
+        renderer->drawInfos    = malloc(renderer->drawInfosCap * sizeof(wheelDrawInfo_t));
+    }
+    wheelDrawInfo_t* drawInfos = renderer->drawInfos;
+    uint8_t curDraw            = 0;
 
     if (renderer->zoomed)
     {
@@ -261,66 +370,6 @@ void drawWheelMenu(menu_t* menu, wheelMenuRenderer_t* renderer, int64_t elapsedU
             drawInfos[curDraw].bgColor = renderer->zoomBackSelected ? renderer->selBgColor : renderer->unselBgColor;
             curDraw++;
         }
-        else if (menuItemIsSetting(curItem))
-        {
-            drawCircleFilled(renderer->x, renderer->y, renderer->spokeR, renderer->unselBgColor);
-            drawCircle(renderer->x, renderer->y, renderer->spokeR, renderer->borderColor);
-            int tickStart = renderer->spokeR - 4;
-            int tickEnd   = renderer->spokeR;
-            int textR     = renderer->spokeR + 5;
-            uint16_t curAngle
-                = ((curItem->currentSetting - curItem->minSetting) * 180) / (curItem->maxSetting - curItem->minSetting)
-                  + 180;
-            char tickLabel[16];
-
-            // Draw tick marks
-            for (int i = curItem->minSetting; i <= curItem->maxSetting; i++)
-            {
-                // Offset
-                uint16_t tickAngle
-                    = ((i - curItem->minSetting) * -180) / (curItem->maxSetting - curItem->minSetting) + 180;
-                ESP_LOGD("Wheel", "tick angle: %" PRIu16, tickAngle);
-
-                // Start tick
-                uint16_t x0 = renderer->x + getCos1024(tickAngle) * tickStart / 1024;
-                uint16_t y0 = renderer->y - getSin1024(tickAngle) * tickStart / 1024;
-
-                // End tick
-                uint16_t x1 = renderer->x + getCos1024(tickAngle) * tickEnd / 1024;
-                uint16_t y1 = renderer->y - getSin1024(tickAngle) * tickEnd / 1024;
-
-                uint16_t textX = renderer->x + getCos1024(tickAngle) * textR / 1024;
-                uint16_t textY = renderer->y - getSin1024(tickAngle) * textR / 1024;
-
-                snprintf(tickLabel, sizeof(tickLabel), "%" PRIu8, i);
-                uint16_t textLen = textWidth(renderer->font, tickLabel) + 1;
-
-                textX += (getCos1024(tickAngle) - 1024) * textLen / 2048;
-                textY -= (getSin1024(tickAngle) + 1024) * renderer->font->height / 2048;
-
-                /*if ((tickAngle < 2 || tickAngle > 358) || (tickAngle > 88 && tickAngle < 92))
-                {
-                    // Vertical center
-                    textY -= renderer->font->height / 2;
-                }
-                else if (tickAngle < 180)
-                {
-                    // Justify upwards
-                    textY -= renderer->font->height;
-                }*/
-                // Otherwise this is fine
-
-                ESP_LOGD("Wheel", "tick loc: (%" PRIu16 ", %" PRIu16 ") ->  (%" PRIu16 ", %" PRIu16 ")", x0, y0, x1,
-                         y1);
-
-                drawLine(x0, y0, x1, y1, renderer->borderColor, 0);
-
-                drawText(renderer->font, c000, tickLabel, textX, textY);
-            }
-
-            drawLine(renderer->x, renderer->y, renderer->x + getCos1024(curAngle) * (tickStart - 2) / 1024,
-                     renderer->y + getSin1024(curAngle) * (tickStart - 2) / 1024, c500, 0);
-        }
     }
     else
     {
@@ -404,70 +453,105 @@ void drawWheelMenu(menu_t* menu, wheelMenuRenderer_t* renderer, int64_t elapsedU
         qsort(drawInfos, curDraw, sizeof(wheelDrawInfo_t), cmpDrawInfo);
     }
 
-    for (int i = 0; i < curDraw; i++)
-    {
-        wheelDrawInfo_t* info = &drawInfos[i];
-        drawCircleFilled(info->x, info->y, info->selected ? selR : unselR, info->bgColor);
-        if (info->wsg)
-        {
-            drawWsgSimple(info->wsg, info->x - info->wsg->w / 2, info->y - info->wsg->h / 2);
-        }
-        drawCircle(info->x, info->y, info->selected ? selR : unselR, renderer->borderColor);
-    }
+    renderer->numDrawInfos = curDraw;
+    renderer->drawUnselR   = unselR;
+    renderer->drawSelR     = selR;
+}
 
-    if (renderer->textBox)
+/**
+ * @brief Draw the dial for a zoomed-in setting item. This depends on the setting's current value, so it's drawn every
+ * frame rather than laid out
+ *
+ * @param renderer The renderer to draw with
+ * @param curItem The setting item to draw the dial for
+ */
+static void drawWheelSettingDial(wheelMenuRenderer_t* renderer, const menuItem_t* curItem)
+{
+    drawCircleFilled(renderer->x, renderer->y, renderer->spokeR, renderer->unselBgColor);
+    drawCircle(renderer->x, renderer->y, renderer->spokeR, renderer->borderColor);
+    int tickStart = renderer->spokeR - 4;
+    int tickEnd   = renderer->spokeR;
+    int textR     = renderer->spokeR + 5;
+    uint16_t curAngle
+        = ((curItem->currentSetting - curItem->minSetting) * 180) / (curItem->maxSetting - curItem->minSetting) + 180;
+    char tickLabel[16];
+
+    // Draw tick marks
+    for (int i = curItem->minSetting; i <= curItem->maxSetting; i++)
     {
-        char buffer[128]  = {0};
-        const char* label = menu->title;
+        // Offset
+        uint16_t tickAngle = ((i - curItem->minSetting) * -180) / (curItem->maxSetting - curItem->minSetting) + 180;
+        ESP_LOGD("Wheel", "tick angle: %" PRIu16, tickAngle);
 
-        if (renderer->touched)
+        // Start tick
+        uint16_t x0 = renderer->x + getCos1024(tickAngle) * tickStart / 1024;
+        uint16_t y0 = renderer->y - getSin1024(tickAngle) * tickStart / 1024;
+
+        // End tick
+        uint16_t x1 = renderer->x + getCos1024(tickAngle) * tickEnd / 1024;
+        uint16_t y1 = renderer->y - getSin1024(tickAngle) * tickEnd / 1024;
+
+        uint16_t textX = renderer->x + getCos1024(tickAngle) * textR / 1024;
+        uint16_t textY = renderer->y - getSin1024(tickAngle) * textR / 1024;
+
+        snprintf(tickLabel, sizeof(tickLabel), "%" PRIu8, i);
+        uint16_t textLen = textWidth(renderer->font, tickLabel) + 1;
+
+        textX += (getCos1024(tickAngle) - 1024) * textLen / 2048;
+        textY -= (getSin1024(tickAngle) + 1024) * renderer->font->height / 2048;
+
+        /*if ((tickAngle < 2 || tickAngle > 358) || (tickAngle > 88 && tickAngle < 92))
         {
-            label = menu->currentItem ? getMenuItemLabelText(buffer, sizeof(buffer) - 1, menu->currentItem->val)
-                                      : "Close Menu";
+            // Vertical center
+            textY -= renderer->font->height / 2;
         }
-        else if (renderer->zoomed)
+        else if (tickAngle < 180)
         {
-            if (renderer->zoomBackSelected)
-            {
-                label = mnuBackStr;
-            }
-            else
-            {
-                label = menu->currentItem ? getMenuItemLabelText(buffer, sizeof(buffer) - 1, menu->currentItem->val)
-                                          : mnuBackStr;
-            }
-        }
+            // Justify upwards
+            textY -= renderer->font->height;
+        }*/
+        // Otherwise this is fine
 
-        if (label != NULL)
-        {
-            uint16_t textW = textWidth(renderer->font, label);
+        ESP_LOGD("Wheel", "tick loc: (%" PRIu16 ", %" PRIu16 ") ->  (%" PRIu16 ", %" PRIu16 ")", x0, y0, x1, y1);
 
-            while (textW > renderer->textBox->width)
-            {
-                // Copy the real label first if we're using a static string
-                if (label != buffer)
-                {
-                    snprintf(buffer, sizeof(buffer) - 1, "%s", label);
-                    label = buffer;
-                }
+        drawLine(x0, y0, x1, y1, renderer->borderColor, 0);
 
-                char* ptr = buffer + strlen(buffer);
-                // Shorten the text by one, and add trailing
-                *ptr-- = '\0';
+        drawText(renderer->font, c000, tickLabel, textX, textY);
+    }
 
-                for (uint8_t i = 0; i < 3 && ptr > buffer; i++)
-                {
-                    *ptr-- = '.';
-                }
+    drawLine(renderer->x, renderer->y, renderer->x + getCos1024(curAngle) * (tickStart - 2) / 1024,
+             renderer->y + getSin1024(curAngle) * (tickStart - 2) / 1024, c500, 0);
+}
 
-                textW = textWidth(renderer->font, label);
-            }
+/**
+ * @brief Shorten a label with trailing dots until it fits in the wheel's text box, and store it in the renderer
+ *
+ * @param renderer The renderer to fit the label for
+ * @param label The label to fit
+ */
+static void fitWheelLabel(wheelMenuRenderer_t* renderer, const char* label)
+{
+    snprintf(renderer->label, sizeof(renderer->label), "%s", label);
 
-            drawText(renderer->font, renderer->textColor, label,
-                     renderer->textBox->x + (renderer->textBox->width - textW) / 2,
-                     renderer->textBox->y + (renderer->textBox->height - renderer->font->height - 1) / 2);
+    char* buffer = renderer->fitLabel;
+    snprintf(buffer, sizeof(renderer->fitLabel) - 1, "%s", label);
+
+    uint16_t textW = textWidth(renderer->font, buffer);
+    while (textW > renderer->textBox->width && buffer[0])
+    {
+        char* ptr = buffer + strlen(buffer) - 1;
+        // Shorten the text by one, and add trailing
+        *ptr-- = '\0';
+
+        for (uint8_t i = 0; i < 3 && ptr > buffer; i++)
+        {
+            *ptr-- = '.';
         }
+
+        textW = textWidth(renderer->font, buffer);
     }
+
+    renderer->fitLabelW = textW;
 }
 
 /**
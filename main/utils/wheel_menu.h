@@ -45,6 +45,44 @@ typedef enum
     SCROLL_HORIZ_R = SCROLL_HORIZ | SCROLL_REVERSE, ///< TODO doc
 } wheelScrollDir_t;
 
+/**
+ * @brief Where and how to draw one item of a menu wheel
+ */
+typedef struct
+{
+    uint8_t drawOrder;      ///< Items are drawn from highest to lowest draw order
+    uint16_t x;             ///< The X position of the item's center
+    uint16_t y;             ///< The Y position of the item's center
+    bool selected;          ///< Whether the item is drawn as selected
+    const wsg_t* wsg;       ///< The item's icon, or NULL for none
+    paletteColor_t bgColor; ///< The item's background color
+} wheelDrawInfo_t;
+
+/**
+ * @brief Everything a menu wheel's layout depends on. The layout is only rebuilt when this changes
+ */
+typedef struct
+{
+    const menu_t* menu;          ///< The menu which was laid out
+    const node_t* currentItem;   ///< The selected item
+    uint32_t revision;           ///< The menu's revision, which changes when items are added or removed
+    uint16_t numItems;           ///< The number of items in the menu
+    uint8_t currentOpt;          ///< The selected item's current option
+    uint32_t infoGen;            ///< The renderer's infoGen
+    uint16_t anchorAngle;        ///< The renderer's anchorAngle
+    uint16_t x;                  ///< The renderer's x
+    uint16_t y;                  ///< The renderer's y
+    uint16_t spokeR;             ///< The renderer's spokeR
+    uint16_t unselR;             ///< The renderer's unselR
+    uint16_t selR;               ///< The renderer's selR
+    paletteColor_t unselBgColor; ///< The renderer's unselBgColor
+    paletteColor_t selBgColor;   ///< The renderer's selBgColor
+    bool customBack;             ///< The renderer's customBack
+    bool touched;                ///< The renderer's touched
+    bool zoomed;                 ///< The renderer's zoomed
+    bool zoomBackSelected;       ///< The renderer's zoomBackSelected
+} wheelLayoutKey_t;
+
 /**
  * @brief Renderer for a menu wheel
  */
@@ -69,6 +107,18 @@ typedef struct
     bool zoomed;                 ///< Whether or not a settings item is selected
     bool zoomBackSelected;       ///< Whether or not the center is selected while zoomed
     uint8_t zoomValue;           ///< The current selected option/value if zoomed
+
+    uint32_t infoGen;            ///< Incremented whenever an item's info changes, to invalidate the layout
+    wheelLayoutKey_t layoutKey;  ///< What the current layout was built from
+    bool layoutValid;            ///< Whether layoutKey and the laid out items are valid
+    wheelDrawInfo_t* drawInfos;  ///< The laid out items, sorted in draw order
+    uint8_t numDrawInfos;        ///< The number of laid out items
+    uint8_t drawInfosCap;        ///< The number of items drawInfos has room for
+    uint16_t drawUnselR;         ///< The radius of unselected items in the current layout
+    uint16_t drawSelR;           ///< The radius of the selected item in the current layout
+    char label[128];             ///< The text box label the fitted label was made from
+    char fitLabel[128];          ///< The text box label, shortened to fit in the text box
+    uint16_t fitLabelW;          ///< The width of fitLabel, in pixels
 } wheelMenuRenderer_t;
 
 wheelMenuRenderer_t* initWheelMenu(const font_t* font, uint16_t anchorAngle, const rectangle_t* textBox);
@@ -0,0 +1,600 @@
+/**
+ * @file lumberjack_net_test.c
+ * @brief Play two Swadges' lumberjack versus states against each other over p2p and a lossy emulated ESP-NOW link
+ *
+ * Both Swadges run the real p2pConnection and lumberjackNet code in one process. ESP-NOW, esp_timer and the rest of
+ * the IDF they use are replaced here with a link which drops and delays packets like the emulator's
+ * `--espnow-loss` and `--espnow-latency`, and a clock which only moves when the test moves it, so a run is repeatable
+ * from its seed. The test passes if each Swadge ends up with the other's state and every enemy sent.
+ *
+ * Usage: lumberjack_net_test [loss percent] [latency ms] [seed]
+ */
+
+//==============================================================================
+// Includes
+//==============================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+#include <inttypes.h>
+
+#include <esp_timer.h>
+#include <esp_random.h>
+#include <esp_wifi.h>
+#include <esp_log.h>
+
+#include "hdw-esp-now.h"
+#include "p2pConnection.h"
+#include "lumberjackNet.h"
+
+//==============================================================================
+// Defines
+//==============================================================================
+
+/// The mode ID both Swadges connect with
+#define TEST_MODE_ID 0x15
+
+/// The RSSI of every delivered packet, strong enough to connect
+#define TEST_RSSI -40
+
+/// How far the clock moves between checks for packets and timers
+#define TEST_TICK_US 100
+
+/// How often each Swadge runs a game frame, which may change its state and sends a snapshot if it can
+#define TEST_FRAME_US 20000
+
+/// How long the Swadges have to connect before the test fails
+#define TEST_CONNECT_US 60000000
+
+/// How many game frames have events in them
+#define TEST_EVENT_FRAMES 500
+
+/// How many quiet game frames to wait for the states to converge
+#define TEST_DRAIN_FRAMES 5000
+
+/// How many timers the Swadges may create between them
+#define TEST_MAX_TIMERS 16
+
+/// How many packets may be in flight on the link at once. Packets beyond this are dropped.
+#define TEST_LINK_LEN 256
+
+/// The largest payload ESP-NOW can carry
+#define TEST_MAX_DATA 250
+
+//==============================================================================
+// Structs
+//==============================================================================
+
+/**
+ * @brief One Swadge. The sync state mirrors lumberjack_t's, and the true totals don't wrap, so they catch lost or
+ * doubled attacks
+ */
+typedef struct
+{
+    uint8_t mac[6];               ///< This Swadge's MAC address
+    p2pInfo p2p;                  ///< This Swadge's p2p connection
+    connectionEvt_t conStatus;    ///< The last connection event
+    lumberjackNetState_t local;   ///< This Swadge's state
+    lumberjackNetState_t acked;   ///< This Swadge's state as last acknowledged by the other Swadge
+    lumberjackNetState_t txFrame; ///< This Swadge's state as of the snapshot in flight
+    lumberjackNetState_t remote;  ///< The other Swadge's state
+    uint8_t seq;                  ///< The sequence number of the last snapshot sent
+    uint8_t remoteSeq;            ///< The sequence number of the last snapshot received
+    uint8_t unacked;              ///< The flags of the fields sent since the last acknowledged snapshot
+    bool txBusy;                  ///< true while a snapshot is waiting to be acknowledged
+    uint32_t enemiesSent;         ///< The true total of enemies sent
+    uint32_t enemiesRcvd;         ///< The true total of enemies received
+} netTestPeer_t;
+
+/**
+ * @brief A packet in flight on the emulated link
+ */
+typedef struct
+{
+    int64_t deliverAt;           ///< The time to deliver the packet at
+    int src;                     ///< The index of the sending Swadge
+    uint8_t len;                 ///< The length of the payload
+    uint8_t data[TEST_MAX_DATA]; ///< The payload
+} netTestPkt_t;
+
+//==============================================================================
+// Function Prototypes
+//==============================================================================
+
+static bool parseArg(const char* arg, long min, long max, long* out);
+static void runUntil(int64_t tUs);
+static void deliverPackets(void);
+static void fireTimers(void);
+static void gameFrame(netTestPeer_t* peer, bool events);
+static void syncState(netTestPeer_t* peer);
+static netTestPeer_t* getPeer(p2pInfo* p2p);
+static void testConCb(p2pInfo* p2p, connectionEvt_t evt);
+static void testMsgRxCb(p2pInfo* p2p, const uint8_t* payload, uint8_t len);
+static void testMsgTxCb(p2pInfo* p2p, messageStatus_t status, const uint8_t* data, uint8_t len);
+static bool statesEqual(const lumberjackNetState_t* a, const lumberjackNetState_t* b);
+static bool converged(void);
+
+//==============================================================================
+// Variables
+//==============================================================================
+
+/// The two Swadges
+static netTestPeer_t peers[2] = {
+    {.mac = {0x12, 0x12, 0x12, 0x12, 0x12, 0x12}},
+    {.mac = {0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB}},
+};
+
+/// The index of the Swadge whose code is running, so ESP-NOW and timers know which one they belong to. Set it before
+/// calling into either Swadge
+static int curPeer = 0;
+
+/// The emulated clock, in microseconds. It starts at 1 because a timer alarm of 0 means the timer is stopped
+static int64_t nowUs = 1;
+
+/// The percentage of packets to drop
+static long lossPct = 25;
+
+/// How long each packet is delayed, in microseconds
+static int64_t latencyUs = 0;
+
+/// The state of esp_random()
+static uint32_t randState = 1;
+
+/// Every timer either Swadge created. An alarm is the time the timer expires at, or 0 if it's stopped
+static struct esp_timer timers[TEST_MAX_TIMERS];
+
+/// The index of the Swadge which created each timer
+static int timerOwners[TEST_MAX_TIMERS];
+
+/// How many timers have been created
+static int numTimers = 0;
+
+/// Ring buffer of packets in flight. Latency is constant, so FIFO order is delivery order.
+static netTestPkt_t link[TEST_LINK_LEN];
+static int linkHead  = 0;
+static int linkCount = 0;
+
+/// true if either Swadge lost its connection after making it
+static bool conLost = false;
+
+//==============================================================================
+// Functions
+//==============================================================================
+
+/**
+ * @brief Connect two Swadges, play random versus events on both, then wait for their states to converge
+ *
+ * @param argc The number of arguments
+ * @param argv The optional loss percentage, latency in milliseconds, and random seed
+ * @return 0 if the states converged, 1 if they didn't, 2 if the arguments were bad
+ */
+int main(int argc, char** argv)
+{
+    long latencyMs = 0;
+    long seed      = 1;
+    if ((argc > 1 && !parseArg(argv[1], 0, 99, &lossPct)) || (argc > 2 && !parseArg(argv[2], 0, 1000, &latencyMs))
+        || (argc > 3 && !parseArg(argv[3], 1, UINT32_MAX, &seed)))
+    {
+        fprintf(stderr, "Usage: %s [loss percent, 0-99] [latency ms, 0-1000] [seed, 1-%" PRIu32 "]\n", argv[0],
+                UINT32_MAX);
+        return 2;
+    }
+    latencyUs = latencyMs * 1000;
+    randState = seed;
+
+    for (int p = 0; p < 2; p++)
+    {
+        netTestPeer_t* peer = &peers[p];
+        curPeer             = p;
+        p2pInitialize(&peer->p2p, TEST_MODE_ID, testConCb, testMsgRxCb, -70);
+        peer->local.lives = LUMBERJACK_NET_NO_LIVES;
+        peer->acked       = peer->local;
+        peer->txFrame     = peer->local;
+        peer->remote      = peer->local;
+    }
+
+    // Start the Swadges a moment apart, like two people would. If their first broadcasts cross, each waits for the
+    // other to acknowledge its start message and drops the other's
+    for (int p = 0; p < 2; p++)
+    {
+        curPeer = p;
+        p2pStartConnection(&peers[p].p2p);
+        runUntil(nowUs + TEST_TICK_US * (1 + esp_random() % 5000));
+    }
+
+    // Wait for both sides of the connection, as a mode must before sending anything
+    while (CON_ESTABLISHED != peers[0].conStatus || CON_ESTABLISHED != peers[1].conStatus)
+    {
+        if (nowUs > TEST_CONNECT_US)
+        {
+            printf("FAIL: not connected after %d s with %ld%% loss\n", TEST_CONNECT_US / 1000000, lossPct);
+            return 1;
+        }
+        runUntil(nowUs + TEST_TICK_US);
+
+        // p2p reinitializes itself when the handshake fails, and the mode starts it again
+        for (int p = 0; p < 2; p++)
+        {
+            if (CON_LOST == peers[p].conStatus)
+            {
+                curPeer = p;
+                p2pStartConnection(&peers[p].p2p);
+            }
+        }
+    }
+    int64_t connectedUs = nowUs;
+
+    int frame;
+    for (frame = 0; frame < TEST_EVENT_FRAMES + TEST_DRAIN_FRAMES && !conLost; frame++)
+    {
+        if (frame >= TEST_EVENT_FRAMES && converged())
+        {
+            break;
+        }
+
+        for (int p = 0; p < 2; p++)
+        {
+            curPeer = p;
+            gameFrame(&peers[p], frame < TEST_EVENT_FRAMES);
+        }
+        runUntil(nowUs + TEST_FRAME_US);
+    }
+
+    bool passed = !conLost && converged();
+    printf("%s: %ld%% loss, %ld ms latency, seed %ld, connected after %" PRId64 " ms, %s %d frames after the last "
+           "event, enemies sent %" PRIu32 "/%" PRIu32 " received %" PRIu32 "/%" PRIu32 "\n",
+           passed ? "PASS" : "FAIL", lossPct, latencyMs, seed, connectedUs / 1000,
+           passed ? "converged" : (conLost ? "connection lost" : "not converged"), frame - TEST_EVENT_FRAMES,
+           peers[0].enemiesSent, peers[1].enemiesSent, peers[1].enemiesRcvd, peers[0].enemiesRcvd);
+
+    for (int p = 0; p < 2; p++)
+    {
+        curPeer = p;
+        p2pDeinit(&peers[p].p2p);
+    }
+    return passed ? 0 : 1;
+}
+
+/**
+ * @brief Parse a decimal argument
+ *
+ * @param arg The argument
+ * @param min The smallest value allowed
+ * @param max The largest value allowed
+ * @param[out] out Written with the value if it's valid
+ * @return true if the argument was a number between min and max
+ */
+static bool parseArg(const char* arg, long min, long max, long* out)
+{
+    char* end;
+    errno    = 0;
+    long val = strtol(arg, &end, 10);
+    if (end == arg || '\0' != *end || 0 != errno || val < min || val > max)
+    {
+        return false;
+    }
+    *out = val;
+    return true;
+}
+
+/**
+ * @brief Move the clock forward, delivering packets and firing timers as it goes
+ *
+ * @param tUs The time to move the clock to
+ */
+static void runUntil(int64_t tUs)
+{
+    while (nowUs < tUs)
+    {
+        nowUs += TEST_TICK_US;
+        deliverPackets();
+        fireTimers();
+    }
+}
+
+/**
+ * @brief Deliver every packet on the link whose latency has passed to the Swadge it was sent to
+ */
+static void deliverPackets(void)
+{
+    while (linkCount && link[linkHead].deliverAt <= nowUs)
+    {
+        netTestPkt_t* pkt = &link[linkHead];
+        linkHead          = (linkHead + 1) % TEST_LINK_LEN;
+        linkCount--;
+
+        // The slot isn't reused until after the callback returns
+        curPeer = 1 - pkt->src;
+        p2pRecvCb(&peers[curPeer].p2p, peers[pkt->src].mac, pkt->data, pkt->len, TEST_RSSI);
+    }
+}
+
+/**
+ * @brief Call the callback of every timer which has expired, as the Swadge which created it
+ */
+static void fireTimers(void)
+{
+    for (int i = 0; i < numTimers; i++)
+    {
+        esp_timer_handle_t tmr = &timers[i];
+        if (0 != tmr->alarm && (int64_t)tmr->alarm <= nowUs)
+        {
+            // Stop it before calling the callback so the callback may restart it
+            tmr->alarm = 0;
+            curPeer    = timerOwners[i];
+            tmr->callback(tmr->arg);
+        }
+    }
+}
+
+/**
+ * @brief Run one game frame on a Swadge. Its state may change the same ways the game's does, then it sends a snapshot
+ * if it can
+ *
+ * @param peer The Swadge
+ * @param events true to change the state
+ */
+static void gameFrame(netTestPeer_t* peer, bool events)
+{
+    if (events)
+    {
+        switch (esp_random() % 4)
+        {
+            case 0:
+            {
+                peer->local.score += esp_random() % 1000;
+                break;
+            }
+            case 1:
+            {
+                peer->local.lives = esp_random() % 4;
+                break;
+            }
+            case 2:
+            {
+                peer->local.bumps++;
+                break;
+            }
+            default:
+            {
+                peer->local.attacks++;
+                for (int i = 0; i < LUMBERJACK_NET_ENEMY_TYPES; i++)
+                {
+                    uint8_t enemies = esp_random() % 3;
+                    peer->local.enemies[i] += enemies;
+                    peer->enemiesSent += enemies;
+                }
+                break;
+            }
+        }
+    }
+
+    syncState(peer);
+}
+
+/**
+ * @brief Send a snapshot of everything in a Swadge's state which changed since the other Swadge last acknowledged
+ * one, the same way lumberjackSyncState() does
+ *
+ * @param peer The Swadge
+ */
+static void syncState(netTestPeer_t* peer)
+{
+    if (peer->txBusy)
+    {
+        return;
+    }
+
+    uint8_t payload[LUMBERJACK_NET_MAX_LEN];
+    uint8_t len = lumberjackEncodeState(&peer->local, &peer->acked, peer->unacked, false, payload);
+    if (0 == payload[2])
+    {
+        return;
+    }
+    payload[1] = ++peer->seq;
+
+    peer->unacked |= payload[2];
+    peer->txFrame = peer->local;
+    peer->txBusy  = true;
+    p2pSendMsg(&peer->p2p, payload, len, testMsgTxCb);
+}
+
+/**
+ * @brief Find the Swadge a p2p connection belongs to
+ *
+ * @param p2p The p2p connection
+ * @return The Swadge
+ */
+static netTestPeer_t* getPeer(p2pInfo* p2p)
+{
+    return (p2p == &peers[0].p2p) ? &peers[0] : &peers[1];
+}
+
+/**
+ * @brief Track a Swadge's connection
+ *
+ * @param p2p The Swadge's p2p connection
+ * @param evt The connection event
+ */
+static void testConCb(p2pInfo* p2p, connectionEvt_t evt)
+{
+    netTestPeer_t* peer = getPeer(p2p);
+    if (CON_LOST == evt && CON_ESTABLISHED == peer->conStatus)
+    {
+        conLost = true;
+    }
+    peer->conStatus = evt;
+}
+
+/**
+ * @brief Apply a snapshot from the other Swadge and count the enemies it sent
+ *
+ * @param p2p The receiving Swadge's p2p connection
+ * @param payload The message
+ * @param len The length of the message
+ */
+static void testMsgRxCb(p2pInfo* p2p, const uint8_t* payload, uint8_t len)
+{
+    netTestPeer_t* peer = getPeer(p2p);
+    lumberjackNetEvents_t events;
+    if (len > 0 && STATE_MSG == payload[0]
+        && lumberjackApplyState(&peer->remote, &peer->remoteSeq, payload, len, &events))
+    {
+        for (int i = 0; i < LUMBERJACK_NET_ENEMY_TYPES; i++)
+        {
+            peer->enemiesRcvd += events.enemies[i];
+        }
+    }
+}
+
+/**
+ * @brief Note that a snapshot was acknowledged, so the next one only needs what changed since. A failed snapshot is
+ * covered by the next one, which is still relative to the last acknowledged one
+ *
+ * @param p2p The sending Swadge's p2p connection
+ * @param status Whether the snapshot was acknowledged
+ * @param data The snapshot
+ * @param len The length of the snapshot
+ */
+static void testMsgTxCb(p2pInfo* p2p, messageStatus_t status, const uint8_t* data, uint8_t len)
+{
+    netTestPeer_t* peer = getPeer(p2p);
+    if (MSG_ACKED == status)
+    {
+        peer->acked   = peer->txFrame;
+        peer->unacked = 0;
+    }
+    peer->txBusy = false;
+}
+
+/**
+ * @brief Compare two versus states field by field, since the structs may have padding
+ *
+ * @param a A state
+ * @param b Another state
+ * @return true if the states are the same
+ */
+static bool statesEqual(const lumberjackNetState_t* a, const lumberjackNetState_t* b)
+{
+    return a->score == b->score && a->lives == b->lives && a->bumps == b->bumps && a->attacks == b->attacks
+           && 0 == memcmp(a->enemies, b->enemies, sizeof(a->enemies));
+}
+
+/**
+ * @return true if each Swadge has the other's state and every enemy the other sent
+ */
+static bool converged(void)
+{
+    return statesEqual(&peers[0].local, &peers[1].remote) && statesEqual(&peers[1].local, &peers[0].remote)
+           && peers[0].enemiesSent == peers[1].enemiesRcvd && peers[1].enemiesSent == peers[0].enemiesRcvd;
+}
+
+//==============================================================================
+// Emulated IDF
+//==============================================================================
+
+/**
+ * @brief Put a packet from the running Swadge on the link to the other one, unless it's lost, then tell the sender it
+ * went out. Like the emulator, the send callback is called before this returns
+ *
+ * @param data The packet
+ * @param dataLen The length of the packet
+ */
+void espNowSend(const char* data, uint8_t dataLen)
+{
+    int src = curPeer;
+
+    if (dataLen <= TEST_MAX_DATA && (esp_random() % 100) >= lossPct && linkCount < TEST_LINK_LEN)
+    {
+        netTestPkt_t* pkt = &link[(linkHead + linkCount) % TEST_LINK_LEN];
+        pkt->deliverAt    = nowUs + latencyUs;
+        pkt->src          = src;
+        pkt->len          = dataLen;
+        memcpy(pkt->data, data, dataLen);
+        linkCount++;
+    }
+
+    uint8_t bcastMac[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    p2pSendCb(&peers[src].p2p, bcastMac, (dataLen <= TEST_MAX_DATA) ? ESP_NOW_SEND_SUCCESS : ESP_NOW_SEND_FAIL);
+    curPeer = src;
+}
+
+esp_err_t esp_wifi_get_mac(wifi_interface_t ifx, uint8_t mac[6])
+{
+    memcpy(mac, peers[curPeer].mac, sizeof(peers[curPeer].mac));
+    return ESP_OK;
+}
+
+uint32_t esp_random(void)
+{
+    // xorshift32, so runs are repeatable
+    randState ^= randState << 13;
+    randState ^= randState >> 17;
+    randState ^= randState << 5;
+    return randState;
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return nowUs;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle)
+{
+    // p2p never deletes its timers, and creates them again when it restarts, so reuse the old one
+    int i;
+    for (i = 0; i < numTimers; i++)
+    {
+        if (timers[i].callback == create_args->callback && timers[i].arg == create_args->arg)
+        {
+            break;
+        }
+    }
+
+    if (i == numTimers)
+    {
+        if (numTimers >= TEST_MAX_TIMERS)
+        {
+            return ESP_ERR_NO_MEM;
+        }
+        numTimers++;
+    }
+
+    timerOwners[i] = curPeer;
+    *out_handle    = &timers[i];
+    memset(*out_handle, 0, sizeof(struct esp_timer));
+    (*out_handle)->callback = create_args->callback;
+    (*out_handle)->arg      = create_args->arg;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    // Like the emulator, starting a running timer restarts it
+    timer->alarm = nowUs + timeout_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    timer->alarm = 0;
+    return ESP_OK;
+}
+
+void esp_log_write(esp_log_level_t level, const char* tag, const char* format, ...)
+{
+    if (level > ESP_LOG_INFO)
+    {
+        return;
+    }
+
+    va_list args;
+    va_start(args, format);
+    printf("%s: ", tag);
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+}
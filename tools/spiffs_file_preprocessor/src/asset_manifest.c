@@ -0,0 +1,163 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "asset_manifest.h"
+
+/* The first line of a manifest. Bump the number when processed output changes, so everything is processed again */
+#define MANIFEST_HEADER "spiffs_file_preprocessor manifest 2\n"
+
+/* FNV-1a, 64 bit */
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME        0x100000001b3ULL
+
+/**
+ * @brief Hash a file's contents
+ *
+ * @param fname The file to hash
+ * @param hash Written with the hash
+ * @return true if the file was read, false if it couldn't be
+ */
+bool hashFile(const char* fname, uint64_t* hash)
+{
+    FILE* fp = fopen(fname, "rb");
+    if (NULL == fp)
+    {
+        return false;
+    }
+
+    uint64_t h = FNV_OFFSET_BASIS;
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            h = (h ^ buf[i]) * FNV_PRIME;
+        }
+    }
+
+    bool ok = !ferror(fp);
+    fclose(fp);
+    *hash = h;
+    return ok;
+}
+
+/**
+ * @brief Load a manifest written by saveManifest(). If the file doesn't exist or is from a different version, the
+ * manifest is left empty and everything will be processed
+ *
+ * @param fname The manifest file
+ * @param manifest The manifest to load into, which should be zeroed
+ */
+void loadManifest(const char* fname, manifest_t* manifest)
+{
+    FILE* fp = fopen(fname, "rb");
+    if (NULL == fp)
+    {
+        return;
+    }
+
+    char line[1024];
+    if (fgets(line, sizeof(line), fp) && 0 == strcmp(line, MANIFEST_HEADER))
+    {
+        while (fgets(line, sizeof(line), fp))
+        {
+            /* Each line is a hash, the preprocessor's hash, and the path, separated by spaces */
+            char* toolHash = strchr(line, ' ');
+            char* path     = toolHash ? strchr(toolHash + 1, ' ') : NULL;
+            char* end      = strchr(line, '\n');
+            if (NULL == path || NULL == end)
+            {
+                continue;
+            }
+            *(path++) = 0;
+            *end      = 0;
+            addManifestEntry(manifest, path, strtoull(line, NULL, 16), strtoull(toolHash + 1, NULL, 16));
+        }
+    }
+
+    fclose(fp);
+}
+
+/**
+ * @brief Write a manifest to a file
+ *
+ * @param fname The manifest file
+ * @param manifest The manifest to write
+ * @return true if the manifest was written, false if it couldn't be
+ */
+bool saveManifest(const char* fname, const manifest_t* manifest)
+{
+    FILE* fp = fopen(fname, "wb");
+    if (NULL == fp)
+    {
+        return false;
+    }
+
+    fputs(MANIFEST_HEADER, fp);
+    for (int i = 0; i < manifest->count; i++)
+    {
+        fprintf(fp, "%016" PRIx64 " %016" PRIx64 " %s\n", manifest->entries[i].hash, manifest->entries[i].toolHash,
+                manifest->entries[i].path);
+    }
+    return 0 == fclose(fp);
+}
+
+/**
+ * @brief Find an input file in a manifest
+ *
+ * @param manifest The manifest
+ * @param path The input file's path
+ * @return The input file's entry, or NULL if it isn't in the manifest
+ */
+const manifestEntry_t* findManifestEntry(const manifest_t* manifest, const char* path)
+{
+    for (int i = 0; i < manifest->count; i++)
+    {
+        if (0 == strcmp(manifest->entries[i].path, path))
+        {
+            return &manifest->entries[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Add an input file to a manifest
+ *
+ * @param manifest The manifest
+ * @param path The input file's path, which is copied
+ * @param hash The hash of the input file's contents
+ * @param toolHash The hash of the preprocessor which processed it
+ */
+void addManifestEntry(manifest_t* manifest, const char* path, uint64_t hash, uint64_t toolHash)
+{
+    if (manifest->count == manifest->cap)
+    {
+        manifest->cap     = manifest->cap ? manifest->cap * 2 : 64;
+        manifest->entries = realloc(manifest->entries, manifest->cap * sizeof(manifestEntry_t));
+    }
+
+    manifestEntry_t* entry = &manifest->entries[manifest->count++];
+    entry->path            = malloc(strlen(path) + 1);
+    strcpy(entry->path, path);
+    entry->hash     = hash;
+    entry->toolHash = toolHash;
+}
+
+/**
+ * @brief Free a manifest's memory
+ *
+ * @param manifest The manifest to free
+ */
+void freeManifest(manifest_t* manifest)
+{
+    for (int i = 0; i < manifest->count; i++)
+    {
+        free(manifest->entries[i].path);
+    }
+    free(manifest->entries);
+    memset(manifest, 0, sizeof(manifest_t));
+}
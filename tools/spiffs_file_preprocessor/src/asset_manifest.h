@@ -0,0 +1,30 @@
+#ifndef _ASSET_MANIFEST_H_
+#define _ASSET_MANIFEST_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* The content hash of one input file, as of the last time it was processed */
+typedef struct
+{
+    char* path;
+    uint64_t hash;
+    uint64_t toolHash; /* The hash of the preprocessor which processed it */
+} manifestEntry_t;
+
+/* Every input file which was processed, so unchanged ones can be skipped next time */
+typedef struct
+{
+    manifestEntry_t* entries;
+    int count;
+    int cap;
+} manifest_t;
+
+bool hashFile(const char* fname, uint64_t* hash);
+void loadManifest(const char* fname, manifest_t* manifest);
+bool saveManifest(const char* fname, const manifest_t* manifest);
+const manifestEntry_t* findManifestEntry(const manifest_t* manifest, const char* path);
+void addManifestEntry(manifest_t* manifest, const char* path, uint64_t hash, uint64_t toolHash);
+void freeManifest(manifest_t* manifest);
+
+#endif /* _ASSET_MANIFEST_H_ */
@@ -31,21 +31,8 @@ long getFileSize(const char* fname)
  */
 bool doesFileExist(const char* fname)
 {
-    int fd = open(fname, O_CREAT | O_WRONLY | O_EXCL, S_IRUSR | S_IWUSR);
-    if (fd < 0)
-    {
-        /* failure */
-        if (errno == EEXIST)
-        {
-            /* the file already existed */
-            close(fd);
-            return true;
-        }
-    }
-
-    /* File does not exist */
-    close(fd);
-    return false;
+    struct stat st;
+    return 0 == stat(fname, &st);
 }
 
 /**
@@ -3,7 +3,6 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h>
 #include <unistd.h>
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -21,114 +20,118 @@
 
 #define CLAMP(x, l, u) ((x) < l ? l : ((x) > u ? u : (x)))
 
-typedef struct
-{
-    uint8_t r;
-    uint8_t g;
-    uint8_t b;
-    uint8_t a;
-    int eR;
-    int eG;
-    int eB;
-    bool isDrawn;
-} pixel_t;
+/* Input files ending in this are dithered. It is removed from the output file name */
+#define DITHER_SUFFIX ".dither"
+
+/* Error diffusion weights, in sixteenths. Error is pushed ahead on this row, and behind, below, and ahead on the next */
+#define ERR_AHEAD        7
+#define ERR_BELOW_BEHIND 3
+#define ERR_BELOW        5
+#define ERR_BELOW_AHEAD  1
 
-void shuffleArray(uint32_t* ar, uint32_t len);
-int isNeighborNotDrawn(pixel_t** img, int x, int y, int w, int h);
-void spreadError(pixel_t** img, int x, int y, int w, int h, int teR, int teG, int teB, float diagScalar);
+static uint32_t nameSeed(const char* name);
+static uint32_t xorshift32(uint32_t* state);
+static uint8_t quantizeChannel(int val, int* err);
+static void processImage(const char* infile, const char* outdir, bool dither);
 
 /**
- * @brief TODO
+ * @brief Make a random seed from an asset's file name, so each asset dithers the same way every time it is processed
  *
- * @param ar
- * @param len
+ * @param name The file name, without the directory
+ * @return The seed, which is never zero
  */
-void shuffleArray(uint32_t* ar, uint32_t len)
+static uint32_t nameSeed(const char* name)
 {
-    srand(time(NULL));
-    for (int i = len - 1; i > 0; i--)
+    /* FNV-1a */
+    uint32_t h = 0x811c9dc5;
+    while (*name)
     {
-        int index = rand() % (i + 1);
-        int a     = ar[index];
-        ar[index] = ar[i];
-        ar[i]     = a;
+        h = (h ^ (uint8_t)(*name++)) * 0x01000193;
     }
+    return h ? h : 1;
 }
 
 /**
- * @brief TODO
+ * @brief A small, thread safe random number generator
  *
- * @param img
- * @param x
- * @param y
- * @param w
- * @param h
- * @return int
+ * @param state The generator state, which must not be zero
+ * @return The next random number
  */
-int isNeighborNotDrawn(pixel_t** img, int x, int y, int w, int h)
+static uint32_t xorshift32(uint32_t* state)
 {
-    if (0 <= x && x < w)
-    {
-        if (0 <= y && y < h)
-        {
-            return !(img[y][x].isDrawn) ? 1 : 0;
-        }
-    }
-    return 0;
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
 }
 
 /**
- * @brief TODO
+ * @brief Reduce an 8 bit channel to six levels, using rounding
  *
- * @param image8b
- * @param x
- * @param y
- * @param w
- * @param h
- * @param teR
- * @param teG
- * @param teB
- * @param diagScalar
+ * @param val The channel value, plus any error diffused into it
+ * @param[out] err Written with the difference between val and the level's value
+ * @return The level, 0-5
  */
-void spreadError(pixel_t** img, int x, int y, int w, int h, int teR, int teG, int teB, float diagScalar)
+static uint8_t quantizeChannel(int val, int* err)
 {
-    if (0 <= x && x < w)
-    {
-        if (0 <= y && y < h)
-        {
-            if (!img[y][x].isDrawn)
-            {
-                img[y][x].eR = (int)(teR * diagScalar + 0.5);
-                img[y][x].eG = (int)(teG * diagScalar + 0.5);
-                img[y][x].eB = (int)(teB * diagScalar + 0.5);
-            }
-        }
-    }
+    uint8_t level = CLAMP((127 + (val * 5)) / 255, 0, 5);
+    *err          = val - ((level * 255) / 5);
+    return level;
 }
 
 /**
- * @brief TODO
+ * @brief Process a .png into a .wsg without dithering. Don't dither small sprites, it just doesn't look good
  *
- * @param infile
- * @param outdir
+ * @param infile The .png to process
+ * @param outdir The directory to write the .wsg to
  */
 void process_image(const char* infile, const char* outdir)
 {
-    /* Determine if the output file already exists */
+    processImage(infile, outdir, false);
+}
+
+/**
+ * @brief Process a .dither.png into a dithered .wsg. The ".dither" is removed from the output file name
+ *
+ * @param infile The .dither.png to process
+ * @param outdir The directory to write the .wsg to
+ */
+void process_dithered_image(const char* infile, const char* outdir)
+{
+    processImage(infile, outdir, true);
+}
+
+/**
+ * @brief Reduce a .png to the web-safe palette and write it as a compressed .wsg
+ *
+ * Pixels are quantized in a single linear scan. When dithering, each pixel's error is diffused to the unquantized
+ * pixels after it with Floyd-Steinberg weights. Only the current and next rows of error are kept. Each row is scanned
+ * in a random direction to break up the patterns a fixed scan direction leaves, and the random generator is seeded
+ * from the file name, so the output is the same every time.
+ *
+ * @param infile The .png to process
+ * @param outdir The directory to write the .wsg to
+ * @param dither true to dither the image, false to round each pixel to the nearest color
+ */
+static void processImage(const char* infile, const char* outdir, bool dither)
+{
+    /* Determine the output file path */
     char outFilePath[128] = {0};
     strcat(outFilePath, outdir);
     strcat(outFilePath, "/");
     strcat(outFilePath, get_filename(infile));
 
-    /* Change the file extension */
-    char* dotptr = strrchr(outFilePath, '.');
-    snprintf(&dotptr[1], strlen(dotptr), "wsg");
-
-    if (doesFileExist(outFilePath))
+    /* Change the file extension, removing the dither suffix if there is one */
+    char* dotptr   = strrchr(outFilePath, '.');
+    *dotptr        = 0;
+    size_t nameLen = strlen(outFilePath);
+    size_t sufLen  = strlen(DITHER_SUFFIX);
+    if (dither && nameLen >= sufLen && 0 == strcmp(&outFilePath[nameLen - sufLen], DITHER_SUFFIX))
     {
-        // printf("Output for %s already exists\n", infile);
-        return;
+        dotptr = &outFilePath[nameLen - sufLen];
     }
+    snprintf(dotptr, sizeof(outFilePath) - (dotptr - outFilePath), ".wsg");
 
     /* Load the source PNG */
     int w, h, n;
@@ -136,82 +139,74 @@ void process_image(const char* infile, const char* outdir)
 
     if (NULL != data)
     {
-        /* Create an array for output */
-        pixel_t** image8b;
-        image8b = (pixel_t**)calloc(h, sizeof(pixel_t*));
-        for (int y = 0; y < h; y++)
-        {
-            image8b[y] = (pixel_t*)calloc(w, sizeof(pixel_t));
-        }
+        /* Create an array for output, one palette index per pixel */
+        uint32_t paletteBufSize   = sizeof(unsigned char) * w * h;
+        unsigned char* paletteBuf = calloc(1, paletteBufSize);
 
-        /* Create an array of pixel indicies, then shuffle it */
-        uint32_t* indices = (uint32_t*)calloc(w * h, sizeof(uint32_t)); //[w * h];
-        for (int i = 0; i < w * h; i++)
-        {
-            indices[i] = i;
-        }
-        shuffleArray(indices, w * h);
+        /* Error diffused into the current and next rows, in sixteenths, three channels per pixel. There is an extra
+         * pixel on each side so error can be pushed past the edges without checking
+         */
+        int* errCur       = calloc((w + 2) * 3, sizeof(int));
+        int* errNext      = calloc((w + 2) * 3, sizeof(int));
+        uint32_t rngState = nameSeed(get_filename(infile));
 
-        /* For all pixels */
-        for (int i = 0; i < w * h; i++)
+        for (int y = 0; y < h; y++)
         {
-            /* Get the x, y coordinates for the random pixel */
-            int x = indices[i] % w;
-            int y = indices[i] / w;
-
-            /* Get the source pixel, 8 bits per channel */
-            unsigned char sourceR = data[(y * (w * 4)) + (x * 4) + 0];
-            unsigned char sourceG = data[(y * (w * 4)) + (x * 4) + 1];
-            unsigned char sourceB = data[(y * (w * 4)) + (x * 4) + 2];
-            unsigned char sourceA = data[(y * (w * 4)) + (x * 4) + 3];
-
-            /* Find the bit-reduced value, use rounding, 5551 for RGBA */
-            image8b[y][x].r = CLAMP((127 + ((sourceR + image8b[y][x].eR) * 5)) / 255, 0, 5);
-            image8b[y][x].g = CLAMP((127 + ((sourceG + image8b[y][x].eG) * 5)) / 255, 0, 5);
-            image8b[y][x].b = CLAMP((127 + ((sourceB + image8b[y][x].eB) * 5)) / 255, 0, 5);
-            image8b[y][x].a = (sourceA >= 128) ? 0xFF : 0x00;
-
-// Don't dither small sprites, it just doesn't look good
-#if defined(DITHER)
-            /* Find the total error, 8 bits per channel */
-            int teR = sourceR - ((image8b[y][x].r * 255) / 5);
-            int teG = sourceG - ((image8b[y][x].g * 255) / 5);
-            int teB = sourceB - ((image8b[y][x].b * 255) / 5);
+            /* Pick this row's scan direction */
+            int dir    = (dither && (xorshift32(&rngState) & 1)) ? -1 : 1;
+            int x      = (dir > 0) ? 0 : w - 1;
+            int xEnd   = (dir > 0) ? w : -1;
+            int dirErr = dir * 3;
 
-            /* Count all the neighbors that haven't been drawn yet */
-            int adjNeighbors = 0;
-            adjNeighbors += isNeighborNotDrawn(image8b, x + 0, y + 1, w, h);
-            adjNeighbors += isNeighborNotDrawn(image8b, x + 0, y - 1, w, h);
-            adjNeighbors += isNeighborNotDrawn(image8b, x + 1, y + 0, w, h);
-            adjNeighbors += isNeighborNotDrawn(image8b, x - 1, y + 0, w, h);
-            int diagNeighbors = 0;
-            diagNeighbors += isNeighborNotDrawn(image8b, x - 1, y - 1, w, h);
-            diagNeighbors += isNeighborNotDrawn(image8b, x + 1, y - 1, w, h);
-            diagNeighbors += isNeighborNotDrawn(image8b, x - 1, y + 1, w, h);
-            diagNeighbors += isNeighborNotDrawn(image8b, x + 1, y + 1, w, h);
-
-            /* Spread the error to all neighboring unquantized pixels, with
-             * twice as much error to the adjacent pixels as the diagonal ones
-             */
-            float diagScalar = 1 / (float)((2 * adjNeighbors) + diagNeighbors);
-            float adjScalar  = 2 * diagScalar;
-
-            /* Write the error */
-            spreadError(image8b, x - 1, y - 1, w, h, teR, teG, teB, diagScalar);
-            spreadError(image8b, x - 1, y + 1, w, h, teR, teG, teB, diagScalar);
-            spreadError(image8b, x + 1, y - 1, w, h, teR, teG, teB, diagScalar);
-            spreadError(image8b, x + 1, y + 1, w, h, teR, teG, teB, diagScalar);
-            spreadError(image8b, x - 1, y + 0, w, h, teR, teG, teB, adjScalar);
-            spreadError(image8b, x + 1, y + 0, w, h, teR, teG, teB, adjScalar);
-            spreadError(image8b, x + 0, y - 1, w, h, teR, teG, teB, adjScalar);
-            spreadError(image8b, x + 0, y + 1, w, h, teR, teG, teB, adjScalar);
-#endif
+            for (; x != xEnd; x += dir)
+            {
+                /* Get the source pixel, 8 bits per channel */
+                const unsigned char* src = &data[(y * w + x) * 4];
+                /* Get this pixel's error, offset by the padding pixel */
+                int* e  = &errCur[(x + 1) * 3];
+                int* en = &errNext[(x + 1) * 3];
+
+                /* Find the bit-reduced value, 5551 for RGBA */
+                int teR, teG, teB;
+                uint8_t r = quantizeChannel(src[0] + e[0] / 16, &teR);
+                uint8_t g = quantizeChannel(src[1] + e[1] / 16, &teG);
+                uint8_t b = quantizeChannel(src[2] + e[2] / 16, &teB);
+
+                if (src[3] >= 128)
+                {
+                    /* Index math! The palette indices increase blue, then green, then red.
+                     * Each has a value 0-5 (six levels)
+                     */
+                    paletteBuf[y * w + x] = b + (6 * g) + (36 * r);
+
+                    if (dither)
+                    {
+                        const int te[3] = {teR, teG, teB};
+                        for (int c = 0; c < 3; c++)
+                        {
+                            e[dirErr + c] += te[c] * ERR_AHEAD;
+                            en[-dirErr + c] += te[c] * ERR_BELOW_BEHIND;
+                            en[c] += te[c] * ERR_BELOW;
+                            en[dirErr + c] += te[c] * ERR_BELOW_AHEAD;
+                        }
+                    }
+                }
+                else
+                {
+                    /* This invalid value means 'transparent' */
+                    paletteBuf[y * w + x] = 6 * 6 * 6;
+                }
+            }
 
-            /* Mark the random pixel as drawn */
-            image8b[y][x].isDrawn = true;
+            /* The next row becomes the current one, and the new next row starts without error */
+            int* tmp = errCur;
+            errCur   = errNext;
+            errNext  = tmp;
+            memset(errNext, 0, (w + 2) * 3 * sizeof(int));
         }
 
-        free(indices);
+        free(errCur);
+        free(errNext);
 
         /* Free stbi memory */
         stbi_image_free(data);
@@ -221,55 +216,23 @@ void process_image(const char* infile, const char* outdir)
         /* Convert to a pixel buffer */
         unsigned char* pixBuf = (unsigned char*)calloc(w * h * 4, sizeof(unsigned char)); //[w*h*4];
         int pixBufIdx         = 0;
-        for (int y = 0; y < h; y++)
+        for (int i = 0; i < w * h; i++)
         {
-            for (int x = 0; x < w; x++)
-            {
-                pixBuf[pixBufIdx++] = (image8b[y][x].r * 255) / 5;
-                pixBuf[pixBufIdx++] = (image8b[y][x].g * 255) / 5;
-                pixBuf[pixBufIdx++] = (image8b[y][x].b * 255) / 5;
-                pixBuf[pixBufIdx++] = image8b[y][x].a;
-            }
+            uint8_t idx         = paletteBuf[i];
+            bool opaque         = idx < 6 * 6 * 6;
+            pixBuf[pixBufIdx++] = opaque ? ((idx / 36) * 255) / 5 : 0;
+            pixBuf[pixBufIdx++] = opaque ? (((idx / 6) % 6) * 255) / 5 : 0;
+            pixBuf[pixBufIdx++] = opaque ? ((idx % 6) * 255) / 5 : 0;
+            pixBuf[pixBufIdx++] = opaque ? 0xFF : 0x00;
         }
         /* Write a PNG */
-        char pngOutFilePath[strlen(outFilePath) + 4];
+        char pngOutFilePath[strlen(outFilePath) + 5];
         strcpy(pngOutFilePath, outFilePath);
         strcat(pngOutFilePath, ".png");
         stbi_write_png(pngOutFilePath, w, h, 4, pixBuf, 4 * w);
         free(pixBuf);
 #endif
 
-        /* Convert to a palette buffer */
-        uint32_t paletteBufSize   = sizeof(unsigned char) * w * h;
-        unsigned char* paletteBuf = calloc(1, paletteBufSize);
-        int paletteBufIdx         = 0;
-        for (int y = 0; y < h; y++)
-        {
-            for (int x = 0; x < w; x++)
-            {
-                if (image8b[y][x].a)
-                {
-                    /* Index math! The palette indices increase blue, then green, then red.
-                     * Each has a value 0-5 (six levels)
-                     */
-                    paletteBuf[paletteBufIdx++]
-                        = (image8b[y][x].b) + (6 * (image8b[y][x].g)) + (36 * (image8b[y][x].r));
-                }
-                else
-                {
-                    /* This invalid value means 'transparent' */
-                    paletteBuf[paletteBufIdx++] = 6 * 6 * 6;
-                }
-            }
-        }
-
-        /* Free dithering memory */
-        for (int y = 0; y < h; y++)
-        {
-            free(image8b[y]);
-        }
-        free(image8b);
-
         /* Combine the header and image*/
         uint32_t hdrAndImgSz = sizeof(uint8_t) * (4 + paletteBufSize);
         uint8_t* hdrAndImg   = calloc(1, hdrAndImgSz);
@@ -2,5 +2,6 @@
 #define _IMAGE_PROCESSOR_H_
 
 void process_image(const char* infile, const char* outdir);
+void process_dithered_image(const char* infile, const char* outdir);
 
 #endif /* _IMAGE_PROCESSOR_H_ */
\ No newline at end of file
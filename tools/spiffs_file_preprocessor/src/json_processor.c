@@ -13,7 +13,7 @@
 
 void process_json(const char* infile, const char* outdir)
 {
-    /* Determine if the output file already exists */
+    /* Determine the output file path */
     char outFilePath[128] = {0};
     strcat(outFilePath, outdir);
     strcat(outFilePath, "/");
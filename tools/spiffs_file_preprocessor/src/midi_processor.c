@@ -210,7 +210,7 @@ static void checkMidiEvents(MidiParser* midiParser, unsigned long int lastNoteSt
  */
 void process_midi(const char* inFile, const char* outDir)
 {
-    /* Determine if the output file already exists */
+    /* Determine the output file path */
     char outFilePath[128] = {0};
     strcat(outFilePath, outDir);
     strcat(outFilePath, "/");
@@ -220,12 +220,6 @@ void process_midi(const char* inFile, const char* outDir)
     char* dotPtr = strrchr(outFilePath, '.');
     snprintf(&dotPtr[1], strlen(dotPtr), "sng");
 
-    if (doesFileExist(outFilePath))
-    {
-        /* printf("Output for %s already exists\n", inFile); */
-        return;
-    }
-
     /* Parse the MIDI file */
     MidiParser* midiParser = parseMidi(inFile, false, true);
 
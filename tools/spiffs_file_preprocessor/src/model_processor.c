@@ -0,0 +1,489 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "model3d_format.h"
+#include "model_processor.h"
+#include "fileUtils.h"
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/* OBJ coordinates are multiplied by this to make the integer vertices */
+#define FIXED_SCALE 64
+
+/* A growable array */
+typedef struct
+{
+    void* data;
+    size_t len;
+    size_t cap;
+    size_t elemSize;
+} growArray_t;
+
+/* A triangle or a line, and the `o` group it is in */
+typedef struct
+{
+    int idx[3];
+    int group;
+} objFace_t;
+
+/* Everything read from an OBJ file */
+typedef struct
+{
+    growArray_t verts; /* int16_t[3] */
+    growArray_t tris;  /* objFace_t */
+    growArray_t lines; /* objFace_t */
+    growArray_t tags;  /* int, the label of each group. Group 0 is anything before the first `o` */
+} objFile_t;
+
+static void* growArrayPush(growArray_t* arr);
+static void growArrayAppend(growArray_t* arr, const void* src, size_t len);
+static void growArrayAlign(growArray_t* arr);
+static bool parseObj(const char* infile, objFile_t* obj);
+static int parseIndex(const char* str, int nrVerts);
+static void writePart(growArray_t* out, model3dPartDesc_t* desc, const objFile_t* obj, int group, int* vertMap);
+static int compareEdges(const void* a, const void* b);
+
+/**
+ * @brief Make room for one more element at the end of an array
+ *
+ * @param arr The array
+ * @return The new element, zeroed
+ */
+static void* growArrayPush(growArray_t* arr)
+{
+    if (arr->len == arr->cap)
+    {
+        arr->cap  = arr->cap ? arr->cap * 2 : 256;
+        arr->data = realloc(arr->data, arr->cap * arr->elemSize);
+    }
+    void* elem = (uint8_t*)arr->data + (arr->len++ * arr->elemSize);
+    memset(elem, 0, arr->elemSize);
+    return elem;
+}
+
+/**
+ * @brief Append bytes to a byte array
+ *
+ * @param arr The byte array
+ * @param src The bytes to append
+ * @param len The number of bytes to append
+ */
+static void growArrayAppend(growArray_t* arr, const void* src, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        *(uint8_t*)growArrayPush(arr) = ((const uint8_t*)src)[i];
+    }
+}
+
+/**
+ * @brief Pad a byte array with zeros until its length is a multiple of four
+ *
+ * @param arr The byte array
+ */
+static void growArrayAlign(growArray_t* arr)
+{
+    while (arr->len % 4)
+    {
+        growArrayPush(arr);
+    }
+}
+
+/**
+ * @brief Read an OBJ index, which may be negative to count back from the last vertex
+ *
+ * @param str The index, which may be followed by /texture/normal indices
+ * @param nrVerts The number of vertices read so far
+ * @return The zero based vertex index
+ */
+static int parseIndex(const char* str, int nrVerts)
+{
+    int idx = atoi(str);
+    return (idx < 0) ? (nrVerts + idx) : (idx - 1);
+}
+
+/**
+ * @brief Read the vertices, triangles, lines and groups from an OBJ file. Polygons are split into triangle fans
+ *
+ * @param infile The OBJ file to read
+ * @param obj Where to put what was read
+ * @return true if the file was read, false if it couldn't be opened or has an invalid vertex
+ */
+static bool parseObj(const char* infile, objFile_t* obj)
+{
+    FILE* fp = fopen(infile, "rb");
+    if (NULL == fp)
+    {
+        fprintf(stderr, "ERROR: could not open %s\n", infile);
+        return false;
+    }
+
+    *(int*)growArrayPush(&obj->tags) = 0;
+    int group                        = 0;
+
+    char line[1024];
+    int lineNo = 0;
+    while (fgets(line, sizeof(line), fp))
+    {
+        lineNo++;
+        int nrVerts = obj->verts.len;
+        if ('o' == line[0])
+        {
+            group++;
+            char* label                      = strstr(&line[1], "LABEL");
+            *(int*)growArrayPush(&obj->tags) = label ? atoi(label + 5) : 0;
+        }
+        else if ('v' == line[0] && ' ' == line[1])
+        {
+            float vp[3];
+            if (3 != sscanf(&line[2], "%f %f %f", &vp[0], &vp[1], &vp[2]))
+            {
+                /* Dropping the vertex would renumber every vertex after it, so the whole file is rejected */
+                fprintf(stderr, "ERROR: %s:%d has an invalid vertex\n", infile, lineNo);
+                fclose(fp);
+                return false;
+            }
+            int16_t* v = growArrayPush(&obj->verts);
+            for (int k = 0; k < 3; k++)
+            {
+                v[k] = vp[k] * FIXED_SCALE;
+            }
+        }
+        else if ('l' == line[0] || 'f' == line[0])
+        {
+            /* strtok() isn't thread safe, and files are processed in parallel */
+            int idx[64];
+            int ct    = 0;
+            char* tok = &line[1] + strspn(&line[1], " \t\r\n");
+            while (*tok && ct < 64)
+            {
+                idx[ct++] = parseIndex(tok, nrVerts);
+                tok += strcspn(tok, " \t\r\n");
+                tok += strspn(tok, " \t\r\n");
+            }
+
+            for (int i = 0; i < ct; i++)
+            {
+                if (idx[i] < 0 || idx[i] >= nrVerts)
+                {
+                    fprintf(stderr, "ERROR: %s:%d refers to a missing vertex\n", infile, lineNo);
+                    ct = 0;
+                }
+            }
+
+            if ('l' == line[0])
+            {
+                for (int i = 0; i + 1 < ct; i++)
+                {
+                    objFace_t* l = growArrayPush(&obj->lines);
+                    l->idx[0]    = idx[i];
+                    l->idx[1]    = idx[i + 1];
+                    l->group     = group;
+                }
+            }
+            else
+            {
+                for (int i = 0; i + 2 < ct; i++)
+                {
+                    objFace_t* t = growArrayPush(&obj->tris);
+                    t->idx[0]    = idx[0];
+                    t->idx[1]    = idx[i + 1];
+                    t->idx[2]    = idx[i + 2];
+                    t->group     = group;
+                }
+            }
+        }
+    }
+
+    fclose(fp);
+    return true;
+}
+
+/**
+ * @brief Sort edges by their first index, then their second
+ *
+ * @param a An edge, two uint16_t
+ * @param b Another edge, two uint16_t
+ * @return <0 if a sorts first, >0 if b sorts first, 0 if they're the same edge
+ */
+static int compareEdges(const void* a, const void* b)
+{
+    const uint16_t* ea = a;
+    const uint16_t* eb = b;
+    if (ea[0] != eb[0])
+    {
+        return ea[0] - eb[0];
+    }
+    return ea[1] - eb[1];
+}
+
+/**
+ * @brief Write one group of an OBJ file as a model part. The group is drawn with triangles if it has more triangles
+ * than lines, otherwise with lines
+ *
+ * @param out The file being built
+ * @param desc The part's descriptor, to fill in with offsets
+ * @param obj The OBJ file
+ * @param group The group to write
+ * @param vertMap Scratch space, one int per vertex
+ */
+static void writePart(growArray_t* out, model3dPartDesc_t* desc, const objFile_t* obj, int group, int* vertMap)
+{
+    const int16_t* verts    = obj->verts.data;
+    const objFace_t* tris   = obj->tris.data;
+    const objFace_t* lines  = obj->lines.data;
+    int nrVerts             = obj->verts.len;
+    const objFace_t* faces  = tris;
+    int nrAllFaces          = obj->tris.len;
+    int indicesPerFace      = 3;
+    uint16_t nrFaces        = 0;
+    uint16_t nrLines        = 0;
+    uint16_t nrUsed         = 0;
+    int16_t center[3]       = {0};
+    int16_t radius          = 0;
+    int mins[3]             = {32767, 32767, 32767};
+    int maxs[3]             = {-32768, -32768, -32768};
+    growArray_t partVerts   = {.elemSize = sizeof(int16_t)};
+    growArray_t partIndices = {.elemSize = sizeof(uint16_t)};
+    growArray_t edges       = {.elemSize = sizeof(uint16_t) * 2};
+
+    /* Number the vertices used by triangles first, then the ones only used by lines */
+    memset(vertMap, 0, sizeof(int) * nrVerts);
+    for (size_t i = 0; i < obj->tris.len; i++)
+    {
+        if (tris[i].group == group)
+        {
+            nrFaces++;
+            for (int k = 0; k < 3; k++)
+            {
+                vertMap[tris[i].idx[k]] = 1;
+            }
+        }
+    }
+    for (size_t i = 0; i < obj->lines.len; i++)
+    {
+        if (lines[i].group == group)
+        {
+            nrLines++;
+            for (int k = 0; k < 2; k++)
+            {
+                vertMap[lines[i].idx[k]] = 2;
+            }
+        }
+    }
+    for (int pass = 1; pass <= 2; pass++)
+    {
+        for (int j = 0; j < nrVerts; j++)
+        {
+            if (vertMap[j] == pass)
+            {
+                for (int k = 0; k < 3; k++)
+                {
+                    mins[k]                              = MIN(mins[k], verts[j * 3 + k]);
+                    maxs[k]                              = MAX(maxs[k], verts[j * 3 + k]);
+                    *(int16_t*)growArrayPush(&partVerts) = verts[j * 3 + k];
+                }
+                /* Negative so the second pass skips it. This is the index, which is the vertex number times 3 */
+                vertMap[j] = -(nrUsed++ * 3) - 1;
+            }
+        }
+    }
+
+    /* Center the bounding sphere on the bounding box, then find the farthest vertex */
+    for (int k = 0; k < 3; k++)
+    {
+        center[k] = (mins[k] + maxs[k]) / 2;
+    }
+    for (int j = 0; j < nrUsed; j++)
+    {
+        const int16_t* v = &((const int16_t*)partVerts.data)[j * 3];
+        int dx           = v[0] - center[0];
+        int dy           = v[1] - center[1];
+        int dz           = v[2] - center[2];
+        int r            = sqrt(dx * dx + dy * dy + dz * dz);
+        radius           = MAX(radius, r);
+    }
+
+    if (nrFaces <= nrLines)
+    {
+        faces          = lines;
+        nrAllFaces     = obj->lines.len;
+        indicesPerFace = 2;
+        nrFaces        = nrLines;
+    }
+
+    /* Indices are vertex numbers times three, so they point straight at the vertex's coordinates */
+    for (int i = 0; i < nrAllFaces; i++)
+    {
+        if (faces[i].group == group)
+        {
+            uint16_t idx[3];
+            for (int k = 0; k < indicesPerFace; k++)
+            {
+                idx[k]                                  = -(vertMap[faces[i].idx[k]] + 1);
+                *(uint16_t*)growArrayPush(&partIndices) = idx[k];
+            }
+            for (int k = 0; k < indicesPerFace; k++)
+            {
+                uint16_t* e = growArrayPush(&edges);
+                uint16_t a  = idx[k];
+                uint16_t b  = idx[(k + 1) % indicesPerFace];
+                e[0]        = MIN(a, b);
+                e[1]        = MAX(a, b);
+                if (2 == indicesPerFace)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    /* Keep each edge once */
+    uint16_t* edgeData = edges.data;
+    size_t nrEdges     = 0;
+    if (edges.len)
+    {
+        qsort(edgeData, edges.len, edges.elemSize, compareEdges);
+        nrEdges = 1;
+        for (size_t i = 1; i < edges.len; i++)
+        {
+            if (compareEdges(&edgeData[(nrEdges - 1) * 2], &edgeData[i * 2]))
+            {
+                memcpy(&edgeData[nrEdges * 2], &edgeData[i * 2], edges.elemSize);
+                nrEdges++;
+            }
+        }
+    }
+    if (nrEdges > UINT16_MAX)
+    {
+        fprintf(stderr, "ERROR: group %d has too many edges (%zu), only the first %d are kept\n", group, nrEdges,
+                UINT16_MAX);
+        nrEdges = UINT16_MAX;
+    }
+
+    /* The part itself, which is drawn straight from RAM */
+    tdModel header = {
+        .nrvertnums       = partVerts.len,
+        .nrfaces          = nrFaces,
+        .indices_per_face = indicesPerFace,
+        .center           = {center[0], center[1], center[2]},
+        .radius           = radius,
+        .label            = ((const int*)obj->tags.data)[group],
+    };
+    desc->model = out->len;
+    growArrayAppend(out, &header, sizeof(header));
+    growArrayAppend(out, partIndices.data, partIndices.len * partIndices.elemSize);
+    growArrayAppend(out, partVerts.data, partVerts.len * partVerts.elemSize);
+    growArrayAlign(out);
+
+    /* Unit face normals, for triangles only */
+    if (3 == indicesPerFace)
+    {
+        desc->normals = out->len;
+        for (int i = 0; i < nrFaces; i++)
+        {
+            const uint16_t* idx = &((const uint16_t*)partIndices.data)[i * 3];
+            const int16_t* v    = partVerts.data;
+            double u[3], w[3];
+            for (int k = 0; k < 3; k++)
+            {
+                u[k] = v[idx[1] + k] - v[idx[0] + k];
+                w[k] = v[idx[2] + k] - v[idx[0] + k];
+            }
+            double n[3] = {u[1] * w[2] - u[2] * w[1], u[2] * w[0] - u[0] * w[2], u[0] * w[1] - u[1] * w[0]};
+            double len  = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+            for (int k = 0; k < 3; k++)
+            {
+                int16_t nk = (len > 0) ? lround(n[k] * MODEL3D_NORMAL_ONE / len) : 0;
+                growArrayAppend(out, &nk, sizeof(nk));
+            }
+        }
+        growArrayAlign(out);
+    }
+
+    desc->edges   = out->len;
+    desc->nrEdges = nrEdges;
+    growArrayAppend(out, edgeData, nrEdges * edges.elemSize);
+    growArrayAlign(out);
+
+    free(partVerts.data);
+    free(partIndices.data);
+    free(edges.data);
+}
+
+/**
+ * @brief Convert an OBJ file into a MDL file. Each `o` group becomes one part, and groups may be labelled by putting
+ * LABEL and a number in their name. See model3d_format.h for the output format
+ *
+ * @param infile The OBJ file to convert
+ * @param outdir The directory to write the MDL file to
+ */
+void process_model(const char* infile, const char* outdir)
+{
+    /* Determine the output file path */
+    char outFilePath[128] = {0};
+    strcat(outFilePath, outdir);
+    strcat(outFilePath, "/");
+    strcat(outFilePath, get_filename(infile));
+
+    /* Change the file extension */
+    char* dotptr = strrchr(outFilePath, '.');
+    snprintf(&dotptr[1], strlen(dotptr), "mdl");
+
+    objFile_t obj = {
+        .verts = {.elemSize = sizeof(int16_t) * 3},
+        .tris  = {.elemSize = sizeof(objFace_t)},
+        .lines = {.elemSize = sizeof(objFace_t)},
+        .tags  = {.elemSize = sizeof(int)},
+    };
+    if (!parseObj(infile, &obj))
+    {
+        free(obj.verts.data);
+        free(obj.tris.data);
+        free(obj.lines.data);
+        free(obj.tags.data);
+        return;
+    }
+
+    /* Anything before the first `o` isn't part of a group, and is dropped */
+    uint16_t nrParts         = obj.tags.len - 1;
+    model3dHeader_t header   = {.version = MODEL3D_VERSION, .nrParts = nrParts};
+    model3dPartDesc_t* descs = calloc(nrParts, sizeof(model3dPartDesc_t));
+    int* vertMap             = malloc(sizeof(int) * (obj.verts.len + 1));
+    growArray_t out          = {.elemSize = 1};
+    memcpy(header.magic, MODEL3D_MAGIC, sizeof(header.magic));
+
+    /* Leave room for the header and descriptors, then fill them in once the parts are written */
+    growArrayAppend(&out, &header, sizeof(header));
+    growArrayAppend(&out, descs, nrParts * sizeof(model3dPartDesc_t));
+    growArrayAlign(&out);
+    for (int g = 0; g < nrParts; g++)
+    {
+        writePart(&out, &descs[g], &obj, g + 1, vertMap);
+    }
+    memcpy((uint8_t*)out.data + sizeof(header), descs, nrParts * sizeof(model3dPartDesc_t));
+
+    FILE* outFile = fopen(outFilePath, "wb");
+    if (NULL == outFile)
+    {
+        fprintf(stderr, "ERROR: could not open %s\n", outFilePath);
+    }
+    else
+    {
+        fwrite(out.data, out.len, 1, outFile);
+        fclose(outFile);
+    }
+
+    free(out.data);
+    free(vertMap);
+    free(descs);
+    free(obj.verts.data);
+    free(obj.tris.data);
+    free(obj.lines.data);
+    free(obj.tags.data);
+}
@@ -0,0 +1,6 @@
+#ifndef _MODEL_PROCESSOR_H_
+#define _MODEL_PROCESSOR_H_
+
+void process_model(const char* infile, const char* outdir);
+
+#endif /* _MODEL_PROCESSOR_H_ */
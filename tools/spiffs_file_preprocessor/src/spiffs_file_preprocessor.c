@@ -1,11 +1,15 @@
+#define _XOPEN_SOURCE 700
+
 #include <ctype.h>
 #include <fcntl.h>
 #include <ftw.h>
 #include <getopt.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -17,11 +21,67 @@
 #include "txt_processor.h"
 #include "midi_processor.h"
 #include "rmd_processor.h"
+#include "model_processor.h"
+#include "asset_manifest.h"
+#include "fileUtils.h"
+
+/* How a type of asset is processed */
+typedef struct
+{
+    const char* suffix;    /* Input files ending in this are processed */
+    const char* outSuffix; /* The output file replaces suffix with this */
+    void (*process)(const char* infile, const char* outdir);
+    bool serial; /* true if this processor isn't thread safe, so only one may run at a time */
+} assetProcessor_t;
+
+/* One input file to process */
+typedef struct
+{
+    char* path;
+    const assetProcessor_t* proc;
+    uint64_t hash;
+    bool hashed;    /* true if hash is valid */
+    bool processed; /* true if the file was processed, false if it was unchanged */
+    bool duplicate; /* true if another job writes the same output from an identical file */
+    double ms;      /* How long processing took */
+} assetJob_t;
+
+/* Processors are checked in order, so longer suffixes must come before shorter ones which they end with */
+static const assetProcessor_t processors[] = {
+    {".font.png", ".font", process_font, false},
+    {".dither.png", ".wsg", process_dithered_image, false},
+    {".png", ".wsg", process_image, false},
+    {".json", ".hjs", process_json, false},
+    {".bin", ".bin", process_bin, false},
+    {".txt", ".txt", process_txt, false},
+    /* parseMidi() returns a static struct */
+    {".mid", ".sng", process_midi, true},
+    {".midi", ".sng", process_midi, true},
+    {".rmd", ".rmh", process_rmd, false},
+    {".obj", ".mdl", process_model, false},
+};
 
 const char* outDirName = NULL;
 
+static manifest_t oldManifest;
+/* A different build of this program may write different output, so assets it processed are processed again */
+static uint64_t toolHash;
+static bool toolHashed;
+static assetJob_t* jobs;
+static int numJobs;
+static int jobsCap;
+static int nextJob;
+static pthread_mutex_t jobLock    = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t serialLock = PTHREAD_MUTEX_INITIALIZER;
+
 void print_usage(void);
 bool endsWith(const char* filename, const char* suffix);
+static double nowMs(void);
+static void getOutputPath(const assetJob_t* job, char* outFilePath, size_t size);
+static bool outputExists(const assetJob_t* job);
+static bool checkOutputCollisions(void);
+static bool hashTool(const char* argv0, uint64_t* hash);
+static void* processJobs(void* arg);
 
 /**
  * @brief TODO
@@ -29,7 +89,8 @@ bool endsWith(const char* filename, const char* suffix);
  */
 void print_usage(void)
 {
-    printf("Usage:\n  spiffs_file_preprocessor\n    -i INPUT_DIRECTORY\n    -o OUTPUT_DIRECTORY\n");
+    printf("Usage:\n  spiffs_file_preprocessor\n    -i INPUT_DIRECTORY\n    -o OUTPUT_DIRECTORY\n"
+           "    [-m MANIFEST_FILE] (default OUTPUT_DIRECTORY.manifest)\n    [-j THREADS]\n");
 }
 
 /**
@@ -50,7 +111,111 @@ bool endsWith(const char* filename, const char* suffix)
 }
 
 /**
- * @brief TODO
+ * @brief Get a monotonic time, for timing jobs
+ *
+ * @return The time in milliseconds
+ */
+static double nowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+/**
+ * @brief Check if a job's output file exists
+ *
+ * @param job The job
+ * @return true if the output file exists
+ */
+static bool outputExists(const assetJob_t* job)
+{
+    char outFilePath[256];
+    getOutputPath(job, outFilePath, sizeof(outFilePath));
+    return doesFileExist(outFilePath);
+}
+
+/**
+ * @brief Get the path a job writes its output to. Every output goes straight in the output directory
+ *
+ * @param job The job
+ * @param[out] outFilePath Written with the output path
+ * @param size The size of outFilePath
+ */
+static void getOutputPath(const assetJob_t* job, char* outFilePath, size_t size)
+{
+    const char* name = get_filename(job->path);
+    snprintf(outFilePath, size, "%s/%.*s%s", outDirName, (int)(strlen(name) - strlen(job->proc->suffix)), name,
+             job->proc->outSuffix);
+}
+
+/**
+ * @brief Find jobs which would write the same output file, like `foo.png` and `foo.dither.png`, or files with the
+ * same name in different directories. Jobs run in parallel, so they would race, and only one output would survive.
+ *
+ * Identical files processed the same way are allowed, and only the first is processed. Anything else is an error
+ *
+ * @return true if the jobs can run, false if any would overwrite another's output
+ */
+static bool checkOutputCollisions(void)
+{
+    char(*outPaths)[256] = malloc(numJobs * sizeof(*outPaths));
+    for (int i = 0; i < numJobs; i++)
+    {
+        getOutputPath(&jobs[i], outPaths[i], sizeof(outPaths[i]));
+    }
+
+    bool ok = true;
+    for (int i = 0; i < numJobs; i++)
+    {
+        for (int j = i + 1; j < numJobs; j++)
+        {
+            if (jobs[j].duplicate || strcmp(outPaths[i], outPaths[j]))
+            {
+                continue;
+            }
+
+            uint64_t hashI, hashJ;
+            if (jobs[i].proc == jobs[j].proc && hashFile(jobs[i].path, &hashI) && hashFile(jobs[j].path, &hashJ)
+                && hashI == hashJ)
+            {
+                jobs[j].duplicate = true;
+            }
+            else
+            {
+                fprintf(stderr, "ERROR: %s and %s would both be written to %s\n", jobs[i].path, jobs[j].path,
+                        outPaths[i]);
+                ok = false;
+            }
+        }
+    }
+
+    free(outPaths);
+    return ok;
+}
+
+/**
+ * @brief Hash this program's binary
+ *
+ * @param argv0 The path this program was run with
+ * @param[out] hash Written with the hash
+ * @return true if the binary was hashed, false if it couldn't be found
+ */
+static bool hashTool(const char* argv0, uint64_t* hash)
+{
+    /* Linux can always find the running binary. Elsewhere it's wherever it was run from */
+    if (hashFile("/proc/self/exe", hash) || hashFile(argv0, hash))
+    {
+        return true;
+    }
+
+    char exePath[256];
+    snprintf(exePath, sizeof(exePath), "%s.exe", argv0);
+    return hashFile(exePath, hash);
+}
+
+/**
+ * @brief Add every file which can be processed to the list of jobs
  *
  * @param fpath
  * @param st
@@ -63,33 +228,22 @@ static int processFile(const char* fpath, const struct stat* st __attribute__((u
     {
         case FTW_F: // file
         {
-            if (endsWith(fpath, ".font.png"))
-            {
-                process_font(fpath, outDirName);
-            }
-            else if (endsWith(fpath, ".png"))
-            {
-                process_image(fpath, outDirName);
-            }
-            else if (endsWith(fpath, ".json"))
-            {
-                process_json(fpath, outDirName);
-            }
-            else if (endsWith(fpath, ".bin"))
-            {
-                process_bin(fpath, outDirName);
-            }
-            else if (endsWith(fpath, ".txt"))
+            for (int i = 0; i < sizeof(processors) / sizeof(processors[0]); i++)
             {
-                process_txt(fpath, outDirName);
-            }
-            else if (endsWith(fpath, ".mid") || endsWith(fpath, ".midi"))
-            {
-                process_midi(fpath, outDirName);
-            }
-            else if (endsWith(fpath, ".rmd"))
-            {
-                process_rmd(fpath, outDirName);
+                if (endsWith(fpath, processors[i].suffix))
+                {
+                    if (numJobs == jobsCap)
+                    {
+                        jobsCap = jobsCap ? jobsCap * 2 : 64;
+                        jobs    = realloc(jobs, jobsCap * sizeof(assetJob_t));
+                    }
+                    assetJob_t* job = &jobs[numJobs++];
+                    memset(job, 0, sizeof(assetJob_t));
+                    job->path = malloc(strlen(fpath) + 1);
+                    strcpy(job->path, fpath);
+                    job->proc = &processors[i];
+                    break;
+                }
             }
             break;
         }
@@ -108,6 +262,55 @@ static int processFile(const char* fpath, const struct stat* st __attribute__((u
     return 0;
 }
 
+/**
+ * @brief A worker thread. Takes jobs until there are none left, and processes the ones which changed since they were
+ * last processed
+ *
+ * @param arg unused
+ * @return NULL
+ */
+static void* processJobs(void* arg)
+{
+    while (true)
+    {
+        pthread_mutex_lock(&jobLock);
+        int idx = nextJob++;
+        pthread_mutex_unlock(&jobLock);
+        if (idx >= numJobs)
+        {
+            return NULL;
+        }
+
+        assetJob_t* job = &jobs[idx];
+        if (job->duplicate)
+        {
+            continue;
+        }
+        job->hashed = hashFile(job->path, &job->hash);
+
+        /* Skip files which haven't changed since this build processed them, as long as their output is still there */
+        const manifestEntry_t* entry = findManifestEntry(&oldManifest, job->path);
+        if (job->hashed && toolHashed && entry && entry->hash == job->hash && entry->toolHash == toolHash
+            && outputExists(job))
+        {
+            continue;
+        }
+
+        double start = nowMs();
+        if (job->proc->serial)
+        {
+            pthread_mutex_lock(&serialLock);
+        }
+        job->proc->process(job->path, outDirName);
+        if (job->proc->serial)
+        {
+            pthread_mutex_unlock(&serialLock);
+        }
+        job->ms        = nowMs() - start;
+        job->processed = true;
+    }
+}
+
 /**
  * @brief TODO
  *
@@ -118,10 +321,12 @@ static int processFile(const char* fpath, const struct stat* st __attribute__((u
 int main(int argc, char** argv)
 {
     int c;
-    const char* inDirName = NULL;
+    const char* inDirName    = NULL;
+    const char* manifestName = NULL;
+    int numThreads           = 0;
 
     opterr = 0;
-    while ((c = getopt(argc, argv, "i:o:")) != -1)
+    while ((c = getopt(argc, argv, "i:o:m:j:")) != -1)
     {
         switch (c)
         {
@@ -135,6 +340,16 @@ int main(int argc, char** argv)
                 outDirName = optarg;
                 break;
             }
+            case 'm':
+            {
+                manifestName = optarg;
+                break;
+            }
+            case 'j':
+            {
+                numThreads = atoi(optarg);
+                break;
+            }
             default:
             {
                 fprintf(stderr, "Invalid argument %c\n", c);
@@ -151,6 +366,30 @@ int main(int argc, char** argv)
         return -1;
     }
 
+    // The manifest goes next to the output directory, not in it, so it isn't flashed
+    char defaultManifestName[256];
+    if (NULL == manifestName)
+    {
+        int len = strlen(outDirName);
+        while (len > 1 && outDirName[len - 1] == '/')
+        {
+            len--;
+        }
+        snprintf(defaultManifestName, sizeof(defaultManifestName), "%.*s.manifest", len, outDirName);
+        manifestName = defaultManifestName;
+    }
+
+    if (numThreads <= 0)
+    {
+#if defined(_SC_NPROCESSORS_ONLN)
+        numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+        if (numThreads <= 0)
+        {
+            numThreads = 4;
+        }
+    }
+
     // Create output directory if it doesn't exist
     struct stat st = {0};
     if (stat(outDirName, &st) == -1)
@@ -168,5 +407,62 @@ int main(int argc, char** argv)
         return -1;
     }
 
+    if (!checkOutputCollisions())
+    {
+        return -1;
+    }
+
+    loadManifest(manifestName, &oldManifest);
+    toolHashed = hashTool(argv[0], &toolHash);
+    if (!toolHashed)
+    {
+        fprintf(stderr, "WARNING: Couldn't find %s to hash it, so every asset will be processed\n", argv[0]);
+    }
+
+    double start = nowMs();
+    if (numThreads > numJobs)
+    {
+        numThreads = numJobs;
+    }
+    pthread_t threads[numThreads > 0 ? numThreads : 1];
+    for (int i = 0; i < numThreads; i++)
+    {
+        pthread_create(&threads[i], NULL, processJobs, NULL);
+    }
+    for (int i = 0; i < numThreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    double elapsed = nowMs() - start;
+
+    // Report what was done, and remember every input for next time
+    manifest_t newManifest = {0};
+    int numProcessed       = 0;
+    double workMs          = 0;
+    for (int i = 0; i < numJobs; i++)
+    {
+        if (jobs[i].processed)
+        {
+            printf("%9.1f ms  %s\n", jobs[i].ms, jobs[i].path);
+            numProcessed++;
+            workMs += jobs[i].ms;
+        }
+        if (jobs[i].hashed)
+        {
+            addManifestEntry(&newManifest, jobs[i].path, jobs[i].hash, toolHash);
+        }
+        free(jobs[i].path);
+    }
+    printf("Processed %d of %d assets in %.1f ms (%.1f ms of work on %d threads)\n", numProcessed, numJobs, elapsed,
+           workMs, numThreads);
+
+    if (!saveManifest(manifestName, &newManifest))
+    {
+        fprintf(stderr, "Failed to write %s\n", manifestName);
+    }
+
+    freeManifest(&newManifest);
+    freeManifest(&oldManifest);
+    free(jobs);
     return 0;
 }
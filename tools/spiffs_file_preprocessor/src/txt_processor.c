@@ -35,18 +35,12 @@ long remove_chars(char* str, long len, char c)
 
 void process_txt(const char* infile, const char* outdir)
 {
-    /* Determine if the output file already exists */
+    /* Determine the output file path */
     char outFilePath[128] = {0};
     strcat(outFilePath, outdir);
     strcat(outFilePath, "/");
     strcat(outFilePath, get_filename(infile));
 
-    if (doesFileExist(outFilePath))
-    {
-        // printf("Output for %s already exists\n", infile);
-        return;
-    }
-
     /* Read input file */
     FILE* fp = fopen(infile, "rb");
     fseek(fp, 0L, SEEK_END);